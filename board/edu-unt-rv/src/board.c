@@ -33,6 +33,7 @@ SPDX-License-Identifier: MIT
 
 #include "board.h"
 #include "gd32vf103.h"
+#include "riscv_encoding.h"
 
 /* === Macros definitions ====================================================================== */
 
@@ -55,6 +56,11 @@ void BoardSetup(void) {
     SystemInit();
     SystemCoreClockUpdate();
 #endif
+#ifdef BAREMETAL
+    /* The interrupts are enabled as after the reset on cortex cores, with an rtos the scheduler
+       enables them when the first task starts */
+    set_csr(mstatus, MSTATUS_MIE);
+#endif
 }
 
 /* === End of documentation ====================================================================
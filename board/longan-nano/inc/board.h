@@ -50,7 +50,9 @@ extern "C" {
 /* === Public macros definitions =============================================================== */
 
 #if defined(USE_HAL)
-
+#define LED_R HAL_GPIO_PC13
+#define LED_G HAL_GPIO_PA1
+#define LED_B HAL_GPIO_PA2
 #elif defined(USE_DRIVERS)
 
 #endif
@@ -0,0 +1,8314 @@
+
+build/bench/bin/bench.out:     file format elf64-x86-64
+build/bench/bin/bench.out
+architecture: i386:x86-64, flags 0x00000150:
+HAS_SYMS, DYNAMIC, D_PAGED
+start address 0x00000000000026b0
+
+Program Header:
+    PHDR off    0x0000000000000040 vaddr 0x0000000000000040 paddr 0x0000000000000040 align 2**3
+         filesz 0x00000000000002d8 memsz 0x00000000000002d8 flags r--
+  INTERP off    0x0000000000000318 vaddr 0x0000000000000318 paddr 0x0000000000000318 align 2**0
+         filesz 0x000000000000001c memsz 0x000000000000001c flags r--
+    LOAD off    0x0000000000000000 vaddr 0x0000000000000000 paddr 0x0000000000000000 align 2**12
+         filesz 0x0000000000001870 memsz 0x0000000000001870 flags r--
+    LOAD off    0x0000000000002000 vaddr 0x0000000000002000 paddr 0x0000000000002000 align 2**12
+         filesz 0x00000000000055d9 memsz 0x00000000000055d9 flags r-x
+    LOAD off    0x0000000000008000 vaddr 0x0000000000008000 paddr 0x0000000000008000 align 2**12
+         filesz 0x0000000000001860 memsz 0x0000000000001860 flags r--
+    LOAD off    0x0000000000009db8 vaddr 0x000000000000adb8 paddr 0x000000000000adb8 align 2**12
+         filesz 0x0000000000000808 memsz 0x000000000006be48 flags rw-
+ DYNAMIC off    0x0000000000009dd0 vaddr 0x000000000000add0 paddr 0x000000000000add0 align 2**3
+         filesz 0x00000000000001e0 memsz 0x00000000000001e0 flags rw-
+    NOTE off    0x0000000000000338 vaddr 0x0000000000000338 paddr 0x0000000000000338 align 2**3
+         filesz 0x0000000000000020 memsz 0x0000000000000020 flags r--
+    NOTE off    0x0000000000000358 vaddr 0x0000000000000358 paddr 0x0000000000000358 align 2**2
+         filesz 0x0000000000000044 memsz 0x0000000000000044 flags r--
+0x6474e553 off    0x0000000000000338 vaddr 0x0000000000000338 paddr 0x0000000000000338 align 2**3
+         filesz 0x0000000000000020 memsz 0x0000000000000020 flags r--
+EH_FRAME off    0x0000000000008aa0 vaddr 0x0000000000008aa0 paddr 0x0000000000008aa0 align 2**2
+         filesz 0x00000000000001bc memsz 0x00000000000001bc flags r--
+   STACK off    0x0000000000000000 vaddr 0x0000000000000000 paddr 0x0000000000000000 align 2**4
+         filesz 0x0000000000000000 memsz 0x0000000000000000 flags rw-
+   RELRO off    0x0000000000009db8 vaddr 0x000000000000adb8 paddr 0x000000000000adb8 align 2**0
+         filesz 0x0000000000000248 memsz 0x0000000000000248 flags r--
+
+Dynamic Section:
+  NEEDED               libc.so.6
+  INIT                 0x0000000000002000
+  FINI                 0x00000000000075d0
+  INIT_ARRAY           0x000000000000adb8
+  INIT_ARRAYSZ         0x0000000000000010
+  FINI_ARRAY           0x000000000000adc8
+  FINI_ARRAYSZ         0x0000000000000008
+  GNU_HASH             0x00000000000003a0
+  STRTAB               0x0000000000000ab8
+  SYMTAB               0x00000000000003c8
+  STRSZ                0x00000000000002e3
+  SYMENT               0x0000000000000018
+  DEBUG                0x0000000000000000
+  PLTGOT               0x000000000000afe8
+  PLTRELSZ             0x0000000000000630
+  PLTREL               0x0000000000000007
+  JMPREL               0x0000000000001240
+  RELA                 0x0000000000000eb0
+  RELASZ               0x0000000000000390
+  RELAENT              0x0000000000000018
+  FLAGS_1              0x0000000008000000
+  VERNEED              0x0000000000000e30
+  VERNEEDNUM           0x0000000000000001
+  VERSYM               0x0000000000000d9c
+  RELACOUNT            0x000000000000001f
+
+Version References:
+  required from libc.so.6:
+    0x0d696919 0x00 08 GLIBC_2.9
+    0x0d696917 0x00 07 GLIBC_2.7
+    0x06969194 0x00 06 GLIBC_2.14
+    0x06969190 0x00 05 GLIBC_2.10
+    0x06969197 0x00 04 GLIBC_2.17
+    0x069691b4 0x00 03 GLIBC_2.34
+    0x09691a75 0x00 02 GLIBC_2.2.5
+
+Sections:
+Idx Name          Size      VMA               LMA               File off  Algn
+  0 .interp       0000001c  0000000000000318  0000000000000318  00000318  2**0
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  1 .note.gnu.property 00000020  0000000000000338  0000000000000338  00000338  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  2 .note.gnu.build-id 00000024  0000000000000358  0000000000000358  00000358  2**2
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  3 .note.ABI-tag 00000020  000000000000037c  000000000000037c  0000037c  2**2
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  4 .gnu.hash     00000024  00000000000003a0  00000000000003a0  000003a0  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  5 .dynsym       000006f0  00000000000003c8  00000000000003c8  000003c8  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  6 .dynstr       000002e3  0000000000000ab8  0000000000000ab8  00000ab8  2**0
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  7 .gnu.version  00000094  0000000000000d9c  0000000000000d9c  00000d9c  2**1
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  8 .gnu.version_r 00000080  0000000000000e30  0000000000000e30  00000e30  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+  9 .rela.dyn     00000390  0000000000000eb0  0000000000000eb0  00000eb0  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+ 10 .rela.plt     00000630  0000000000001240  0000000000001240  00001240  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+ 11 .init         00000017  0000000000002000  0000000000002000  00002000  2**2
+                  CONTENTS, ALLOC, LOAD, READONLY, CODE
+ 12 .plt          00000430  0000000000002020  0000000000002020  00002020  2**4
+                  CONTENTS, ALLOC, LOAD, READONLY, CODE
+ 13 .plt.got      00000008  0000000000002450  0000000000002450  00002450  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, CODE
+ 14 .text         0000516e  0000000000002460  0000000000002460  00002460  2**4
+                  CONTENTS, ALLOC, LOAD, READONLY, CODE
+ 15 .fini         00000009  00000000000075d0  00000000000075d0  000075d0  2**2
+                  CONTENTS, ALLOC, LOAD, READONLY, CODE
+ 16 .rodata       00000aa0  0000000000008000  0000000000008000  00008000  2**5
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+ 17 .eh_frame_hdr 000001bc  0000000000008aa0  0000000000008aa0  00008aa0  2**2
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+ 18 .eh_frame     00000c00  0000000000008c60  0000000000008c60  00008c60  2**3
+                  CONTENTS, ALLOC, LOAD, READONLY, DATA
+ 19 .init_array   00000010  000000000000adb8  000000000000adb8  00009db8  2**3
+                  CONTENTS, ALLOC, LOAD, DATA
+ 20 .fini_array   00000008  000000000000adc8  000000000000adc8  00009dc8  2**3
+                  CONTENTS, ALLOC, LOAD, DATA
+ 21 .dynamic      000001e0  000000000000add0  000000000000add0  00009dd0  2**3
+                  CONTENTS, ALLOC, LOAD, DATA
+ 22 .got          00000038  000000000000afb0  000000000000afb0  00009fb0  2**3
+                  CONTENTS, ALLOC, LOAD, DATA
+ 23 .got.plt      00000228  000000000000afe8  000000000000afe8  00009fe8  2**3
+                  CONTENTS, ALLOC, LOAD, DATA
+ 24 .data         00000380  000000000000b240  000000000000b240  0000a240  2**6
+                  CONTENTS, ALLOC, LOAD, DATA
+ 25 .bss          0006b640  000000000000b5c0  000000000000b5c0  0000a5c0  2**5
+                  ALLOC
+ 26 .comment      00000027  0000000000000000  0000000000000000  0000a5c0  2**0
+                  CONTENTS, READONLY
+ 27 .debug_aranges 00000050  0000000000000000  0000000000000000  0000a5e7  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 28 .debug_info   00010251  0000000000000000  0000000000000000  0000a637  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 29 .debug_abbrev 000021c1  0000000000000000  0000000000000000  0001a888  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 30 .debug_line   00005ebd  0000000000000000  0000000000000000  0001ca49  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 31 .debug_str    000205a5  0000000000000000  0000000000000000  00022906  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 32 .debug_line_str 00000d4d  0000000000000000  0000000000000000  00042eab  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 33 .debug_loclists 00004e5a  0000000000000000  0000000000000000  00043bf8  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 34 .debug_macro  0000bf1b  0000000000000000  0000000000000000  00048a52  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+ 35 .debug_rnglists 00000fad  0000000000000000  0000000000000000  0005496d  2**0
+                  CONTENTS, READONLY, DEBUGGING, OCTETS
+SYMBOL TABLE:
+0000000000000000 l    df *ABS*	0000000000000000              Scrt1.o
+000000000000037c l     O .note.ABI-tag	0000000000000020              __abi_tag
+0000000000000000 l    df *ABS*	0000000000000000              
+00000000000027a0 l     F .text	0000000000000040              gpio_get_state_bench
+0000000000076be0 l     O .bss	0000000000000010              gpio_emulation
+000000000000c701 l     O .bss	0000000000000001              __compound_literal.0.lto_priv.0
+0000000000002460 l     F .text	0000000000000013              BenchRegister
+000000000000c708 l     O .bss	0000000000000008              benchs
+00000000000027e0 l     F .text	0000000000000005              BenchTickEvent
+00000000000027f0 l     F .text	000000000000006d              fifo_put_get_bench
+000000000000b440 l     O .data	00000000000000c0              bench_fifo
+0000000000002860 l     F .text	00000000000000a0              LatencyFind
+0000000000012540 l     O .bss	0000000000000004              allocated
+0000000000011f20 l     O .bss	0000000000000620              vectors
+000000000000b250 l     O .data	0000000000000004              released.0
+0000000000002900 l     F .text	000000000000009b              VcdBegin
+0000000000052740 l     O .bss	0000000000000028              vcd_lock
+0000000000052770 l     O .bss	0000000000000008              vcd_start
+0000000000052728 l     O .bss	0000000000000008              vcd_last
+0000000000052720 l     O .bss	0000000000000008              vcd_used
+0000000000012720 l     O .bss	0000000000040000              vcd_buffer
+00000000000029a0 l     F .text	00000000000000bf              TraceEvent.part.0
+000000000000b500 l     O .data	00000000000000c0              trace_queue
+0000000000002a60 l     F .text	00000000000000a9              mpsc_push_pop_bench
+000000000000b380 l     O .data	00000000000000c0              bench_mpsc
+0000000000002b10 l     F .text	0000000000000220              fifo_write_read_block_bench
+0000000000002d30 l     F .text	0000000000000268              VcdOpen
+0000000000076bc0 l     O .bss	0000000000000008              vcd_file
+0000000000003670 l     F .text	0000000000000061              VcdFlush
+0000000000052768 l     O .bss	0000000000000008              vcd_flushed
+0000000000002fa0 l     F .text	0000000000000131              FaultReport
+0000000000012660 l     O .bss	0000000000000001              fault_used
+00000000000527c0 l     O .bss	000000000000c160              fault_sci
+0000000000012591 l     O .bss	0000000000000001              fault_glitch_count
+00000000000125a0 l     O .bss	00000000000000c0              fault_glitches
+0000000000052780 l     O .bss	0000000000000028              fault_tick
+00000000000030e0 l     F .text	0000000000000059              JournalReadNumber
+00000000000729d0 l     O .bss	0000000000000008              journal_replay
+0000000000003140 l     F .text	0000000000000118              JournalRead
+00000000000629c0 l     O .bss	0000000000010010              journal_next
+0000000000003260 l     F .text	00000000000001d6              JournalOpen
+00000000000729d8 l     O .bss	0000000000000008              journal_start
+00000000000062b0 l     F .text	00000000000000fe              ReplayThread
+000000000005e980 l     O .bss	0000000000000008              thread.0.lto_priv.0
+000000000005e988 l     O .bss	0000000000000001              journal_pending
+0000000000072a48 l     O .bss	0000000000000008              journal_record
+0000000000003510 l     F .text	0000000000000025              JournalFlush
+0000000000003440 l     F .text	00000000000000c3              GpioParseName
+0000000000072a20 l     O .bss	0000000000000028              journal_lock
+0000000000003540 l     F .text	000000000000009c              VcdEnd
+00000000000035e0 l     F .text	0000000000000089              VcdGpio.part.0
+00000000000036e0 l     F .text	00000000000003a4              WireLoadNetlist
+0000000000012700 l     O .bss	0000000000000020              gpio_nets
+0000000000076ba0 l     O .bss	000000000000000c              sci_links
+0000000000003a90 l     F .text	00000000000001db              WireOpen
+0000000000072a50 l     O .bss	0000000000000004              journal_once
+0000000000006a10 l     F .text	00000000000001cf              WireThread
+00000000000126e0 l     O .bss	0000000000000008              thread.0.lto_priv.1
+0000000000076bb0 l     O .bss	0000000000000008              bus
+0000000000003c70 l     F .text	000000000000004e              WireNotify
+0000000000003cc0 l     F .text	0000000000000075              WireGpio
+0000000000076bb8 l     O .bss	0000000000000004              wire_once
+00000000000126c0 l     O .bss	0000000000000020              gpio_levels
+0000000000003d40 l     F .text	0000000000000121              gpio_bit_set_bench
+0000000000076bf0 l     O .bss	0000000000000010              gpio_stuck
+0000000000076bd0 l     O .bss	0000000000000010              gpio_outputs
+0000000000076bcc l     O .bss	0000000000000004              gpio_dirty
+0000000000076bc8 l     O .bss	0000000000000004              vcd_once
+0000000000003e70 l     F .text	0000000000000131              gpio_bit_toggle_bench
+0000000000003fb0 l     F .text	000000000000014b              ConsoleOpenTerminal
+0000000000072aa0 l     O .bss	0000000000004100              console_ports
+0000000000004100 l     F .text	00000000000001da              ConsoleOpenServer
+00000000000042e0 l     F .text	000000000000025f              ConsoleStart
+0000000000012680 l     O .bss	0000000000000028              console_lock
+000000000000b268 l     O .data	0000000000000008              console_wake
+0000000000006be0 l     F .text	00000000000003c3              ConsoleThread
+0000000000012668 l     O .bss	0000000000000008              thread.0.lto_priv.2
+0000000000004540 l     F .text	0000000000000446              sci_send_byte_bench
+000000000000c700 l     O .bss	0000000000000001              __compound_literal.0.lto_priv.1
+0000000000072a85 l     O .bss	0000000000000001              trace_enabled
+0000000000008a40 l     O .rodata	0000000000000001              data.2
+0000000000004990 l     F .text	00000000000000a7              FaultThreshold
+0000000000004a40 l     F .text	00000000000000dd              LatencyDispatch
+0000000000004b20 l     F .text	00000000000000aa              LatencyExit
+0000000000004bd0 l     F .text	00000000000001e9              tick_dispatch_bench
+0000000000072a84 l     O .bss	0000000000000001              started.1
+0000000000072a60 l     O .bss	0000000000000020              instance
+00000000000063b0 l     F .text	000000000000065a              TimerThread
+0000000000072a80 l     O .bss	0000000000000004              events.0
+0000000000004dc0 l     F .text	00000000000002f1              GpioDispatchEvent
+00000000000729f8 l     O .bss	0000000000000001              journal_ticking
+0000000000072a00 l     O .bss	0000000000000008              journal_last
+0000000000008740 l     O .rodata	0000000000000300              event_handlers.lto_priv.0
+00000000000729e8 l     O .bss	0000000000000004              tick_period
+00000000000729f0 l     O .bss	0000000000000008              tick_wall
+00000000000729e0 l     O .bss	0000000000000008              tick_time
+00000000000050c0 l     F .text	00000000000000fa              GpioInjectState
+00000000000051c0 l     F .text	000000000000016b              GpioSetStuck
+0000000000005330 l     F .text	00000000000005f6              FaultParse
+000000000000b258 l     O .data	0000000000000008              fault_seed
+0000000000012590 l     O .bss	0000000000000001              fault_glitching
+0000000000005ae0 l     F .text	0000000000000104              GlitchThread
+0000000000012588 l     O .bss	0000000000000008              fault_thread
+0000000000005930 l     F .text	00000000000000ad              FaultOpen
+0000000000012560 l     O .bss	0000000000000028              fault_lock
+00000000000059e0 l     F .text	00000000000000f1              GpioInjectToggle.isra.0
+0000000000005bf0 l     F .text	0000000000000488              SciInjectEvent.part.0
+000000000005e920 l     O .bss	0000000000000060              event_handlers.lto_priv.1
+000000000005e9a0 l     O .bss	0000000000004020              journal_sci
+0000000000006080 l     F .text	000000000000022b              JournalDeliver
+00000000000527a8 l     O .bss	0000000000000004              fault_once
+000000000000b260 l     O .data	0000000000000001              wire_refresh
+0000000000006fb0 l     F .text	0000000000000003              TestRunAll
+0000000000006fc0 l     F .text	00000000000005f1              BenchRunAll
+000000000000c720 l     O .bss	0000000000005800              previous.0
+0000000000002650 l     F .text	0000000000000060              _sub_I_65535_0.0
+000000000000b280 l     O .data	0000000000000020              mpsc_push_pop_case
+000000000000b2a0 l     O .data	0000000000000020              fifo_write_read_block_case
+000000000000b2c0 l     O .data	0000000000000020              fifo_put_get_case
+000000000000b2e0 l     O .data	0000000000000020              tick_dispatch_case
+000000000000b300 l     O .data	0000000000000020              sci_send_byte_case
+000000000000b320 l     O .data	0000000000000020              gpio_get_state_case
+000000000000b340 l     O .data	0000000000000020              gpio_bit_toggle_case
+000000000000b360 l     O .data	0000000000000020              gpio_bit_set_case
+000000000000b5e0 l     O .bss	0000000000000004              trace_queues
+000000000000b600 l     O .bss	0000000000000800              bench_mpsc_cells
+000000000000be00 l     O .bss	0000000000000100              bench_fifo_buffer
+000000000000bf00 l     O .bss	0000000000000800              trace_cells
+0000000000000000 l    df *ABS*	0000000000000000              crtstuff.c
+00000000000026e0 l     F .text	0000000000000000              deregister_tm_clones
+0000000000002710 l     F .text	0000000000000000              register_tm_clones
+0000000000002750 l     F .text	0000000000000000              __do_global_dtors_aux
+000000000000b5c0 l     O .bss	0000000000000001              completed.0
+000000000000adc8 l     O .fini_array	0000000000000000              __do_global_dtors_aux_fini_array_entry
+0000000000002790 l     F .text	0000000000000000              frame_dummy
+000000000000adb8 l     O .init_array	0000000000000000              __frame_dummy_init_array_entry
+0000000000000000 l    df *ABS*	0000000000000000              crtstuff.c
+000000000000985c l     O .eh_frame	0000000000000000              __FRAME_END__
+0000000000000000 l    df *ABS*	0000000000000000              
+00000000000075c0 l     F .text	000000000000000e              atexit
+000000000000add0 l     O .dynamic	0000000000000000              _DYNAMIC
+0000000000008aa0 l       .eh_frame_hdr	0000000000000000              __GNU_EH_FRAME_HDR
+000000000000afe8 l     O .got.plt	0000000000000000              _GLOBAL_OFFSET_TABLE_
+0000000000000000       F *UND*	0000000000000000              getenv@GLIBC_2.2.5
+000000000000e3e7  w      .debug_info	0000000000000000              .hidden latency.c.63583380
+0000000000000000       F *UND*	0000000000000000              ptsname@GLIBC_2.2.5
+000000000000b009  w      .debug_info	0000000000000000              .hidden soc_vcd.c.6b8eaa1d
+0000000000000000       F *UND*	0000000000000000              putchar@GLIBC_2.2.5
+000000000000788b  w      .debug_info	0000000000000000              .hidden bench_fifo.c.a1132b02
+0000000000000000       F *UND*	0000000000000000              __libc_start_main@GLIBC_2.34
+0000000000000000       F *UND*	0000000000000000              __errno_location@GLIBC_2.2.5
+0000000000009b38  w      .debug_info	0000000000000000              .hidden soc_sci.c.6913fee6
+0000000000000000       F *UND*	0000000000000000              unlink@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              strncmp@GLIBC_2.2.5
+0000000000000000  w      *UND*	0000000000000000              _ITM_deregisterTMCloneTable
+0000000000000000       O *UND*	0000000000000000              stdout@GLIBC_2.2.5
+000000000000b240  w      .data	0000000000000000              data_start
+0000000000008f8b  w      .debug_info	0000000000000000              .hidden soc_journal.c.b95de2df
+0000000000000000       F *UND*	0000000000000000              fread@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              strtod@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              setsockopt@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              fcntl@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              clock_gettime@GLIBC_2.17
+0000000000000000       F *UND*	0000000000000000              write@GLIBC_2.2.5
+000000000000b5c0 g       .data	0000000000000000              _edata
+0000000000000000       F *UND*	0000000000000000              fclose@GLIBC_2.2.5
+00000000000075d0 g     F .fini	0000000000000000              .hidden _fini
+0000000000000000       F *UND*	0000000000000000              strlen@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              mmap@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              accept4@GLIBC_2.10
+0000000000000000       F *UND*	0000000000000000              send@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              strchr@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              printf@GLIBC_2.2.5
+000000000000a22d  w      .debug_info	0000000000000000              .hidden soc_stimulus.c.133c448e
+0000000000000000       F *UND*	0000000000000000              symlink@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              snprintf@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              ftruncate@GLIBC_2.2.5
+000000000000c2f6  w      .debug_info	0000000000000000              .hidden soc_console.c.6a23cb79
+00000000000101c3  w      .debug_info	0000000000000000              .hidden arch_cycles.c.6a11d680
+0000000000000000       F *UND*	0000000000000000              close@GLIBC_2.2.5
+000000000000f709  w      .debug_info	0000000000000000              .hidden unit_test.c.962afe2f
+0000000000000000       F *UND*	0000000000000000              strtok_r@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              read@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              fgets@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              strtoull@GLIBC_2.2.5
+000000000000b240 g       .data	0000000000000000              __data_start
+0000000000000000       F *UND*	0000000000000000              strcmp@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              putc@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              unlockpt@GLIBC_2.2.5
+000000000000d5fc  w      .debug_info	0000000000000000              .hidden soc_fault.c.79617174
+0000000000000000       F *UND*	0000000000000000              fprintf@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              syscall@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              feof@GLIBC_2.2.5
+0000000000000000  w      *UND*	0000000000000000              __gmon_start__
+0000000000000000       F *UND*	0000000000000000              strtol@GLIBC_2.2.5
+000000000000b248 g     O .data	0000000000000000              .hidden __dso_handle
+0000000000007f84  w      .debug_info	0000000000000000              .hidden soc_gpio.c.407f2a52
+0000000000000000       F *UND*	0000000000000000              memcpy@GLIBC_2.14
+0000000000008000 g     O .rodata	0000000000000004              _IO_stdin_used
+0000000000000000       F *UND*	0000000000000000              pthread_mutex_unlock@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              fflush@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              __isoc99_sscanf@GLIBC_2.7
+0000000000000000       F *UND*	0000000000000000              listen@GLIBC_2.2.5
+0000000000076c00 g       .bss	0000000000000000              _end
+00000000000026b0 g     F .text	0000000000000022              _start
+000000000000b5c0 g       .bss	0000000000000000              __bss_start
+0000000000000000       F *UND*	0000000000000000              cfmakeraw@GLIBC_2.2.5
+0000000000002480 g     F .text	00000000000001cb              main
+0000000000000000       F *UND*	0000000000000000              setvbuf@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              poll@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              bind@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              pthread_create@GLIBC_2.34
+000000000000751f  w      .debug_info	0000000000000000              .hidden bench_hal.c.32ed9fbe
+0000000000000000       F *UND*	0000000000000000              tcgetattr@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              tcsetattr@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              open@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              fopen@GLIBC_2.2.5
+000000000000b7d4  w      .debug_info	0000000000000000              .hidden soc_wire.c.40f60844
+0000000000000000       F *UND*	0000000000000000              strtoul@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              flock@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              __cxa_atexit@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              grantpt@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              pipe2@GLIBC_2.9
+0000000000000000       F *UND*	0000000000000000              sprintf@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              exit@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              fwrite@GLIBC_2.2.5
+000000000000b5c0 g     O .data	0000000000000000              .hidden __TMC_END__
+0000000000000000       F *UND*	0000000000000000              shm_open@GLIBC_2.34
+0000000000000000       F *UND*	0000000000000000              clock_nanosleep@GLIBC_2.17
+0000000000000000  w      *UND*	0000000000000000              _ITM_registerTMCloneTable
+0000000000000000       F *UND*	0000000000000000              posix_openpt@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              pthread_mutex_init@GLIBC_2.2.5
+000000000000ed18  w      .debug_info	0000000000000000              .hidden trace.c.e4cd1ae7
+0000000000000000       F *UND*	0000000000000000              pthread_once@GLIBC_2.34
+0000000000000000  w    F *UND*	0000000000000000              __cxa_finalize@GLIBC_2.2.5
+0000000000002000 g     F .init	0000000000000000              .hidden _init
+0000000000000000       F *UND*	0000000000000000              getc@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              strstr@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              pthread_mutex_lock@GLIBC_2.2.5
+000000000000ac7c  w      .debug_info	0000000000000000              .hidden soc_tick.c.94925b15
+0000000000000000       F *UND*	0000000000000000              usleep@GLIBC_2.2.5
+0000000000000000       O *UND*	0000000000000000              stderr@GLIBC_2.2.5
+0000000000000000       F *UND*	0000000000000000              socket@GLIBC_2.2.5
+
+
+
+Disassembly of section .init:
+
+0000000000002000 <_init>:
+    2000:	48 83 ec 08          	sub    $0x8,%rsp
+    2004:	48 8b 05 bd 8f 00 00 	mov    0x8fbd(%rip),%rax        # afc8 <__gmon_start__@Base>
+    200b:	48 85 c0             	test   %rax,%rax
+    200e:	74 02                	je     2012 <_init+0x12>
+    2010:	ff d0                	call   *%rax
+    2012:	48 83 c4 08          	add    $0x8,%rsp
+    2016:	c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000002020 <getenv@plt-0x10>:
+    2020:	ff 35 ca 8f 00 00    	push   0x8fca(%rip)        # aff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    2026:	ff 25 cc 8f 00 00    	jmp    *0x8fcc(%rip)        # aff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    202c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002030 <getenv@plt>:
+    2030:	ff 25 ca 8f 00 00    	jmp    *0x8fca(%rip)        # b000 <getenv@GLIBC_2.2.5>
+    2036:	68 00 00 00 00       	push   $0x0
+    203b:	e9 e0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002040 <ptsname@plt>:
+    2040:	ff 25 c2 8f 00 00    	jmp    *0x8fc2(%rip)        # b008 <ptsname@GLIBC_2.2.5>
+    2046:	68 01 00 00 00       	push   $0x1
+    204b:	e9 d0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002050 <putchar@plt>:
+    2050:	ff 25 ba 8f 00 00    	jmp    *0x8fba(%rip)        # b010 <putchar@GLIBC_2.2.5>
+    2056:	68 02 00 00 00       	push   $0x2
+    205b:	e9 c0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002060 <__errno_location@plt>:
+    2060:	ff 25 b2 8f 00 00    	jmp    *0x8fb2(%rip)        # b018 <__errno_location@GLIBC_2.2.5>
+    2066:	68 03 00 00 00       	push   $0x3
+    206b:	e9 b0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002070 <unlink@plt>:
+    2070:	ff 25 aa 8f 00 00    	jmp    *0x8faa(%rip)        # b020 <unlink@GLIBC_2.2.5>
+    2076:	68 04 00 00 00       	push   $0x4
+    207b:	e9 a0 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002080 <strncmp@plt>:
+    2080:	ff 25 a2 8f 00 00    	jmp    *0x8fa2(%rip)        # b028 <strncmp@GLIBC_2.2.5>
+    2086:	68 05 00 00 00       	push   $0x5
+    208b:	e9 90 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002090 <fread@plt>:
+    2090:	ff 25 9a 8f 00 00    	jmp    *0x8f9a(%rip)        # b030 <fread@GLIBC_2.2.5>
+    2096:	68 06 00 00 00       	push   $0x6
+    209b:	e9 80 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020a0 <strtod@plt>:
+    20a0:	ff 25 92 8f 00 00    	jmp    *0x8f92(%rip)        # b038 <strtod@GLIBC_2.2.5>
+    20a6:	68 07 00 00 00       	push   $0x7
+    20ab:	e9 70 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020b0 <setsockopt@plt>:
+    20b0:	ff 25 8a 8f 00 00    	jmp    *0x8f8a(%rip)        # b040 <setsockopt@GLIBC_2.2.5>
+    20b6:	68 08 00 00 00       	push   $0x8
+    20bb:	e9 60 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020c0 <fcntl@plt>:
+    20c0:	ff 25 82 8f 00 00    	jmp    *0x8f82(%rip)        # b048 <fcntl@GLIBC_2.2.5>
+    20c6:	68 09 00 00 00       	push   $0x9
+    20cb:	e9 50 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020d0 <clock_gettime@plt>:
+    20d0:	ff 25 7a 8f 00 00    	jmp    *0x8f7a(%rip)        # b050 <clock_gettime@GLIBC_2.17>
+    20d6:	68 0a 00 00 00       	push   $0xa
+    20db:	e9 40 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020e0 <write@plt>:
+    20e0:	ff 25 72 8f 00 00    	jmp    *0x8f72(%rip)        # b058 <write@GLIBC_2.2.5>
+    20e6:	68 0b 00 00 00       	push   $0xb
+    20eb:	e9 30 ff ff ff       	jmp    2020 <_init+0x20>
+
+00000000000020f0 <fclose@plt>:
+    20f0:	ff 25 6a 8f 00 00    	jmp    *0x8f6a(%rip)        # b060 <fclose@GLIBC_2.2.5>
+    20f6:	68 0c 00 00 00       	push   $0xc
+    20fb:	e9 20 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002100 <strlen@plt>:
+    2100:	ff 25 62 8f 00 00    	jmp    *0x8f62(%rip)        # b068 <strlen@GLIBC_2.2.5>
+    2106:	68 0d 00 00 00       	push   $0xd
+    210b:	e9 10 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002110 <mmap@plt>:
+    2110:	ff 25 5a 8f 00 00    	jmp    *0x8f5a(%rip)        # b070 <mmap@GLIBC_2.2.5>
+    2116:	68 0e 00 00 00       	push   $0xe
+    211b:	e9 00 ff ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002120 <accept4@plt>:
+    2120:	ff 25 52 8f 00 00    	jmp    *0x8f52(%rip)        # b078 <accept4@GLIBC_2.10>
+    2126:	68 0f 00 00 00       	push   $0xf
+    212b:	e9 f0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002130 <send@plt>:
+    2130:	ff 25 4a 8f 00 00    	jmp    *0x8f4a(%rip)        # b080 <send@GLIBC_2.2.5>
+    2136:	68 10 00 00 00       	push   $0x10
+    213b:	e9 e0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002140 <strchr@plt>:
+    2140:	ff 25 42 8f 00 00    	jmp    *0x8f42(%rip)        # b088 <strchr@GLIBC_2.2.5>
+    2146:	68 11 00 00 00       	push   $0x11
+    214b:	e9 d0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002150 <printf@plt>:
+    2150:	ff 25 3a 8f 00 00    	jmp    *0x8f3a(%rip)        # b090 <printf@GLIBC_2.2.5>
+    2156:	68 12 00 00 00       	push   $0x12
+    215b:	e9 c0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002160 <symlink@plt>:
+    2160:	ff 25 32 8f 00 00    	jmp    *0x8f32(%rip)        # b098 <symlink@GLIBC_2.2.5>
+    2166:	68 13 00 00 00       	push   $0x13
+    216b:	e9 b0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002170 <snprintf@plt>:
+    2170:	ff 25 2a 8f 00 00    	jmp    *0x8f2a(%rip)        # b0a0 <snprintf@GLIBC_2.2.5>
+    2176:	68 14 00 00 00       	push   $0x14
+    217b:	e9 a0 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002180 <ftruncate@plt>:
+    2180:	ff 25 22 8f 00 00    	jmp    *0x8f22(%rip)        # b0a8 <ftruncate@GLIBC_2.2.5>
+    2186:	68 15 00 00 00       	push   $0x15
+    218b:	e9 90 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002190 <close@plt>:
+    2190:	ff 25 1a 8f 00 00    	jmp    *0x8f1a(%rip)        # b0b0 <close@GLIBC_2.2.5>
+    2196:	68 16 00 00 00       	push   $0x16
+    219b:	e9 80 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021a0 <strtok_r@plt>:
+    21a0:	ff 25 12 8f 00 00    	jmp    *0x8f12(%rip)        # b0b8 <strtok_r@GLIBC_2.2.5>
+    21a6:	68 17 00 00 00       	push   $0x17
+    21ab:	e9 70 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021b0 <read@plt>:
+    21b0:	ff 25 0a 8f 00 00    	jmp    *0x8f0a(%rip)        # b0c0 <read@GLIBC_2.2.5>
+    21b6:	68 18 00 00 00       	push   $0x18
+    21bb:	e9 60 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021c0 <fgets@plt>:
+    21c0:	ff 25 02 8f 00 00    	jmp    *0x8f02(%rip)        # b0c8 <fgets@GLIBC_2.2.5>
+    21c6:	68 19 00 00 00       	push   $0x19
+    21cb:	e9 50 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021d0 <strtoull@plt>:
+    21d0:	ff 25 fa 8e 00 00    	jmp    *0x8efa(%rip)        # b0d0 <strtoull@GLIBC_2.2.5>
+    21d6:	68 1a 00 00 00       	push   $0x1a
+    21db:	e9 40 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021e0 <strcmp@plt>:
+    21e0:	ff 25 f2 8e 00 00    	jmp    *0x8ef2(%rip)        # b0d8 <strcmp@GLIBC_2.2.5>
+    21e6:	68 1b 00 00 00       	push   $0x1b
+    21eb:	e9 30 fe ff ff       	jmp    2020 <_init+0x20>
+
+00000000000021f0 <putc@plt>:
+    21f0:	ff 25 ea 8e 00 00    	jmp    *0x8eea(%rip)        # b0e0 <putc@GLIBC_2.2.5>
+    21f6:	68 1c 00 00 00       	push   $0x1c
+    21fb:	e9 20 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002200 <unlockpt@plt>:
+    2200:	ff 25 e2 8e 00 00    	jmp    *0x8ee2(%rip)        # b0e8 <unlockpt@GLIBC_2.2.5>
+    2206:	68 1d 00 00 00       	push   $0x1d
+    220b:	e9 10 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002210 <fprintf@plt>:
+    2210:	ff 25 da 8e 00 00    	jmp    *0x8eda(%rip)        # b0f0 <fprintf@GLIBC_2.2.5>
+    2216:	68 1e 00 00 00       	push   $0x1e
+    221b:	e9 00 fe ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002220 <syscall@plt>:
+    2220:	ff 25 d2 8e 00 00    	jmp    *0x8ed2(%rip)        # b0f8 <syscall@GLIBC_2.2.5>
+    2226:	68 1f 00 00 00       	push   $0x1f
+    222b:	e9 f0 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002230 <feof@plt>:
+    2230:	ff 25 ca 8e 00 00    	jmp    *0x8eca(%rip)        # b100 <feof@GLIBC_2.2.5>
+    2236:	68 20 00 00 00       	push   $0x20
+    223b:	e9 e0 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002240 <strtol@plt>:
+    2240:	ff 25 c2 8e 00 00    	jmp    *0x8ec2(%rip)        # b108 <strtol@GLIBC_2.2.5>
+    2246:	68 21 00 00 00       	push   $0x21
+    224b:	e9 d0 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002250 <memcpy@plt>:
+    2250:	ff 25 ba 8e 00 00    	jmp    *0x8eba(%rip)        # b110 <memcpy@GLIBC_2.14>
+    2256:	68 22 00 00 00       	push   $0x22
+    225b:	e9 c0 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002260 <pthread_mutex_unlock@plt>:
+    2260:	ff 25 b2 8e 00 00    	jmp    *0x8eb2(%rip)        # b118 <pthread_mutex_unlock@GLIBC_2.2.5>
+    2266:	68 23 00 00 00       	push   $0x23
+    226b:	e9 b0 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002270 <fflush@plt>:
+    2270:	ff 25 aa 8e 00 00    	jmp    *0x8eaa(%rip)        # b120 <fflush@GLIBC_2.2.5>
+    2276:	68 24 00 00 00       	push   $0x24
+    227b:	e9 a0 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002280 <__isoc99_sscanf@plt>:
+    2280:	ff 25 a2 8e 00 00    	jmp    *0x8ea2(%rip)        # b128 <__isoc99_sscanf@GLIBC_2.7>
+    2286:	68 25 00 00 00       	push   $0x25
+    228b:	e9 90 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002290 <listen@plt>:
+    2290:	ff 25 9a 8e 00 00    	jmp    *0x8e9a(%rip)        # b130 <listen@GLIBC_2.2.5>
+    2296:	68 26 00 00 00       	push   $0x26
+    229b:	e9 80 fd ff ff       	jmp    2020 <_init+0x20>
+
+00000000000022a0 <cfmakeraw@plt>:
+    22a0:	ff 25 92 8e 00 00    	jmp    *0x8e92(%rip)        # b138 <cfmakeraw@GLIBC_2.2.5>
+    22a6:	68 27 00 00 00       	push   $0x27
+    22ab:	e9 70 fd ff ff       	jmp    2020 <_init+0x20>
+
+00000000000022b0 <setvbuf@plt>:
+    22b0:	ff 25 8a 8e 00 00    	jmp    *0x8e8a(%rip)        # b140 <setvbuf@GLIBC_2.2.5>
+    22b6:	68 28 00 00 00       	push   $0x28
+    22bb:	e9 60 fd ff ff       	jmp    2020 <_init+0x20>
+
+00000000000022c0 <poll@plt>:
+    22c0:	ff 25 82 8e 00 00    	jmp    *0x8e82(%rip)        # b148 <poll@GLIBC_2.2.5>
+    22c6:	68 29 00 00 00       	push   $0x29
+    22cb:	e9 50 fd ff ff       	jmp    2020 <_init+0x20>
+
+00000000000022d0 <bind@plt>:
+    22d0:	ff 25 7a 8e 00 00    	jmp    *0x8e7a(%rip)        # b150 <bind@GLIBC_2.2.5>
+    22d6:	68 2a 00 00 00       	push   $0x2a
+    22db:	e9 40 fd ff ff       	jmp    2020 <_init+0x20>
+
+00000000000022e0 <pthread_create@plt>:
+    22e0:	ff 25 72 8e 00 00    	jmp    *0x8e72(%rip)        # b158 <pthread_create@GLIBC_2.34>
+    22e6:	68 2b 00 00 00       	push   $0x2b
+    22eb:	e9 30 fd ff ff       	jmp    2020 <_init+0x20>
+
+00000000000022f0 <tcgetattr@plt>:
+    22f0:	ff 25 6a 8e 00 00    	jmp    *0x8e6a(%rip)        # b160 <tcgetattr@GLIBC_2.2.5>
+    22f6:	68 2c 00 00 00       	push   $0x2c
+    22fb:	e9 20 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002300 <tcsetattr@plt>:
+    2300:	ff 25 62 8e 00 00    	jmp    *0x8e62(%rip)        # b168 <tcsetattr@GLIBC_2.2.5>
+    2306:	68 2d 00 00 00       	push   $0x2d
+    230b:	e9 10 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002310 <open@plt>:
+    2310:	ff 25 5a 8e 00 00    	jmp    *0x8e5a(%rip)        # b170 <open@GLIBC_2.2.5>
+    2316:	68 2e 00 00 00       	push   $0x2e
+    231b:	e9 00 fd ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002320 <fopen@plt>:
+    2320:	ff 25 52 8e 00 00    	jmp    *0x8e52(%rip)        # b178 <fopen@GLIBC_2.2.5>
+    2326:	68 2f 00 00 00       	push   $0x2f
+    232b:	e9 f0 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002330 <strtoul@plt>:
+    2330:	ff 25 4a 8e 00 00    	jmp    *0x8e4a(%rip)        # b180 <strtoul@GLIBC_2.2.5>
+    2336:	68 30 00 00 00       	push   $0x30
+    233b:	e9 e0 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002340 <flock@plt>:
+    2340:	ff 25 42 8e 00 00    	jmp    *0x8e42(%rip)        # b188 <flock@GLIBC_2.2.5>
+    2346:	68 31 00 00 00       	push   $0x31
+    234b:	e9 d0 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002350 <__cxa_atexit@plt>:
+    2350:	ff 25 3a 8e 00 00    	jmp    *0x8e3a(%rip)        # b190 <__cxa_atexit@GLIBC_2.2.5>
+    2356:	68 32 00 00 00       	push   $0x32
+    235b:	e9 c0 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002360 <grantpt@plt>:
+    2360:	ff 25 32 8e 00 00    	jmp    *0x8e32(%rip)        # b198 <grantpt@GLIBC_2.2.5>
+    2366:	68 33 00 00 00       	push   $0x33
+    236b:	e9 b0 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002370 <pipe2@plt>:
+    2370:	ff 25 2a 8e 00 00    	jmp    *0x8e2a(%rip)        # b1a0 <pipe2@GLIBC_2.9>
+    2376:	68 34 00 00 00       	push   $0x34
+    237b:	e9 a0 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002380 <sprintf@plt>:
+    2380:	ff 25 22 8e 00 00    	jmp    *0x8e22(%rip)        # b1a8 <sprintf@GLIBC_2.2.5>
+    2386:	68 35 00 00 00       	push   $0x35
+    238b:	e9 90 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002390 <exit@plt>:
+    2390:	ff 25 1a 8e 00 00    	jmp    *0x8e1a(%rip)        # b1b0 <exit@GLIBC_2.2.5>
+    2396:	68 36 00 00 00       	push   $0x36
+    239b:	e9 80 fc ff ff       	jmp    2020 <_init+0x20>
+
+00000000000023a0 <fwrite@plt>:
+    23a0:	ff 25 12 8e 00 00    	jmp    *0x8e12(%rip)        # b1b8 <fwrite@GLIBC_2.2.5>
+    23a6:	68 37 00 00 00       	push   $0x37
+    23ab:	e9 70 fc ff ff       	jmp    2020 <_init+0x20>
+
+00000000000023b0 <shm_open@plt>:
+    23b0:	ff 25 0a 8e 00 00    	jmp    *0x8e0a(%rip)        # b1c0 <shm_open@GLIBC_2.34>
+    23b6:	68 38 00 00 00       	push   $0x38
+    23bb:	e9 60 fc ff ff       	jmp    2020 <_init+0x20>
+
+00000000000023c0 <clock_nanosleep@plt>:
+    23c0:	ff 25 02 8e 00 00    	jmp    *0x8e02(%rip)        # b1c8 <clock_nanosleep@GLIBC_2.17>
+    23c6:	68 39 00 00 00       	push   $0x39
+    23cb:	e9 50 fc ff ff       	jmp    2020 <_init+0x20>
+
+00000000000023d0 <posix_openpt@plt>:
+    23d0:	ff 25 fa 8d 00 00    	jmp    *0x8dfa(%rip)        # b1d0 <posix_openpt@GLIBC_2.2.5>
+    23d6:	68 3a 00 00 00       	push   $0x3a
+    23db:	e9 40 fc ff ff       	jmp    2020 <_init+0x20>
+
+00000000000023e0 <pthread_mutex_init@plt>:
+    23e0:	ff 25 f2 8d 00 00    	jmp    *0x8df2(%rip)        # b1d8 <pthread_mutex_init@GLIBC_2.2.5>
+    23e6:	68 3b 00 00 00       	push   $0x3b
+    23eb:	e9 30 fc ff ff       	jmp    2020 <_init+0x20>
+
+00000000000023f0 <pthread_once@plt>:
+    23f0:	ff 25 ea 8d 00 00    	jmp    *0x8dea(%rip)        # b1e0 <pthread_once@GLIBC_2.34>
+    23f6:	68 3c 00 00 00       	push   $0x3c
+    23fb:	e9 20 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002400 <getc@plt>:
+    2400:	ff 25 e2 8d 00 00    	jmp    *0x8de2(%rip)        # b1e8 <getc@GLIBC_2.2.5>
+    2406:	68 3d 00 00 00       	push   $0x3d
+    240b:	e9 10 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002410 <strstr@plt>:
+    2410:	ff 25 da 8d 00 00    	jmp    *0x8dda(%rip)        # b1f0 <strstr@GLIBC_2.2.5>
+    2416:	68 3e 00 00 00       	push   $0x3e
+    241b:	e9 00 fc ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002420 <pthread_mutex_lock@plt>:
+    2420:	ff 25 d2 8d 00 00    	jmp    *0x8dd2(%rip)        # b1f8 <pthread_mutex_lock@GLIBC_2.2.5>
+    2426:	68 3f 00 00 00       	push   $0x3f
+    242b:	e9 f0 fb ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002430 <usleep@plt>:
+    2430:	ff 25 ca 8d 00 00    	jmp    *0x8dca(%rip)        # b200 <usleep@GLIBC_2.2.5>
+    2436:	68 40 00 00 00       	push   $0x40
+    243b:	e9 e0 fb ff ff       	jmp    2020 <_init+0x20>
+
+0000000000002440 <socket@plt>:
+    2440:	ff 25 c2 8d 00 00    	jmp    *0x8dc2(%rip)        # b208 <socket@GLIBC_2.2.5>
+    2446:	68 41 00 00 00       	push   $0x41
+    244b:	e9 d0 fb ff ff       	jmp    2020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000002450 <__cxa_finalize@plt>:
+    2450:	ff 25 82 8b 00 00    	jmp    *0x8b82(%rip)        # afd8 <__cxa_finalize@GLIBC_2.2.5>
+    2456:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000002460 <BenchRegister>:
+    test->next = tests;
+    tests = test;
+}
+
+void BenchRegister(bench_case_t bench) {
+    bench->next = benchs;
+    2460:	48 8b 05 a1 a2 00 00 	mov    0xa2a1(%rip),%rax        # c708 <benchs>
+    benchs = bench;
+    2467:	48 89 3d 9a a2 00 00 	mov    %rdi,0xa29a(%rip)        # c708 <benchs>
+    bench->next = benchs;
+    246e:	48 89 47 18          	mov    %rax,0x18(%rdi)
+}
+    2472:	c3                   	ret
+    2473:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    247a:	00 00 00 00 
+    247e:	66 90                	xchg   %ax,%ax
+
+0000000000002480 <main>:
+    va_end(arguments);
+    printf("\n");
+    longjmp(test_abort, 1);
+}
+
+int main(int argc, char * argv[]) {
+    2480:	41 57                	push   %r15
+    2482:	41 56                	push   %r14
+    2484:	41 55                	push   %r13
+    2486:	41 54                	push   %r12
+    2488:	55                   	push   %rbp
+    2489:	53                   	push   %rbx
+    248a:	48 83 ec 28          	sub    $0x28,%rsp
+    char const * output = NULL;
+    char const * baseline = NULL;
+    double tolerance = -1;
+    int failed;
+
+    for (int index = 1; index < argc; index++) {
+    248e:	83 ff 01             	cmp    $0x1,%edi
+    2491:	0f 8e 91 01 00 00    	jle    2628 <main+0x1a8>
+    2497:	44 8d 6f fe          	lea    -0x2(%rdi),%r13d
+    249b:	41 89 ff             	mov    %edi,%r15d
+    249e:	49 89 f6             	mov    %rsi,%r14
+    24a1:	bb 02 00 00 00       	mov    $0x2,%ebx
+    double tolerance = -1;
+    24a6:	f2 0f 10 0d d2 65 00 	movsd  0x65d2(%rip),%xmm1        # 8a80 <data.2+0x40>
+    24ad:	00 
+    24ae:	41 83 e5 fe          	and    $0xfffffffe,%r13d
+    char const * baseline = NULL;
+    24b2:	48 c7 44 24 18 00 00 	movq   $0x0,0x18(%rsp)
+    24b9:	00 00 
+    24bb:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+    char const * output = NULL;
+    24bf:	48 c7 44 24 10 00 00 	movq   $0x0,0x10(%rsp)
+    24c6:	00 00 
+    24c8:	41 83 c5 04          	add    $0x4,%r13d
+    char const * filter = NULL;
+    24cc:	48 c7 04 24 00 00 00 	movq   $0x0,(%rsp)
+    24d3:	00 
+    double tolerance = -1;
+    24d4:	f2 0f 11 4c 24 08    	movsd  %xmm1,0x8(%rsp)
+    24da:	eb 1f                	jmp    24fb <main+0x7b>
+    24dc:	0f 1f 40 00          	nopl   0x0(%rax)
+        if ((strcmp(argv[index], "--filter") == 0) && (index + 1 < argc)) {
+    24e0:	44 39 fb             	cmp    %r15d,%ebx
+    24e3:	7d 2d                	jge    2512 <main+0x92>
+            filter = argv[++index];
+    24e5:	89 d8                	mov    %ebx,%eax
+    24e7:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+    24eb:	48 89 04 24          	mov    %rax,(%rsp)
+    for (int index = 1; index < argc; index++) {
+    24ef:	83 c3 02             	add    $0x2,%ebx
+    24f2:	49 83 c4 10          	add    $0x10,%r12
+    24f6:	44 39 eb             	cmp    %r13d,%ebx
+    24f9:	74 4a                	je     2545 <main+0xc5>
+        if ((strcmp(argv[index], "--filter") == 0) && (index + 1 < argc)) {
+    24fb:	49 8b 2c 24          	mov    (%r12),%rbp
+    24ff:	48 8d 35 c3 5d 00 00 	lea    0x5dc3(%rip),%rsi        # 82c9 <_IO_stdin_used+0x2c9>
+    2506:	48 89 ef             	mov    %rbp,%rdi
+    2509:	e8 d2 fc ff ff       	call   21e0 <strcmp@plt>
+    250e:	85 c0                	test   %eax,%eax
+    2510:	74 ce                	je     24e0 <main+0x60>
+        } else if ((strcmp(argv[index], "--json") == 0) && (index + 1 < argc)) {
+    2512:	48 8d 35 b9 5d 00 00 	lea    0x5db9(%rip),%rsi        # 82d2 <_IO_stdin_used+0x2d2>
+    2519:	48 89 ef             	mov    %rbp,%rdi
+    251c:	e8 bf fc ff ff       	call   21e0 <strcmp@plt>
+    2521:	85 c0                	test   %eax,%eax
+    2523:	75 73                	jne    2598 <main+0x118>
+    2525:	44 39 fb             	cmp    %r15d,%ebx
+    2528:	0f 8d c2 00 00 00    	jge    25f0 <main+0x170>
+            output = argv[++index];
+    252e:	89 d8                	mov    %ebx,%eax
+    for (int index = 1; index < argc; index++) {
+    2530:	83 c3 02             	add    $0x2,%ebx
+    2533:	49 83 c4 10          	add    $0x10,%r12
+            output = argv[++index];
+    2537:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+    253b:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    for (int index = 1; index < argc; index++) {
+    2540:	44 39 eb             	cmp    %r13d,%ebx
+    2543:	75 b6                	jne    24fb <main+0x7b>
+                            " [--tolerance percent]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    2545:	48 8b 05 74 8a 00 00 	mov    0x8a74(%rip),%rax        # afc0 <stdout@GLIBC_2.2.5>
+    254c:	31 c9                	xor    %ecx,%ecx
+    254e:	31 f6                	xor    %esi,%esi
+    2550:	ba 01 00 00 00       	mov    $0x1,%edx
+    2555:	48 8b 38             	mov    (%rax),%rdi
+    2558:	e8 53 fd ff ff       	call   22b0 <setvbuf@plt>
+    failed = TestRunAll(filter);
+    255d:	48 8b 3c 24          	mov    (%rsp),%rdi
+    2561:	e8 4a 4a 00 00       	call   6fb0 <TestRunAll>
+    failed += BenchRunAll(filter, output, baseline, tolerance);
+    2566:	f2 0f 10 44 24 08    	movsd  0x8(%rsp),%xmm0
+    256c:	48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    2571:	48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    failed = TestRunAll(filter);
+    2576:	89 c3                	mov    %eax,%ebx
+    failed += BenchRunAll(filter, output, baseline, tolerance);
+    2578:	e8 43 4a 00 00       	call   6fc0 <BenchRunAll>
+    return failed ? 1 : 0;
+    257d:	01 c3                	add    %eax,%ebx
+    257f:	0f 95 c0             	setne  %al
+    2582:	0f b6 c0             	movzbl %al,%eax
+}
+    2585:	48 83 c4 28          	add    $0x28,%rsp
+    2589:	5b                   	pop    %rbx
+    258a:	5d                   	pop    %rbp
+    258b:	41 5c                	pop    %r12
+    258d:	41 5d                	pop    %r13
+    258f:	41 5e                	pop    %r14
+    2591:	41 5f                	pop    %r15
+    2593:	c3                   	ret
+    2594:	0f 1f 40 00          	nopl   0x0(%rax)
+        } else if ((strcmp(argv[index], "--baseline") == 0) && (index + 1 < argc)) {
+    2598:	48 8d 35 3a 5d 00 00 	lea    0x5d3a(%rip),%rsi        # 82d9 <_IO_stdin_used+0x2d9>
+    259f:	48 89 ef             	mov    %rbp,%rdi
+    25a2:	e8 39 fc ff ff       	call   21e0 <strcmp@plt>
+    25a7:	85 c0                	test   %eax,%eax
+    25a9:	75 15                	jne    25c0 <main+0x140>
+    25ab:	44 39 fb             	cmp    %r15d,%ebx
+    25ae:	7d 53                	jge    2603 <main+0x183>
+            baseline = argv[++index];
+    25b0:	89 d8                	mov    %ebx,%eax
+    25b2:	49 8b 04 c6          	mov    (%r14,%rax,8),%rax
+    25b6:	48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    25bb:	e9 2f ff ff ff       	jmp    24ef <main+0x6f>
+        } else if ((strcmp(argv[index], "--tolerance") == 0) && (index + 1 < argc)) {
+    25c0:	48 8d 35 1d 5d 00 00 	lea    0x5d1d(%rip),%rsi        # 82e4 <_IO_stdin_used+0x2e4>
+    25c7:	48 89 ef             	mov    %rbp,%rdi
+    25ca:	e8 11 fc ff ff       	call   21e0 <strcmp@plt>
+    25cf:	85 c0                	test   %eax,%eax
+    25d1:	75 30                	jne    2603 <main+0x183>
+    25d3:	44 39 fb             	cmp    %r15d,%ebx
+    25d6:	7d 2b                	jge    2603 <main+0x183>
+            tolerance = atof(argv[++index]);
+    25d8:	89 d8                	mov    %ebx,%eax
+
+#ifdef __USE_EXTERN_INLINES
+__extern_inline double
+__NTH (atof (const char *__nptr))
+{
+  return strtod (__nptr, (char **) NULL);
+    25da:	31 f6                	xor    %esi,%esi
+    25dc:	49 8b 3c c6          	mov    (%r14,%rax,8),%rdi
+    25e0:	e8 bb fa ff ff       	call   20a0 <strtod@plt>
+    25e5:	f2 0f 11 44 24 08    	movsd  %xmm0,0x8(%rsp)
+    25eb:	e9 ff fe ff ff       	jmp    24ef <main+0x6f>
+        } else if ((strcmp(argv[index], "--baseline") == 0) && (index + 1 < argc)) {
+    25f0:	48 8d 35 e2 5c 00 00 	lea    0x5ce2(%rip),%rsi        # 82d9 <_IO_stdin_used+0x2d9>
+    25f7:	48 89 ef             	mov    %rbp,%rdi
+    25fa:	e8 e1 fb ff ff       	call   21e0 <strcmp@plt>
+    25ff:	85 c0                	test   %eax,%eax
+    2601:	75 bd                	jne    25c0 <main+0x140>
+            fprintf(stderr, "usage: %s [--filter text] [--json results] [--baseline results]"
+    2603:	48 8b 05 d6 89 00 00 	mov    0x89d6(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    260a:	49 8b 16             	mov    (%r14),%rdx
+    260d:	48 8d 35 bc 60 00 00 	lea    0x60bc(%rip),%rsi        # 86d0 <_IO_stdin_used+0x6d0>
+    2614:	48 8b 38             	mov    (%rax),%rdi
+    2617:	31 c0                	xor    %eax,%eax
+    2619:	e8 f2 fb ff ff       	call   2210 <fprintf@plt>
+            return 2;
+    261e:	b8 02 00 00 00       	mov    $0x2,%eax
+    2623:	e9 5d ff ff ff       	jmp    2585 <main+0x105>
+    double tolerance = -1;
+    2628:	f2 0f 10 15 50 64 00 	movsd  0x6450(%rip),%xmm2        # 8a80 <data.2+0x40>
+    262f:	00 
+    char const * output = NULL;
+    2630:	31 c0                	xor    %eax,%eax
+    2632:	48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    char const * filter = NULL;
+    2637:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    263c:	48 89 04 24          	mov    %rax,(%rsp)
+    double tolerance = -1;
+    2640:	f2 0f 11 54 24 08    	movsd  %xmm2,0x8(%rsp)
+    2646:	e9 fa fe ff ff       	jmp    2545 <main+0xc5>
+    264b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002650 <_sub_I_65535_0.0>:
+    2650:	48 8d 3d 29 8c 00 00 	lea    0x8c29(%rip),%rdi        # b280 <mpsc_push_pop_case>
+    2657:	e8 04 fe ff ff       	call   2460 <BenchRegister>
+    265c:	48 8d 3d 3d 8c 00 00 	lea    0x8c3d(%rip),%rdi        # b2a0 <fifo_write_read_block_case>
+    2663:	e8 f8 fd ff ff       	call   2460 <BenchRegister>
+    2668:	48 8d 3d 51 8c 00 00 	lea    0x8c51(%rip),%rdi        # b2c0 <fifo_put_get_case>
+    266f:	e8 ec fd ff ff       	call   2460 <BenchRegister>
+    2674:	48 8d 3d 65 8c 00 00 	lea    0x8c65(%rip),%rdi        # b2e0 <tick_dispatch_case>
+    267b:	e8 e0 fd ff ff       	call   2460 <BenchRegister>
+    2680:	48 8d 3d 79 8c 00 00 	lea    0x8c79(%rip),%rdi        # b300 <sci_send_byte_case>
+    2687:	e8 d4 fd ff ff       	call   2460 <BenchRegister>
+    268c:	48 8d 3d 8d 8c 00 00 	lea    0x8c8d(%rip),%rdi        # b320 <gpio_get_state_case>
+    2693:	e8 c8 fd ff ff       	call   2460 <BenchRegister>
+    2698:	48 8d 3d a1 8c 00 00 	lea    0x8ca1(%rip),%rdi        # b340 <gpio_bit_toggle_case>
+    269f:	e8 bc fd ff ff       	call   2460 <BenchRegister>
+    26a4:	48 8d 3d b5 8c 00 00 	lea    0x8cb5(%rip),%rdi        # b360 <gpio_bit_set_case>
+    26ab:	e9 b0 fd ff ff       	jmp    2460 <BenchRegister>
+
+00000000000026b0 <_start>:
+    26b0:	31 ed                	xor    %ebp,%ebp
+    26b2:	49 89 d1             	mov    %rdx,%r9
+    26b5:	5e                   	pop    %rsi
+    26b6:	48 89 e2             	mov    %rsp,%rdx
+    26b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    26bd:	50                   	push   %rax
+    26be:	54                   	push   %rsp
+    26bf:	45 31 c0             	xor    %r8d,%r8d
+    26c2:	31 c9                	xor    %ecx,%ecx
+    26c4:	48 8d 3d b5 fd ff ff 	lea    -0x24b(%rip),%rdi        # 2480 <main>
+    26cb:	ff 15 df 88 00 00    	call   *0x88df(%rip)        # afb0 <__libc_start_main@GLIBC_2.34>
+    26d1:	f4                   	hlt
+    26d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    26d9:	00 00 00 
+    26dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000026e0 <deregister_tm_clones>:
+    26e0:	48 8d 3d d9 8e 00 00 	lea    0x8ed9(%rip),%rdi        # b5c0 <__TMC_END__>
+    26e7:	48 8d 05 d2 8e 00 00 	lea    0x8ed2(%rip),%rax        # b5c0 <__TMC_END__>
+    26ee:	48 39 f8             	cmp    %rdi,%rax
+    26f1:	74 15                	je     2708 <deregister_tm_clones+0x28>
+    26f3:	48 8b 05 be 88 00 00 	mov    0x88be(%rip),%rax        # afb8 <_ITM_deregisterTMCloneTable@Base>
+    26fa:	48 85 c0             	test   %rax,%rax
+    26fd:	74 09                	je     2708 <deregister_tm_clones+0x28>
+    26ff:	ff e0                	jmp    *%rax
+    2701:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2708:	c3                   	ret
+    2709:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002710 <register_tm_clones>:
+    2710:	48 8d 3d a9 8e 00 00 	lea    0x8ea9(%rip),%rdi        # b5c0 <__TMC_END__>
+    2717:	48 8d 35 a2 8e 00 00 	lea    0x8ea2(%rip),%rsi        # b5c0 <__TMC_END__>
+    271e:	48 29 fe             	sub    %rdi,%rsi
+    2721:	48 89 f0             	mov    %rsi,%rax
+    2724:	48 c1 ee 3f          	shr    $0x3f,%rsi
+    2728:	48 c1 f8 03          	sar    $0x3,%rax
+    272c:	48 01 c6             	add    %rax,%rsi
+    272f:	48 d1 fe             	sar    %rsi
+    2732:	74 14                	je     2748 <register_tm_clones+0x38>
+    2734:	48 8b 05 95 88 00 00 	mov    0x8895(%rip),%rax        # afd0 <_ITM_registerTMCloneTable@Base>
+    273b:	48 85 c0             	test   %rax,%rax
+    273e:	74 08                	je     2748 <register_tm_clones+0x38>
+    2740:	ff e0                	jmp    *%rax
+    2742:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2748:	c3                   	ret
+    2749:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002750 <__do_global_dtors_aux>:
+    2750:	f3 0f 1e fa          	endbr64
+    2754:	80 3d 65 8e 00 00 00 	cmpb   $0x0,0x8e65(%rip)        # b5c0 <__TMC_END__>
+    275b:	75 2b                	jne    2788 <__do_global_dtors_aux+0x38>
+    275d:	55                   	push   %rbp
+    275e:	48 83 3d 72 88 00 00 	cmpq   $0x0,0x8872(%rip)        # afd8 <__cxa_finalize@GLIBC_2.2.5>
+    2765:	00 
+    2766:	48 89 e5             	mov    %rsp,%rbp
+    2769:	74 0c                	je     2777 <__do_global_dtors_aux+0x27>
+    276b:	48 8b 3d d6 8a 00 00 	mov    0x8ad6(%rip),%rdi        # b248 <__dso_handle>
+    2772:	e8 d9 fc ff ff       	call   2450 <__cxa_finalize@plt>
+    2777:	e8 64 ff ff ff       	call   26e0 <deregister_tm_clones>
+    277c:	c6 05 3d 8e 00 00 01 	movb   $0x1,0x8e3d(%rip)        # b5c0 <__TMC_END__>
+    2783:	5d                   	pop    %rbp
+    2784:	c3                   	ret
+    2785:	0f 1f 00             	nopl   (%rax)
+    2788:	c3                   	ret
+    2789:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002790 <frame_dummy>:
+    2790:	f3 0f 1e fa          	endbr64
+    2794:	e9 77 ff ff ff       	jmp    2710 <register_tm_clones>
+    2799:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000027a0 <gpio_get_state_bench>:
+    27a0:	85 ff                	test   %edi,%edi
+    27a2:	74 3b                	je     27df <gpio_get_state_bench+0x3f>
+    27a4:	31 c0                	xor    %eax,%eax
+    27a6:	4c 8d 05 33 44 07 00 	lea    0x74433(%rip),%r8        # 76be0 <gpio_emulation>
+}
+
+bool GpioGetState(hal_gpio_bit_t gpio) {
+    bool result = false;
+    if (gpio) {
+        result = (gpio_emulation[gpio->gpio] & GPIO_MASK(gpio->bit)) != 0;
+    27ad:	be 01 00 00 00       	mov    $0x1,%esi
+    27b2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    27b8:	0f b6 0d 42 9f 00 00 	movzbl 0x9f42(%rip),%ecx        # c701 <__compound_literal.0.lto_priv.0>
+    27bf:	41 89 f1             	mov    %esi,%r9d
+    27c2:	48 89 ca             	mov    %rcx,%rdx
+    27c5:	c0 e9 03             	shr    $0x3,%cl
+    27c8:	83 e2 07             	and    $0x7,%edx
+    27cb:	41 d3 e1             	shl    %cl,%r9d
+    27ce:	41 8b 14 90          	mov    (%r8,%rdx,4),%edx
+    27d2:	41 85 d1             	test   %edx,%r9d
+    27d5:	0f 95 c2             	setne  %dl
+        GpioBitToggle(HAL_GPIO0_0);
+    }
+}
+
+BENCH(gpio, get_state) {
+    for (uint32_t index = 0; index < iterations; index++) {
+    27d8:	83 c0 01             	add    $0x1,%eax
+    27db:	39 c7                	cmp    %eax,%edi
+    27dd:	75 d9                	jne    27b8 <gpio_get_state_bench+0x18>
+        BENCH_KEEP(GpioGetState(HAL_GPIO0_0));
+    }
+}
+    27df:	c3                   	ret
+
+00000000000027e0 <BenchTickEvent>:
+    __atomic_fetch_add((uint32_t *)object, 1, __ATOMIC_RELAXED);
+    27e0:	f0 83 07 01          	lock addl $0x1,(%rdi)
+}
+    27e4:	c3                   	ret
+    27e5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    27ec:	00 00 00 00 
+
+00000000000027f0 <fifo_put_get_bench>:
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+BENCH(fifo, put_get) {
+    27f0:	41 89 f9             	mov    %edi,%r9d
+    uint8_t value;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+    27f3:	85 ff                	test   %edi,%edi
+    27f5:	74 65                	je     285c <fifo_put_get_bench+0x6c>
+    27f7:	31 d2                	xor    %edx,%edx
+    27f9:	4c 8d 15 40 8c 00 00 	lea    0x8c40(%rip),%r10        # b440 <bench_fifo>
+ * @param   value  Byte to write
+ * @return  true   The byte was written
+ * @return  false  The ring is full and the byte was discarded
+ */
+static inline bool FifoPut(fifo_t self, uint8_t value) {
+    uint32_t head = self->head;
+    2800:	8b 05 7a 8c 00 00    	mov    0x8c7a(%rip),%eax        # b480 <bench_fifo+0x40>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2806:	8b 3d b4 8c 00 00    	mov    0x8cb4(%rip),%edi        # b4c0 <bench_fifo+0x80>
+
+    if (head - FifoLoad(&self->tail) > self->mask) {
+    280c:	89 c6                	mov    %eax,%esi
+    280e:	8b 0d 34 8c 00 00    	mov    0x8c34(%rip),%ecx        # b448 <bench_fifo+0x8>
+    2814:	29 fe                	sub    %edi,%esi
+    2816:	39 f1                	cmp    %esi,%ecx
+    2818:	72 11                	jb     282b <fifo_put_get_bench+0x3b>
+        return false;
+    }
+    self->buffer[head & self->mask] = value;
+    281a:	49 8b 32             	mov    (%r10),%rsi
+    281d:	21 c1                	and    %eax,%ecx
+    FifoStore(&self->head, head + 1);
+    281f:	83 c0 01             	add    $0x1,%eax
+    self->buffer[head & self->mask] = value;
+    2822:	88 14 0e             	mov    %dl,(%rsi,%rcx,1)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2825:	89 05 55 8c 00 00    	mov    %eax,0x8c55(%rip)        # b480 <bench_fifo+0x40>
+ * @param   value  Pointer to store the byte read
+ * @return  true   The byte was read
+ * @return  false  The ring is empty
+ */
+static inline bool FifoGet(fifo_t self, uint8_t * value) {
+    uint32_t tail = self->tail;
+    282b:	8b 05 8f 8c 00 00    	mov    0x8c8f(%rip),%eax        # b4c0 <bench_fifo+0x80>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2831:	8b 0d 49 8c 00 00    	mov    0x8c49(%rip),%ecx        # b480 <bench_fifo+0x40>
+
+    if (FifoLoad(&self->head) == tail) {
+    2837:	39 c8                	cmp    %ecx,%eax
+    2839:	74 19                	je     2854 <fifo_put_get_bench+0x64>
+        return false;
+    }
+    *value = self->buffer[tail & self->mask];
+    283b:	49 8b 32             	mov    (%r10),%rsi
+    283e:	89 c1                	mov    %eax,%ecx
+    FifoStore(&self->tail, tail + 1);
+    2840:	83 c0 01             	add    $0x1,%eax
+    *value = self->buffer[tail & self->mask];
+    2843:	23 0d ff 8b 00 00    	and    0x8bff(%rip),%ecx        # b448 <bench_fifo+0x8>
+    2849:	44 0f b6 04 0e       	movzbl (%rsi,%rcx,1),%r8d
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    284e:	89 05 6c 8c 00 00    	mov    %eax,0x8c6c(%rip)        # b4c0 <bench_fifo+0x80>
+    2854:	83 c2 01             	add    $0x1,%edx
+    2857:	41 39 d1             	cmp    %edx,%r9d
+    285a:	75 a4                	jne    2800 <fifo_put_get_bench+0x10>
+        FifoPut(bench_fifo, (uint8_t)index);
+        FifoGet(bench_fifo, &value);
+        BENCH_KEEP(value);
+    }
+}
+    285c:	c3                   	ret
+    285d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002860 <LatencyFind>:
+//! Amount of entries allocated
+static volatile uint32_t allocated = 0;
+
+/* === Private function implementation ========================================================= */
+
+static latency_vector_t LatencyFind(uint16_t source) {
+    2860:	41 89 f8             	mov    %edi,%r8d
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2863:	8b 3d d7 fc 00 00    	mov    0xfcd7(%rip),%edi        # 12540 <allocated>
+    static volatile uint32_t const released = 0;
+    uint32_t count = FifoLoad(&allocated);
+    uint32_t index;
+
+    for (index = 0; index < count; index++) {
+    2869:	85 ff                	test   %edi,%edi
+    286b:	74 43                	je     28b0 <LatencyFind+0x50>
+        if (vectors[index].key == source + 1) {
+    286d:	41 0f b7 f0          	movzwl %r8w,%esi
+    2871:	48 8d 15 5c f7 00 00 	lea    0xf75c(%rip),%rdx        # 11fd4 <vectors+0xb4>
+    for (index = 0; index < count; index++) {
+    2878:	31 c0                	xor    %eax,%eax
+        if (vectors[index].key == source + 1) {
+    287a:	83 c6 01             	add    $0x1,%esi
+    287d:	eb 0f                	jmp    288e <LatencyFind+0x2e>
+    287f:	90                   	nop
+    for (index = 0; index < count; index++) {
+    2880:	83 c0 01             	add    $0x1,%eax
+    2883:	48 81 c2 c4 00 00 00 	add    $0xc4,%rdx
+    288a:	39 f8                	cmp    %edi,%eax
+    288c:	74 22                	je     28b0 <LatencyFind+0x50>
+        if (vectors[index].key == source + 1) {
+    288e:	0f b7 0a             	movzwl (%rdx),%ecx
+    2891:	39 f1                	cmp    %esi,%ecx
+    2893:	75 eb                	jne    2880 <LatencyFind+0x20>
+            return &vectors[index];
+    2895:	48 69 c0 c4 00 00 00 	imul   $0xc4,%rax,%rax
+    289c:	48 8d 15 7d f6 00 00 	lea    0xf67d(%rip),%rdx        # 11f20 <vectors>
+    28a3:	48 01 d0             	add    %rdx,%rax
+    28a6:	c3                   	ret
+    28a7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    28ae:	00 00 
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    28b0:	8b 05 8a fc 00 00    	mov    0xfc8a(%rip),%eax        # 12540 <allocated>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    28b6:	8b 35 94 89 00 00    	mov    0x8994(%rip),%esi        # b250 <released.0>
+        if (index + count - FifoLoad(tail) > capacity) {
+    28bc:	8d 50 01             	lea    0x1(%rax),%edx
+    28bf:	89 d1                	mov    %edx,%ecx
+    28c1:	29 f1                	sub    %esi,%ecx
+    28c3:	83 f9 08             	cmp    $0x8,%ecx
+    28c6:	77 35                	ja     28fd <LatencyFind+0x9d>
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+    28c8:	f0 0f b1 15 70 fc 00 	lock cmpxchg %edx,0xfc70(%rip)        # 12540 <allocated>
+    28cf:	00 
+    28d0:	75 e4                	jne    28b6 <LatencyFind+0x56>
+     * The entries are never released, so they are reserved as the elements of a queue that is
+     * never read and the counter doesn't grow when the table is full */
+    if (!FifoReserve(&allocated, &released, LATENCY_VECTORS, 1, &index)) {
+        return NULL;
+    }
+    vectors[index].stats.source = source;
+    28d2:	89 c0                	mov    %eax,%eax
+    28d4:	48 69 d0 c4 00 00 00 	imul   $0xc4,%rax,%rdx
+    28db:	48 8d 05 3e f6 00 00 	lea    0xf63e(%rip),%rax        # 11f20 <vectors>
+    28e2:	48 01 d0             	add    %rdx,%rax
+    28e5:	66 44 89 00          	mov    %r8w,(%rax)
+    vectors[index].stats.latency_min = UINT32_MAX;
+    vectors[index].key = source + 1;
+    28e9:	41 83 c0 01          	add    $0x1,%r8d
+    vectors[index].stats.latency_min = UINT32_MAX;
+    28ed:	c7 40 08 ff ff ff ff 	movl   $0xffffffff,0x8(%rax)
+    vectors[index].key = source + 1;
+    28f4:	66 44 89 80 b4 00 00 	mov    %r8w,0xb4(%rax)
+    28fb:	00 
+    return &vectors[index];
+}
+    28fc:	c3                   	ret
+        return NULL;
+    28fd:	31 c0                	xor    %eax,%eax
+    28ff:	c3                   	ret
+
+0000000000002900 <VcdBegin>:
+    vcd_start = VcdClock();
+    vcd_flushed = vcd_start;
+    atexit(VcdFlush);
+}
+
+static char * VcdBegin(void) {
+    2900:	55                   	push   %rbp
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    2901:	bf 01 00 00 00       	mov    $0x1,%edi
+static char * VcdBegin(void) {
+    2906:	53                   	push   %rbx
+    2907:	48 83 ec 18          	sub    $0x18,%rsp
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    290b:	48 89 e6             	mov    %rsp,%rsi
+    290e:	e8 bd f7 ff ff       	call   20d0 <clock_gettime@plt>
+    uint64_t now = VcdClock() - vcd_start;
+
+    pthread_mutex_lock(&vcd_lock);
+    2913:	48 8d 3d 26 fe 04 00 	lea    0x4fe26(%rip),%rdi        # 52740 <vcd_lock>
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    291a:	48 69 1c 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rbx
+    2921:	3b 
+    uint64_t now = VcdClock() - vcd_start;
+    2922:	48 03 5c 24 08       	add    0x8(%rsp),%rbx
+    2927:	48 2b 1d 42 fe 04 00 	sub    0x4fe42(%rip),%rbx        # 52770 <vcd_start>
+    pthread_mutex_lock(&vcd_lock);
+    292e:	e8 ed fa ff ff       	call   2420 <pthread_mutex_lock@plt>
+    if (now > vcd_last) {
+    2933:	48 39 1d ee fd 04 00 	cmp    %rbx,0x4fdee(%rip)        # 52728 <vcd_last>
+    293a:	72 1c                	jb     2958 <VcdBegin+0x58>
+        vcd_last = now;
+        vcd_used += sprintf(&vcd_buffer[vcd_used], "#%llu\n", (unsigned long long)now);
+    }
+    return &vcd_buffer[vcd_used];
+    293c:	48 8b 05 dd fd 04 00 	mov    0x4fddd(%rip),%rax        # 52720 <vcd_used>
+    2943:	48 8d 2d d6 fd 00 00 	lea    0xfdd6(%rip),%rbp        # 12720 <vcd_buffer>
+}
+    294a:	48 83 c4 18          	add    $0x18,%rsp
+    294e:	5b                   	pop    %rbx
+    return &vcd_buffer[vcd_used];
+    294f:	48 01 e8             	add    %rbp,%rax
+}
+    2952:	5d                   	pop    %rbp
+    2953:	c3                   	ret
+    2954:	0f 1f 40 00          	nopl   0x0(%rax)
+        vcd_used += sprintf(&vcd_buffer[vcd_used], "#%llu\n", (unsigned long long)now);
+    2958:	48 8b 3d c1 fd 04 00 	mov    0x4fdc1(%rip),%rdi        # 52720 <vcd_used>
+    295f:	48 8d 2d ba fd 00 00 	lea    0xfdba(%rip),%rbp        # 12720 <vcd_buffer>
+    2966:	48 89 da             	mov    %rbx,%rdx
+    2969:	31 c0                	xor    %eax,%eax
+    296b:	48 8d 35 92 56 00 00 	lea    0x5692(%rip),%rsi        # 8004 <_IO_stdin_used+0x4>
+        vcd_last = now;
+    2972:	48 89 1d af fd 04 00 	mov    %rbx,0x4fdaf(%rip)        # 52728 <vcd_last>
+        vcd_used += sprintf(&vcd_buffer[vcd_used], "#%llu\n", (unsigned long long)now);
+    2979:	48 01 ef             	add    %rbp,%rdi
+    297c:	e8 ff f9 ff ff       	call   2380 <sprintf@plt>
+    2981:	48 98                	cltq
+    2983:	48 03 05 96 fd 04 00 	add    0x4fd96(%rip),%rax        # 52720 <vcd_used>
+    298a:	48 89 05 8f fd 04 00 	mov    %rax,0x4fd8f(%rip)        # 52720 <vcd_used>
+}
+    2991:	48 83 c4 18          	add    $0x18,%rsp
+    return &vcd_buffer[vcd_used];
+    2995:	48 01 e8             	add    %rbp,%rax
+}
+    2998:	5b                   	pop    %rbx
+    2999:	5d                   	pop    %rbp
+    299a:	c3                   	ret
+    299b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000029a0 <TraceEvent.part.0>:
+
+void TraceStop(void) {
+    trace_enabled = false;
+}
+
+void TraceEvent(uint8_t type, uint32_t data) {
+    29a0:	55                   	push   %rbp
+    29a1:	89 f5                	mov    %esi,%ebp
+    29a3:	53                   	push   %rbx
+    29a4:	89 fb                	mov    %edi,%ebx
+    uint32_t result;
+    __asm volatile("csrr %0, mcycle" : "=r"(result));
+    return result;
+#elif defined(X86)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    29a6:	bf 01 00 00 00       	mov    $0x1,%edi
+    if (trace_enabled) {
+        uint32_t const words[TRACE_EVENT_WORDS] = {
+            CyclesRead(),
+            ((uint32_t)type << 24) | (data & 0x00FFFFFF),
+    29ab:	81 e5 ff ff ff 00    	and    $0xffffff,%ebp
+    29b1:	c1 e3 18             	shl    $0x18,%ebx
+    29b4:	09 eb                	or     %ebp,%ebx
+void TraceEvent(uint8_t type, uint32_t data) {
+    29b6:	48 83 ec 18          	sub    $0x18,%rsp
+    29ba:	48 89 e6             	mov    %rsp,%rsi
+    29bd:	e8 0e f7 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    29c2:	48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    29c7:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    29ce:	9b c4 20 
+    29d1:	69 34 24 40 42 0f 00 	imul   $0xf4240,(%rsp),%esi
+    29d8:	48 f7 e9             	imul   %rcx
+ * @return  true    The values were written
+ * @return  false   The queue doesn't have enough space and the values were discarded
+ */
+static inline bool MpscWrite(mpsc_t self, uint32_t const * values, uint32_t count,
+                             uint32_t * first) {
+    if (!FifoReserve(&self->head, &self->tail, self->mask + 1, count, first)) {
+    29db:	8b 05 27 8b 00 00    	mov    0x8b27(%rip),%eax        # b508 <trace_queue+0x8>
+    29e1:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    29e5:	48 c1 fa 07          	sar    $0x7,%rdx
+    29e9:	48 29 ca             	sub    %rcx,%rdx
+    29ec:	44 8d 04 16          	lea    (%rsi,%rdx,1),%r8d
+    29f0:	8d 50 01             	lea    0x1(%rax),%edx
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    29f3:	8b 05 47 8b 00 00    	mov    0x8b47(%rip),%eax        # b540 <trace_queue+0x40>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    29f9:	8b 3d 81 8b 00 00    	mov    0x8b81(%rip),%edi        # b580 <trace_queue+0x80>
+        if (index + count - FifoLoad(tail) > capacity) {
+    29ff:	8d 48 02             	lea    0x2(%rax),%ecx
+    2a02:	89 ce                	mov    %ecx,%esi
+    2a04:	29 fe                	sub    %edi,%esi
+    2a06:	39 f2                	cmp    %esi,%edx
+    2a08:	72 46                	jb     2a50 <TraceEvent.part.0+0xb0>
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+    2a0a:	f0 0f b1 0d 2e 8b 00 	lock cmpxchg %ecx,0x8b2e(%rip)        # b540 <trace_queue+0x40>
+    2a11:	00 
+    2a12:	75 e5                	jne    29f9 <TraceEvent.part.0+0x59>
+        FifoAtomicAdd(&self->dropped, count);
+        return false;
+    }
+    for (uint32_t index = 0; index < count; index++) {
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    2a14:	48 8b 15 e5 8a 00 00 	mov    0x8ae5(%rip),%rdx        # b500 <trace_queue>
+    2a1b:	89 c1                	mov    %eax,%ecx
+    2a1d:	23 0d e5 8a 00 00    	and    0x8ae5(%rip),%ecx        # b508 <trace_queue+0x8>
+    2a23:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+        cell->value = values[index];
+        FifoStore(&cell->sequence, *first + index + 1);
+    2a27:	8d 50 01             	lea    0x1(%rax),%edx
+    2a2a:	83 c0 02             	add    $0x2,%eax
+        cell->value = values[index];
+    2a2d:	44 89 41 04          	mov    %r8d,0x4(%rcx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2a31:	89 11                	mov    %edx,(%rcx)
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    2a33:	48 8b 0d c6 8a 00 00 	mov    0x8ac6(%rip),%rcx        # b500 <trace_queue>
+    2a3a:	23 15 c8 8a 00 00    	and    0x8ac8(%rip),%edx        # b508 <trace_queue+0x8>
+    2a40:	48 8d 14 d1          	lea    (%rcx,%rdx,8),%rdx
+        cell->value = values[index];
+    2a44:	89 5a 04             	mov    %ebx,0x4(%rdx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2a47:	89 02                	mov    %eax,(%rdx)
+        };
+        MpscPushBatch(trace_queue, words, TRACE_EVENT_WORDS);
+    }
+}
+    2a49:	48 83 c4 18          	add    $0x18,%rsp
+    2a4d:	5b                   	pop    %rbx
+    2a4e:	5d                   	pop    %rbp
+    2a4f:	c3                   	ret
+    return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+    2a50:	f0 83 05 ec 8a 00 00 	lock addl $0x2,0x8aec(%rip)        # b544 <trace_queue+0x44>
+    2a57:	02 
+    2a58:	48 83 c4 18          	add    $0x18,%rsp
+    2a5c:	5b                   	pop    %rbx
+    2a5d:	5d                   	pop    %rbp
+    2a5e:	c3                   	ret
+    2a5f:	90                   	nop
+
+0000000000002a60 <mpsc_push_pop_bench>:
+        FifoRead(bench_fifo, block, sizeof(block));
+        BENCH_KEEP(block[0]);
+    }
+}
+
+BENCH(mpsc, push_pop) {
+    2a60:	41 89 fa             	mov    %edi,%r10d
+    uint32_t value;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+    2a63:	45 31 c9             	xor    %r9d,%r9d
+    2a66:	48 8d 3d 13 89 00 00 	lea    0x8913(%rip),%rdi        # b380 <bench_mpsc>
+    2a6d:	45 85 d2             	test   %r10d,%r10d
+    2a70:	75 21                	jne    2a93 <mpsc_push_pop_bench+0x33>
+    2a72:	e9 8c 00 00 00       	jmp    2b03 <mpsc_push_pop_bench+0xa3>
+    2a77:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2a7e:	00 00 
+    for (index = 0; index < count; index++) {
+        struct mpsc_cell_s * cell = &self->cells[(tail + index) & self->mask];
+        if (FifoLoad(&cell->sequence) != tail + index + 1) {
+            break;
+        }
+        values[index] = cell->value;
+    2a80:	44 8b 42 04          	mov    0x4(%rdx),%r8d
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2a84:	89 0d 76 89 00 00    	mov    %ecx,0x8976(%rip)        # b400 <bench_mpsc+0x80>
+    2a8a:	41 83 c1 01          	add    $0x1,%r9d
+    2a8e:	45 39 ca             	cmp    %r9d,%r10d
+    2a91:	74 75                	je     2b08 <mpsc_push_pop_bench+0xa8>
+    if (!FifoReserve(&self->head, &self->tail, self->mask + 1, count, first)) {
+    2a93:	8b 05 ef 88 00 00    	mov    0x88ef(%rip),%eax        # b388 <bench_mpsc+0x8>
+    2a99:	8d 50 01             	lea    0x1(%rax),%edx
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    2a9c:	8b 05 1e 89 00 00    	mov    0x891e(%rip),%eax        # b3c0 <bench_mpsc+0x40>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2aa2:	44 8b 1d 57 89 00 00 	mov    0x8957(%rip),%r11d        # b400 <bench_mpsc+0x80>
+        if (index + count - FifoLoad(tail) > capacity) {
+    2aa9:	8d 48 01             	lea    0x1(%rax),%ecx
+    2aac:	89 ce                	mov    %ecx,%esi
+    2aae:	44 29 de             	sub    %r11d,%esi
+    2ab1:	39 f2                	cmp    %esi,%edx
+    2ab3:	72 44                	jb     2af9 <mpsc_push_pop_bench+0x99>
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+    2ab5:	f0 0f b1 0d 03 89 00 	lock cmpxchg %ecx,0x8903(%rip)        # b3c0 <bench_mpsc+0x40>
+    2abc:	00 
+    2abd:	75 e3                	jne    2aa2 <mpsc_push_pop_bench+0x42>
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    2abf:	48 8b 17             	mov    (%rdi),%rdx
+    2ac2:	89 c1                	mov    %eax,%ecx
+    2ac4:	23 0d be 88 00 00    	and    0x88be(%rip),%ecx        # b388 <bench_mpsc+0x8>
+        FifoStore(&cell->sequence, *first + index + 1);
+    2aca:	83 c0 01             	add    $0x1,%eax
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    2acd:	48 8d 14 ca          	lea    (%rdx,%rcx,8),%rdx
+        cell->value = values[index];
+    2ad1:	44 89 4a 04          	mov    %r9d,0x4(%rdx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2ad5:	89 02                	mov    %eax,(%rdx)
+    uint32_t tail = self->tail;
+    2ad7:	8b 05 23 89 00 00    	mov    0x8923(%rip),%eax        # b400 <bench_mpsc+0x80>
+        struct mpsc_cell_s * cell = &self->cells[(tail + index) & self->mask];
+    2add:	48 8b 17             	mov    (%rdi),%rdx
+    2ae0:	89 c1                	mov    %eax,%ecx
+    2ae2:	23 0d a0 88 00 00    	and    0x88a0(%rip),%ecx        # b388 <bench_mpsc+0x8>
+    2ae8:	48 8d 14 ca          	lea    (%rdx,%rcx,8),%rdx
+        if (FifoLoad(&cell->sequence) != tail + index + 1) {
+    2aec:	8d 48 01             	lea    0x1(%rax),%ecx
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2aef:	8b 32                	mov    (%rdx),%esi
+        if (FifoLoad(&cell->sequence) != tail + index + 1) {
+    2af1:	39 ce                	cmp    %ecx,%esi
+    2af3:	74 8b                	je     2a80 <mpsc_push_pop_bench+0x20>
+    2af5:	89 c1                	mov    %eax,%ecx
+    2af7:	eb 8b                	jmp    2a84 <mpsc_push_pop_bench+0x24>
+    return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+    2af9:	f0 83 05 c3 88 00 00 	lock addl $0x1,0x88c3(%rip)        # b3c4 <bench_mpsc+0x44>
+    2b00:	01 
+        return false;
+    2b01:	eb d4                	jmp    2ad7 <mpsc_push_pop_bench+0x77>
+        MpscPush(bench_mpsc, index);
+        MpscPop(bench_mpsc, &value);
+        BENCH_KEEP(value);
+    }
+}
+    2b03:	c3                   	ret
+    2b04:	0f 1f 40 00          	nopl   0x0(%rax)
+    2b08:	c3                   	ret
+    2b09:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002b10 <fifo_write_read_block_bench>:
+BENCH(fifo, write_read_block) {
+    2b10:	41 57                	push   %r15
+    uint8_t block[32] = {0};
+    2b12:	66 0f ef c0          	pxor   %xmm0,%xmm0
+BENCH(fifo, write_read_block) {
+    2b16:	41 56                	push   %r14
+    2b18:	41 55                	push   %r13
+    2b1a:	41 54                	push   %r12
+    2b1c:	55                   	push   %rbp
+    2b1d:	53                   	push   %rbx
+    2b1e:	48 83 ec 28          	sub    $0x28,%rsp
+    uint8_t block[32] = {0};
+    2b22:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    2b26:	0f 29 44 24 10       	movaps %xmm0,0x10(%rsp)
+    for (uint32_t index = 0; index < iterations; index++) {
+    2b2b:	85 ff                	test   %edi,%edi
+    2b2d:	0f 84 3f 01 00 00    	je     2c72 <fifo_write_read_block_bench+0x162>
+    2b33:	89 fd                	mov    %edi,%ebp
+    2b35:	31 db                	xor    %ebx,%ebx
+    2b37:	4c 8d 3d 02 89 00 00 	lea    0x8902(%rip),%r15        # b440 <bench_fifo>
+    2b3e:	49 89 e5             	mov    %rsp,%r13
+    2b41:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    uint32_t head = self->head;
+    2b48:	44 8b 35 31 89 00 00 	mov    0x8931(%rip),%r14d        # b480 <bench_fifo+0x40>
+    uint32_t space = self->mask + 1 - (head - FifoLoad(&self->tail));
+    2b4f:	8b 0d f3 88 00 00    	mov    0x88f3(%rip),%ecx        # b448 <bench_fifo+0x8>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2b55:	8b 35 65 89 00 00    	mov    0x8965(%rip),%esi        # b4c0 <bench_fifo+0x80>
+    uint32_t space = self->mask + 1 - (head - FifoLoad(&self->tail));
+    2b5b:	44 29 f1             	sub    %r14d,%ecx
+    uint32_t offset = head & self->mask;
+    2b5e:	44 89 f0             	mov    %r14d,%eax
+    uint32_t space = self->mask + 1 - (head - FifoLoad(&self->tail));
+    2b61:	44 8d 64 31 01       	lea    0x1(%rcx,%rsi,1),%r12d
+    2b66:	b9 20 00 00 00       	mov    $0x20,%ecx
+    uint32_t offset = head & self->mask;
+    2b6b:	8b 15 d7 88 00 00    	mov    0x88d7(%rip),%edx        # b448 <bench_fifo+0x8>
+    2b71:	21 d0                	and    %edx,%eax
+    2b73:	41 39 cc             	cmp    %ecx,%r12d
+    2b76:	44 0f 47 e1          	cmova  %ecx,%r12d
+    first = self->mask + 1 - offset;
+    2b7a:	83 c2 01             	add    $0x1,%edx
+    2b7d:	29 c2                	sub    %eax,%edx
+    2b7f:	44 39 e2             	cmp    %r12d,%edx
+    2b82:	41 0f 47 d4          	cmova  %r12d,%edx
+    memcpy(&self->buffer[offset], data, first);
+    2b86:	49 03 07             	add    (%r15),%rax
+    2b89:	89 d6                	mov    %edx,%esi
+    2b8b:	83 fa 08             	cmp    $0x8,%edx
+    2b8e:	0f 83 f4 00 00 00    	jae    2c88 <fifo_write_read_block_bench+0x178>
+    2b94:	f6 c2 04             	test   $0x4,%dl
+    2b97:	0f 85 6b 01 00 00    	jne    2d08 <fifo_write_read_block_bench+0x1f8>
+    2b9d:	85 d2                	test   %edx,%edx
+    2b9f:	74 10                	je     2bb1 <fifo_write_read_block_bench+0xa1>
+    2ba1:	41 0f b6 4d 00       	movzbl 0x0(%r13),%ecx
+    2ba6:	88 08                	mov    %cl,(%rax)
+    2ba8:	f6 c2 02             	test   $0x2,%dl
+    2bab:	0f 85 6f 01 00 00    	jne    2d20 <fifo_write_read_block_bench+0x210>
+    memcpy(self->buffer, (uint8_t const *)data + first, size - first);
+    2bb1:	44 89 e0             	mov    %r12d,%eax
+    2bb4:	49 8b 3f             	mov    (%r15),%rdi
+    FifoStore(&self->head, head + size);
+    2bb7:	45 01 e6             	add    %r12d,%r14d
+    memcpy(self->buffer, (uint8_t const *)data + first, size - first);
+    2bba:	4c 01 ee             	add    %r13,%rsi
+    2bbd:	29 d0                	sub    %edx,%eax
+    2bbf:	48 89 c2             	mov    %rax,%rdx
+    2bc2:	e8 89 f6 ff ff       	call   2250 <memcpy@plt>
+    2bc7:	ba 20 00 00 00       	mov    $0x20,%edx
+    memcpy(data, &self->buffer[offset], first);
+    2bcc:	4d 89 e8             	mov    %r13,%r8
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2bcf:	44 89 35 aa 88 00 00 	mov    %r14d,0x88aa(%rip)        # b480 <bench_fifo+0x40>
+    uint32_t tail = self->tail;
+    2bd6:	44 8b 35 e3 88 00 00 	mov    0x88e3(%rip),%r14d        # b4c0 <bench_fifo+0x80>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    2bdd:	44 8b 25 9c 88 00 00 	mov    0x889c(%rip),%r12d        # b480 <bench_fifo+0x40>
+    uint32_t offset = tail & self->mask;
+    2be4:	44 89 f1             	mov    %r14d,%ecx
+    uint32_t count = FifoLoad(&self->head) - tail;
+    2be7:	45 29 f4             	sub    %r14d,%r12d
+    uint32_t offset = tail & self->mask;
+    2bea:	8b 05 58 88 00 00    	mov    0x8858(%rip),%eax        # b448 <bench_fifo+0x8>
+    memcpy(data, &self->buffer[offset], first);
+    2bf0:	49 8b 37             	mov    (%r15),%rsi
+    uint32_t offset = tail & self->mask;
+    2bf3:	21 c1                	and    %eax,%ecx
+    2bf5:	41 39 d4             	cmp    %edx,%r12d
+    2bf8:	44 0f 47 e2          	cmova  %edx,%r12d
+    first = self->mask + 1 - offset;
+    2bfc:	83 c0 01             	add    $0x1,%eax
+    2bff:	29 c8                	sub    %ecx,%eax
+    2c01:	44 39 e0             	cmp    %r12d,%eax
+    2c04:	41 0f 47 c4          	cmova  %r12d,%eax
+    memcpy(data, &self->buffer[offset], first);
+    2c08:	48 01 f1             	add    %rsi,%rcx
+    2c0b:	89 c7                	mov    %eax,%edi
+    2c0d:	48 89 c8             	mov    %rcx,%rax
+    2c10:	48 89 fa             	mov    %rdi,%rdx
+    2c13:	83 ff 08             	cmp    $0x8,%edi
+    2c16:	0f 83 bc 00 00 00    	jae    2cd8 <fifo_write_read_block_bench+0x1c8>
+    2c1c:	31 c9                	xor    %ecx,%ecx
+    2c1e:	f6 c2 04             	test   $0x4,%dl
+    2c21:	74 0a                	je     2c2d <fifo_write_read_block_bench+0x11d>
+    2c23:	8b 08                	mov    (%rax),%ecx
+    2c25:	41 89 08             	mov    %ecx,(%r8)
+    2c28:	b9 04 00 00 00       	mov    $0x4,%ecx
+    2c2d:	f6 c2 02             	test   $0x2,%dl
+    2c30:	74 0e                	je     2c40 <fifo_write_read_block_bench+0x130>
+    2c32:	44 0f b7 0c 08       	movzwl (%rax,%rcx,1),%r9d
+    2c37:	66 45 89 0c 08       	mov    %r9w,(%r8,%rcx,1)
+    2c3c:	48 83 c1 02          	add    $0x2,%rcx
+    2c40:	f6 c2 01             	test   $0x1,%dl
+    2c43:	74 08                	je     2c4d <fifo_write_read_block_bench+0x13d>
+    2c45:	0f b6 04 08          	movzbl (%rax,%rcx,1),%eax
+    2c49:	41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    memcpy((uint8_t *)data + first, self->buffer, size - first);
+    2c4d:	44 89 e0             	mov    %r12d,%eax
+    2c50:	4c 01 ef             	add    %r13,%rdi
+    FifoStore(&self->tail, tail + size);
+    2c53:	45 01 e6             	add    %r12d,%r14d
+    memcpy((uint8_t *)data + first, self->buffer, size - first);
+    2c56:	29 d0                	sub    %edx,%eax
+    2c58:	48 89 c2             	mov    %rax,%rdx
+    2c5b:	e8 f0 f5 ff ff       	call   2250 <memcpy@plt>
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    2c60:	44 89 35 59 88 00 00 	mov    %r14d,0x8859(%rip)        # b4c0 <bench_fifo+0x80>
+    2c67:	83 c3 01             	add    $0x1,%ebx
+    2c6a:	39 dd                	cmp    %ebx,%ebp
+    2c6c:	0f 85 d6 fe ff ff    	jne    2b48 <fifo_write_read_block_bench+0x38>
+}
+    2c72:	48 83 c4 28          	add    $0x28,%rsp
+    2c76:	5b                   	pop    %rbx
+    2c77:	5d                   	pop    %rbp
+    2c78:	41 5c                	pop    %r12
+    2c7a:	41 5d                	pop    %r13
+    2c7c:	41 5e                	pop    %r14
+    2c7e:	41 5f                	pop    %r15
+    2c80:	c3                   	ret
+    2c81:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    memcpy(&self->buffer[offset], data, first);
+    2c88:	49 8b 4d 00          	mov    0x0(%r13),%rcx
+    2c8c:	4c 8d 40 08          	lea    0x8(%rax),%r8
+    2c90:	4d 89 e9             	mov    %r13,%r9
+    2c93:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    2c97:	48 89 08             	mov    %rcx,(%rax)
+    2c9a:	49 8b 4c 35 f8       	mov    -0x8(%r13,%rsi,1),%rcx
+    2c9f:	48 89 4c 30 f8       	mov    %rcx,-0x8(%rax,%rsi,1)
+    2ca4:	4c 29 c0             	sub    %r8,%rax
+    2ca7:	49 29 c1             	sub    %rax,%r9
+    2caa:	01 d0                	add    %edx,%eax
+    2cac:	83 e0 f8             	and    $0xfffffff8,%eax
+    2caf:	83 f8 08             	cmp    $0x8,%eax
+    2cb2:	0f 82 f9 fe ff ff    	jb     2bb1 <fifo_write_read_block_bench+0xa1>
+    2cb8:	83 e0 f8             	and    $0xfffffff8,%eax
+    2cbb:	31 c9                	xor    %ecx,%ecx
+    2cbd:	89 cf                	mov    %ecx,%edi
+    2cbf:	83 c1 08             	add    $0x8,%ecx
+    2cc2:	4d 8b 14 39          	mov    (%r9,%rdi,1),%r10
+    2cc6:	4d 89 14 38          	mov    %r10,(%r8,%rdi,1)
+    2cca:	39 c1                	cmp    %eax,%ecx
+    2ccc:	72 ef                	jb     2cbd <fifo_write_read_block_bench+0x1ad>
+    2cce:	e9 de fe ff ff       	jmp    2bb1 <fifo_write_read_block_bench+0xa1>
+    2cd3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    memcpy(data, &self->buffer[offset], first);
+    2cd8:	41 89 fa             	mov    %edi,%r10d
+    2cdb:	31 c0                	xor    %eax,%eax
+    2cdd:	41 83 e2 f8          	and    $0xfffffff8,%r10d
+    2ce1:	41 89 c0             	mov    %eax,%r8d
+    2ce4:	83 c0 08             	add    $0x8,%eax
+    2ce7:	4e 8b 0c 01          	mov    (%rcx,%r8,1),%r9
+    2ceb:	4f 89 4c 05 00       	mov    %r9,0x0(%r13,%r8,1)
+    2cf0:	44 39 d0             	cmp    %r10d,%eax
+    2cf3:	72 ec                	jb     2ce1 <fifo_write_read_block_bench+0x1d1>
+    2cf5:	4d 8d 44 05 00       	lea    0x0(%r13,%rax,1),%r8
+    2cfa:	48 01 c8             	add    %rcx,%rax
+    2cfd:	e9 1a ff ff ff       	jmp    2c1c <fifo_write_read_block_bench+0x10c>
+    2d02:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    memcpy(&self->buffer[offset], data, first);
+    2d08:	41 8b 4d 00          	mov    0x0(%r13),%ecx
+    2d0c:	89 08                	mov    %ecx,(%rax)
+    2d0e:	41 8b 4c 35 fc       	mov    -0x4(%r13,%rsi,1),%ecx
+    2d13:	89 4c 30 fc          	mov    %ecx,-0x4(%rax,%rsi,1)
+    2d17:	e9 95 fe ff ff       	jmp    2bb1 <fifo_write_read_block_bench+0xa1>
+    2d1c:	0f 1f 40 00          	nopl   0x0(%rax)
+    2d20:	41 0f b7 4c 35 fe    	movzwl -0x2(%r13,%rsi,1),%ecx
+    2d26:	66 89 4c 30 fe       	mov    %cx,-0x2(%rax,%rsi,1)
+    2d2b:	e9 81 fe ff ff       	jmp    2bb1 <fifo_write_read_block_bench+0xa1>
+
+0000000000002d30 <VcdOpen>:
+static void VcdOpen(void) {
+    2d30:	41 57                	push   %r15
+    char const * name = getenv(VCD_ENVIRONMENT);
+    2d32:	48 8d 3d d2 52 00 00 	lea    0x52d2(%rip),%rdi        # 800b <_IO_stdin_used+0xb>
+static void VcdOpen(void) {
+    2d39:	41 56                	push   %r14
+    2d3b:	41 55                	push   %r13
+    2d3d:	41 54                	push   %r12
+    2d3f:	55                   	push   %rbp
+    2d40:	53                   	push   %rbx
+    2d41:	48 83 ec 28          	sub    $0x28,%rsp
+    char const * name = getenv(VCD_ENVIRONMENT);
+    2d45:	e8 e6 f2 ff ff       	call   2030 <getenv@plt>
+    if (name == NULL) {
+    2d4a:	48 85 c0             	test   %rax,%rax
+    2d4d:	0f 84 36 02 00 00    	je     2f89 <VcdOpen+0x259>
+    2d53:	48 89 c7             	mov    %rax,%rdi
+    vcd_file = fopen(name, "w");
+    2d56:	48 8d 35 b7 52 00 00 	lea    0x52b7(%rip),%rsi        # 8014 <_IO_stdin_used+0x14>
+    2d5d:	e8 be f5 ff ff       	call   2320 <fopen@plt>
+    2d62:	48 89 05 57 3e 07 00 	mov    %rax,0x73e57(%rip)        # 76bc0 <vcd_file>
+    2d69:	48 89 c1             	mov    %rax,%rcx
+    if (vcd_file == NULL) {
+    2d6c:	48 85 c0             	test   %rax,%rax
+    2d6f:	0f 84 14 02 00 00    	je     2f89 <VcdOpen+0x259>
+    fprintf(vcd_file, "$version muju posix $end\n$timescale 1ns $end\n$scope module board $end\n");
+    2d75:	ba 46 00 00 00       	mov    $0x46,%edx
+    2d7a:	be 01 00 00 00       	mov    $0x1,%esi
+    2d7f:	45 31 f6             	xor    %r14d,%r14d
+    for (int port = 0; port < SOC_GPIO_PORTS; port++) {
+    2d82:	31 ed                	xor    %ebp,%ebp
+    fprintf(vcd_file, "$version muju posix $end\n$timescale 1ns $end\n$scope module board $end\n");
+    2d84:	48 8d 3d cd 55 00 00 	lea    0x55cd(%rip),%rdi        # 8358 <_IO_stdin_used+0x358>
+    2d8b:	48 8d 5c 24 0c       	lea    0xc(%rsp),%rbx
+    2d90:	e8 0b f6 ff ff       	call   23a0 <fwrite@plt>
+    for (int port = 0; port < SOC_GPIO_PORTS; port++) {
+    2d95:	4c 8d 2d 04 56 00 00 	lea    0x5604(%rip),%r13        # 83a0 <_IO_stdin_used+0x3a0>
+        fprintf(vcd_file, "$scope module gpio%d $end\n", port);
+    2d9c:	48 8b 3d 1d 3e 07 00 	mov    0x73e1d(%rip),%rdi        # 76bc0 <vcd_file>
+    2da3:	89 ea                	mov    %ebp,%edx
+    2da5:	31 c0                	xor    %eax,%eax
+        for (int bit = 0; bit < SOC_GPIO_BITS; bit++) {
+    2da7:	45 31 ff             	xor    %r15d,%r15d
+        fprintf(vcd_file, "$scope module gpio%d $end\n", port);
+    2daa:	48 8d 35 65 52 00 00 	lea    0x5265(%rip),%rsi        # 8016 <_IO_stdin_used+0x16>
+        identifier[length++] = '!' + (index % 94);
+    2db1:	45 8d 66 21          	lea    0x21(%r14),%r12d
+        fprintf(vcd_file, "$scope module gpio%d $end\n", port);
+    2db5:	e8 56 f4 ff ff       	call   2210 <fprintf@plt>
+        for (int bit = 0; bit < SOC_GPIO_BITS; bit++) {
+    2dba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        identifier[length++] = '!' + (index % 94);
+    2dc0:	43 8d 04 3c          	lea    (%r12,%r15,1),%eax
+            fprintf(vcd_file, "$var wire 1 %s gpio%d_%d $end\n",
+    2dc4:	48 8b 3d f5 3d 07 00 	mov    0x73df5(%rip),%rdi        # 76bc0 <vcd_file>
+    2dcb:	45 89 f8             	mov    %r15d,%r8d
+    2dce:	89 e9                	mov    %ebp,%ecx
+        identifier[length++] = '!' + (index % 94);
+    2dd0:	88 44 24 0c          	mov    %al,0xc(%rsp)
+            fprintf(vcd_file, "$var wire 1 %s gpio%d_%d $end\n",
+    2dd4:	48 89 da             	mov    %rbx,%rdx
+    2dd7:	4c 89 ee             	mov    %r13,%rsi
+    2dda:	31 c0                	xor    %eax,%eax
+        for (int bit = 0; bit < SOC_GPIO_BITS; bit++) {
+    2ddc:	41 83 c7 01          	add    $0x1,%r15d
+    identifier[length] = 0;
+    2de0:	c6 44 24 0d 00       	movb   $0x0,0xd(%rsp)
+            fprintf(vcd_file, "$var wire 1 %s gpio%d_%d $end\n",
+    2de5:	e8 26 f4 ff ff       	call   2210 <fprintf@plt>
+        for (int bit = 0; bit < SOC_GPIO_BITS; bit++) {
+    2dea:	41 83 ff 08          	cmp    $0x8,%r15d
+    2dee:	75 d0                	jne    2dc0 <VcdOpen+0x90>
+        fprintf(vcd_file, "$upscope $end\n");
+    2df0:	48 8b 0d c9 3d 07 00 	mov    0x73dc9(%rip),%rcx        # 76bc0 <vcd_file>
+    2df7:	ba 0e 00 00 00       	mov    $0xe,%edx
+    2dfc:	be 01 00 00 00       	mov    $0x1,%esi
+    2e01:	48 8d 3d 29 52 00 00 	lea    0x5229(%rip),%rdi        # 8031 <_IO_stdin_used+0x31>
+    for (int port = 0; port < SOC_GPIO_PORTS; port++) {
+    2e08:	83 c5 01             	add    $0x1,%ebp
+    2e0b:	41 83 c6 08          	add    $0x8,%r14d
+        fprintf(vcd_file, "$upscope $end\n");
+    2e0f:	e8 8c f5 ff ff       	call   23a0 <fwrite@plt>
+    for (int port = 0; port < SOC_GPIO_PORTS; port++) {
+    2e14:	83 fd 04             	cmp    $0x4,%ebp
+    2e17:	75 83                	jne    2d9c <VcdOpen+0x6c>
+    2e19:	bd 41 00 00 00       	mov    $0x41,%ebp
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+    2e1e:	45 31 e4             	xor    %r12d,%r12d
+    2e21:	4c 8d 35 18 52 00 00 	lea    0x5218(%rip),%r14        # 8040 <_IO_stdin_used+0x40>
+    2e28:	4c 8d 2d 2b 52 00 00 	lea    0x522b(%rip),%r13        # 805a <_IO_stdin_used+0x5a>
+    2e2f:	4c 8d 3d 8a 55 00 00 	lea    0x558a(%rip),%r15        # 83c0 <_IO_stdin_used+0x3c0>
+        fprintf(vcd_file, "$scope module sci%d $end\n", port);
+    2e36:	48 8b 3d 83 3d 07 00 	mov    0x73d83(%rip),%rdi        # 76bc0 <vcd_file>
+    2e3d:	44 89 e2             	mov    %r12d,%edx
+    2e40:	4c 89 f6             	mov    %r14,%rsi
+    2e43:	31 c0                	xor    %eax,%eax
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+    2e45:	41 83 c4 01          	add    $0x1,%r12d
+        fprintf(vcd_file, "$scope module sci%d $end\n", port);
+    2e49:	e8 c2 f3 ff ff       	call   2210 <fprintf@plt>
+        fprintf(vcd_file, "$var wire 8 %s tx_data $end\n",
+    2e4e:	48 89 da             	mov    %rbx,%rdx
+    2e51:	4c 89 ee             	mov    %r13,%rsi
+    2e54:	31 c0                	xor    %eax,%eax
+    2e56:	48 8b 3d 63 3d 07 00 	mov    0x73d63(%rip),%rdi        # 76bc0 <vcd_file>
+        identifier[length++] = '!' + (index % 94);
+    2e5d:	40 88 6c 24 0c       	mov    %bpl,0xc(%rsp)
+    identifier[length] = 0;
+    2e62:	c6 44 24 0d 00       	movb   $0x0,0xd(%rsp)
+        fprintf(vcd_file, "$var wire 8 %s tx_data $end\n",
+    2e67:	e8 a4 f3 ff ff       	call   2210 <fprintf@plt>
+        identifier[length++] = '!' + (index % 94);
+    2e6c:	8d 45 01             	lea    0x1(%rbp),%eax
+        fprintf(vcd_file, "$var event 1 %s tx_strobe $end\n",
+    2e6f:	48 89 da             	mov    %rbx,%rdx
+    2e72:	4c 89 fe             	mov    %r15,%rsi
+    2e75:	48 8b 3d 44 3d 07 00 	mov    0x73d44(%rip),%rdi        # 76bc0 <vcd_file>
+        identifier[length++] = '!' + (index % 94);
+    2e7c:	88 44 24 0c          	mov    %al,0xc(%rsp)
+        fprintf(vcd_file, "$var event 1 %s tx_strobe $end\n",
+    2e80:	31 c0                	xor    %eax,%eax
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+    2e82:	83 c5 02             	add    $0x2,%ebp
+    identifier[length] = 0;
+    2e85:	c6 44 24 0d 00       	movb   $0x0,0xd(%rsp)
+        fprintf(vcd_file, "$var event 1 %s tx_strobe $end\n",
+    2e8a:	e8 81 f3 ff ff       	call   2210 <fprintf@plt>
+        fprintf(vcd_file, "$upscope $end\n");
+    2e8f:	ba 0e 00 00 00       	mov    $0xe,%edx
+    2e94:	48 8b 0d 25 3d 07 00 	mov    0x73d25(%rip),%rcx        # 76bc0 <vcd_file>
+    2e9b:	be 01 00 00 00       	mov    $0x1,%esi
+    2ea0:	48 8d 3d 8a 51 00 00 	lea    0x518a(%rip),%rdi        # 8031 <_IO_stdin_used+0x31>
+    2ea7:	e8 f4 f4 ff ff       	call   23a0 <fwrite@plt>
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+    2eac:	41 83 fc 04          	cmp    $0x4,%r12d
+    2eb0:	75 84                	jne    2e36 <VcdOpen+0x106>
+    fprintf(vcd_file, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+    2eb2:	ba 30 00 00 00       	mov    $0x30,%edx
+    2eb7:	48 8b 0d 02 3d 07 00 	mov    0x73d02(%rip),%rcx        # 76bc0 <vcd_file>
+    2ebe:	be 01 00 00 00       	mov    $0x1,%esi
+    2ec3:	48 8d 3d 16 55 00 00 	lea    0x5516(%rip),%rdi        # 83e0 <_IO_stdin_used+0x3e0>
+    2eca:	bd 21 00 00 00       	mov    $0x21,%ebp
+    2ecf:	4c 8d 25 a1 51 00 00 	lea    0x51a1(%rip),%r12        # 8077 <_IO_stdin_used+0x77>
+    2ed6:	e8 c5 f4 ff ff       	call   23a0 <fwrite@plt>
+    for (int index = 0; index < VCD_SCI_BASE; index++) {
+    2edb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        fprintf(vcd_file, "0%s\n", VcdIdentifier(index, identifier));
+    2ee0:	48 8b 3d d9 3c 07 00 	mov    0x73cd9(%rip),%rdi        # 76bc0 <vcd_file>
+    2ee7:	48 89 da             	mov    %rbx,%rdx
+    2eea:	4c 89 e6             	mov    %r12,%rsi
+    2eed:	31 c0                	xor    %eax,%eax
+        identifier[length++] = '!' + (index % 94);
+    2eef:	40 88 6c 24 0c       	mov    %bpl,0xc(%rsp)
+    for (int index = 0; index < VCD_SCI_BASE; index++) {
+    2ef4:	83 c5 01             	add    $0x1,%ebp
+    identifier[length] = 0;
+    2ef7:	c6 44 24 0d 00       	movb   $0x0,0xd(%rsp)
+        fprintf(vcd_file, "0%s\n", VcdIdentifier(index, identifier));
+    2efc:	e8 0f f3 ff ff       	call   2210 <fprintf@plt>
+    for (int index = 0; index < VCD_SCI_BASE; index++) {
+    2f01:	40 80 fd 41          	cmp    $0x41,%bpl
+    2f05:	75 d9                	jne    2ee0 <VcdOpen+0x1b0>
+    2f07:	4c 8d 25 6e 51 00 00 	lea    0x516e(%rip),%r12        # 807c <_IO_stdin_used+0x7c>
+        fprintf(vcd_file, "bxxxxxxxx %s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, identifier));
+    2f0e:	48 8b 3d ab 3c 07 00 	mov    0x73cab(%rip),%rdi        # 76bc0 <vcd_file>
+    2f15:	48 89 da             	mov    %rbx,%rdx
+    2f18:	4c 89 e6             	mov    %r12,%rsi
+    2f1b:	31 c0                	xor    %eax,%eax
+        identifier[length++] = '!' + (index % 94);
+    2f1d:	40 88 6c 24 0c       	mov    %bpl,0xc(%rsp)
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+    2f22:	83 c5 02             	add    $0x2,%ebp
+    identifier[length] = 0;
+    2f25:	c6 44 24 0d 00       	movb   $0x0,0xd(%rsp)
+        fprintf(vcd_file, "bxxxxxxxx %s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, identifier));
+    2f2a:	e8 e1 f2 ff ff       	call   2210 <fprintf@plt>
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+    2f2f:	40 80 fd 49          	cmp    $0x49,%bpl
+    2f33:	75 d9                	jne    2f0e <VcdOpen+0x1de>
+    fprintf(vcd_file, "$end\n");
+    2f35:	48 8b 0d 84 3c 07 00 	mov    0x73c84(%rip),%rcx        # 76bc0 <vcd_file>
+    2f3c:	ba 05 00 00 00       	mov    $0x5,%edx
+    2f41:	be 01 00 00 00       	mov    $0x1,%esi
+    2f46:	48 8d 3d 24 51 00 00 	lea    0x5124(%rip),%rdi        # 8071 <_IO_stdin_used+0x71>
+    2f4d:	e8 4e f4 ff ff       	call   23a0 <fwrite@plt>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    2f52:	bf 01 00 00 00       	mov    $0x1,%edi
+    2f57:	48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+    2f5c:	e8 6f f1 ff ff       	call   20d0 <clock_gettime@plt>
+    atexit(VcdFlush);
+    2f61:	48 8d 3d 08 07 00 00 	lea    0x708(%rip),%rdi        # 3670 <VcdFlush>
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    2f68:	48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    2f6f:	9a 3b 
+    2f71:	48 03 44 24 18       	add    0x18(%rsp),%rax
+    vcd_start = VcdClock();
+    2f76:	48 89 05 f3 f7 04 00 	mov    %rax,0x4f7f3(%rip)        # 52770 <vcd_start>
+    vcd_flushed = vcd_start;
+    2f7d:	48 89 05 e4 f7 04 00 	mov    %rax,0x4f7e4(%rip)        # 52768 <vcd_flushed>
+    atexit(VcdFlush);
+    2f84:	e8 37 46 00 00       	call   75c0 <atexit>
+}
+    2f89:	48 83 c4 28          	add    $0x28,%rsp
+    2f8d:	5b                   	pop    %rbx
+    2f8e:	5d                   	pop    %rbp
+    2f8f:	41 5c                	pop    %r12
+    2f91:	41 5d                	pop    %r13
+    2f93:	41 5e                	pop    %r14
+    2f95:	41 5f                	pop    %r15
+    2f97:	c3                   	ret
+    2f98:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2f9f:	00 
+
+0000000000002fa0 <FaultReport>:
+    }
+    return NULL;
+}
+
+static void FaultReport(void) {
+    if (!fault_used) {
+    2fa0:	80 3d b9 f6 00 00 00 	cmpb   $0x0,0xf6b9(%rip)        # 12660 <fault_used>
+    2fa7:	0f 84 23 01 00 00    	je     30d0 <FaultReport+0x130>
+static void FaultReport(void) {
+    2fad:	41 55                	push   %r13
+    2faf:	41 54                	push   %r12
+    2fb1:	4c 8d 25 60 54 00 00 	lea    0x5460(%rip),%r12        # 8418 <_IO_stdin_used+0x418>
+    2fb8:	55                   	push   %rbp
+    2fb9:	31 ed                	xor    %ebp,%ebp
+    2fbb:	53                   	push   %rbx
+    2fbc:	48 8d 1d fd f7 04 00 	lea    0x4f7fd(%rip),%rbx        # 527c0 <fault_sci>
+    2fc3:	48 83 ec 08          	sub    $0x8,%rsp
+        return;
+    }
+    for (int port = 0; port < FAULT_SCI_PORTS; port++) {
+        struct fault_sci_s * sci = &fault_sci[port];
+        if (sci->count.bytes) {
+    2fc7:	8b 8b 38 30 00 00    	mov    0x3038(%rbx),%ecx
+    2fcd:	85 c9                	test   %ecx,%ecx
+    2fcf:	75 7f                	jne    3050 <FaultReport+0xb0>
+    for (int port = 0; port < FAULT_SCI_PORTS; port++) {
+    2fd1:	83 c5 01             	add    $0x1,%ebp
+    2fd4:	48 81 c3 58 30 00 00 	add    $0x3058,%rbx
+    2fdb:	83 fd 04             	cmp    $0x4,%ebp
+    2fde:	75 e7                	jne    2fc7 <FaultReport+0x27>
+                    "%u overruns losing %u bytes, %u breaks\n",
+                    port, sci->count.bytes, sci->count.bits, sci->count.drops, sci->count.dups,
+                    sci->count.overrun, sci->count.lost, sci->count.breaks);
+        }
+    }
+    for (int index = 0; index < fault_glitch_count; index++) {
+    2fe0:	0f b6 05 aa f5 00 00 	movzbl 0xf5aa(%rip),%eax        # 12591 <fault_glitch_count>
+    2fe7:	84 c0                	test   %al,%al
+    2fe9:	74 48                	je     3033 <FaultReport+0x93>
+    2feb:	4c 8b 2d ee 7f 00 00 	mov    0x7fee(%rip),%r13        # afe0 <stderr@GLIBC_2.2.5>
+    2ff2:	48 8d 1d a7 f5 00 00 	lea    0xf5a7(%rip),%rbx        # 125a0 <fault_glitches>
+    2ff9:	31 ed                	xor    %ebp,%ebp
+    2ffb:	4c 8d 25 88 50 00 00 	lea    0x5088(%rip),%r12        # 808a <_IO_stdin_used+0x8a>
+    3002:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        fprintf(stderr, "fault: GPIO%u_%u %u glitches\n", fault_glitches[index].port,
+    3008:	0f b6 4b 01          	movzbl 0x1(%rbx),%ecx
+    300c:	0f b6 13             	movzbl (%rbx),%edx
+    300f:	4c 89 e6             	mov    %r12,%rsi
+    3012:	31 c0                	xor    %eax,%eax
+    3014:	44 8b 43 14          	mov    0x14(%rbx),%r8d
+    3018:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+    for (int index = 0; index < fault_glitch_count; index++) {
+    301c:	83 c5 01             	add    $0x1,%ebp
+    301f:	48 83 c3 18          	add    $0x18,%rbx
+        fprintf(stderr, "fault: GPIO%u_%u %u glitches\n", fault_glitches[index].port,
+    3023:	e8 e8 f1 ff ff       	call   2210 <fprintf@plt>
+    for (int index = 0; index < fault_glitch_count; index++) {
+    3028:	0f b6 05 62 f5 00 00 	movzbl 0xf562(%rip),%eax        # 12591 <fault_glitch_count>
+    302f:	39 c5                	cmp    %eax,%ebp
+    3031:	7c d5                	jl     3008 <FaultReport+0x68>
+                fault_glitches[index].bit, fault_glitches[index].count);
+    }
+    if (fault_tick.delays || fault_tick.misses) {
+    3033:	48 83 3d 65 f7 04 00 	cmpq   $0x0,0x4f765(%rip)        # 527a0 <fault_tick+0x20>
+    303a:	00 
+    303b:	75 63                	jne    30a0 <FaultReport+0x100>
+        fprintf(stderr, "fault: tick %u delayed, %u missed\n", fault_tick.delays,
+                fault_tick.misses);
+    }
+}
+    303d:	48 83 c4 08          	add    $0x8,%rsp
+    3041:	5b                   	pop    %rbx
+    3042:	5d                   	pop    %rbp
+    3043:	41 5c                	pop    %r12
+    3045:	41 5d                	pop    %r13
+    3047:	c3                   	ret
+    3048:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    304f:	00 
+            fprintf(stderr,
+    3050:	8b 83 50 30 00 00    	mov    0x3050(%rbx),%eax
+    3056:	4c 8b 2d 83 7f 00 00 	mov    0x7f83(%rip),%r13        # afe0 <stderr@GLIBC_2.2.5>
+    305d:	89 ea                	mov    %ebp,%edx
+    305f:	4c 89 e6             	mov    %r12,%rsi
+    3062:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+    3066:	50                   	push   %rax
+    3067:	8b 83 4c 30 00 00    	mov    0x304c(%rbx),%eax
+    306d:	50                   	push   %rax
+    306e:	8b 83 48 30 00 00    	mov    0x3048(%rbx),%eax
+    3074:	50                   	push   %rax
+    3075:	8b 83 44 30 00 00    	mov    0x3044(%rbx),%eax
+    307b:	50                   	push   %rax
+    307c:	44 8b 8b 40 30 00 00 	mov    0x3040(%rbx),%r9d
+    3083:	31 c0                	xor    %eax,%eax
+    3085:	44 8b 83 3c 30 00 00 	mov    0x303c(%rbx),%r8d
+    308c:	e8 7f f1 ff ff       	call   2210 <fprintf@plt>
+    3091:	48 83 c4 20          	add    $0x20,%rsp
+    3095:	e9 37 ff ff ff       	jmp    2fd1 <FaultReport+0x31>
+    309a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        fprintf(stderr, "fault: tick %u delayed, %u missed\n", fault_tick.delays,
+    30a0:	48 8b 05 39 7f 00 00 	mov    0x7f39(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    30a7:	8b 0d f7 f6 04 00    	mov    0x4f6f7(%rip),%ecx        # 527a4 <fault_tick+0x24>
+    30ad:	48 8d 35 d4 53 00 00 	lea    0x53d4(%rip),%rsi        # 8488 <_IO_stdin_used+0x488>
+    30b4:	8b 15 e6 f6 04 00    	mov    0x4f6e6(%rip),%edx        # 527a0 <fault_tick+0x20>
+    30ba:	48 8b 38             	mov    (%rax),%rdi
+}
+    30bd:	48 83 c4 08          	add    $0x8,%rsp
+        fprintf(stderr, "fault: tick %u delayed, %u missed\n", fault_tick.delays,
+    30c1:	31 c0                	xor    %eax,%eax
+}
+    30c3:	5b                   	pop    %rbx
+    30c4:	5d                   	pop    %rbp
+    30c5:	41 5c                	pop    %r12
+    30c7:	41 5d                	pop    %r13
+        fprintf(stderr, "fault: tick %u delayed, %u missed\n", fault_tick.delays,
+    30c9:	e9 42 f1 ff ff       	jmp    2210 <fprintf@plt>
+    30ce:	66 90                	xchg   %ax,%ax
+    30d0:	c3                   	ret
+    30d1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    30d8:	00 00 00 00 
+    30dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000030e0 <JournalReadNumber>:
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+        value = value >> 7;
+    } while (value);
+}
+
+static bool JournalReadNumber(uint64_t * value) {
+    30e0:	55                   	push   %rbp
+    30e1:	48 89 fd             	mov    %rdi,%rbp
+    30e4:	53                   	push   %rbx
+    int data, shift = 0;
+    30e5:	31 db                	xor    %ebx,%ebx
+static bool JournalReadNumber(uint64_t * value) {
+    30e7:	48 83 ec 08          	sub    $0x8,%rsp
+
+    *value = 0;
+    30eb:	48 c7 07 00 00 00 00 	movq   $0x0,(%rdi)
+    30f2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    do {
+        data = getc(journal_replay);
+    30f8:	48 8b 3d d1 f8 06 00 	mov    0x6f8d1(%rip),%rdi        # 729d0 <journal_replay>
+    30ff:	e8 fc f2 ff ff       	call   2400 <getc@plt>
+        if ((data == EOF) || (shift > 63)) {
+    3104:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3107:	74 27                	je     3130 <JournalReadNumber+0x50>
+    3109:	83 fb 3f             	cmp    $0x3f,%ebx
+    310c:	7f 22                	jg     3130 <JournalReadNumber+0x50>
+            return false;
+        }
+        *value |= (uint64_t)(data & 0x7F) << shift;
+    310e:	89 c2                	mov    %eax,%edx
+    3110:	89 d9                	mov    %ebx,%ecx
+        shift += 7;
+    3112:	83 c3 07             	add    $0x7,%ebx
+        *value |= (uint64_t)(data & 0x7F) << shift;
+    3115:	83 e2 7f             	and    $0x7f,%edx
+    3118:	48 d3 e2             	shl    %cl,%rdx
+    311b:	48 09 55 00          	or     %rdx,0x0(%rbp)
+    } while (data & 0x80);
+    311f:	a8 80                	test   $0x80,%al
+    3121:	75 d5                	jne    30f8 <JournalReadNumber+0x18>
+    return true;
+}
+    3123:	48 83 c4 08          	add    $0x8,%rsp
+    return true;
+    3127:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    312c:	5b                   	pop    %rbx
+    312d:	5d                   	pop    %rbp
+    312e:	c3                   	ret
+    312f:	90                   	nop
+    3130:	48 83 c4 08          	add    $0x8,%rsp
+            return false;
+    3134:	31 c0                	xor    %eax,%eax
+}
+    3136:	5b                   	pop    %rbx
+    3137:	5d                   	pop    %rbp
+    3138:	c3                   	ret
+    3139:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000003140 <JournalRead>:
+    putc(kind, journal_record);
+    JournalWriteNumber(now - journal_last);
+    journal_last = now;
+}
+
+static bool JournalRead(void) {
+    3140:	55                   	push   %rbp
+    3141:	53                   	push   %rbx
+    3142:	48 83 ec 18          	sub    $0x18,%rsp
+    uint64_t delta, size;
+    int kind, port, data;
+
+    kind = getc(journal_replay);
+    3146:	48 8b 3d 83 f8 06 00 	mov    0x6f883(%rip),%rdi        # 729d0 <journal_replay>
+    314d:	e8 ae f2 ff ff       	call   2400 <getc@plt>
+    if ((kind == EOF) || !JournalReadNumber(&delta)) {
+    3152:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3155:	74 33                	je     318a <JournalRead+0x4a>
+    3157:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    315c:	89 c3                	mov    %eax,%ebx
+    315e:	e8 7d ff ff ff       	call   30e0 <JournalReadNumber>
+    3163:	89 c5                	mov    %eax,%ebp
+    3165:	84 c0                	test   %al,%al
+    3167:	74 21                	je     318a <JournalRead+0x4a>
+        return false;
+    }
+    journal_next.kind = kind;
+    journal_next.time += delta;
+    3169:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    journal_next.kind = kind;
+    316e:	88 1d 54 f8 05 00    	mov    %bl,0x5f854(%rip)        # 629c8 <journal_next+0x8>
+    journal_next.time += delta;
+    3174:	48 01 05 45 f8 05 00 	add    %rax,0x5f845(%rip)        # 629c0 <journal_next>
+    if (kind == JOURNAL_GPIO) {
+    317b:	83 fb 01             	cmp    $0x1,%ebx
+    317e:	74 28                	je     31a8 <JournalRead+0x68>
+            return false;
+        }
+        journal_next.port = port;
+        journal_next.bit = data & 0x7F;
+        journal_next.state = (data & 0x80) != 0;
+    } else if (kind == JOURNAL_SCI) {
+    3180:	83 fb 02             	cmp    $0x2,%ebx
+    3183:	74 6b                	je     31f0 <JournalRead+0xb0>
+        journal_next.port = port;
+        journal_next.size = size;
+        if (fread(journal_next.data, 1, size, journal_replay) != size) {
+            return false;
+        }
+    } else if (kind == JOURNAL_TICK) {
+    3185:	83 fb 03             	cmp    $0x3,%ebx
+    3188:	74 0e                	je     3198 <JournalRead+0x58>
+        return false;
+    318a:	31 ed                	xor    %ebp,%ebp
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+    318c:	48 83 c4 18          	add    $0x18,%rsp
+    3190:	89 e8                	mov    %ebp,%eax
+    3192:	5b                   	pop    %rbx
+    3193:	5d                   	pop    %rbp
+    3194:	c3                   	ret
+    3195:	0f 1f 00             	nopl   (%rax)
+        if (!JournalReadNumber(&size)) {
+    3198:	48 89 e7             	mov    %rsp,%rdi
+    319b:	e8 40 ff ff ff       	call   30e0 <JournalReadNumber>
+    31a0:	89 c5                	mov    %eax,%ebp
+    31a2:	eb e8                	jmp    318c <JournalRead+0x4c>
+    31a4:	0f 1f 40 00          	nopl   0x0(%rax)
+        port = getc(journal_replay);
+    31a8:	48 8b 3d 21 f8 06 00 	mov    0x6f821(%rip),%rdi        # 729d0 <journal_replay>
+    31af:	e8 4c f2 ff ff       	call   2400 <getc@plt>
+        data = getc(journal_replay);
+    31b4:	48 8b 3d 15 f8 06 00 	mov    0x6f815(%rip),%rdi        # 729d0 <journal_replay>
+        port = getc(journal_replay);
+    31bb:	89 c3                	mov    %eax,%ebx
+        data = getc(journal_replay);
+    31bd:	e8 3e f2 ff ff       	call   2400 <getc@plt>
+        if ((port == EOF) || (data == EOF)) {
+    31c2:	83 fb ff             	cmp    $0xffffffff,%ebx
+    31c5:	74 c3                	je     318a <JournalRead+0x4a>
+    31c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31ca:	74 be                	je     318a <JournalRead+0x4a>
+        journal_next.bit = data & 0x7F;
+    31cc:	89 c2                	mov    %eax,%edx
+        journal_next.state = (data & 0x80) != 0;
+    31ce:	c0 e8 07             	shr    $0x7,%al
+        journal_next.port = port;
+    31d1:	88 1d f2 f7 05 00    	mov    %bl,0x5f7f2(%rip)        # 629c9 <journal_next+0x9>
+        journal_next.bit = data & 0x7F;
+    31d7:	83 e2 7f             	and    $0x7f,%edx
+        journal_next.state = (data & 0x80) != 0;
+    31da:	88 05 eb f7 05 00    	mov    %al,0x5f7eb(%rip)        # 629cb <journal_next+0xb>
+        journal_next.bit = data & 0x7F;
+    31e0:	88 15 e4 f7 05 00    	mov    %dl,0x5f7e4(%rip)        # 629ca <journal_next+0xa>
+        journal_next.state = (data & 0x80) != 0;
+    31e6:	eb a4                	jmp    318c <JournalRead+0x4c>
+    31e8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    31ef:	00 
+        port = getc(journal_replay);
+    31f0:	48 8b 3d d9 f7 06 00 	mov    0x6f7d9(%rip),%rdi        # 729d0 <journal_replay>
+    31f7:	e8 04 f2 ff ff       	call   2400 <getc@plt>
+    31fc:	89 c3                	mov    %eax,%ebx
+        if ((port == EOF) || !JournalReadNumber(&size) || (size > UINT16_MAX)) {
+    31fe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3201:	74 87                	je     318a <JournalRead+0x4a>
+    3203:	48 89 e7             	mov    %rsp,%rdi
+    3206:	e8 d5 fe ff ff       	call   30e0 <JournalReadNumber>
+    320b:	84 c0                	test   %al,%al
+    320d:	0f 84 77 ff ff ff    	je     318a <JournalRead+0x4a>
+    3213:	48 8b 2c 24          	mov    (%rsp),%rbp
+    3217:	48 81 fd ff ff 00 00 	cmp    $0xffff,%rbp
+    321e:	0f 87 66 ff ff ff    	ja     318a <JournalRead+0x4a>
+        if (fread(journal_next.data, 1, size, journal_replay) != size) {
+    3224:	48 8b 0d a5 f7 06 00 	mov    0x6f7a5(%rip),%rcx        # 729d0 <journal_replay>
+    322b:	48 89 ea             	mov    %rbp,%rdx
+    322e:	be 01 00 00 00       	mov    $0x1,%esi
+    3233:	48 8d 3d 94 f7 05 00 	lea    0x5f794(%rip),%rdi        # 629ce <journal_next+0xe>
+        journal_next.size = size;
+    323a:	66 89 2d 8b f7 05 00 	mov    %bp,0x5f78b(%rip)        # 629cc <journal_next+0xc>
+        journal_next.port = port;
+    3241:	88 1d 82 f7 05 00    	mov    %bl,0x5f782(%rip)        # 629c9 <journal_next+0x9>
+        if (fread(journal_next.data, 1, size, journal_replay) != size) {
+    3247:	e8 44 ee ff ff       	call   2090 <fread@plt>
+    324c:	48 39 c5             	cmp    %rax,%rbp
+    324f:	40 0f 94 c5          	sete   %bpl
+    3253:	e9 34 ff ff ff       	jmp    318c <JournalRead+0x4c>
+    3258:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    325f:	00 
+
+0000000000003260 <JournalOpen>:
+        }
+    }
+    return NULL;
+}
+
+static void JournalOpen(void) {
+    3260:	55                   	push   %rbp
+    char const * record = getenv(JOURNAL_RECORD_ENVIRONMENT);
+    3261:	48 8d 3d 40 4e 00 00 	lea    0x4e40(%rip),%rdi        # 80a8 <_IO_stdin_used+0xa8>
+static void JournalOpen(void) {
+    3268:	53                   	push   %rbx
+    3269:	48 83 ec 28          	sub    $0x28,%rsp
+    char const * record = getenv(JOURNAL_RECORD_ENVIRONMENT);
+    326d:	e8 be ed ff ff       	call   2030 <getenv@plt>
+    char const * replay = getenv(JOURNAL_REPLAY_ENVIRONMENT);
+    3272:	48 8d 3d 3b 4e 00 00 	lea    0x4e3b(%rip),%rdi        # 80b4 <_IO_stdin_used+0xb4>
+    char const * record = getenv(JOURNAL_RECORD_ENVIRONMENT);
+    3279:	48 89 c5             	mov    %rax,%rbp
+    char const * replay = getenv(JOURNAL_REPLAY_ENVIRONMENT);
+    327c:	e8 af ed ff ff       	call   2030 <getenv@plt>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    3281:	48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+    3286:	bf 01 00 00 00       	mov    $0x1,%edi
+    static pthread_t thread;
+    char magic[sizeof(JOURNAL_MAGIC)] = {0};
+    328b:	c7 44 24 0b 00 00 00 	movl   $0x0,0xb(%rsp)
+    3292:	00 
+    3293:	c6 44 24 0f 00       	movb   $0x0,0xf(%rsp)
+    char const * replay = getenv(JOURNAL_REPLAY_ENVIRONMENT);
+    3298:	48 89 c3             	mov    %rax,%rbx
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    329b:	e8 30 ee ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    32a0:	48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    32a5:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    32ac:	9b c4 20 
+    32af:	48 69 4c 24 10 40 42 	imul   $0xf4240,0x10(%rsp),%rcx
+    32b6:	0f 00 
+    32b8:	48 f7 ee             	imul   %rsi
+    32bb:	48 c1 fe 3f          	sar    $0x3f,%rsi
+    32bf:	48 c1 fa 07          	sar    $0x7,%rdx
+    32c3:	48 29 f2             	sub    %rsi,%rdx
+    32c6:	48 01 d1             	add    %rdx,%rcx
+    32c9:	48 2b 0d 08 f7 06 00 	sub    0x6f708(%rip),%rcx        # 729d8 <journal_start>
+
+    journal_start = JournalClock();
+    32d0:	48 89 0d 01 f7 06 00 	mov    %rcx,0x6f701(%rip)        # 729d8 <journal_start>
+    if (replay) {
+    32d7:	48 85 db             	test   %rbx,%rbx
+    32da:	0f 84 a0 00 00 00    	je     3380 <JournalOpen+0x120>
+        journal_replay = fopen(replay, "rb");
+    32e0:	48 8d 35 d9 4d 00 00 	lea    0x4dd9(%rip),%rsi        # 80c0 <_IO_stdin_used+0xc0>
+    32e7:	48 89 df             	mov    %rbx,%rdi
+    32ea:	e8 31 f0 ff ff       	call   2320 <fopen@plt>
+    32ef:	48 89 05 da f6 06 00 	mov    %rax,0x6f6da(%rip)        # 729d0 <journal_replay>
+    32f6:	48 89 c1             	mov    %rax,%rcx
+        if ((journal_replay == NULL) || (fread(magic, 1, 4, journal_replay) != 4) ||
+    32f9:	48 85 c0             	test   %rax,%rax
+    32fc:	0f 84 ef 00 00 00    	je     33f1 <JournalOpen+0x191>
+    3302:	48 8d 6c 24 0b       	lea    0xb(%rsp),%rbp
+    3307:	ba 04 00 00 00       	mov    $0x4,%edx
+    330c:	be 01 00 00 00       	mov    $0x1,%esi
+    3311:	48 89 ef             	mov    %rbp,%rdi
+    3314:	e8 77 ed ff ff       	call   2090 <fread@plt>
+    3319:	48 83 f8 04          	cmp    $0x4,%rax
+    331d:	0f 85 ce 00 00 00    	jne    33f1 <JournalOpen+0x191>
+            (strcmp(magic, JOURNAL_MAGIC) != 0) || (getc(journal_replay) != JOURNAL_VERSION)) {
+    3323:	48 8d 35 b3 4d 00 00 	lea    0x4db3(%rip),%rsi        # 80dd <_IO_stdin_used+0xdd>
+    332a:	48 89 ef             	mov    %rbp,%rdi
+    332d:	e8 ae ee ff ff       	call   21e0 <strcmp@plt>
+        if ((journal_replay == NULL) || (fread(magic, 1, 4, journal_replay) != 4) ||
+    3332:	85 c0                	test   %eax,%eax
+    3334:	0f 85 b7 00 00 00    	jne    33f1 <JournalOpen+0x191>
+            (strcmp(magic, JOURNAL_MAGIC) != 0) || (getc(journal_replay) != JOURNAL_VERSION)) {
+    333a:	48 8b 3d 8f f6 06 00 	mov    0x6f68f(%rip),%rdi        # 729d0 <journal_replay>
+    3341:	e8 ba f0 ff ff       	call   2400 <getc@plt>
+    3346:	83 f8 01             	cmp    $0x1,%eax
+    3349:	0f 85 a2 00 00 00    	jne    33f1 <JournalOpen+0x191>
+            fprintf(stderr, "journal: can't replay %s\n", replay);
+            exit(EXIT_FAILURE);
+        }
+        journal_pending = JournalRead();
+    334f:	e8 ec fd ff ff       	call   3140 <JournalRead>
+        pthread_create(&thread, NULL, ReplayThread, NULL);
+    3354:	31 c9                	xor    %ecx,%ecx
+    3356:	48 8d 15 53 2f 00 00 	lea    0x2f53(%rip),%rdx        # 62b0 <ReplayThread>
+    335d:	31 f6                	xor    %esi,%esi
+    335f:	48 8d 3d 1a b6 05 00 	lea    0x5b61a(%rip),%rdi        # 5e980 <thread.0.lto_priv.0>
+        journal_pending = JournalRead();
+    3366:	88 05 1c b6 05 00    	mov    %al,0x5b61c(%rip)        # 5e988 <journal_pending>
+        pthread_create(&thread, NULL, ReplayThread, NULL);
+    336c:	e8 6f ef ff ff       	call   22e0 <pthread_create@plt>
+        fwrite(JOURNAL_MAGIC, 1, 4, journal_record);
+        putc(JOURNAL_VERSION, journal_record);
+        /* The buffered records are written when the program ends with exit */
+        atexit(JournalFlush);
+    }
+}
+    3371:	48 83 c4 28          	add    $0x28,%rsp
+    3375:	5b                   	pop    %rbx
+    3376:	5d                   	pop    %rbp
+    3377:	c3                   	ret
+    3378:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    337f:	00 
+    } else if (record) {
+    3380:	48 85 ed             	test   %rbp,%rbp
+    3383:	74 ec                	je     3371 <JournalOpen+0x111>
+        journal_record = fopen(record, "wb");
+    3385:	48 8d 35 56 4d 00 00 	lea    0x4d56(%rip),%rsi        # 80e2 <_IO_stdin_used+0xe2>
+    338c:	48 89 ef             	mov    %rbp,%rdi
+    338f:	e8 8c ef ff ff       	call   2320 <fopen@plt>
+    3394:	48 89 05 ad f6 06 00 	mov    %rax,0x6f6ad(%rip)        # 72a48 <journal_record>
+    339b:	48 89 c3             	mov    %rax,%rbx
+        if (journal_record == NULL) {
+    339e:	48 85 c0             	test   %rax,%rax
+    33a1:	74 73                	je     3416 <JournalOpen+0x1b6>
+        setvbuf(journal_record, NULL, _IOFBF, JOURNAL_FILE_BUFFER);
+    33a3:	b9 00 00 01 00       	mov    $0x10000,%ecx
+    33a8:	31 d2                	xor    %edx,%edx
+    33aa:	31 f6                	xor    %esi,%esi
+    33ac:	48 89 c7             	mov    %rax,%rdi
+    33af:	e8 fc ee ff ff       	call   22b0 <setvbuf@plt>
+        fwrite(JOURNAL_MAGIC, 1, 4, journal_record);
+    33b4:	48 89 d9             	mov    %rbx,%rcx
+    33b7:	ba 04 00 00 00       	mov    $0x4,%edx
+    33bc:	be 01 00 00 00       	mov    $0x1,%esi
+    33c1:	48 8d 3d 15 4d 00 00 	lea    0x4d15(%rip),%rdi        # 80dd <_IO_stdin_used+0xdd>
+    33c8:	e8 d3 ef ff ff       	call   23a0 <fwrite@plt>
+        putc(JOURNAL_VERSION, journal_record);
+    33cd:	48 8b 35 74 f6 06 00 	mov    0x6f674(%rip),%rsi        # 72a48 <journal_record>
+    33d4:	bf 01 00 00 00       	mov    $0x1,%edi
+    33d9:	e8 12 ee ff ff       	call   21f0 <putc@plt>
+        atexit(JournalFlush);
+    33de:	48 8d 3d 2b 01 00 00 	lea    0x12b(%rip),%rdi        # 3510 <JournalFlush>
+    33e5:	e8 d6 41 00 00       	call   75c0 <atexit>
+}
+    33ea:	48 83 c4 28          	add    $0x28,%rsp
+    33ee:	5b                   	pop    %rbx
+    33ef:	5d                   	pop    %rbp
+    33f0:	c3                   	ret
+            fprintf(stderr, "journal: can't replay %s\n", replay);
+    33f1:	48 8b 05 e8 7b 00 00 	mov    0x7be8(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    33f8:	48 89 da             	mov    %rbx,%rdx
+    33fb:	48 8d 35 c1 4c 00 00 	lea    0x4cc1(%rip),%rsi        # 80c3 <_IO_stdin_used+0xc3>
+    3402:	48 8b 38             	mov    (%rax),%rdi
+    3405:	31 c0                	xor    %eax,%eax
+    3407:	e8 04 ee ff ff       	call   2210 <fprintf@plt>
+            exit(EXIT_FAILURE);
+    340c:	bf 01 00 00 00       	mov    $0x1,%edi
+    3411:	e8 7a ef ff ff       	call   2390 <exit@plt>
+            fprintf(stderr, "journal: can't record %s\n", record);
+    3416:	48 8b 05 c3 7b 00 00 	mov    0x7bc3(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    341d:	48 89 ea             	mov    %rbp,%rdx
+    3420:	48 8d 35 be 4c 00 00 	lea    0x4cbe(%rip),%rsi        # 80e5 <_IO_stdin_used+0xe5>
+    3427:	48 8b 38             	mov    (%rax),%rdi
+    342a:	31 c0                	xor    %eax,%eax
+    342c:	e8 df ed ff ff       	call   2210 <fprintf@plt>
+            return;
+    3431:	e9 3b ff ff ff       	jmp    3371 <JournalOpen+0x111>
+    3436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    343d:	00 00 00 
+
+0000000000003440 <GpioParseName>:
+
+bool GpioIsOutput(uint8_t port, uint8_t bit) {
+    return (port < SOC_GPIO_PORTS) && (gpio_outputs[port] & GPIO_MASK(bit));
+}
+
+bool GpioParseName(char const * text, uint8_t * port, uint8_t * bit) {
+    3440:	41 54                	push   %r12
+    3442:	49 89 f4             	mov    %rsi,%r12
+    unsigned int number, terminal;
+    char separator;
+
+    if (strncmp(text, "HAL_", 4) == 0) {
+    3445:	48 8d 35 b3 4c 00 00 	lea    0x4cb3(%rip),%rsi        # 80ff <_IO_stdin_used+0xff>
+bool GpioParseName(char const * text, uint8_t * port, uint8_t * bit) {
+    344c:	55                   	push   %rbp
+    344d:	48 89 d5             	mov    %rdx,%rbp
+    if (strncmp(text, "HAL_", 4) == 0) {
+    3450:	ba 04 00 00 00       	mov    $0x4,%edx
+bool GpioParseName(char const * text, uint8_t * port, uint8_t * bit) {
+    3455:	53                   	push   %rbx
+    3456:	48 89 fb             	mov    %rdi,%rbx
+    3459:	48 83 ec 10          	sub    $0x10,%rsp
+    if (strncmp(text, "HAL_", 4) == 0) {
+    345d:	e8 1e ec ff ff       	call   2080 <strncmp@plt>
+        text += 4;
+    }
+    if (strncmp(text, "GPIO", 4) == 0) {
+    3462:	48 8d 35 9b 4c 00 00 	lea    0x4c9b(%rip),%rsi        # 8104 <_IO_stdin_used+0x104>
+    if (strncmp(text, "HAL_", 4) == 0) {
+    3469:	89 c2                	mov    %eax,%edx
+        text += 4;
+    346b:	48 8d 43 04          	lea    0x4(%rbx),%rax
+    346f:	85 d2                	test   %edx,%edx
+    if (strncmp(text, "GPIO", 4) == 0) {
+    3471:	ba 04 00 00 00       	mov    $0x4,%edx
+        text += 4;
+    3476:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (strncmp(text, "GPIO", 4) == 0) {
+    347a:	48 89 df             	mov    %rbx,%rdi
+    347d:	e8 fe eb ff ff       	call   2080 <strncmp@plt>
+        text += 4;
+    }
+    if (sscanf(text, "%u%c%u", &number, &separator, &terminal) != 3) {
+    3482:	48 8d 4c 24 07       	lea    0x7(%rsp),%rcx
+    3487:	4c 8d 44 24 08       	lea    0x8(%rsp),%r8
+    if (strncmp(text, "GPIO", 4) == 0) {
+    348c:	89 c2                	mov    %eax,%edx
+        text += 4;
+    348e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+    if (sscanf(text, "%u%c%u", &number, &separator, &terminal) != 3) {
+    3492:	48 8d 35 70 4c 00 00 	lea    0x4c70(%rip),%rsi        # 8109 <_IO_stdin_used+0x109>
+        text += 4;
+    3499:	85 d2                	test   %edx,%edx
+    if (sscanf(text, "%u%c%u", &number, &separator, &terminal) != 3) {
+    349b:	48 8d 54 24 0c       	lea    0xc(%rsp),%rdx
+        text += 4;
+    34a0:	48 0f 44 d8          	cmove  %rax,%rbx
+    if (sscanf(text, "%u%c%u", &number, &separator, &terminal) != 3) {
+    34a4:	31 c0                	xor    %eax,%eax
+    34a6:	48 89 df             	mov    %rbx,%rdi
+    34a9:	e8 d2 ed ff ff       	call   2280 <__isoc99_sscanf@plt>
+    34ae:	89 c2                	mov    %eax,%edx
+        return false;
+    34b0:	31 c0                	xor    %eax,%eax
+    if (sscanf(text, "%u%c%u", &number, &separator, &terminal) != 3) {
+    34b2:	83 fa 03             	cmp    $0x3,%edx
+    34b5:	75 33                	jne    34ea <GpioParseName+0xaa>
+    }
+    if (((separator != '_') && (separator != '.')) || (number >= SOC_GPIO_PORTS) ||
+    34b7:	0f b6 54 24 07       	movzbl 0x7(%rsp),%edx
+    34bc:	80 fa 5f             	cmp    $0x5f,%dl
+    34bf:	0f 95 c0             	setne  %al
+    34c2:	80 fa 2e             	cmp    $0x2e,%dl
+    34c5:	0f 95 c2             	setne  %dl
+    34c8:	20 d0                	and    %dl,%al
+    34ca:	75 2c                	jne    34f8 <GpioParseName+0xb8>
+    34cc:	8b 54 24 0c          	mov    0xc(%rsp),%edx
+    34d0:	83 fa 03             	cmp    $0x3,%edx
+    34d3:	77 15                	ja     34ea <GpioParseName+0xaa>
+        (terminal >= SOC_GPIO_BITS)) {
+    34d5:	8b 4c 24 08          	mov    0x8(%rsp),%ecx
+    if (((separator != '_') && (separator != '.')) || (number >= SOC_GPIO_PORTS) ||
+    34d9:	83 f9 07             	cmp    $0x7,%ecx
+    34dc:	77 0c                	ja     34ea <GpioParseName+0xaa>
+        return false;
+    }
+    *port = number;
+    34de:	41 88 14 24          	mov    %dl,(%r12)
+    *bit = terminal;
+    return true;
+    34e2:	b8 01 00 00 00       	mov    $0x1,%eax
+    *bit = terminal;
+    34e7:	88 4d 00             	mov    %cl,0x0(%rbp)
+}
+    34ea:	48 83 c4 10          	add    $0x10,%rsp
+    34ee:	5b                   	pop    %rbx
+    34ef:	5d                   	pop    %rbp
+    34f0:	41 5c                	pop    %r12
+    34f2:	c3                   	ret
+    34f3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    34f8:	48 83 c4 10          	add    $0x10,%rsp
+        return false;
+    34fc:	31 c0                	xor    %eax,%eax
+}
+    34fe:	5b                   	pop    %rbx
+    34ff:	5d                   	pop    %rbp
+    3500:	41 5c                	pop    %r12
+    3502:	c3                   	ret
+    3503:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    350a:	00 00 00 00 
+    350e:	66 90                	xchg   %ax,%ax
+
+0000000000003510 <JournalFlush>:
+static void JournalFlush(void) {
+    3510:	53                   	push   %rbx
+    pthread_mutex_lock(&journal_lock);
+    3511:	48 8d 1d 08 f5 06 00 	lea    0x6f508(%rip),%rbx        # 72a20 <journal_lock>
+    3518:	48 89 df             	mov    %rbx,%rdi
+    351b:	e8 00 ef ff ff       	call   2420 <pthread_mutex_lock@plt>
+    fflush(journal_record);
+    3520:	48 8b 3d 21 f5 06 00 	mov    0x6f521(%rip),%rdi        # 72a48 <journal_record>
+    3527:	e8 44 ed ff ff       	call   2270 <fflush@plt>
+    pthread_mutex_unlock(&journal_lock);
+    352c:	48 89 df             	mov    %rbx,%rdi
+}
+    352f:	5b                   	pop    %rbx
+    pthread_mutex_unlock(&journal_lock);
+    3530:	e9 2b ed ff ff       	jmp    2260 <pthread_mutex_unlock@plt>
+    3535:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    353c:	00 00 00 00 
+
+0000000000003540 <VcdEnd>:
+
+static void VcdEnd(int size) {
+    vcd_used += size;
+    3540:	48 63 d7             	movslq %edi,%rdx
+    3543:	48 03 15 d6 f1 04 00 	add    0x4f1d6(%rip),%rdx        # 52720 <vcd_used>
+    354a:	48 89 15 cf f1 04 00 	mov    %rdx,0x4f1cf(%rip)        # 52720 <vcd_used>
+    if ((vcd_used > VCD_BUFFER_SIZE - VCD_CHANGE_SIZE) ||
+    3551:	48 81 fa c0 ff 03 00 	cmp    $0x3ffc0,%rdx
+    3558:	77 1d                	ja     3577 <VcdEnd+0x37>
+        (vcd_last + vcd_start - vcd_flushed > VCD_FLUSH_PERIOD)) {
+    355a:	48 8b 05 0f f2 04 00 	mov    0x4f20f(%rip),%rax        # 52770 <vcd_start>
+    3561:	48 03 05 c0 f1 04 00 	add    0x4f1c0(%rip),%rax        # 52728 <vcd_last>
+    3568:	48 2b 05 f9 f1 04 00 	sub    0x4f1f9(%rip),%rax        # 52768 <vcd_flushed>
+    if ((vcd_used > VCD_BUFFER_SIZE - VCD_CHANGE_SIZE) ||
+    356f:	48 3d 00 e1 f5 05    	cmp    $0x5f5e100,%rax
+    3575:	76 59                	jbe    35d0 <VcdEnd+0x90>
+static void VcdEnd(int size) {
+    3577:	48 83 ec 08          	sub    $0x8,%rsp
+        fwrite(vcd_buffer, 1, vcd_used, vcd_file);
+    357b:	48 8b 0d 3e 36 07 00 	mov    0x7363e(%rip),%rcx        # 76bc0 <vcd_file>
+    3582:	be 01 00 00 00       	mov    $0x1,%esi
+    3587:	48 8d 3d 92 f1 00 00 	lea    0xf192(%rip),%rdi        # 12720 <vcd_buffer>
+    358e:	e8 0d ee ff ff       	call   23a0 <fwrite@plt>
+        fflush(vcd_file);
+    3593:	48 8b 3d 26 36 07 00 	mov    0x73626(%rip),%rdi        # 76bc0 <vcd_file>
+    359a:	e8 d1 ec ff ff       	call   2270 <fflush@plt>
+        vcd_used = 0;
+        vcd_flushed = vcd_last + vcd_start;
+    359f:	48 8b 05 ca f1 04 00 	mov    0x4f1ca(%rip),%rax        # 52770 <vcd_start>
+    35a6:	48 03 05 7b f1 04 00 	add    0x4f17b(%rip),%rax        # 52728 <vcd_last>
+        vcd_used = 0;
+    35ad:	48 c7 05 68 f1 04 00 	movq   $0x0,0x4f168(%rip)        # 52720 <vcd_used>
+    35b4:	00 00 00 00 
+        vcd_flushed = vcd_last + vcd_start;
+    35b8:	48 89 05 a9 f1 04 00 	mov    %rax,0x4f1a9(%rip)        # 52768 <vcd_flushed>
+    }
+    pthread_mutex_unlock(&vcd_lock);
+    35bf:	48 8d 3d 7a f1 04 00 	lea    0x4f17a(%rip),%rdi        # 52740 <vcd_lock>
+}
+    35c6:	48 83 c4 08          	add    $0x8,%rsp
+    pthread_mutex_unlock(&vcd_lock);
+    35ca:	e9 91 ec ff ff       	jmp    2260 <pthread_mutex_unlock@plt>
+    35cf:	90                   	nop
+    35d0:	48 8d 3d 69 f1 04 00 	lea    0x4f169(%rip),%rdi        # 52740 <vcd_lock>
+    35d7:	e9 84 ec ff ff       	jmp    2260 <pthread_mutex_unlock@plt>
+    35dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000035e0 <VcdGpio.part.0>:
+
+/* === Public function implementation ========================================================== */
+
+void VcdGpio(uint8_t port, uint8_t bit, bool state) {
+    35e0:	41 54                	push   %r12
+    35e2:	41 89 f4             	mov    %esi,%r12d
+    35e5:	55                   	push   %rbp
+    35e6:	89 fd                	mov    %edi,%ebp
+
+    pthread_once(&vcd_once, VcdOpen);
+    if (vcd_file) {
+        change = VcdBegin();
+        VcdEnd(sprintf(change, "%c%s\n", state ? '1' : '0',
+                       VcdIdentifier(port * SOC_GPIO_BITS + bit, identifier)));
+    35e8:	45 0f b6 e4          	movzbl %r12b,%r12d
+void VcdGpio(uint8_t port, uint8_t bit, bool state) {
+    35ec:	53                   	push   %rbx
+    35ed:	89 d3                	mov    %edx,%ebx
+    35ef:	48 83 ec 10          	sub    $0x10,%rsp
+        change = VcdBegin();
+    35f3:	e8 08 f3 ff ff       	call   2900 <VcdBegin>
+                       VcdIdentifier(port * SOC_GPIO_BITS + bit, identifier)));
+    35f8:	40 0f b6 d5          	movzbl %bpl,%edx
+    35fc:	41 8d 14 d4          	lea    (%r12,%rdx,8),%edx
+        change = VcdBegin();
+    3600:	48 89 c7             	mov    %rax,%rdi
+        identifier[length++] = '!' + (index % 94);
+    3603:	89 d0                	mov    %edx,%eax
+    3605:	89 d1                	mov    %edx,%ecx
+    3607:	66 d1 e8             	shr    %ax
+    360a:	0f b7 c0             	movzwl %ax,%eax
+    360d:	69 c0 4d ae 00 00    	imul   $0xae4d,%eax,%eax
+    3613:	c1 e8 15             	shr    $0x15,%eax
+    3616:	6b f0 5e             	imul   $0x5e,%eax,%esi
+    3619:	29 f1                	sub    %esi,%ecx
+    361b:	83 c1 21             	add    $0x21,%ecx
+    361e:	88 4c 24 0c          	mov    %cl,0xc(%rsp)
+    } while (index > 0);
+    3622:	66 83 fa 5d          	cmp    $0x5d,%dx
+    3626:	76 3a                	jbe    3662 <VcdGpio.part.0+0x82>
+        identifier[length++] = '!' + (index % 94);
+    3628:	83 c0 21             	add    $0x21,%eax
+    362b:	88 44 24 0d          	mov    %al,0xd(%rsp)
+    362f:	b8 02 00 00 00       	mov    $0x2,%eax
+        VcdEnd(sprintf(change, "%c%s\n", state ? '1' : '0',
+    3634:	0f b6 d3             	movzbl %bl,%edx
+    identifier[length] = 0;
+    3637:	c6 44 04 0c 00       	movb   $0x0,0xc(%rsp,%rax,1)
+        VcdEnd(sprintf(change, "%c%s\n", state ? '1' : '0',
+    363c:	31 c0                	xor    %eax,%eax
+    363e:	48 8d 4c 24 0c       	lea    0xc(%rsp),%rcx
+    3643:	83 c2 30             	add    $0x30,%edx
+    3646:	48 8d 35 c3 4a 00 00 	lea    0x4ac3(%rip),%rsi        # 8110 <_IO_stdin_used+0x110>
+    364d:	e8 2e ed ff ff       	call   2380 <sprintf@plt>
+    3652:	89 c7                	mov    %eax,%edi
+    3654:	e8 e7 fe ff ff       	call   3540 <VcdEnd>
+    }
+}
+    3659:	48 83 c4 10          	add    $0x10,%rsp
+    365d:	5b                   	pop    %rbx
+    365e:	5d                   	pop    %rbp
+    365f:	41 5c                	pop    %r12
+    3661:	c3                   	ret
+        identifier[length++] = '!' + (index % 94);
+    3662:	b8 01 00 00 00       	mov    $0x1,%eax
+    3667:	eb cb                	jmp    3634 <VcdGpio.part.0+0x54>
+    3669:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000003670 <VcdFlush>:
+        VcdEnd(size);
+    }
+}
+
+void VcdFlush(void) {
+    if (vcd_file) {
+    3670:	48 83 3d 48 35 07 00 	cmpq   $0x0,0x73548(%rip)        # 76bc0 <vcd_file>
+    3677:	00 
+    3678:	74 56                	je     36d0 <VcdFlush+0x60>
+void VcdFlush(void) {
+    367a:	53                   	push   %rbx
+        pthread_mutex_lock(&vcd_lock);
+    367b:	48 8d 1d be f0 04 00 	lea    0x4f0be(%rip),%rbx        # 52740 <vcd_lock>
+    3682:	48 89 df             	mov    %rbx,%rdi
+    3685:	e8 96 ed ff ff       	call   2420 <pthread_mutex_lock@plt>
+        fwrite(vcd_buffer, 1, vcd_used, vcd_file);
+    368a:	48 8b 0d 2f 35 07 00 	mov    0x7352f(%rip),%rcx        # 76bc0 <vcd_file>
+    3691:	48 8b 15 88 f0 04 00 	mov    0x4f088(%rip),%rdx        # 52720 <vcd_used>
+    3698:	be 01 00 00 00       	mov    $0x1,%esi
+    369d:	48 8d 3d 7c f0 00 00 	lea    0xf07c(%rip),%rdi        # 12720 <vcd_buffer>
+    36a4:	e8 f7 ec ff ff       	call   23a0 <fwrite@plt>
+        fflush(vcd_file);
+    36a9:	48 8b 3d 10 35 07 00 	mov    0x73510(%rip),%rdi        # 76bc0 <vcd_file>
+    36b0:	e8 bb eb ff ff       	call   2270 <fflush@plt>
+        vcd_used = 0;
+        pthread_mutex_unlock(&vcd_lock);
+    36b5:	48 89 df             	mov    %rbx,%rdi
+    }
+}
+    36b8:	5b                   	pop    %rbx
+        vcd_used = 0;
+    36b9:	48 c7 05 5c f0 04 00 	movq   $0x0,0x4f05c(%rip)        # 52720 <vcd_used>
+    36c0:	00 00 00 00 
+        pthread_mutex_unlock(&vcd_lock);
+    36c4:	e9 97 eb ff ff       	jmp    2260 <pthread_mutex_unlock@plt>
+    36c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    36d0:	c3                   	ret
+    36d1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    36d8:	00 00 00 00 
+    36dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000036e0 <WireLoadNetlist>:
+    bool blocked;     /**< The last transmission was not fully accepted */
+} sci_links[WIRE_SCI_PORTS];
+
+/* === Private function implementation ========================================================= */
+
+static bool WireLoadNetlist(char const * name, char const * board) {
+    36e0:	41 57                	push   %r15
+    36e2:	41 56                	push   %r14
+    36e4:	41 55                	push   %r13
+    36e6:	41 54                	push   %r12
+    36e8:	49 89 fc             	mov    %rdi,%r12
+    char line[256], kind[8], endpoint[64];
+    int nets = 0, links = 0, number = 0, offset, used;
+    size_t length = strlen(board);
+    36eb:	48 89 f7             	mov    %rsi,%rdi
+static bool WireLoadNetlist(char const * name, char const * board) {
+    36ee:	55                   	push   %rbp
+    36ef:	53                   	push   %rbx
+    36f0:	48 81 ec a8 01 00 00 	sub    $0x1a8,%rsp
+    36f7:	48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    size_t length = strlen(board);
+    36fc:	e8 ff e9 ff ff       	call   2100 <strlen@plt>
+    FILE * file;
+
+    file = fopen(name, "r");
+    3701:	48 8d 35 c8 4b 00 00 	lea    0x4bc8(%rip),%rsi        # 82d0 <_IO_stdin_used+0x2d0>
+    3708:	4c 89 e7             	mov    %r12,%rdi
+    size_t length = strlen(board);
+    370b:	48 89 c5             	mov    %rax,%rbp
+    file = fopen(name, "r");
+    370e:	e8 0d ec ff ff       	call   2320 <fopen@plt>
+    3713:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    if (file == NULL) {
+    3718:	48 85 c0             	test   %rax,%rax
+    371b:	0f 84 41 03 00 00    	je     3a62 <WireLoadNetlist+0x382>
+            offset += used;
+            while (sscanf(&line[offset], "%63s%n", endpoint, &used) == 1) {
+                uint8_t port, bit;
+                offset += used;
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.')) {
+                    if (!GpioParseName(&endpoint[length + 1], &port, &bit)) {
+    3721:	48 8d 44 2c 61       	lea    0x61(%rsp,%rbp,1),%rax
+    int nets = 0, links = 0, number = 0, offset, used;
+    3726:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%rsp)
+    372d:	00 
+    372e:	4c 8d b4 24 a0 00 00 	lea    0xa0(%rsp),%r14
+    3735:	00 
+    3736:	c7 44 24 30 00 00 00 	movl   $0x0,0x30(%rsp)
+    373d:	00 
+    373e:	48 8d 5c 24 60       	lea    0x60(%rsp),%rbx
+    3743:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%rsp)
+    374a:	00 
+                    if (!GpioParseName(&endpoint[length + 1], &port, &bit)) {
+    374b:	48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    3750:	4c 89 64 24 38       	mov    %r12,0x38(%rsp)
+    3755:	0f 1f 00             	nopl   (%rax)
+    while (fgets(line, sizeof(line), file)) {
+    3758:	48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    375d:	be 00 01 00 00       	mov    $0x100,%esi
+    3762:	4c 89 f7             	mov    %r14,%rdi
+    3765:	e8 56 ea ff ff       	call   21c0 <fgets@plt>
+    376a:	48 85 c0             	test   %rax,%rax
+    376d:	0f 84 fd 01 00 00    	je     3970 <WireLoadNetlist+0x290>
+        if ((sscanf(line, "%7s%n", kind, &offset) != 1) || (kind[0] == '#')) {
+    3773:	31 c0                	xor    %eax,%eax
+    3775:	48 8d 4c 24 50       	lea    0x50(%rsp),%rcx
+    377a:	48 8d 54 24 58       	lea    0x58(%rsp),%rdx
+    377f:	4c 89 f7             	mov    %r14,%rdi
+    3782:	48 8d 35 a2 49 00 00 	lea    0x49a2(%rip),%rsi        # 812b <_IO_stdin_used+0x12b>
+        number++;
+    3789:	83 44 24 18 01       	addl   $0x1,0x18(%rsp)
+        if ((sscanf(line, "%7s%n", kind, &offset) != 1) || (kind[0] == '#')) {
+    378e:	e8 ed ea ff ff       	call   2280 <__isoc99_sscanf@plt>
+    3793:	83 f8 01             	cmp    $0x1,%eax
+    3796:	75 c0                	jne    3758 <WireLoadNetlist+0x78>
+    3798:	80 7c 24 58 23       	cmpb   $0x23,0x58(%rsp)
+    379d:	74 b9                	je     3758 <WireLoadNetlist+0x78>
+        if (strcmp(kind, "net") == 0) {
+    379f:	81 7c 24 58 6e 65 74 	cmpl   $0x74656e,0x58(%rsp)
+    37a6:	00 
+    37a7:	0f 84 b3 00 00 00    	je     3860 <WireLoadNetlist+0x180>
+                    }
+                    gpio_nets[port * SOC_GPIO_BITS + bit] = nets;
+                }
+            }
+            nets++;
+        } else if (strcmp(kind, "link") == 0) {
+    37ad:	81 7c 24 58 6c 69 6e 	cmpl   $0x6b6e696c,0x58(%rsp)
+    37b4:	6b 
+    37b5:	0f 84 9d 01 00 00    	je     3958 <WireLoadNetlist+0x278>
+    37bb:	b8 01 00 00 00       	mov    $0x1,%eax
+            if (links >= WIRE_LINKS) {
+    37c0:	8b 4c 24 30          	mov    0x30(%rsp),%ecx
+    37c4:	83 f9 0f             	cmp    $0xf,%ecx
+    37c7:	0f 8f a3 01 00 00    	jg     3970 <WireLoadNetlist+0x290>
+    37cd:	85 c0                	test   %eax,%eax
+    37cf:	0f 85 9b 01 00 00    	jne    3970 <WireLoadNetlist+0x290>
+    37d5:	89 c8                	mov    %ecx,%eax
+    37d7:	4c 8d 2d 57 49 00 00 	lea    0x4957(%rip),%r13        # 8135 <_IO_stdin_used+0x135>
+    37de:	88 4c 24 37          	mov    %cl,0x37(%rsp)
+    37e2:	4c 8d 7c 24 4c       	lea    0x4c(%rsp),%r15
+    37e7:	01 c0                	add    %eax,%eax
+    37e9:	4c 89 6c 24 20       	mov    %r13,0x20(%rsp)
+    37ee:	8d 48 01             	lea    0x1(%rax),%ecx
+    37f1:	41 89 c4             	mov    %eax,%r12d
+    37f4:	41 89 cd             	mov    %ecx,%r13d
+                break;
+            }
+            for (int side = 0; side < 2; side++) {
+                unsigned int port;
+                if (sscanf(&line[offset], "%63s%n", endpoint, &used) != 1) {
+    37f7:	48 63 7c 24 50       	movslq 0x50(%rsp),%rdi
+    37fc:	48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    3801:	31 c0                	xor    %eax,%eax
+    3803:	4c 89 f9             	mov    %r15,%rcx
+    3806:	48 89 da             	mov    %rbx,%rdx
+    3809:	4c 01 f7             	add    %r14,%rdi
+    380c:	e8 6f ea ff ff       	call   2280 <__isoc99_sscanf@plt>
+    3811:	83 f8 01             	cmp    $0x1,%eax
+    3814:	75 3a                	jne    3850 <WireLoadNetlist+0x170>
+                    break;
+                }
+                offset += used;
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.') &&
+    3816:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    381b:	48 89 ea             	mov    %rbp,%rdx
+    381e:	48 89 df             	mov    %rbx,%rdi
+                offset += used;
+    3821:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+    3825:	01 44 24 50          	add    %eax,0x50(%rsp)
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.') &&
+    3829:	e8 52 e8 ff ff       	call   2080 <strncmp@plt>
+    382e:	85 c0                	test   %eax,%eax
+    3830:	75 0b                	jne    383d <WireLoadNetlist+0x15d>
+    3832:	80 7c 2c 60 2e       	cmpb   $0x2e,0x60(%rsp,%rbp,1)
+    3837:	0f 84 73 01 00 00    	je     39b0 <WireLoadNetlist+0x2d0>
+            for (int side = 0; side < 2; side++) {
+    383d:	41 8d 45 ff          	lea    -0x1(%r13),%eax
+    3841:	45 38 ec             	cmp    %r13b,%r12b
+    3844:	74 0a                	je     3850 <WireLoadNetlist+0x170>
+    3846:	41 89 c5             	mov    %eax,%r13d
+    3849:	eb ac                	jmp    37f7 <WireLoadNetlist+0x117>
+    384b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                    /* The pipe 2 * link carries the data from the first to the second side */
+                    sci_links[port].transmit = 2 * links + side;
+                    sci_links[port].receive = 2 * links + 1 - side;
+                }
+            }
+            links++;
+    3850:	83 44 24 30 01       	addl   $0x1,0x30(%rsp)
+    3855:	e9 fe fe ff ff       	jmp    3758 <WireLoadNetlist+0x78>
+    385a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            if ((nets >= WIRE_NETS) || (sscanf(&line[offset], "%63s%n", endpoint, &used) != 1)) {
+    3860:	83 7c 24 1c 3f       	cmpl   $0x3f,0x1c(%rsp)
+    3865:	0f 8f 05 01 00 00    	jg     3970 <WireLoadNetlist+0x290>
+    386b:	48 63 7c 24 50       	movslq 0x50(%rsp),%rdi
+    3870:	4c 8d 7c 24 4c       	lea    0x4c(%rsp),%r15
+    3875:	31 c0                	xor    %eax,%eax
+    3877:	48 89 da             	mov    %rbx,%rdx
+    387a:	4c 8d 2d b4 48 00 00 	lea    0x48b4(%rip),%r13        # 8135 <_IO_stdin_used+0x135>
+    3881:	4c 89 f9             	mov    %r15,%rcx
+    3884:	4c 01 f7             	add    %r14,%rdi
+    3887:	4c 89 ee             	mov    %r13,%rsi
+    388a:	e8 f1 e9 ff ff       	call   2280 <__isoc99_sscanf@plt>
+    388f:	83 f8 01             	cmp    $0x1,%eax
+    3892:	0f 85 d8 00 00 00    	jne    3970 <WireLoadNetlist+0x290>
+            offset += used;
+    3898:	8b 4c 24 4c          	mov    0x4c(%rsp),%ecx
+                    if (!GpioParseName(&endpoint[length + 1], &port, &bit)) {
+    389c:	48 8d 44 24 4b       	lea    0x4b(%rsp),%rax
+            offset += used;
+    38a1:	03 4c 24 50          	add    0x50(%rsp),%ecx
+    38a5:	89 4c 24 50          	mov    %ecx,0x50(%rsp)
+    38a9:	41 89 cc             	mov    %ecx,%r12d
+                    if (!GpioParseName(&endpoint[length + 1], &port, &bit)) {
+    38ac:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    38b1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            while (sscanf(&line[offset], "%63s%n", endpoint, &used) == 1) {
+    38b8:	49 63 fc             	movslq %r12d,%rdi
+    38bb:	31 c0                	xor    %eax,%eax
+    38bd:	4c 89 f9             	mov    %r15,%rcx
+    38c0:	48 89 da             	mov    %rbx,%rdx
+    38c3:	4c 01 f7             	add    %r14,%rdi
+    38c6:	4c 89 ee             	mov    %r13,%rsi
+    38c9:	e8 b2 e9 ff ff       	call   2280 <__isoc99_sscanf@plt>
+    38ce:	83 f8 01             	cmp    $0x1,%eax
+    38d1:	75 75                	jne    3948 <WireLoadNetlist+0x268>
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.')) {
+    38d3:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+                offset += used;
+    38d8:	44 8b 64 24 4c       	mov    0x4c(%rsp),%r12d
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.')) {
+    38dd:	48 89 ea             	mov    %rbp,%rdx
+    38e0:	48 89 df             	mov    %rbx,%rdi
+                offset += used;
+    38e3:	44 03 64 24 50       	add    0x50(%rsp),%r12d
+    38e8:	44 89 64 24 50       	mov    %r12d,0x50(%rsp)
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.')) {
+    38ed:	e8 8e e7 ff ff       	call   2080 <strncmp@plt>
+    38f2:	85 c0                	test   %eax,%eax
+    38f4:	75 c2                	jne    38b8 <WireLoadNetlist+0x1d8>
+    38f6:	80 7c 2c 60 2e       	cmpb   $0x2e,0x60(%rsp,%rbp,1)
+    38fb:	75 bb                	jne    38b8 <WireLoadNetlist+0x1d8>
+                    if (!GpioParseName(&endpoint[length + 1], &port, &bit)) {
+    38fd:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+    3902:	48 8b 7c 24 28       	mov    0x28(%rsp),%rdi
+    3907:	48 8d 74 24 54       	lea    0x54(%rsp),%rsi
+    390c:	e8 2f fb ff ff       	call   3440 <GpioParseName>
+    3911:	84 c0                	test   %al,%al
+    3913:	0f 84 11 01 00 00    	je     3a2a <WireLoadNetlist+0x34a>
+                    gpio_nets[port * SOC_GPIO_BITS + bit] = nets;
+    3919:	0f b6 54 24 54       	movzbl 0x54(%rsp),%edx
+    391e:	0f b6 44 24 4b       	movzbl 0x4b(%rsp),%eax
+    3923:	48 8d 0d d6 ed 00 00 	lea    0xedd6(%rip),%rcx        # 12700 <gpio_nets>
+            while (sscanf(&line[offset], "%63s%n", endpoint, &used) == 1) {
+    392a:	44 8b 64 24 50       	mov    0x50(%rsp),%r12d
+                    gpio_nets[port * SOC_GPIO_BITS + bit] = nets;
+    392f:	8d 04 d0             	lea    (%rax,%rdx,8),%eax
+    3932:	0f b6 54 24 1c       	movzbl 0x1c(%rsp),%edx
+    3937:	48 98                	cltq
+    3939:	88 14 01             	mov    %dl,(%rcx,%rax,1)
+    393c:	e9 77 ff ff ff       	jmp    38b8 <WireLoadNetlist+0x1d8>
+    3941:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nets++;
+    3948:	83 44 24 1c 01       	addl   $0x1,0x1c(%rsp)
+    394d:	e9 06 fe ff ff       	jmp    3758 <WireLoadNetlist+0x78>
+    3952:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        } else if (strcmp(kind, "link") == 0) {
+    3958:	31 c0                	xor    %eax,%eax
+    395a:	80 7c 24 5c 00       	cmpb   $0x0,0x5c(%rsp)
+    395f:	0f 84 5b fe ff ff    	je     37c0 <WireLoadNetlist+0xe0>
+    3965:	e9 51 fe ff ff       	jmp    37bb <WireLoadNetlist+0xdb>
+    396a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        } else {
+            break;
+        }
+    }
+    bool valid = feof(file);
+    3970:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+    3975:	4c 8b 64 24 38       	mov    0x38(%rsp),%r12
+    397a:	4c 89 ff             	mov    %r15,%rdi
+    397d:	e8 ae e8 ff ff       	call   2230 <feof@plt>
+    fclose(file);
+    3982:	4c 89 ff             	mov    %r15,%rdi
+    bool valid = feof(file);
+    3985:	89 c3                	mov    %eax,%ebx
+    fclose(file);
+    3987:	e8 64 e7 ff ff       	call   20f0 <fclose@plt>
+    if (!valid) {
+        fprintf(stderr, "wire: error in line %d of %s\n", number, name);
+    }
+    return valid;
+    398c:	b8 01 00 00 00       	mov    $0x1,%eax
+    if (!valid) {
+    3991:	85 db                	test   %ebx,%ebx
+    3993:	74 6f                	je     3a04 <WireLoadNetlist+0x324>
+}
+    3995:	48 81 c4 a8 01 00 00 	add    $0x1a8,%rsp
+    399c:	5b                   	pop    %rbx
+    399d:	5d                   	pop    %rbp
+    399e:	41 5c                	pop    %r12
+    39a0:	41 5d                	pop    %r13
+    39a2:	41 5e                	pop    %r14
+    39a4:	41 5f                	pop    %r15
+    39a6:	c3                   	ret
+    39a7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    39ae:	00 00 
+                    (sscanf(&endpoint[length + 1], "sci%u", &port) == 1) &&
+    39b0:	48 8d 54 24 54       	lea    0x54(%rsp),%rdx
+    39b5:	48 8d 7c 2b 01       	lea    0x1(%rbx,%rbp,1),%rdi
+    39ba:	48 8d 35 80 47 00 00 	lea    0x4780(%rip),%rsi        # 8141 <_IO_stdin_used+0x141>
+    39c1:	e8 ba e8 ff ff       	call   2280 <__isoc99_sscanf@plt>
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.') &&
+    39c6:	83 f8 01             	cmp    $0x1,%eax
+    39c9:	0f 85 6e fe ff ff    	jne    383d <WireLoadNetlist+0x15d>
+                    (port < WIRE_SCI_PORTS)) {
+    39cf:	8b 44 24 54          	mov    0x54(%rsp),%eax
+                    (sscanf(&endpoint[length + 1], "sci%u", &port) == 1) &&
+    39d3:	83 f8 03             	cmp    $0x3,%eax
+    39d6:	0f 87 61 fe ff ff    	ja     383d <WireLoadNetlist+0x15d>
+                    sci_links[port].transmit = 2 * links + side;
+    39dc:	0f b6 4c 24 37       	movzbl 0x37(%rsp),%ecx
+    39e1:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+    39e5:	48 8d 05 b4 31 07 00 	lea    0x731b4(%rip),%rax        # 76ba0 <sci_links>
+    39ec:	48 01 d0             	add    %rdx,%rax
+    39ef:	8d 14 8d 01 00 00 00 	lea    0x1(,%rcx,4),%edx
+                    sci_links[port].receive = 2 * links + 1 - side;
+    39f6:	44 88 68 01          	mov    %r13b,0x1(%rax)
+                    sci_links[port].transmit = 2 * links + side;
+    39fa:	44 29 ea             	sub    %r13d,%edx
+    39fd:	88 10                	mov    %dl,(%rax)
+                    sci_links[port].receive = 2 * links + 1 - side;
+    39ff:	e9 39 fe ff ff       	jmp    383d <WireLoadNetlist+0x15d>
+        fprintf(stderr, "wire: error in line %d of %s\n", number, name);
+    3a04:	48 8b 05 d5 75 00 00 	mov    0x75d5(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    3a0b:	8b 54 24 18          	mov    0x18(%rsp),%edx
+    3a0f:	4c 89 e1             	mov    %r12,%rcx
+    3a12:	48 8d 35 2e 47 00 00 	lea    0x472e(%rip),%rsi        # 8147 <_IO_stdin_used+0x147>
+    3a19:	48 8b 38             	mov    (%rax),%rdi
+    3a1c:	31 c0                	xor    %eax,%eax
+    3a1e:	e8 ed e7 ff ff       	call   2210 <fprintf@plt>
+        return false;
+    3a23:	31 c0                	xor    %eax,%eax
+    3a25:	e9 6b ff ff ff       	jmp    3995 <WireLoadNetlist+0x2b5>
+                        fprintf(stderr, "wire: unknown terminal %s in line %d of %s\n", endpoint,
+    3a2a:	48 8b 05 af 75 00 00 	mov    0x75af(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    3a31:	4c 8b 64 24 38       	mov    0x38(%rsp),%r12
+    3a36:	48 89 da             	mov    %rbx,%rdx
+    3a39:	48 8d 35 70 4a 00 00 	lea    0x4a70(%rip),%rsi        # 84b0 <_IO_stdin_used+0x4b0>
+    3a40:	8b 4c 24 18          	mov    0x18(%rsp),%ecx
+    3a44:	48 8b 38             	mov    (%rax),%rdi
+    3a47:	4d 89 e0             	mov    %r12,%r8
+    3a4a:	31 c0                	xor    %eax,%eax
+    3a4c:	e8 bf e7 ff ff       	call   2210 <fprintf@plt>
+                        fclose(file);
+    3a51:	48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    3a56:	e8 95 e6 ff ff       	call   20f0 <fclose@plt>
+        return false;
+    3a5b:	31 c0                	xor    %eax,%eax
+    3a5d:	e9 33 ff ff ff       	jmp    3995 <WireLoadNetlist+0x2b5>
+        fprintf(stderr, "wire: can't open %s\n", name);
+    3a62:	48 8b 05 77 75 00 00 	mov    0x7577(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    3a69:	4c 89 e2             	mov    %r12,%rdx
+    3a6c:	48 8d 35 a3 46 00 00 	lea    0x46a3(%rip),%rsi        # 8116 <_IO_stdin_used+0x116>
+    3a73:	48 8b 38             	mov    (%rax),%rdi
+    3a76:	31 c0                	xor    %eax,%eax
+    3a78:	e8 93 e7 ff ff       	call   2210 <fprintf@plt>
+        return false;
+    3a7d:	31 c0                	xor    %eax,%eax
+    3a7f:	e9 11 ff ff ff       	jmp    3995 <WireLoadNetlist+0x2b5>
+    3a84:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3a8b:	00 00 00 00 
+    3a8f:	90                   	nop
+
+0000000000003a90 <WireOpen>:
+
+static void WireOpen(void) {
+    3a90:	41 54                	push   %r12
+    char const * netlist = getenv(WIRE_NETLIST_ENVIRONMENT);
+    3a92:	48 8d 3d d6 46 00 00 	lea    0x46d6(%rip),%rdi        # 816f <_IO_stdin_used+0x16f>
+static void WireOpen(void) {
+    3a99:	55                   	push   %rbp
+    3a9a:	53                   	push   %rbx
+    char const * netlist = getenv(WIRE_NETLIST_ENVIRONMENT);
+    3a9b:	e8 90 e5 ff ff       	call   2030 <getenv@plt>
+    char const * board = getenv(WIRE_BOARD_ENVIRONMENT);
+    3aa0:	48 8d 3d d5 46 00 00 	lea    0x46d5(%rip),%rdi        # 817c <_IO_stdin_used+0x17c>
+    char const * netlist = getenv(WIRE_NETLIST_ENVIRONMENT);
+    3aa7:	48 89 c3             	mov    %rax,%rbx
+    char const * board = getenv(WIRE_BOARD_ENVIRONMENT);
+    3aaa:	e8 81 e5 ff ff       	call   2030 <getenv@plt>
+    char const * name = getenv(WIRE_BUS_ENVIRONMENT);
+    3aaf:	48 8d 3d d1 46 00 00 	lea    0x46d1(%rip),%rdi        # 8187 <_IO_stdin_used+0x187>
+    char const * board = getenv(WIRE_BOARD_ENVIRONMENT);
+    3ab6:	49 89 c4             	mov    %rax,%r12
+    char const * name = getenv(WIRE_BUS_ENVIRONMENT);
+    3ab9:	e8 72 e5 ff ff       	call   2030 <getenv@plt>
+    void * memory;
+    int file;
+
+    memset(gpio_nets, WIRE_NONE, sizeof(gpio_nets));
+    for (int port = 0; port < WIRE_SCI_PORTS; port++) {
+        sci_links[port].transmit = WIRE_NONE;
+    3abe:	0f b7 15 d7 4f 00 00 	movzwl 0x4fd7(%rip),%edx        # 8a9c <data.2+0x5c>
+    memset(gpio_nets, WIRE_NONE, sizeof(gpio_nets));
+    3ac5:	66 0f 76 c0          	pcmpeqd %xmm0,%xmm0
+    3ac9:	0f 29 05 30 ec 00 00 	movaps %xmm0,0xec30(%rip)        # 12700 <gpio_nets>
+        sci_links[port].transmit = WIRE_NONE;
+    3ad0:	66 89 15 c9 30 07 00 	mov    %dx,0x730c9(%rip)        # 76ba0 <sci_links>
+    3ad7:	66 89 15 c5 30 07 00 	mov    %dx,0x730c5(%rip)        # 76ba3 <sci_links+0x3>
+    3ade:	66 89 15 c1 30 07 00 	mov    %dx,0x730c1(%rip)        # 76ba6 <sci_links+0x6>
+    3ae5:	66 89 15 bd 30 07 00 	mov    %dx,0x730bd(%rip)        # 76ba9 <sci_links+0x9>
+    memset(gpio_nets, WIRE_NONE, sizeof(gpio_nets));
+    3aec:	0f 29 05 1d ec 00 00 	movaps %xmm0,0xec1d(%rip)        # 12710 <gpio_nets+0x10>
+        sci_links[port].receive = WIRE_NONE;
+    }
+    if ((netlist == NULL) || (board == NULL) || JournalReplaying() ||
+    3af3:	48 85 db             	test   %rbx,%rbx
+    3af6:	0f 84 cc 00 00 00    	je     3bc8 <WireOpen+0x138>
+    3afc:	4d 85 e4             	test   %r12,%r12
+    3aff:	0f 84 c3 00 00 00    	je     3bc8 <WireOpen+0x138>
+
+/* === Public function implementation ========================================================== */
+
+void JournalStart(void) {
+    pthread_once(&journal_once, JournalOpen);
+    3b05:	48 8d 35 54 f7 ff ff 	lea    -0x8ac(%rip),%rsi        # 3260 <JournalOpen>
+    3b0c:	48 8d 3d 3d ef 06 00 	lea    0x6ef3d(%rip),%rdi        # 72a50 <journal_once>
+    3b13:	48 89 c5             	mov    %rax,%rbp
+    3b16:	e8 d5 e8 ff ff       	call   23f0 <pthread_once@plt>
+    3b1b:	48 83 3d ad ee 06 00 	cmpq   $0x0,0x6eead(%rip)        # 729d0 <journal_replay>
+    3b22:	00 
+    3b23:	0f 85 9f 00 00 00    	jne    3bc8 <WireOpen+0x138>
+        !WireLoadNetlist(netlist, board)) {
+    3b29:	4c 89 e6             	mov    %r12,%rsi
+    3b2c:	48 89 df             	mov    %rbx,%rdi
+    3b2f:	e8 ac fb ff ff       	call   36e0 <WireLoadNetlist>
+    if ((netlist == NULL) || (board == NULL) || JournalReplaying() ||
+    3b34:	84 c0                	test   %al,%al
+    3b36:	0f 84 8c 00 00 00    	je     3bc8 <WireOpen+0x138>
+        return;
+    }
+
+    file = shm_open(name ? name : WIRE_BUS_DEFAULT, O_RDWR | O_CREAT, 0600);
+    3b3c:	48 85 ed             	test   %rbp,%rbp
+    3b3f:	ba 80 01 00 00       	mov    $0x180,%edx
+    3b44:	be 42 00 00 00       	mov    $0x42,%esi
+    3b49:	48 8d 05 15 46 00 00 	lea    0x4615(%rip),%rax        # 8165 <_IO_stdin_used+0x165>
+    3b50:	48 0f 44 e8          	cmove  %rax,%rbp
+    3b54:	48 89 ef             	mov    %rbp,%rdi
+    3b57:	e8 54 e8 ff ff       	call   23b0 <shm_open@plt>
+    3b5c:	89 c3                	mov    %eax,%ebx
+    if (file < 0) {
+    3b5e:	85 c0                	test   %eax,%eax
+    3b60:	0f 88 ab 00 00 00    	js     3c11 <WireOpen+0x181>
+        return;
+    }
+    /* Every connected program keeps a shared lock on the object until it ends, even if it crashes,
+     * so the program that gets the exclusive lock is the first of the session and it clears the
+     * states left by the previous one. The others wait in the shared lock until it is cleared */
+    if ((flock(file, LOCK_EX | LOCK_NB) == 0) && (ftruncate(file, 0) != 0)) {
+    3b66:	be 06 00 00 00       	mov    $0x6,%esi
+    3b6b:	89 c7                	mov    %eax,%edi
+    3b6d:	e8 ce e7 ff ff       	call   2340 <flock@plt>
+    3b72:	85 c0                	test   %eax,%eax
+    3b74:	0f 84 bb 00 00 00    	je     3c35 <WireOpen+0x1a5>
+        fprintf(stderr, "wire: can't clear the shared memory\n");
+    }
+    if ((ftruncate(file, sizeof(struct wire_bus_s)) != 0) || (flock(file, LOCK_SH) != 0)) {
+    3b7a:	be 48 01 02 00       	mov    $0x20148,%esi
+    3b7f:	89 df                	mov    %ebx,%edi
+    3b81:	e8 fa e5 ff ff       	call   2180 <ftruncate@plt>
+    3b86:	85 c0                	test   %eax,%eax
+    3b88:	75 10                	jne    3b9a <WireOpen+0x10a>
+    3b8a:	be 01 00 00 00       	mov    $0x1,%esi
+    3b8f:	89 df                	mov    %ebx,%edi
+    3b91:	e8 aa e7 ff ff       	call   2340 <flock@plt>
+    3b96:	85 c0                	test   %eax,%eax
+    3b98:	74 33                	je     3bcd <WireOpen+0x13d>
+        fprintf(stderr, "wire: can't open the shared memory\n");
+    3b9a:	48 8b 05 3f 74 00 00 	mov    0x743f(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    3ba1:	ba 23 00 00 00       	mov    $0x23,%edx
+    3ba6:	be 01 00 00 00       	mov    $0x1,%esi
+    3bab:	48 8d 3d 2e 49 00 00 	lea    0x492e(%rip),%rdi        # 84e0 <_IO_stdin_used+0x4e0>
+    3bb2:	48 8b 08             	mov    (%rax),%rcx
+    3bb5:	e8 e6 e7 ff ff       	call   23a0 <fwrite@plt>
+        close(file);
+        return;
+    }
+    memory = mmap(NULL, sizeof(struct wire_bus_s), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (memory == MAP_FAILED) {
+        close(file);
+    3bba:	89 df                	mov    %ebx,%edi
+        return;
+    }
+    bus = memory;
+    pthread_create(&thread, NULL, WireThread, NULL);
+}
+    3bbc:	5b                   	pop    %rbx
+    3bbd:	5d                   	pop    %rbp
+    3bbe:	41 5c                	pop    %r12
+        close(file);
+    3bc0:	e9 cb e5 ff ff       	jmp    2190 <close@plt>
+    3bc5:	0f 1f 00             	nopl   (%rax)
+}
+    3bc8:	5b                   	pop    %rbx
+    3bc9:	5d                   	pop    %rbp
+    3bca:	41 5c                	pop    %r12
+    3bcc:	c3                   	ret
+    memory = mmap(NULL, sizeof(struct wire_bus_s), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    3bcd:	45 31 c9             	xor    %r9d,%r9d
+    3bd0:	31 ff                	xor    %edi,%edi
+    3bd2:	41 89 d8             	mov    %ebx,%r8d
+    3bd5:	b9 01 00 00 00       	mov    $0x1,%ecx
+    3bda:	ba 03 00 00 00       	mov    $0x3,%edx
+    3bdf:	be 48 01 02 00       	mov    $0x20148,%esi
+    3be4:	e8 27 e5 ff ff       	call   2110 <mmap@plt>
+    if (memory == MAP_FAILED) {
+    3be9:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+    3bed:	74 cb                	je     3bba <WireOpen+0x12a>
+}
+    3bef:	5b                   	pop    %rbx
+    pthread_create(&thread, NULL, WireThread, NULL);
+    3bf0:	31 c9                	xor    %ecx,%ecx
+}
+    3bf2:	5d                   	pop    %rbp
+    pthread_create(&thread, NULL, WireThread, NULL);
+    3bf3:	31 f6                	xor    %esi,%esi
+    3bf5:	48 8d 15 14 2e 00 00 	lea    0x2e14(%rip),%rdx        # 6a10 <WireThread>
+    3bfc:	48 8d 3d dd ea 00 00 	lea    0xeadd(%rip),%rdi        # 126e0 <thread.0.lto_priv.1>
+}
+    3c03:	41 5c                	pop    %r12
+    bus = memory;
+    3c05:	48 89 05 a4 2f 07 00 	mov    %rax,0x72fa4(%rip)        # 76bb0 <bus>
+    pthread_create(&thread, NULL, WireThread, NULL);
+    3c0c:	e9 cf e6 ff ff       	jmp    22e0 <pthread_create@plt>
+        fprintf(stderr, "wire: can't open the shared memory\n");
+    3c11:	48 8b 05 c8 73 00 00 	mov    0x73c8(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+}
+    3c18:	5b                   	pop    %rbx
+        fprintf(stderr, "wire: can't open the shared memory\n");
+    3c19:	ba 23 00 00 00       	mov    $0x23,%edx
+    3c1e:	be 01 00 00 00       	mov    $0x1,%esi
+}
+    3c23:	5d                   	pop    %rbp
+        fprintf(stderr, "wire: can't open the shared memory\n");
+    3c24:	48 8d 3d b5 48 00 00 	lea    0x48b5(%rip),%rdi        # 84e0 <_IO_stdin_used+0x4e0>
+}
+    3c2b:	41 5c                	pop    %r12
+        fprintf(stderr, "wire: can't open the shared memory\n");
+    3c2d:	48 8b 08             	mov    (%rax),%rcx
+    3c30:	e9 6b e7 ff ff       	jmp    23a0 <fwrite@plt>
+    if ((flock(file, LOCK_EX | LOCK_NB) == 0) && (ftruncate(file, 0) != 0)) {
+    3c35:	31 f6                	xor    %esi,%esi
+    3c37:	89 df                	mov    %ebx,%edi
+    3c39:	e8 42 e5 ff ff       	call   2180 <ftruncate@plt>
+    3c3e:	85 c0                	test   %eax,%eax
+    3c40:	0f 84 34 ff ff ff    	je     3b7a <WireOpen+0xea>
+        fprintf(stderr, "wire: can't clear the shared memory\n");
+    3c46:	48 8b 05 93 73 00 00 	mov    0x7393(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    3c4d:	ba 24 00 00 00       	mov    $0x24,%edx
+    3c52:	be 01 00 00 00       	mov    $0x1,%esi
+    3c57:	48 8d 3d aa 48 00 00 	lea    0x48aa(%rip),%rdi        # 8508 <_IO_stdin_used+0x508>
+    3c5e:	48 8b 08             	mov    (%rax),%rcx
+    3c61:	e8 3a e7 ff ff       	call   23a0 <fwrite@plt>
+    3c66:	e9 0f ff ff ff       	jmp    3b7a <WireOpen+0xea>
+    3c6b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000003c70 <WireNotify>:
+
+static void WireNotify(void) {
+    __atomic_add_fetch(&bus->generation, 1, __ATOMIC_SEQ_CST);
+    3c70:	48 8b 05 39 2f 07 00 	mov    0x72f39(%rip),%rax        # 76bb0 <bus>
+    3c77:	f0 83 00 01          	lock addl $0x1,(%rax)
+    if (__atomic_load_n(&bus->waiters, __ATOMIC_SEQ_CST)) {
+    3c7b:	48 8b 05 2e 2f 07 00 	mov    0x72f2e(%rip),%rax        # 76bb0 <bus>
+    3c82:	8b 40 04             	mov    0x4(%rax),%eax
+    3c85:	85 c0                	test   %eax,%eax
+    3c87:	75 07                	jne    3c90 <WireNotify+0x20>
+    3c89:	c3                   	ret
+    3c8a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+static void WireNotify(void) {
+    3c90:	48 83 ec 10          	sub    $0x10,%rsp
+        syscall(SYS_futex, &bus->generation, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    3c94:	48 8b 35 15 2f 07 00 	mov    0x72f15(%rip),%rsi        # 76bb0 <bus>
+    3c9b:	45 31 c9             	xor    %r9d,%r9d
+    3c9e:	31 c0                	xor    %eax,%eax
+    3ca0:	6a 00                	push   $0x0
+    3ca2:	45 31 c0             	xor    %r8d,%r8d
+    3ca5:	b9 ff ff ff 7f       	mov    $0x7fffffff,%ecx
+    3caa:	ba 01 00 00 00       	mov    $0x1,%edx
+    3caf:	bf ca 00 00 00       	mov    $0xca,%edi
+    3cb4:	e8 67 e5 ff ff       	call   2220 <syscall@plt>
+    }
+}
+    3cb9:	48 83 c4 18          	add    $0x18,%rsp
+    3cbd:	c3                   	ret
+    3cbe:	66 90                	xchg   %ax,%ax
+
+0000000000003cc0 <WireGpio>:
+
+void WireStart(void) {
+    pthread_once(&wire_once, WireOpen);
+}
+
+void WireGpio(uint8_t port, uint8_t bit, bool state) {
+    3cc0:	41 54                	push   %r12
+    3cc2:	41 89 d4             	mov    %edx,%r12d
+    3cc5:	55                   	push   %rbp
+    3cc6:	89 fd                	mov    %edi,%ebp
+    pthread_once(&wire_once, WireOpen);
+    3cc8:	48 8d 3d e9 2e 07 00 	lea    0x72ee9(%rip),%rdi        # 76bb8 <wire_once>
+void WireGpio(uint8_t port, uint8_t bit, bool state) {
+    3ccf:	53                   	push   %rbx
+    3cd0:	89 f3                	mov    %esi,%ebx
+    uint8_t net;
+
+    WireStart();
+    net = gpio_nets[port * SOC_GPIO_BITS + bit];
+    3cd2:	40 0f b6 ed          	movzbl %bpl,%ebp
+    pthread_once(&wire_once, WireOpen);
+    3cd6:	48 8d 35 b3 fd ff ff 	lea    -0x24d(%rip),%rsi        # 3a90 <WireOpen>
+    net = gpio_nets[port * SOC_GPIO_BITS + bit];
+    3cdd:	0f b6 db             	movzbl %bl,%ebx
+    pthread_once(&wire_once, WireOpen);
+    3ce0:	e8 0b e7 ff ff       	call   23f0 <pthread_once@plt>
+    net = gpio_nets[port * SOC_GPIO_BITS + bit];
+    3ce5:	8d 04 eb             	lea    (%rbx,%rbp,8),%eax
+    3ce8:	48 8d 15 11 ea 00 00 	lea    0xea11(%rip),%rdx        # 12700 <gpio_nets>
+    if (bus && (net != WIRE_NONE) && (bus->nets[net] != state)) {
+    3cef:	48 8b 0d ba 2e 07 00 	mov    0x72eba(%rip),%rcx        # 76bb0 <bus>
+    net = gpio_nets[port * SOC_GPIO_BITS + bit];
+    3cf6:	48 98                	cltq
+    3cf8:	0f b6 14 02          	movzbl (%rdx,%rax,1),%edx
+    if (bus && (net != WIRE_NONE) && (bus->nets[net] != state)) {
+    3cfc:	80 fa ff             	cmp    $0xff,%dl
+    3cff:	74 2f                	je     3d30 <WireGpio+0x70>
+    3d01:	48 85 c9             	test   %rcx,%rcx
+    3d04:	74 2a                	je     3d30 <WireGpio+0x70>
+    3d06:	0f b6 74 11 08       	movzbl 0x8(%rcx,%rdx,1),%esi
+    3d0b:	44 38 e6             	cmp    %r12b,%sil
+    3d0e:	74 20                	je     3d30 <WireGpio+0x70>
+        gpio_levels[port * SOC_GPIO_BITS + bit] = state;
+        bus->nets[net] = state;
+    3d10:	44 88 64 11 08       	mov    %r12b,0x8(%rcx,%rdx,1)
+        gpio_levels[port * SOC_GPIO_BITS + bit] = state;
+    3d15:	48 8d 35 a4 e9 00 00 	lea    0xe9a4(%rip),%rsi        # 126c0 <gpio_levels>
+    3d1c:	44 88 24 06          	mov    %r12b,(%rsi,%rax,1)
+        WireNotify();
+    }
+}
+    3d20:	5b                   	pop    %rbx
+    3d21:	5d                   	pop    %rbp
+    3d22:	41 5c                	pop    %r12
+        WireNotify();
+    3d24:	e9 47 ff ff ff       	jmp    3c70 <WireNotify>
+    3d29:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+}
+    3d30:	5b                   	pop    %rbx
+    3d31:	5d                   	pop    %rbp
+    3d32:	41 5c                	pop    %r12
+    3d34:	c3                   	ret
+    3d35:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3d3c:	00 00 00 00 
+
+0000000000003d40 <gpio_bit_set_bench>:
+    for (uint32_t index = 0; index < iterations; index++) {
+    3d40:	85 ff                	test   %edi,%edi
+    3d42:	0f 84 18 01 00 00    	je     3e60 <gpio_bit_set_bench+0x120>
+BENCH(gpio, bit_set) {
+    3d48:	41 57                	push   %r15
+    3d4a:	4c 8d 3d 9f 2e 07 00 	lea    0x72e9f(%rip),%r15        # 76bf0 <gpio_stuck>
+    3d51:	41 56                	push   %r14
+    3d53:	41 89 fe             	mov    %edi,%r14d
+    3d56:	41 55                	push   %r13
+    for (uint32_t index = 0; index < iterations; index++) {
+    3d58:	45 31 ed             	xor    %r13d,%r13d
+BENCH(gpio, bit_set) {
+    3d5b:	41 54                	push   %r12
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    3d5d:	4c 8d 25 6c 2e 07 00 	lea    0x72e6c(%rip),%r12        # 76bd0 <gpio_outputs>
+    3d64:	55                   	push   %rbp
+        bool previous = __atomic_fetch_or(port, mask, __ATOMIC_RELAXED) & mask;
+    3d65:	48 8d 2d 74 2e 07 00 	lea    0x72e74(%rip),%rbp        # 76be0 <gpio_emulation>
+    3d6c:	53                   	push   %rbx
+    3d6d:	48 83 ec 18          	sub    $0x18,%rsp
+    3d71:	eb 12                	jmp    3d85 <gpio_bit_set_bench+0x45>
+    3d73:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    for (uint32_t index = 0; index < iterations; index++) {
+    3d78:	41 83 c5 01          	add    $0x1,%r13d
+    3d7c:	45 39 ee             	cmp    %r13d,%r14d
+    3d7f:	0f 84 c2 00 00 00    	je     3e47 <gpio_bit_set_bench+0x107>
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    3d85:	0f b6 05 75 89 00 00 	movzbl 0x8975(%rip),%eax        # c701 <__compound_literal.0.lto_priv.0>
+    3d8c:	48 89 c1             	mov    %rax,%rcx
+    3d8f:	89 c2                	mov    %eax,%edx
+    3d91:	c0 e8 03             	shr    $0x3,%al
+    3d94:	83 e1 07             	and    $0x7,%ecx
+    3d97:	83 e2 07             	and    $0x7,%edx
+    3d9a:	0f b6 f0             	movzbl %al,%esi
+    3d9d:	41 8b 0c 8f          	mov    (%r15,%rcx,4),%ecx
+    3da1:	0f a3 c1             	bt     %eax,%ecx
+    3da4:	72 d2                	jb     3d78 <gpio_bit_set_bench+0x38>
+        volatile uint32_t * port = &gpio_emulation[gpio->gpio];
+    3da6:	0f b6 d2             	movzbl %dl,%edx
+        bool previous = __atomic_fetch_or(port, mask, __ATOMIC_RELAXED) & mask;
+    3da9:	f0 0f ab 74 95 00    	lock bts %esi,0x0(%rbp,%rdx,4)
+    if (previous != state) {
+    3daf:	72 c7                	jb     3d78 <gpio_bit_set_bench+0x38>
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    3db1:	0f b6 0d 49 89 00 00 	movzbl 0x8949(%rip),%ecx        # c701 <__compound_literal.0.lto_priv.0>
+    3db8:	b8 01 00 00 00       	mov    $0x1,%eax
+    3dbd:	83 e1 07             	and    $0x7,%ecx
+    3dc0:	d3 e0                	shl    %cl,%eax
+    3dc2:	f0 09 05 03 2e 07 00 	lock or %eax,0x72e03(%rip)        # 76bcc <gpio_dirty>
+        VcdGpio(gpio->gpio, gpio->bit, state);
+    3dc9:	0f b6 1d 31 89 00 00 	movzbl 0x8931(%rip),%ebx        # c701 <__compound_literal.0.lto_priv.0>
+    pthread_once(&vcd_once, VcdOpen);
+    3dd0:	48 8d 35 59 ef ff ff 	lea    -0x10a7(%rip),%rsi        # 2d30 <VcdOpen>
+    3dd7:	48 8d 3d ea 2d 07 00 	lea    0x72dea(%rip),%rdi        # 76bc8 <vcd_once>
+    3dde:	89 d8                	mov    %ebx,%eax
+    3de0:	83 e3 07             	and    $0x7,%ebx
+    3de3:	c0 e8 03             	shr    $0x3,%al
+    3de6:	88 44 24 0f          	mov    %al,0xf(%rsp)
+    3dea:	e8 01 e6 ff ff       	call   23f0 <pthread_once@plt>
+    if (vcd_file) {
+    3def:	48 83 3d c9 2d 07 00 	cmpq   $0x0,0x72dc9(%rip)        # 76bc0 <vcd_file>
+    3df6:	00 
+    3df7:	74 12                	je     3e0b <gpio_bit_set_bench+0xcb>
+    3df9:	0f b6 74 24 0f       	movzbl 0xf(%rsp),%esi
+    3dfe:	0f b6 fb             	movzbl %bl,%edi
+    3e01:	ba 01 00 00 00       	mov    $0x1,%edx
+    3e06:	e8 d5 f7 ff ff       	call   35e0 <VcdGpio.part.0>
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    3e0b:	0f b6 05 ef 88 00 00 	movzbl 0x88ef(%rip),%eax        # c701 <__compound_literal.0.lto_priv.0>
+    3e12:	48 89 c2             	mov    %rax,%rdx
+    3e15:	89 c7                	mov    %eax,%edi
+    3e17:	c0 e8 03             	shr    $0x3,%al
+    3e1a:	83 e2 07             	and    $0x7,%edx
+    3e1d:	83 e7 07             	and    $0x7,%edi
+    3e20:	0f b6 f0             	movzbl %al,%esi
+    3e23:	41 8b 14 94          	mov    (%r12,%rdx,4),%edx
+    3e27:	0f a3 c2             	bt     %eax,%edx
+    3e2a:	0f 83 48 ff ff ff    	jae    3d78 <gpio_bit_set_bench+0x38>
+        WireGpio(gpio->gpio, gpio->bit, state);
+    3e30:	ba 01 00 00 00       	mov    $0x1,%edx
+    3e35:	41 83 c5 01          	add    $0x1,%r13d
+    3e39:	e8 82 fe ff ff       	call   3cc0 <WireGpio>
+    3e3e:	45 39 ee             	cmp    %r13d,%r14d
+    3e41:	0f 85 3e ff ff ff    	jne    3d85 <gpio_bit_set_bench+0x45>
+}
+    3e47:	48 83 c4 18          	add    $0x18,%rsp
+    3e4b:	5b                   	pop    %rbx
+    3e4c:	5d                   	pop    %rbp
+    3e4d:	41 5c                	pop    %r12
+    3e4f:	41 5d                	pop    %r13
+    3e51:	41 5e                	pop    %r14
+    3e53:	41 5f                	pop    %r15
+    3e55:	c3                   	ret
+    3e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    3e5d:	00 00 00 
+    3e60:	c3                   	ret
+    3e61:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3e68:	00 00 00 00 
+    3e6c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000003e70 <gpio_bit_toggle_bench>:
+    for (uint32_t index = 0; index < iterations; index++) {
+    3e70:	85 ff                	test   %edi,%edi
+    3e72:	0f 84 28 01 00 00    	je     3fa0 <gpio_bit_toggle_bench+0x130>
+BENCH(gpio, bit_toggle) {
+    3e78:	41 57                	push   %r15
+    3e7a:	41 89 ff             	mov    %edi,%r15d
+    3e7d:	41 56                	push   %r14
+    for (uint32_t index = 0; index < iterations; index++) {
+    3e7f:	45 31 f6             	xor    %r14d,%r14d
+BENCH(gpio, bit_toggle) {
+    3e82:	41 55                	push   %r13
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    3e84:	4c 8d 2d 45 2d 07 00 	lea    0x72d45(%rip),%r13        # 76bd0 <gpio_outputs>
+    3e8b:	41 54                	push   %r12
+    3e8d:	4c 8d 25 5c 2d 07 00 	lea    0x72d5c(%rip),%r12        # 76bf0 <gpio_stuck>
+    3e94:	55                   	push   %rbp
+    3e95:	53                   	push   %rbx
+        bool previous = __atomic_fetch_xor(port, mask, __ATOMIC_RELAXED) & mask;
+    3e96:	48 8d 1d 43 2d 07 00 	lea    0x72d43(%rip),%rbx        # 76be0 <gpio_emulation>
+    3e9d:	48 83 ec 18          	sub    $0x18,%rsp
+    3ea1:	eb 12                	jmp    3eb5 <gpio_bit_toggle_bench+0x45>
+    3ea3:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    for (uint32_t index = 0; index < iterations; index++) {
+    3ea8:	41 83 c6 01          	add    $0x1,%r14d
+    3eac:	45 39 f7             	cmp    %r14d,%r15d
+    3eaf:	0f 84 d9 00 00 00    	je     3f8e <gpio_bit_toggle_bench+0x11e>
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    3eb5:	0f b6 05 45 88 00 00 	movzbl 0x8845(%rip),%eax        # c701 <__compound_literal.0.lto_priv.0>
+    3ebc:	48 89 c1             	mov    %rax,%rcx
+    3ebf:	89 c2                	mov    %eax,%edx
+    3ec1:	c0 e8 03             	shr    $0x3,%al
+    3ec4:	83 e1 07             	and    $0x7,%ecx
+    3ec7:	83 e2 07             	and    $0x7,%edx
+    3eca:	0f b6 f0             	movzbl %al,%esi
+    3ecd:	41 8b 0c 8c          	mov    (%r12,%rcx,4),%ecx
+    3ed1:	0f a3 c1             	bt     %eax,%ecx
+    3ed4:	72 d2                	jb     3ea8 <gpio_bit_toggle_bench+0x38>
+        volatile uint32_t * port = &gpio_emulation[gpio->gpio];
+    3ed6:	0f b6 d2             	movzbl %dl,%edx
+        bool previous = __atomic_fetch_xor(port, mask, __ATOMIC_RELAXED) & mask;
+    3ed9:	31 c0                	xor    %eax,%eax
+    3edb:	f0 0f bb 34 93       	lock btc %esi,(%rbx,%rdx,4)
+    3ee0:	0f 92 c0             	setb   %al
+        DriveStatus(gpio, previous, !previous);
+    3ee3:	85 c0                	test   %eax,%eax
+    3ee5:	40 0f 94 c5          	sete   %bpl
+        bool previous = __atomic_fetch_xor(port, mask, __ATOMIC_RELAXED) & mask;
+    3ee9:	0f 95 c0             	setne  %al
+    if (previous != state) {
+    3eec:	40 38 e8             	cmp    %bpl,%al
+    3eef:	74 b7                	je     3ea8 <gpio_bit_toggle_bench+0x38>
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    3ef1:	0f b6 0d 09 88 00 00 	movzbl 0x8809(%rip),%ecx        # c701 <__compound_literal.0.lto_priv.0>
+    3ef8:	b8 01 00 00 00       	mov    $0x1,%eax
+        DriveStatus(gpio, previous, !previous);
+    3efd:	40 0f b6 ed          	movzbl %bpl,%ebp
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    3f01:	83 e1 07             	and    $0x7,%ecx
+    3f04:	d3 e0                	shl    %cl,%eax
+    3f06:	f0 09 05 bf 2c 07 00 	lock or %eax,0x72cbf(%rip)        # 76bcc <gpio_dirty>
+        VcdGpio(gpio->gpio, gpio->bit, state);
+    3f0d:	0f b6 05 ed 87 00 00 	movzbl 0x87ed(%rip),%eax        # c701 <__compound_literal.0.lto_priv.0>
+    pthread_once(&vcd_once, VcdOpen);
+    3f14:	48 8d 35 15 ee ff ff 	lea    -0x11eb(%rip),%rsi        # 2d30 <VcdOpen>
+    3f1b:	89 c7                	mov    %eax,%edi
+    3f1d:	83 e0 07             	and    $0x7,%eax
+    3f20:	40 c0 ef 03          	shr    $0x3,%dil
+    3f24:	40 88 7c 24 0e       	mov    %dil,0xe(%rsp)
+    3f29:	48 8d 3d 98 2c 07 00 	lea    0x72c98(%rip),%rdi        # 76bc8 <vcd_once>
+    3f30:	88 44 24 0f          	mov    %al,0xf(%rsp)
+    3f34:	e8 b7 e4 ff ff       	call   23f0 <pthread_once@plt>
+    if (vcd_file) {
+    3f39:	48 83 3d 7f 2c 07 00 	cmpq   $0x0,0x72c7f(%rip)        # 76bc0 <vcd_file>
+    3f40:	00 
+    3f41:	74 11                	je     3f54 <gpio_bit_toggle_bench+0xe4>
+    3f43:	0f b6 74 24 0e       	movzbl 0xe(%rsp),%esi
+    3f48:	0f b6 7c 24 0f       	movzbl 0xf(%rsp),%edi
+    3f4d:	89 ea                	mov    %ebp,%edx
+    3f4f:	e8 8c f6 ff ff       	call   35e0 <VcdGpio.part.0>
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    3f54:	0f b6 05 a6 87 00 00 	movzbl 0x87a6(%rip),%eax        # c701 <__compound_literal.0.lto_priv.0>
+    3f5b:	48 89 c2             	mov    %rax,%rdx
+    3f5e:	89 c7                	mov    %eax,%edi
+    3f60:	c0 e8 03             	shr    $0x3,%al
+    3f63:	83 e2 07             	and    $0x7,%edx
+    3f66:	83 e7 07             	and    $0x7,%edi
+    3f69:	0f b6 f0             	movzbl %al,%esi
+    3f6c:	41 8b 54 95 00       	mov    0x0(%r13,%rdx,4),%edx
+    3f71:	0f a3 c2             	bt     %eax,%edx
+    3f74:	0f 83 2e ff ff ff    	jae    3ea8 <gpio_bit_toggle_bench+0x38>
+        WireGpio(gpio->gpio, gpio->bit, state);
+    3f7a:	89 ea                	mov    %ebp,%edx
+    3f7c:	41 83 c6 01          	add    $0x1,%r14d
+    3f80:	e8 3b fd ff ff       	call   3cc0 <WireGpio>
+    3f85:	45 39 f7             	cmp    %r14d,%r15d
+    3f88:	0f 85 27 ff ff ff    	jne    3eb5 <gpio_bit_toggle_bench+0x45>
+}
+    3f8e:	48 83 c4 18          	add    $0x18,%rsp
+    3f92:	5b                   	pop    %rbx
+    3f93:	5d                   	pop    %rbp
+    3f94:	41 5c                	pop    %r12
+    3f96:	41 5d                	pop    %r13
+    3f98:	41 5e                	pop    %r14
+    3f9a:	41 5f                	pop    %r15
+    3f9c:	c3                   	ret
+    3f9d:	0f 1f 00             	nopl   (%rax)
+    3fa0:	c3                   	ret
+    3fa1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3fa8:	00 00 00 00 
+    3fac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000003fb0 <ConsoleOpenTerminal>:
+//! Pipe used to wake the thread, the thread is running when it is open
+static int console_wake[2] = {-1, -1};
+
+/* === Private function implementation ========================================================= */
+
+static bool ConsoleOpenTerminal(uint8_t port, char const * link) {
+    3fb0:	41 57                	push   %r15
+    3fb2:	41 56                	push   %r14
+    3fb4:	41 55                	push   %r13
+    3fb6:	41 54                	push   %r12
+    3fb8:	41 89 fc             	mov    %edi,%r12d
+    struct termios settings;
+    int master, slave;
+    char const * name;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    3fbb:	bf 02 01 00 00       	mov    $0x102,%edi
+static bool ConsoleOpenTerminal(uint8_t port, char const * link) {
+    3fc0:	55                   	push   %rbp
+    3fc1:	48 89 f5             	mov    %rsi,%rbp
+    3fc4:	53                   	push   %rbx
+    3fc5:	48 83 ec 48          	sub    $0x48,%rsp
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    3fc9:	e8 02 e4 ff ff       	call   23d0 <posix_openpt@plt>
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0)) {
+    3fce:	85 c0                	test   %eax,%eax
+    3fd0:	78 0d                	js     3fdf <ConsoleOpenTerminal+0x2f>
+    3fd2:	89 c7                	mov    %eax,%edi
+    3fd4:	89 c3                	mov    %eax,%ebx
+    3fd6:	e8 85 e3 ff ff       	call   2360 <grantpt@plt>
+    3fdb:	85 c0                	test   %eax,%eax
+    3fdd:	74 11                	je     3ff0 <ConsoleOpenTerminal+0x40>
+        return false;
+    3fdf:	31 c0                	xor    %eax,%eax
+    3fe1:	e9 cf 00 00 00       	jmp    40b5 <ConsoleOpenTerminal+0x105>
+    3fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    3fed:	00 00 00 
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0)) {
+    3ff0:	89 df                	mov    %ebx,%edi
+    3ff2:	e8 09 e2 ff ff       	call   2200 <unlockpt@plt>
+    3ff7:	85 c0                	test   %eax,%eax
+    3ff9:	75 e4                	jne    3fdf <ConsoleOpenTerminal+0x2f>
+    }
+    name = ptsname(master);
+    3ffb:	89 df                	mov    %ebx,%edi
+    3ffd:	e8 3e e0 ff ff       	call   2040 <ptsname@plt>
+    /* The slave side is kept open so the master doesn't hang up when the clients close it */
+    slave = open(name, O_RDWR | O_NOCTTY);
+    4002:	be 02 01 00 00       	mov    $0x102,%esi
+    4007:	48 89 c7             	mov    %rax,%rdi
+    name = ptsname(master);
+    400a:	49 89 c6             	mov    %rax,%r14
+    slave = open(name, O_RDWR | O_NOCTTY);
+    400d:	31 c0                	xor    %eax,%eax
+    400f:	e8 fc e2 ff ff       	call   2310 <open@plt>
+    4014:	41 89 c5             	mov    %eax,%r13d
+    if (slave < 0) {
+    4017:	85 c0                	test   %eax,%eax
+    4019:	0f 88 d1 00 00 00    	js     40f0 <ConsoleOpenTerminal+0x140>
+        close(master);
+        return false;
+    }
+    tcgetattr(slave, &settings);
+    401f:	49 89 e7             	mov    %rsp,%r15
+    4022:	89 c7                	mov    %eax,%edi
+    4024:	4c 89 fe             	mov    %r15,%rsi
+    4027:	e8 c4 e2 ff ff       	call   22f0 <tcgetattr@plt>
+    cfmakeraw(&settings);
+    402c:	4c 89 ff             	mov    %r15,%rdi
+    402f:	e8 6c e2 ff ff       	call   22a0 <cfmakeraw@plt>
+    tcsetattr(slave, TCSANOW, &settings);
+    4034:	31 f6                	xor    %esi,%esi
+    4036:	4c 89 fa             	mov    %r15,%rdx
+    4039:	44 89 ef             	mov    %r13d,%edi
+    403c:	e8 bf e2 ff ff       	call   2300 <tcsetattr@plt>
+    fcntl(master, F_SETFL, O_NONBLOCK);
+    4041:	31 c0                	xor    %eax,%eax
+    4043:	ba 00 08 00 00       	mov    $0x800,%edx
+    4048:	89 df                	mov    %ebx,%edi
+    404a:	be 04 00 00 00       	mov    $0x4,%esi
+    404f:	e8 6c e0 ff ff       	call   20c0 <fcntl@plt>
+
+    if (link) {
+    4054:	48 85 ed             	test   %rbp,%rbp
+    4057:	0f 84 83 00 00 00    	je     40e0 <ConsoleOpenTerminal+0x130>
+        unlink(link);
+    405d:	48 89 ef             	mov    %rbp,%rdi
+    4060:	e8 0b e0 ff ff       	call   2070 <unlink@plt>
+        if (symlink(name, link) != 0) {
+    4065:	48 89 ee             	mov    %rbp,%rsi
+    4068:	4c 89 f7             	mov    %r14,%rdi
+    406b:	e8 f0 e0 ff ff       	call   2160 <symlink@plt>
+            fprintf(stderr, "console: can't create the link %s\n", link);
+    4070:	4c 8b 2d 69 6f 00 00 	mov    0x6f69(%rip),%r13        # afe0 <stderr@GLIBC_2.2.5>
+        if (symlink(name, link) != 0) {
+    4077:	85 c0                	test   %eax,%eax
+    4079:	75 4d                	jne    40c8 <ConsoleOpenTerminal+0x118>
+        }
+    }
+    fprintf(stderr, "console: sci%u on %s\n", port, name);
+    407b:	45 0f b6 e4          	movzbl %r12b,%r12d
+    407f:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+    4083:	4c 89 f1             	mov    %r14,%rcx
+    4086:	31 c0                	xor    %eax,%eax
+    4088:	44 89 e2             	mov    %r12d,%edx
+    408b:	48 8d 35 fe 40 00 00 	lea    0x40fe(%rip),%rsi        # 8190 <_IO_stdin_used+0x190>
+    4092:	e8 79 e1 ff ff       	call   2210 <fprintf@plt>
+    console_ports[port].client = master;
+    4097:	4c 89 e0             	mov    %r12,%rax
+    409a:	48 8d 15 ff e9 06 00 	lea    0x6e9ff(%rip),%rdx        # 72aa0 <console_ports>
+    40a1:	48 c1 e0 06          	shl    $0x6,%rax
+    40a5:	4c 01 e0             	add    %r12,%rax
+    40a8:	48 c1 e0 06          	shl    $0x6,%rax
+    40ac:	89 5c 02 30          	mov    %ebx,0x30(%rdx,%rax,1)
+    return true;
+    40b0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    40b5:	48 83 c4 48          	add    $0x48,%rsp
+    40b9:	5b                   	pop    %rbx
+    40ba:	5d                   	pop    %rbp
+    40bb:	41 5c                	pop    %r12
+    40bd:	41 5d                	pop    %r13
+    40bf:	41 5e                	pop    %r14
+    40c1:	41 5f                	pop    %r15
+    40c3:	c3                   	ret
+    40c4:	0f 1f 40 00          	nopl   0x0(%rax)
+            fprintf(stderr, "console: can't create the link %s\n", link);
+    40c8:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+    40cc:	48 89 ea             	mov    %rbp,%rdx
+    40cf:	48 8d 35 5a 44 00 00 	lea    0x445a(%rip),%rsi        # 8530 <_IO_stdin_used+0x530>
+    40d6:	31 c0                	xor    %eax,%eax
+    40d8:	e8 33 e1 ff ff       	call   2210 <fprintf@plt>
+    40dd:	eb 9c                	jmp    407b <ConsoleOpenTerminal+0xcb>
+    40df:	90                   	nop
+    40e0:	4c 8b 2d f9 6e 00 00 	mov    0x6ef9(%rip),%r13        # afe0 <stderr@GLIBC_2.2.5>
+    40e7:	eb 92                	jmp    407b <ConsoleOpenTerminal+0xcb>
+    40e9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        close(master);
+    40f0:	89 df                	mov    %ebx,%edi
+    40f2:	e8 99 e0 ff ff       	call   2190 <close@plt>
+        return false;
+    40f7:	31 c0                	xor    %eax,%eax
+    40f9:	eb ba                	jmp    40b5 <ConsoleOpenTerminal+0x105>
+    40fb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000004100 <ConsoleOpenServer>:
+
+static bool ConsoleOpenServer(uint8_t port, int kind, char const * address) {
+    4100:	41 56                	push   %r14
+    struct sockaddr_un local = {.sun_family = AF_UNIX};
+    4102:	31 c0                	xor    %eax,%eax
+static bool ConsoleOpenServer(uint8_t port, int kind, char const * address) {
+    4104:	41 89 f6             	mov    %esi,%r14d
+    struct sockaddr_in network = {.sin_family = AF_INET};
+    int server, enable = 1;
+    bool result;
+
+    server = socket(kind, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    4107:	be 01 08 00 00       	mov    $0x801,%esi
+static bool ConsoleOpenServer(uint8_t port, int kind, char const * address) {
+    410c:	41 55                	push   %r13
+    410e:	41 54                	push   %r12
+    4110:	55                   	push   %rbp
+    4111:	48 89 d5             	mov    %rdx,%rbp
+    struct sockaddr_in network = {.sin_family = AF_INET};
+    4114:	ba 02 00 00 00       	mov    $0x2,%edx
+static bool ConsoleOpenServer(uint8_t port, int kind, char const * address) {
+    4119:	53                   	push   %rbx
+    411a:	89 fb                	mov    %edi,%ebx
+    411c:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    struct sockaddr_un local = {.sun_family = AF_UNIX};
+    4123:	4c 8d 64 24 22       	lea    0x22(%rsp),%r12
+    4128:	48 8d 7c 24 28       	lea    0x28(%rsp),%rdi
+    412d:	48 c7 44 24 22 00 00 	movq   $0x0,0x22(%rsp)
+    4134:	00 00 
+    4136:	48 c7 84 24 86 00 00 	movq   $0x0,0x86(%rsp)
+    413d:	00 00 00 00 00 
+    4142:	4c 89 e1             	mov    %r12,%rcx
+    4145:	48 29 f9             	sub    %rdi,%rcx
+    4148:	83 c1 6c             	add    $0x6c,%ecx
+    414b:	c1 e9 03             	shr    $0x3,%ecx
+    414e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    struct sockaddr_in network = {.sin_family = AF_INET};
+    4151:	66 89 54 24 10       	mov    %dx,0x10(%rsp)
+    struct sockaddr_un local = {.sun_family = AF_UNIX};
+    4156:	b8 01 00 00 00       	mov    $0x1,%eax
+    server = socket(kind, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    415b:	31 d2                	xor    %edx,%edx
+    415d:	44 89 f7             	mov    %r14d,%edi
+    struct sockaddr_un local = {.sun_family = AF_UNIX};
+    4160:	66 89 44 24 20       	mov    %ax,0x20(%rsp)
+    struct sockaddr_in network = {.sin_family = AF_INET};
+    4165:	48 c7 44 24 12 00 00 	movq   $0x0,0x12(%rsp)
+    416c:	00 00 
+    int server, enable = 1;
+    416e:	c7 44 24 0c 01 00 00 	movl   $0x1,0xc(%rsp)
+    4175:	00 
+    struct sockaddr_in network = {.sin_family = AF_INET};
+    4176:	48 c7 44 24 18 00 00 	movq   $0x0,0x18(%rsp)
+    417d:	00 00 
+    server = socket(kind, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    417f:	e8 bc e2 ff ff       	call   2440 <socket@plt>
+    if (server < 0) {
+    4184:	85 c0                	test   %eax,%eax
+    4186:	0f 88 3c 01 00 00    	js     42c8 <ConsoleOpenServer+0x1c8>
+    418c:	41 89 c5             	mov    %eax,%r13d
+        return false;
+    }
+    if (kind == AF_UNIX) {
+    418f:	41 83 fe 01          	cmp    $0x1,%r14d
+    4193:	0f 84 c7 00 00 00    	je     4260 <ConsoleOpenServer+0x160>
+        snprintf(local.sun_path, sizeof(local.sun_path), "%s", address);
+        unlink(local.sun_path);
+        result = bind(server, (struct sockaddr *)&local, sizeof(local)) == 0;
+    } else {
+        setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    4199:	48 8d 4c 24 0c       	lea    0xc(%rsp),%rcx
+    419e:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+    41a4:	ba 02 00 00 00       	mov    $0x2,%edx
+    41a9:	89 c7                	mov    %eax,%edi
+    41ab:	be 01 00 00 00       	mov    $0x1,%esi
+    41b0:	e8 fb de ff ff       	call   20b0 <setsockopt@plt>
+
+#ifdef __USE_EXTERN_INLINES
+__extern_inline int
+__NTH (atoi (const char *__nptr))
+{
+  return (int) strtol (__nptr, (char **) NULL, 10);
+    41b5:	31 f6                	xor    %esi,%esi
+    41b7:	ba 0a 00 00 00       	mov    $0xa,%edx
+    41bc:	48 89 ef             	mov    %rbp,%rdi
+        network.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    41bf:	c7 44 24 14 7f 00 00 	movl   $0x100007f,0x14(%rsp)
+    41c6:	01 
+    41c7:	e8 74 e0 ff ff       	call   2240 <strtol@plt>
+        network.sin_port = htons(atoi(address));
+        result = bind(server, (struct sockaddr *)&network, sizeof(network)) == 0;
+    41cc:	48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+    41d1:	ba 10 00 00 00       	mov    $0x10,%edx
+    41d6:	44 89 ef             	mov    %r13d,%edi
+
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+#if __GNUC_PREREQ (4, 8)
+  return __builtin_bswap16 (__bsx);
+    41d9:	66 c1 c0 08          	rol    $0x8,%ax
+        network.sin_port = htons(atoi(address));
+    41dd:	66 89 44 24 12       	mov    %ax,0x12(%rsp)
+        result = bind(server, (struct sockaddr *)&network, sizeof(network)) == 0;
+    41e2:	e8 e9 e0 ff ff       	call   22d0 <bind@plt>
+    }
+    if (!result || (listen(server, 1) != 0)) {
+    41e7:	85 c0                	test   %eax,%eax
+    41e9:	0f 85 d1 00 00 00    	jne    42c0 <ConsoleOpenServer+0x1c0>
+    41ef:	be 01 00 00 00       	mov    $0x1,%esi
+    41f4:	44 89 ef             	mov    %r13d,%edi
+    41f7:	e8 94 e0 ff ff       	call   2290 <listen@plt>
+        close(server);
+        return false;
+    }
+    fprintf(stderr, "console: sci%u on %s%s\n", port, kind == AF_UNIX ? "unix:" : "tcp:", address);
+    41fc:	48 8d 0d a3 3f 00 00 	lea    0x3fa3(%rip),%rcx        # 81a6 <_IO_stdin_used+0x1a6>
+    if (!result || (listen(server, 1) != 0)) {
+    4203:	85 c0                	test   %eax,%eax
+    4205:	0f 85 b5 00 00 00    	jne    42c0 <ConsoleOpenServer+0x1c0>
+    fprintf(stderr, "console: sci%u on %s%s\n", port, kind == AF_UNIX ? "unix:" : "tcp:", address);
+    420b:	48 8b 05 ce 6d 00 00 	mov    0x6dce(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    4212:	0f b6 db             	movzbl %bl,%ebx
+    4215:	49 89 e8             	mov    %rbp,%r8
+    4218:	48 8d 35 92 3f 00 00 	lea    0x3f92(%rip),%rsi        # 81b1 <_IO_stdin_used+0x1b1>
+    421f:	89 da                	mov    %ebx,%edx
+    4221:	48 8b 38             	mov    (%rax),%rdi
+    4224:	31 c0                	xor    %eax,%eax
+    4226:	e8 e5 df ff ff       	call   2210 <fprintf@plt>
+    console_ports[port].server = server;
+    422b:	48 89 d8             	mov    %rbx,%rax
+    422e:	48 8d 15 6b e8 06 00 	lea    0x6e86b(%rip),%rdx        # 72aa0 <console_ports>
+    4235:	48 c1 e0 06          	shl    $0x6,%rax
+    4239:	48 01 d8             	add    %rbx,%rax
+    423c:	48 c1 e0 06          	shl    $0x6,%rax
+    4240:	44 89 6c 02 2c       	mov    %r13d,0x2c(%rdx,%rax,1)
+    return true;
+}
+    4245:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+    return true;
+    424c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    4251:	5b                   	pop    %rbx
+    4252:	5d                   	pop    %rbp
+    4253:	41 5c                	pop    %r12
+    4255:	41 5d                	pop    %r13
+    4257:	41 5e                	pop    %r14
+    4259:	c3                   	ret
+    425a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        snprintf(local.sun_path, sizeof(local.sun_path), "%s", address);
+    4260:	48 8d 15 32 40 00 00 	lea    0x4032(%rip),%rdx        # 8299 <_IO_stdin_used+0x299>
+    4267:	48 89 e9             	mov    %rbp,%rcx
+    426a:	4c 89 e7             	mov    %r12,%rdi
+    426d:	31 c0                	xor    %eax,%eax
+    426f:	be 6c 00 00 00       	mov    $0x6c,%esi
+    4274:	4c 8d 74 24 20       	lea    0x20(%rsp),%r14
+    4279:	e8 f2 de ff ff       	call   2170 <snprintf@plt>
+        unlink(local.sun_path);
+    427e:	4c 89 e7             	mov    %r12,%rdi
+    4281:	e8 ea dd ff ff       	call   2070 <unlink@plt>
+        result = bind(server, (struct sockaddr *)&local, sizeof(local)) == 0;
+    4286:	ba 6e 00 00 00       	mov    $0x6e,%edx
+    428b:	4c 89 f6             	mov    %r14,%rsi
+    428e:	44 89 ef             	mov    %r13d,%edi
+    4291:	e8 3a e0 ff ff       	call   22d0 <bind@plt>
+    if (!result || (listen(server, 1) != 0)) {
+    4296:	85 c0                	test   %eax,%eax
+    4298:	75 26                	jne    42c0 <ConsoleOpenServer+0x1c0>
+    429a:	be 01 00 00 00       	mov    $0x1,%esi
+    429f:	44 89 ef             	mov    %r13d,%edi
+    42a2:	e8 e9 df ff ff       	call   2290 <listen@plt>
+    fprintf(stderr, "console: sci%u on %s%s\n", port, kind == AF_UNIX ? "unix:" : "tcp:", address);
+    42a7:	48 8d 0d fd 3e 00 00 	lea    0x3efd(%rip),%rcx        # 81ab <_IO_stdin_used+0x1ab>
+    if (!result || (listen(server, 1) != 0)) {
+    42ae:	85 c0                	test   %eax,%eax
+    42b0:	0f 84 55 ff ff ff    	je     420b <ConsoleOpenServer+0x10b>
+    42b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    42bd:	00 00 00 
+        close(server);
+    42c0:	44 89 ef             	mov    %r13d,%edi
+    42c3:	e8 c8 de ff ff       	call   2190 <close@plt>
+}
+    42c8:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+        return false;
+    42cf:	31 c0                	xor    %eax,%eax
+}
+    42d1:	5b                   	pop    %rbx
+    42d2:	5d                   	pop    %rbp
+    42d3:	41 5c                	pop    %r12
+    42d5:	41 5d                	pop    %r13
+    42d7:	41 5e                	pop    %r14
+    42d9:	c3                   	ret
+    42da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000042e0 <ConsoleStart>:
+    static pthread_t thread;
+    char name[sizeof(CONSOLE_ENVIRONMENT) + 4];
+    char const * value;
+    bool result = false;
+
+    if ((port >= SOC_SCI_PORTS) || __atomic_load_n(&console->started, __ATOMIC_ACQUIRE)) {
+    42e0:	40 80 ff 03          	cmp    $0x3,%dil
+    42e4:	76 0a                	jbe    42f0 <ConsoleStart+0x10>
+    42e6:	c3                   	ret
+    42e7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    42ee:	00 00 
+    42f0:	40 0f b6 c7          	movzbl %dil,%eax
+void ConsoleStart(uint8_t port) {
+    42f4:	41 57                	push   %r15
+    42f6:	41 56                	push   %r14
+    42f8:	41 55                	push   %r13
+    42fa:	41 54                	push   %r12
+    if ((port >= SOC_SCI_PORTS) || __atomic_load_n(&console->started, __ATOMIC_ACQUIRE)) {
+    42fc:	4c 8d 25 9d e7 06 00 	lea    0x6e79d(%rip),%r12        # 72aa0 <console_ports>
+void ConsoleStart(uint8_t port) {
+    4303:	55                   	push   %rbp
+    4304:	48 89 c5             	mov    %rax,%rbp
+    4307:	48 c1 e5 06          	shl    $0x6,%rbp
+    430b:	53                   	push   %rbx
+    430c:	48 01 c5             	add    %rax,%rbp
+    430f:	48 c1 e5 06          	shl    $0x6,%rbp
+    if ((port >= SOC_SCI_PORTS) || __atomic_load_n(&console->started, __ATOMIC_ACQUIRE)) {
+    4313:	4d 8d 6c 2c 28       	lea    0x28(%r12,%rbp,1),%r13
+void ConsoleStart(uint8_t port) {
+    4318:	48 83 ec 28          	sub    $0x28,%rsp
+    if ((port >= SOC_SCI_PORTS) || __atomic_load_n(&console->started, __ATOMIC_ACQUIRE)) {
+    431c:	41 0f b6 45 00       	movzbl 0x0(%r13),%eax
+    4321:	84 c0                	test   %al,%al
+    4323:	75 3d                	jne    4362 <ConsoleStart+0x82>
+    struct console_port_s * console = &console_ports[port];
+    4325:	40 0f b6 c7          	movzbl %dil,%eax
+        return;
+    }
+    pthread_mutex_lock(&console_lock);
+    4329:	4c 8d 35 50 e3 00 00 	lea    0xe350(%rip),%r14        # 12680 <console_lock>
+    struct console_port_s * console = &console_ports[port];
+    4330:	89 c3                	mov    %eax,%ebx
+    pthread_mutex_lock(&console_lock);
+    4332:	4c 89 f7             	mov    %r14,%rdi
+    struct console_port_s * console = &console_ports[port];
+    4335:	89 44 24 04          	mov    %eax,0x4(%rsp)
+    pthread_mutex_lock(&console_lock);
+    4339:	e8 e2 e0 ff ff       	call   2420 <pthread_mutex_lock@plt>
+    if (!console->started) {
+    433e:	48 63 db             	movslq %ebx,%rbx
+    4341:	48 89 da             	mov    %rbx,%rdx
+    4344:	48 c1 e2 06          	shl    $0x6,%rdx
+    4348:	48 01 da             	add    %rbx,%rdx
+    434b:	48 c1 e2 06          	shl    $0x6,%rdx
+    434f:	45 0f b6 7c 14 28    	movzbl 0x28(%r12,%rdx,1),%r15d
+    4355:	45 84 ff             	test   %r15b,%r15b
+    4358:	74 1e                	je     4378 <ConsoleStart+0x98>
+        __atomic_store_n(&console->started, true, __ATOMIC_RELEASE);
+        if (console->attached) {
+            ConsoleWake();
+        }
+    }
+    pthread_mutex_unlock(&console_lock);
+    435a:	4c 89 f7             	mov    %r14,%rdi
+    435d:	e8 fe de ff ff       	call   2260 <pthread_mutex_unlock@plt>
+}
+    4362:	48 83 c4 28          	add    $0x28,%rsp
+    4366:	5b                   	pop    %rbx
+    4367:	5d                   	pop    %rbp
+    4368:	41 5c                	pop    %r12
+    436a:	41 5d                	pop    %r13
+    436c:	41 5e                	pop    %r14
+    436e:	41 5f                	pop    %r15
+    4370:	c3                   	ret
+    4371:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        pthread_mutex_init(&console->lock, NULL);
+    4378:	49 8d 3c 2c          	lea    (%r12,%rbp,1),%rdi
+    437c:	31 f6                	xor    %esi,%esi
+    437e:	48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+        snprintf(name, sizeof(name), "%s%u", CONSOLE_ENVIRONMENT, port);
+    4383:	48 8d 6c 24 13       	lea    0x13(%rsp),%rbp
+        pthread_mutex_init(&console->lock, NULL);
+    4388:	e8 53 e0 ff ff       	call   23e0 <pthread_mutex_init@plt>
+        console->server = -1;
+    438d:	48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+        snprintf(name, sizeof(name), "%s%u", CONSOLE_ENVIRONMENT, port);
+    4392:	48 89 ef             	mov    %rbp,%rdi
+    4395:	31 c0                	xor    %eax,%eax
+        console->server = -1;
+    4397:	48 8b 0d aa 46 00 00 	mov    0x46aa(%rip),%rcx        # 8a48 <data.2+0x8>
+        snprintf(name, sizeof(name), "%s%u", CONSOLE_ENVIRONMENT, port);
+    439e:	44 8b 44 24 04       	mov    0x4(%rsp),%r8d
+    43a3:	be 0d 00 00 00       	mov    $0xd,%esi
+        console->server = -1;
+    43a8:	4a 89 4c 22 2c       	mov    %rcx,0x2c(%rdx,%r12,1)
+        snprintf(name, sizeof(name), "%s%u", CONSOLE_ENVIRONMENT, port);
+    43ad:	48 8d 0d 15 3e 00 00 	lea    0x3e15(%rip),%rcx        # 81c9 <_IO_stdin_used+0x1c9>
+    43b4:	48 8d 15 17 3e 00 00 	lea    0x3e17(%rip),%rdx        # 81d2 <_IO_stdin_used+0x1d2>
+    43bb:	e8 b0 dd ff ff       	call   2170 <snprintf@plt>
+        value = getenv(name);
+    43c0:	48 89 ef             	mov    %rbp,%rdi
+    43c3:	e8 68 dc ff ff       	call   2030 <getenv@plt>
+    43c8:	48 89 c5             	mov    %rax,%rbp
+        if (value == NULL) {
+    43cb:	48 85 c0             	test   %rax,%rax
+    43ce:	0f 84 8a 00 00 00    	je     445e <ConsoleStart+0x17e>
+        } else if (strcmp(value, "pty") == 0) {
+    43d4:	48 8d 35 fc 3d 00 00 	lea    0x3dfc(%rip),%rsi        # 81d7 <_IO_stdin_used+0x1d7>
+    43db:	48 89 c7             	mov    %rax,%rdi
+    43de:	e8 fd dd ff ff       	call   21e0 <strcmp@plt>
+    43e3:	85 c0                	test   %eax,%eax
+    43e5:	0f 84 bd 00 00 00    	je     44a8 <ConsoleStart+0x1c8>
+        } else if (strncmp(value, "pty:", 4) == 0) {
+    43eb:	ba 04 00 00 00       	mov    $0x4,%edx
+    43f0:	48 8d 35 e4 3d 00 00 	lea    0x3de4(%rip),%rsi        # 81db <_IO_stdin_used+0x1db>
+    43f7:	48 89 ef             	mov    %rbp,%rdi
+    43fa:	e8 81 dc ff ff       	call   2080 <strncmp@plt>
+    43ff:	85 c0                	test   %eax,%eax
+    4401:	0f 84 c9 00 00 00    	je     44d0 <ConsoleStart+0x1f0>
+        } else if (strncmp(value, "unix:", 5) == 0) {
+    4407:	ba 05 00 00 00       	mov    $0x5,%edx
+    440c:	48 8d 35 98 3d 00 00 	lea    0x3d98(%rip),%rsi        # 81ab <_IO_stdin_used+0x1ab>
+    4413:	48 89 ef             	mov    %rbp,%rdi
+    4416:	e8 65 dc ff ff       	call   2080 <strncmp@plt>
+    441b:	85 c0                	test   %eax,%eax
+    441d:	0f 84 db 00 00 00    	je     44fe <ConsoleStart+0x21e>
+        } else if (strncmp(value, "tcp:", 4) == 0) {
+    4423:	ba 04 00 00 00       	mov    $0x4,%edx
+    4428:	48 8d 35 77 3d 00 00 	lea    0x3d77(%rip),%rsi        # 81a6 <_IO_stdin_used+0x1a6>
+    442f:	48 89 ef             	mov    %rbp,%rdi
+    4432:	e8 49 dc ff ff       	call   2080 <strncmp@plt>
+    4437:	85 c0                	test   %eax,%eax
+    4439:	0f 84 d3 00 00 00    	je     4512 <ConsoleStart+0x232>
+            fprintf(stderr, "console: can't attach sci%u to %s\n", port, value);
+    443f:	48 8b 05 9a 6b 00 00 	mov    0x6b9a(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    4446:	8b 54 24 04          	mov    0x4(%rsp),%edx
+    444a:	48 89 e9             	mov    %rbp,%rcx
+    444d:	48 8d 35 04 41 00 00 	lea    0x4104(%rip),%rsi        # 8558 <_IO_stdin_used+0x558>
+    4454:	48 8b 38             	mov    (%rax),%rdi
+    4457:	31 c0                	xor    %eax,%eax
+    4459:	e8 b2 dd ff ff       	call   2210 <fprintf@plt>
+        console->attached = result && (console_wake[0] >= 0);
+    445e:	48 89 d8             	mov    %rbx,%rax
+    4461:	48 c1 e0 06          	shl    $0x6,%rax
+    4465:	48 01 d8             	add    %rbx,%rax
+    4468:	48 c1 e0 06          	shl    $0x6,%rax
+    446c:	49 01 c4             	add    %rax,%r12
+    446f:	45 88 7c 24 29       	mov    %r15b,0x29(%r12)
+        __atomic_store_n(&console->started, true, __ATOMIC_RELEASE);
+    4474:	41 c6 45 00 01       	movb   $0x1,0x0(%r13)
+        if (console->attached) {
+    4479:	41 80 7c 24 29 00    	cmpb   $0x0,0x29(%r12)
+    447f:	0f 84 d5 fe ff ff    	je     435a <ConsoleStart+0x7a>
+    if (write(console_wake[1], &signal, 1) < 0) {
+    4485:	8b 3d e1 6d 00 00    	mov    0x6de1(%rip),%edi        # b26c <console_wake+0x4>
+    448b:	48 8d 74 24 12       	lea    0x12(%rsp),%rsi
+    4490:	ba 01 00 00 00       	mov    $0x1,%edx
+    char signal = 0;
+    4495:	c6 44 24 12 00       	movb   $0x0,0x12(%rsp)
+    if (write(console_wake[1], &signal, 1) < 0) {
+    449a:	e8 41 dc ff ff       	call   20e0 <write@plt>
+}
+    449f:	e9 b6 fe ff ff       	jmp    435a <ConsoleStart+0x7a>
+    44a4:	0f 1f 40 00          	nopl   0x0(%rax)
+            result = ConsoleOpenTerminal(port, NULL);
+    44a8:	8b 7c 24 04          	mov    0x4(%rsp),%edi
+    44ac:	31 f6                	xor    %esi,%esi
+    44ae:	e8 fd fa ff ff       	call   3fb0 <ConsoleOpenTerminal>
+        if (value && !result) {
+    44b3:	84 c0                	test   %al,%al
+    44b5:	74 88                	je     443f <ConsoleStart+0x15f>
+        if (result && (console_wake[0] < 0)) {
+    44b7:	44 8b 3d aa 6d 00 00 	mov    0x6daa(%rip),%r15d        # b268 <console_wake>
+    44be:	45 85 ff             	test   %r15d,%r15d
+    44c1:	78 1d                	js     44e0 <ConsoleStart+0x200>
+        console->attached = result && (console_wake[0] >= 0);
+    44c3:	41 f7 d7             	not    %r15d
+    44c6:	41 c1 ef 1f          	shr    $0x1f,%r15d
+    44ca:	eb 92                	jmp    445e <ConsoleStart+0x17e>
+    44cc:	0f 1f 40 00          	nopl   0x0(%rax)
+            result = ConsoleOpenTerminal(port, value + 4);
+    44d0:	8b 7c 24 04          	mov    0x4(%rsp),%edi
+    44d4:	48 8d 75 04          	lea    0x4(%rbp),%rsi
+    44d8:	e8 d3 fa ff ff       	call   3fb0 <ConsoleOpenTerminal>
+    44dd:	eb d4                	jmp    44b3 <ConsoleStart+0x1d3>
+    44df:	90                   	nop
+            if (pipe2(console_wake, O_NONBLOCK) == 0) {
+    44e0:	be 00 08 00 00       	mov    $0x800,%esi
+    44e5:	48 8d 3d 7c 6d 00 00 	lea    0x6d7c(%rip),%rdi        # b268 <console_wake>
+    44ec:	e8 7f de ff ff       	call   2370 <pipe2@plt>
+    44f1:	85 c0                	test   %eax,%eax
+    44f3:	74 31                	je     4526 <ConsoleStart+0x246>
+        console->attached = result && (console_wake[0] >= 0);
+    44f5:	44 8b 3d 6c 6d 00 00 	mov    0x6d6c(%rip),%r15d        # b268 <console_wake>
+    44fc:	eb c5                	jmp    44c3 <ConsoleStart+0x1e3>
+            result = ConsoleOpenServer(port, AF_UNIX, value + 5);
+    44fe:	8b 7c 24 04          	mov    0x4(%rsp),%edi
+    4502:	48 8d 55 05          	lea    0x5(%rbp),%rdx
+    4506:	be 01 00 00 00       	mov    $0x1,%esi
+    450b:	e8 f0 fb ff ff       	call   4100 <ConsoleOpenServer>
+    4510:	eb a1                	jmp    44b3 <ConsoleStart+0x1d3>
+            result = ConsoleOpenServer(port, AF_INET, value + 4);
+    4512:	8b 7c 24 04          	mov    0x4(%rsp),%edi
+    4516:	48 8d 55 04          	lea    0x4(%rbp),%rdx
+    451a:	be 02 00 00 00       	mov    $0x2,%esi
+    451f:	e8 dc fb ff ff       	call   4100 <ConsoleOpenServer>
+    4524:	eb 8d                	jmp    44b3 <ConsoleStart+0x1d3>
+                pthread_create(&thread, NULL, ConsoleThread, NULL);
+    4526:	31 c9                	xor    %ecx,%ecx
+    4528:	48 8d 15 b1 26 00 00 	lea    0x26b1(%rip),%rdx        # 6be0 <ConsoleThread>
+    452f:	31 f6                	xor    %esi,%esi
+    4531:	48 8d 3d 30 e1 00 00 	lea    0xe130(%rip),%rdi        # 12668 <thread.0.lto_priv.2>
+    4538:	e8 a3 dd ff ff       	call   22e0 <pthread_create@plt>
+    453d:	eb b6                	jmp    44f5 <ConsoleStart+0x215>
+    453f:	90                   	nop
+
+0000000000004540 <sci_send_byte_bench>:
+
+BENCH(sci, send_byte) {
+    4540:	41 57                	push   %r15
+    4542:	41 56                	push   %r14
+    4544:	41 55                	push   %r13
+    4546:	41 54                	push   %r12
+    4548:	55                   	push   %rbp
+    4549:	53                   	push   %rbx
+    454a:	48 83 ec 38          	sub    $0x38,%rsp
+    static const uint8_t data = 'U';
+
+    for (uint32_t index = 0; index < iterations; index++) {
+    454e:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%rsp)
+    4555:	00 
+    4556:	85 ff                	test   %edi,%edi
+    4558:	0f 84 49 01 00 00    	je     46a7 <sci_send_byte_bench+0x167>
+    455e:	89 7c 24 0c          	mov    %edi,0xc(%rsp)
+    4562:	4c 8d 35 c7 e7 ff ff 	lea    -0x1839(%rip),%r14        # 2d30 <VcdOpen>
+    4569:	4c 8d 2d 58 26 07 00 	lea    0x72658(%rip),%r13        # 76bc8 <vcd_once>
+    }
+    return result;
+}
+
+uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
+    uint8_t port = sci ? sci->index : 0;
+    4570:	44 0f b6 3d 88 81 00 	movzbl 0x8188(%rip),%r15d        # c700 <__compound_literal.0.lto_priv.1>
+    4577:	00 
+    pthread_once(&wire_once, WireOpen);
+    4578:	48 8d 35 11 f5 ff ff 	lea    -0xaef(%rip),%rsi        # 3a90 <WireOpen>
+    457f:	48 8d 3d 32 26 07 00 	lea    0x72632(%rip),%rdi        # 76bb8 <wire_once>
+    4586:	e8 65 de ff ff       	call   23f0 <pthread_once@plt>
+    }
+}
+
+bool WireSciLinked(uint8_t port) {
+    WireStart();
+    return bus && (port < WIRE_SCI_PORTS) && (sci_links[port].transmit != WIRE_NONE);
+    458b:	48 8b 05 1e 26 07 00 	mov    0x7261e(%rip),%rax        # 76bb0 <bus>
+    if (WireSciLinked(port)) {
+        size = WireSciSend(port, data, size);
+    } else if (ConsoleAttached(port)) {
+        size = ConsoleSend(port, data, size);
+    }
+    HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + port, size);
+    4592:	41 8d 6f 10          	lea    0x10(%r15),%ebp
+    uint8_t port = sci ? sci->index : 0;
+    4596:	44 89 fb             	mov    %r15d,%ebx
+    HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + port, size);
+    4599:	41 89 ec             	mov    %ebp,%r12d
+    459c:	41 c1 e4 10          	shl    $0x10,%r12d
+    45a0:	48 85 c0             	test   %rax,%rax
+    45a3:	0f 84 e7 01 00 00    	je     4790 <sci_send_byte_bench+0x250>
+    45a9:	41 80 ff 03          	cmp    $0x3,%r15b
+    45ad:	0f 86 0d 01 00 00    	jbe    46c0 <sci_send_byte_bench+0x180>
+
+bool ConsoleAttached(uint8_t port) {
+    ConsoleStart(port);
+    45b3:	44 89 ff             	mov    %r15d,%edi
+    45b6:	e8 25 fd ff ff       	call   42e0 <ConsoleStart>
+    if (trace_enabled) {
+    45bb:	0f b6 05 c3 e4 06 00 	movzbl 0x6e4c3(%rip),%eax        # 72a85 <trace_enabled>
+    45c2:	84 c0                	test   %al,%al
+    45c4:	0f 85 a7 01 00 00    	jne    4771 <sci_send_byte_bench+0x231>
+    45ca:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    45d0:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+                        VcdIdentifier(VCD_SCI_BASE + 2 * port + 1, strobe));
+    45d6:	01 ed                	add    %ebp,%ebp
+        identifier[length++] = '!' + (index % 94);
+    45d8:	8d 45 22             	lea    0x22(%rbp),%eax
+    45db:	83 c5 21             	add    $0x21,%ebp
+    if (vcd_file && (port < VCD_SCI_PORTS)) {
+    45de:	80 fb 03             	cmp    $0x3,%bl
+    45e1:	41 0f 96 c4          	setbe  %r12b
+        identifier[length++] = '!' + (index % 94);
+    45e5:	88 04 24             	mov    %al,(%rsp)
+    if (vcd_file && (port < VCD_SCI_PORTS)) {
+    45e8:	31 db                	xor    %ebx,%ebx
+    45ea:	eb 12                	jmp    45fe <sci_send_byte_bench+0xbe>
+    45ec:	0f 1f 40 00          	nopl   0x0(%rax)
+    for (uint16_t index = 0; index < size; index++) {
+    45f0:	48 83 c3 01          	add    $0x1,%rbx
+    45f4:	66 44 39 fb          	cmp    %r15w,%bx
+    45f8:	0f 83 96 00 00 00    	jae    4694 <sci_send_byte_bench+0x154>
+    pthread_once(&vcd_once, VcdOpen);
+    45fe:	4c 89 f6             	mov    %r14,%rsi
+    4601:	4c 89 ef             	mov    %r13,%rdi
+    4604:	e8 e7 dd ff ff       	call   23f0 <pthread_once@plt>
+    if (vcd_file && (port < VCD_SCI_PORTS)) {
+    4609:	48 83 3d af 25 07 00 	cmpq   $0x0,0x725af(%rip)        # 76bc0 <vcd_file>
+    4610:	00 
+    4611:	74 dd                	je     45f0 <sci_send_byte_bench+0xb0>
+    4613:	45 84 e4             	test   %r12b,%r12b
+    4616:	74 d8                	je     45f0 <sci_send_byte_bench+0xb0>
+        change = VcdBegin();
+    4618:	e8 e3 e2 ff ff       	call   2900 <VcdBegin>
+        for (int bit = 7; bit >= 0; bit--) {
+    461d:	b9 07 00 00 00       	mov    $0x7,%ecx
+            change[size++] = (value & (1 << bit)) ? '1' : '0';
+    4622:	41 b8 55 00 00 00    	mov    $0x55,%r8d
+        change[size++] = 'b';
+    4628:	c6 00 62             	movb   $0x62,(%rax)
+        for (int bit = 7; bit >= 0; bit--) {
+    462b:	48 8d 70 01          	lea    0x1(%rax),%rsi
+    462f:	90                   	nop
+            change[size++] = (value & (1 << bit)) ? '1' : '0';
+    4630:	44 89 c2             	mov    %r8d,%edx
+        for (int bit = 7; bit >= 0; bit--) {
+    4633:	48 83 c6 01          	add    $0x1,%rsi
+            change[size++] = (value & (1 << bit)) ? '1' : '0';
+    4637:	d3 fa                	sar    %cl,%edx
+        for (int bit = 7; bit >= 0; bit--) {
+    4639:	83 e9 01             	sub    $0x1,%ecx
+            change[size++] = (value & (1 << bit)) ? '1' : '0';
+    463c:	83 e2 01             	and    $0x1,%edx
+    463f:	83 c2 30             	add    $0x30,%edx
+    4642:	88 56 ff             	mov    %dl,-0x1(%rsi)
+        for (int bit = 7; bit >= 0; bit--) {
+    4645:	83 f9 ff             	cmp    $0xffffffff,%ecx
+    4648:	75 e6                	jne    4630 <sci_send_byte_bench+0xf0>
+        identifier[length++] = '!' + (index % 94);
+    464a:	0f b6 3c 24          	movzbl (%rsp),%edi
+        size += sprintf(&change[size], " %s\n1%s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, data),
+    464e:	48 8d 4c 24 2c       	lea    0x2c(%rsp),%rcx
+    4653:	48 83 c3 01          	add    $0x1,%rbx
+    4657:	48 8d 54 24 28       	lea    0x28(%rsp),%rdx
+    465c:	48 8d 35 7d 3b 00 00 	lea    0x3b7d(%rip),%rsi        # 81e0 <_IO_stdin_used+0x1e0>
+    identifier[length] = 0;
+    4663:	c6 44 24 2d 00       	movb   $0x0,0x2d(%rsp)
+        identifier[length++] = '!' + (index % 94);
+    4668:	40 88 7c 24 2c       	mov    %dil,0x2c(%rsp)
+        size += sprintf(&change[size], " %s\n1%s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, data),
+    466d:	48 8d 78 09          	lea    0x9(%rax),%rdi
+    4671:	31 c0                	xor    %eax,%eax
+        identifier[length++] = '!' + (index % 94);
+    4673:	40 88 6c 24 28       	mov    %bpl,0x28(%rsp)
+    identifier[length] = 0;
+    4678:	c6 44 24 29 00       	movb   $0x0,0x29(%rsp)
+        size += sprintf(&change[size], " %s\n1%s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, data),
+    467d:	e8 fe dc ff ff       	call   2380 <sprintf@plt>
+    4682:	8d 78 09             	lea    0x9(%rax),%edi
+        VcdEnd(size);
+    4685:	e8 b6 ee ff ff       	call   3540 <VcdEnd>
+    468a:	66 44 39 fb          	cmp    %r15w,%bx
+    468e:	0f 82 6a ff ff ff    	jb     45fe <sci_send_byte_bench+0xbe>
+    4694:	83 44 24 08 01       	addl   $0x1,0x8(%rsp)
+    4699:	8b 44 24 08          	mov    0x8(%rsp),%eax
+    469d:	39 44 24 0c          	cmp    %eax,0xc(%rsp)
+    46a1:	0f 85 c9 fe ff ff    	jne    4570 <sci_send_byte_bench+0x30>
+        BENCH_KEEP(SciSendData(HAL_SCI_USART0, &data, sizeof(data)));
+    }
+}
+    46a7:	48 83 c4 38          	add    $0x38,%rsp
+    46ab:	5b                   	pop    %rbx
+    46ac:	5d                   	pop    %rbp
+    46ad:	41 5c                	pop    %r12
+    46af:	41 5d                	pop    %r13
+    46b1:	41 5e                	pop    %r14
+    46b3:	41 5f                	pop    %r15
+    46b5:	c3                   	ret
+    46b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    46bd:	00 00 00 
+    46c0:	4d 63 c7             	movslq %r15d,%r8
+    46c3:	48 8d 3d d6 24 07 00 	lea    0x724d6(%rip),%rdi        # 76ba0 <sci_links>
+    46ca:	4b 8d 14 40          	lea    (%r8,%r8,2),%rdx
+    46ce:	48 01 d7             	add    %rdx,%rdi
+    46d1:	0f b6 0f             	movzbl (%rdi),%ecx
+    46d4:	80 f9 ff             	cmp    $0xff,%cl
+    46d7:	0f 84 16 02 00 00    	je     48f3 <sci_send_byte_bench+0x3b3>
+}
+
+uint32_t WireSciSpace(uint8_t port) {
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].transmit];
+
+    return WIRE_PIPE_SIZE - (pipe->head - __atomic_load_n(&pipe->tail, __ATOMIC_ACQUIRE));
+    46dd:	0f b6 f1             	movzbl %cl,%esi
+    46e0:	49 89 c8             	mov    %rcx,%r8
+    46e3:	48 89 f2             	mov    %rsi,%rdx
+    46e6:	49 c1 e0 09          	shl    $0x9,%r8
+    46ea:	48 c1 e2 09          	shl    $0x9,%rdx
+    46ee:	4c 01 c1             	add    %r8,%rcx
+    46f1:	48 01 f2             	add    %rsi,%rdx
+    46f4:	4c 8d 04 c8          	lea    (%rax,%rcx,8),%r8
+    46f8:	48 c1 e2 03          	shl    $0x3,%rdx
+    46fc:	8b 74 10 4c          	mov    0x4c(%rax,%rdx,1),%esi
+    4700:	45 8b 48 48          	mov    0x48(%r8),%r9d
+}
+
+uint16_t WireSciSend(uint8_t port, void const * data, uint16_t size) {
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].transmit];
+    uint32_t space = WireSciSpace(port);
+    uint32_t head = pipe->head;
+    4704:	41 8b 48 48          	mov    0x48(%r8),%ecx
+    return WIRE_PIPE_SIZE - (pipe->head - __atomic_load_n(&pipe->tail, __ATOMIC_ACQUIRE));
+    4708:	44 29 ce             	sub    %r9d,%esi
+
+    if (size > space) {
+    470b:	81 fe 00 f0 ff ff    	cmp    $0xfffff000,%esi
+    4711:	75 35                	jne    4748 <sci_send_byte_bench+0x208>
+    4713:	0f b6 05 6b e3 06 00 	movzbl 0x6e36b(%rip),%eax        # 72a85 <trace_enabled>
+        size = space;
+        sci_links[port].blocked = true;
+    471a:	c6 47 02 01          	movb   $0x1,0x2(%rdi)
+    471e:	84 c0                	test   %al,%al
+    4720:	0f 85 bb 01 00 00    	jne    48e1 <sci_send_byte_bench+0x3a1>
+        for (int bit = 7; bit >= 0; bit--) {
+    4726:	45 31 ff             	xor    %r15d,%r15d
+    for (uint32_t index = 0; index < iterations; index++) {
+    4729:	83 44 24 08 01       	addl   $0x1,0x8(%rsp)
+    472e:	8b 44 24 08          	mov    0x8(%rsp),%eax
+    4732:	39 44 24 0c          	cmp    %eax,0xc(%rsp)
+    4736:	0f 85 34 fe ff ff    	jne    4570 <sci_send_byte_bench+0x30>
+    473c:	e9 66 ff ff ff       	jmp    46a7 <sci_send_byte_bench+0x167>
+    4741:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    }
+    for (uint16_t index = 0; index < size; index++) {
+        pipe->data[(head + index) & (WIRE_PIPE_SIZE - 1)] = ((uint8_t const *)data)[index];
+    4748:	89 ce                	mov    %ecx,%esi
+    }
+    if (size) {
+        __atomic_store_n(&pipe->head, head + size, __ATOMIC_RELEASE);
+    474a:	83 c1 01             	add    $0x1,%ecx
+        pipe->data[(head + index) & (WIRE_PIPE_SIZE - 1)] = ((uint8_t const *)data)[index];
+    474d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+    4753:	41 c6 44 30 50 55    	movb   $0x55,0x50(%r8,%rsi,1)
+        __atomic_store_n(&pipe->head, head + size, __ATOMIC_RELEASE);
+    4759:	89 4c 10 48          	mov    %ecx,0x48(%rax,%rdx,1)
+        WireNotify();
+    475d:	e8 0e f5 ff ff       	call   3c70 <WireNotify>
+    4762:	0f b6 05 1c e3 06 00 	movzbl 0x6e31c(%rip),%eax        # 72a85 <trace_enabled>
+    4769:	84 c0                	test   %al,%al
+    476b:	0f 84 5f fe ff ff    	je     45d0 <sci_send_byte_bench+0x90>
+    HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + port, size);
+    4771:	44 89 e6             	mov    %r12d,%esi
+    4774:	bf 20 00 00 00       	mov    $0x20,%edi
+    4779:	83 ce 01             	or     $0x1,%esi
+    477c:	e8 1f e2 ff ff       	call   29a0 <TraceEvent.part.0>
+    4781:	e9 4a fe ff ff       	jmp    45d0 <sci_send_byte_bench+0x90>
+    4786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    478d:	00 00 00 
+    4790:	44 89 ff             	mov    %r15d,%edi
+    4793:	e8 48 fb ff ff       	call   42e0 <ConsoleStart>
+    return (port < SOC_SCI_PORTS) && console_ports[port].attached;
+    4798:	4d 63 c7             	movslq %r15d,%r8
+    479b:	41 80 ff 03          	cmp    $0x3,%r15b
+    479f:	0f 87 18 01 00 00    	ja     48bd <sci_send_byte_bench+0x37d>
+    47a5:	4c 89 c2             	mov    %r8,%rdx
+    47a8:	4c 8d 3d f1 e2 06 00 	lea    0x6e2f1(%rip),%r15        # 72aa0 <console_ports>
+    47af:	48 c1 e2 06          	shl    $0x6,%rdx
+    47b3:	4c 01 c2             	add    %r8,%rdx
+    47b6:	48 c1 e2 06          	shl    $0x6,%rdx
+    47ba:	4c 01 fa             	add    %r15,%rdx
+    47bd:	80 7a 29 00          	cmpb   $0x0,0x29(%rdx)
+    47c1:	0f 84 f6 00 00 00    	je     48bd <sci_send_byte_bench+0x37d>
+
+uint16_t ConsoleSend(uint8_t port, void const * data, uint16_t size) {
+    struct console_port_s * console = &console_ports[port];
+    ssize_t result = size;
+
+    pthread_mutex_lock(&console->lock);
+    47c7:	0f b6 cb             	movzbl %bl,%ecx
+    47ca:	48 89 54 24 10       	mov    %rdx,0x10(%rsp)
+    47cf:	48 89 c8             	mov    %rcx,%rax
+    47d2:	4c 89 44 24 18       	mov    %r8,0x18(%rsp)
+    47d7:	48 c1 e0 06          	shl    $0x6,%rax
+    47db:	48 01 c8             	add    %rcx,%rax
+    47de:	48 c1 e0 06          	shl    $0x6,%rax
+    47e2:	4c 01 f8             	add    %r15,%rax
+    47e5:	48 89 c7             	mov    %rax,%rdi
+    47e8:	48 89 04 24          	mov    %rax,(%rsp)
+    47ec:	e8 2f dc ff ff       	call   2420 <pthread_mutex_lock@plt>
+    if (console->client >= 0) {
+    47f1:	48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    47f6:	8b 7a 30             	mov    0x30(%rdx),%edi
+    47f9:	85 ff                	test   %edi,%edi
+    47fb:	0f 88 b3 00 00 00    	js     48b4 <sci_send_byte_bench+0x374>
+        /* A write on a socket closed by the client would end the program with SIGPIPE */
+        if (console->server >= 0) {
+    4801:	8b 42 2c             	mov    0x2c(%rdx),%eax
+    4804:	4c 8b 44 24 18       	mov    0x18(%rsp),%r8
+    4809:	85 c0                	test   %eax,%eax
+    480b:	4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    4810:	0f 88 f2 00 00 00    	js     4908 <sci_send_byte_bench+0x3c8>
+            result = send(console->client, data, size, MSG_NOSIGNAL);
+    4816:	b9 00 40 00 00       	mov    $0x4000,%ecx
+    481b:	ba 01 00 00 00       	mov    $0x1,%edx
+    4820:	48 8d 35 19 42 00 00 	lea    0x4219(%rip),%rsi        # 8a40 <data.2>
+    4827:	e8 04 d9 ff ff       	call   2130 <send@plt>
+    482c:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    4831:	48 89 c1             	mov    %rax,%rcx
+        } else {
+            result = write(console->client, data, size);
+        }
+        if ((result < 0) && (errno != EAGAIN)) {
+    4834:	48 85 c9             	test   %rcx,%rcx
+    4837:	78 3f                	js     4878 <sci_send_byte_bench+0x338>
+            /* The connection is broken, the data is lost as when nobody is listening and the
+             * thread closes the connection when it gets the hang up */
+            result = size;
+            ConsoleWake();
+        } else if (result < size) {
+    4839:	0f 84 e7 00 00 00    	je     4926 <sci_send_byte_bench+0x3e6>
+            result = (result < 0) ? 0 : result;
+            console->blocked = true;
+            ConsoleWake();
+        }
+    }
+    pthread_mutex_unlock(&console->lock);
+    483f:	48 8b 3c 24          	mov    (%rsp),%rdi
+    4843:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    4848:	e8 13 da ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    return result;
+    484d:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    4852:	0f b6 05 2c e2 06 00 	movzbl 0x6e22c(%rip),%eax        # 72a85 <trace_enabled>
+    4859:	41 89 cf             	mov    %ecx,%r15d
+    485c:	84 c0                	test   %al,%al
+    485e:	0f 85 0b 01 00 00    	jne    496f <sci_send_byte_bench+0x42f>
+    for (uint16_t index = 0; index < size; index++) {
+    4864:	66 45 85 ff          	test   %r15w,%r15w
+    4868:	0f 84 b8 fe ff ff    	je     4726 <sci_send_byte_bench+0x1e6>
+    486e:	e9 63 fd ff ff       	jmp    45d6 <sci_send_byte_bench+0x96>
+    4873:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    4878:	4c 89 44 24 18       	mov    %r8,0x18(%rsp)
+    487d:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+        if ((result < 0) && (errno != EAGAIN)) {
+    4882:	e8 d9 d7 ff ff       	call   2060 <__errno_location@plt>
+    4887:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    488c:	4c 8b 44 24 18       	mov    0x18(%rsp),%r8
+    4891:	83 38 0b             	cmpl   $0xb,(%rax)
+    4894:	0f 84 8c 00 00 00    	je     4926 <sci_send_byte_bench+0x3e6>
+    if (write(console_wake[1], &signal, 1) < 0) {
+    489a:	8b 3d cc 69 00 00    	mov    0x69cc(%rip),%edi        # b26c <console_wake+0x4>
+    48a0:	48 8d 74 24 2c       	lea    0x2c(%rsp),%rsi
+    48a5:	ba 01 00 00 00       	mov    $0x1,%edx
+    char signal = 0;
+    48aa:	c6 44 24 2c 00       	movb   $0x0,0x2c(%rsp)
+    if (write(console_wake[1], &signal, 1) < 0) {
+    48af:	e8 2c d8 ff ff       	call   20e0 <write@plt>
+    pthread_mutex_unlock(&console->lock);
+    48b4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    48b8:	e8 a3 d9 ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    48bd:	0f b6 05 c1 e1 06 00 	movzbl 0x6e1c1(%rip),%eax        # 72a85 <trace_enabled>
+    48c4:	84 c0                	test   %al,%al
+    48c6:	0f 84 04 fd ff ff    	je     45d0 <sci_send_byte_bench+0x90>
+    HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + port, size);
+    48cc:	44 89 e6             	mov    %r12d,%esi
+    48cf:	bf 20 00 00 00       	mov    $0x20,%edi
+    48d4:	83 ce 01             	or     $0x1,%esi
+    48d7:	e8 c4 e0 ff ff       	call   29a0 <TraceEvent.part.0>
+    48dc:	e9 ef fc ff ff       	jmp    45d0 <sci_send_byte_bench+0x90>
+    48e1:	44 89 e6             	mov    %r12d,%esi
+    48e4:	bf 20 00 00 00       	mov    $0x20,%edi
+    48e9:	e8 b2 e0 ff ff       	call   29a0 <TraceEvent.part.0>
+    48ee:	e9 33 fe ff ff       	jmp    4726 <sci_send_byte_bench+0x1e6>
+    ConsoleStart(port);
+    48f3:	44 89 ff             	mov    %r15d,%edi
+    48f6:	4c 89 04 24          	mov    %r8,(%rsp)
+    48fa:	e8 e1 f9 ff ff       	call   42e0 <ConsoleStart>
+    return (port < SOC_SCI_PORTS) && console_ports[port].attached;
+    48ff:	4c 8b 04 24          	mov    (%rsp),%r8
+    4903:	e9 9d fe ff ff       	jmp    47a5 <sci_send_byte_bench+0x265>
+            result = write(console->client, data, size);
+    4908:	ba 01 00 00 00       	mov    $0x1,%edx
+    490d:	48 8d 35 2c 41 00 00 	lea    0x412c(%rip),%rsi        # 8a40 <data.2>
+    4914:	e8 c7 d7 ff ff       	call   20e0 <write@plt>
+    4919:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    491e:	48 89 c1             	mov    %rax,%rcx
+    4921:	e9 0e ff ff ff       	jmp    4834 <sci_send_byte_bench+0x2f4>
+            result = (result < 0) ? 0 : result;
+    4926:	31 c0                	xor    %eax,%eax
+    4928:	48 85 c9             	test   %rcx,%rcx
+    if (write(console_wake[1], &signal, 1) < 0) {
+    492b:	8b 3d 3b 69 00 00    	mov    0x693b(%rip),%edi        # b26c <console_wake+0x4>
+    4931:	48 8d 74 24 2c       	lea    0x2c(%rsp),%rsi
+            result = (result < 0) ? 0 : result;
+    4936:	48 0f 48 c8          	cmovs  %rax,%rcx
+            console->blocked = true;
+    493a:	4c 89 c0             	mov    %r8,%rax
+    if (write(console_wake[1], &signal, 1) < 0) {
+    493d:	ba 01 00 00 00       	mov    $0x1,%edx
+    char signal = 0;
+    4942:	c6 44 24 2c 00       	movb   $0x0,0x2c(%rsp)
+            console->blocked = true;
+    4947:	48 c1 e0 06          	shl    $0x6,%rax
+    494b:	4c 01 c0             	add    %r8,%rax
+            result = (result < 0) ? 0 : result;
+    494e:	48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+            console->blocked = true;
+    4953:	48 c1 e0 06          	shl    $0x6,%rax
+    4957:	4d 8d 0c 07          	lea    (%r15,%rax,1),%r9
+    495b:	41 c6 41 34 01       	movb   $0x1,0x34(%r9)
+    if (write(console_wake[1], &signal, 1) < 0) {
+    4960:	e8 7b d7 ff ff       	call   20e0 <write@plt>
+    4965:	48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+}
+    496a:	e9 d0 fe ff ff       	jmp    483f <sci_send_byte_bench+0x2ff>
+    496f:	0f b7 c9             	movzwl %cx,%ecx
+    4972:	bf 20 00 00 00       	mov    $0x20,%edi
+    4977:	89 ce                	mov    %ecx,%esi
+    4979:	44 09 e6             	or     %r12d,%esi
+    497c:	e8 1f e0 ff ff       	call   29a0 <TraceEvent.part.0>
+    4981:	e9 de fe ff ff       	jmp    4864 <sci_send_byte_bench+0x324>
+    4986:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    498d:	00 00 00 
+
+0000000000004990 <FaultThreshold>:
+static bool FaultThreshold(char const * text, uint64_t * threshold) {
+    4990:	55                   	push   %rbp
+    4991:	48 89 f5             	mov    %rsi,%rbp
+    4994:	53                   	push   %rbx
+    4995:	48 89 fb             	mov    %rdi,%rbx
+    4998:	48 83 ec 18          	sub    $0x18,%rsp
+    double probability = strtod(text, &end);
+    499c:	48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    49a1:	e8 fa d6 ff ff       	call   20a0 <strtod@plt>
+    if ((end == text) || (*end && (*end != '/')) || (probability < 0) || (probability > 1)) {
+    49a6:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    49ab:	48 39 d8             	cmp    %rbx,%rax
+    49ae:	74 40                	je     49f0 <FaultThreshold+0x60>
+    49b0:	0f b6 10             	movzbl (%rax),%edx
+    49b3:	84 d2                	test   %dl,%dl
+    49b5:	0f 95 c0             	setne  %al
+    49b8:	80 fa 2f             	cmp    $0x2f,%dl
+    49bb:	0f 95 c2             	setne  %dl
+    49be:	20 d0                	and    %dl,%al
+    49c0:	75 2e                	jne    49f0 <FaultThreshold+0x60>
+    49c2:	66 0f ef c9          	pxor   %xmm1,%xmm1
+    49c6:	66 0f 2f c8          	comisd %xmm0,%xmm1
+    49ca:	77 1c                	ja     49e8 <FaultThreshold+0x58>
+    49cc:	66 0f 2f 05 7c 40 00 	comisd 0x407c(%rip),%xmm0        # 8a50 <data.2+0x10>
+    49d3:	00 
+    49d4:	77 12                	ja     49e8 <FaultThreshold+0x58>
+    *threshold = (probability >= 1) ? UINT64_MAX : (uint64_t)(probability * 18446744073709551616.0);
+    49d6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    49dd:	72 21                	jb     4a00 <FaultThreshold+0x70>
+    49df:	48 89 45 00          	mov    %rax,0x0(%rbp)
+    return true;
+    49e3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    49e8:	48 83 c4 18          	add    $0x18,%rsp
+    49ec:	5b                   	pop    %rbx
+    49ed:	5d                   	pop    %rbp
+    49ee:	c3                   	ret
+    49ef:	90                   	nop
+    49f0:	48 83 c4 18          	add    $0x18,%rsp
+        return false;
+    49f4:	31 c0                	xor    %eax,%eax
+}
+    49f6:	5b                   	pop    %rbx
+    49f7:	5d                   	pop    %rbp
+    49f8:	c3                   	ret
+    49f9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    *threshold = (probability >= 1) ? UINT64_MAX : (uint64_t)(probability * 18446744073709551616.0);
+    4a00:	f2 0f 59 05 50 40 00 	mulsd  0x4050(%rip),%xmm0        # 8a58 <data.2+0x18>
+    4a07:	00 
+    4a08:	f2 0f 10 0d 50 40 00 	movsd  0x4050(%rip),%xmm1        # 8a60 <data.2+0x20>
+    4a0f:	00 
+    4a10:	66 0f 2f c1          	comisd %xmm1,%xmm0
+    4a14:	72 1a                	jb     4a30 <FaultThreshold+0xa0>
+    4a16:	f2 0f 5c c1          	subsd  %xmm1,%xmm0
+    4a1a:	f2 48 0f 2c c0       	cvttsd2si %xmm0,%rax
+    4a1f:	48 0f ba f8 3f       	btc    $0x3f,%rax
+    4a24:	eb b9                	jmp    49df <FaultThreshold+0x4f>
+    4a26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    4a2d:	00 00 00 
+    4a30:	f2 48 0f 2c c0       	cvttsd2si %xmm0,%rax
+    4a35:	eb a8                	jmp    49df <FaultThreshold+0x4f>
+    4a37:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    4a3e:	00 00 
+
+0000000000004a40 <LatencyDispatch>:
+    if (vector) {
+        vector->entry = now;
+    }
+}
+
+void LatencyDispatch(uint16_t source) {
+    4a40:	53                   	push   %rbx
+    4a41:	89 fb                	mov    %edi,%ebx
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    4a43:	bf 01 00 00 00       	mov    $0x1,%edi
+    4a48:	48 83 ec 10          	sub    $0x10,%rsp
+    4a4c:	48 89 e6             	mov    %rsp,%rsi
+    4a4f:	e8 7c d6 ff ff       	call   20d0 <clock_gettime@plt>
+    uint32_t now = CyclesRead();
+    latency_vector_t vector = LatencyFind(source);
+    4a54:	0f b7 fb             	movzwl %bx,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    4a57:	4c 8b 0c 24          	mov    (%rsp),%r9
+    4a5b:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    4a60:	e8 fb dd ff ff       	call   2860 <LatencyFind>
+    uint32_t latency;
+
+    if (vector) {
+    4a65:	48 85 c0             	test   %rax,%rax
+    4a68:	0f 84 84 00 00 00    	je     4af2 <LatencyDispatch+0xb2>
+        latency = now - (vector->pending ? vector->event : vector->entry);
+    4a6e:	80 b8 b6 00 00 00 00 	cmpb   $0x0,0xb6(%rax)
+    4a75:	8b b0 bc 00 00 00    	mov    0xbc(%rax),%esi
+    4a7b:	48 89 c1             	mov    %rax,%rcx
+    4a7e:	0f 45 b0 b8 00 00 00 	cmovne 0xb8(%rax),%esi
+    4a85:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+        vector->pending = false;
+        vector->dispatch = now;
+        vector->dispatched = true;
+        vector->stats.count++;
+    4a8c:	83 41 04 01          	addl   $0x1,0x4(%rcx)
+    4a90:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    4a97:	9b c4 20 
+    4a9a:	49 f7 ea             	imul   %r10
+    4a9d:	49 c1 fa 3f          	sar    $0x3f,%r10
+        vector->pending = false;
+    4aa1:	0f b7 05 e0 3f 00 00 	movzwl 0x3fe0(%rip),%eax        # 8a88 <data.2+0x48>
+        vector->stats.latency[LatencyBucket(latency)]++;
+        if (latency < vector->stats.latency_min) {
+    4aa8:	8b 79 08             	mov    0x8(%rcx),%edi
+        vector->pending = false;
+    4aab:	66 89 81 b6 00 00 00 	mov    %ax,0xb6(%rcx)
+    4ab2:	48 c1 fa 07          	sar    $0x7,%rdx
+    4ab6:	4c 29 d2             	sub    %r10,%rdx
+    4ab9:	44 01 ca             	add    %r9d,%edx
+        vector->dispatch = now;
+    4abc:	89 91 c0 00 00 00    	mov    %edx,0xc0(%rcx)
+    uint8_t result = (value == 0) ? 0 : (32 - __builtin_clz(value));
+    4ac2:	29 f2                	sub    %esi,%edx
+    4ac4:	74 3a                	je     4b00 <LatencyDispatch+0xc0>
+    4ac6:	0f bd f2             	bsr    %edx,%esi
+    4ac9:	b8 20 00 00 00       	mov    $0x20,%eax
+    4ace:	83 f6 1f             	xor    $0x1f,%esi
+    4ad1:	29 f0                	sub    %esi,%eax
+    return (result < LATENCY_BUCKETS) ? result : (LATENCY_BUCKETS - 1);
+    4ad3:	be 13 00 00 00       	mov    $0x13,%esi
+    4ad8:	40 38 f0             	cmp    %sil,%al
+    4adb:	0f 47 c6             	cmova  %esi,%eax
+        vector->stats.latency[LatencyBucket(latency)]++;
+    4ade:	0f b6 c0             	movzbl %al,%eax
+    4ae1:	83 44 81 14 01       	addl   $0x1,0x14(%rcx,%rax,4)
+        if (latency < vector->stats.latency_min) {
+    4ae6:	39 fa                	cmp    %edi,%edx
+    4ae8:	72 2e                	jb     4b18 <LatencyDispatch+0xd8>
+            vector->stats.latency_min = latency;
+        }
+        if (latency > vector->stats.latency_max) {
+    4aea:	39 51 0c             	cmp    %edx,0xc(%rcx)
+    4aed:	73 03                	jae    4af2 <LatencyDispatch+0xb2>
+            vector->stats.latency_max = latency;
+    4aef:	89 51 0c             	mov    %edx,0xc(%rcx)
+        }
+    }
+}
+    4af2:	48 83 c4 10          	add    $0x10,%rsp
+    4af6:	5b                   	pop    %rbx
+    4af7:	c3                   	ret
+    4af8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    4aff:	00 
+        vector->stats.latency[LatencyBucket(latency)]++;
+    4b00:	83 41 14 01          	addl   $0x1,0x14(%rcx)
+        if (latency < vector->stats.latency_min) {
+    4b04:	85 ff                	test   %edi,%edi
+    4b06:	74 ea                	je     4af2 <LatencyDispatch+0xb2>
+            vector->stats.latency_min = latency;
+    4b08:	c7 41 08 00 00 00 00 	movl   $0x0,0x8(%rcx)
+}
+    4b0f:	48 83 c4 10          	add    $0x10,%rsp
+    4b13:	5b                   	pop    %rbx
+    4b14:	c3                   	ret
+    4b15:	0f 1f 00             	nopl   (%rax)
+            vector->stats.latency_min = latency;
+    4b18:	89 51 08             	mov    %edx,0x8(%rcx)
+    4b1b:	eb cd                	jmp    4aea <LatencyDispatch+0xaa>
+    4b1d:	0f 1f 00             	nopl   (%rax)
+
+0000000000004b20 <LatencyExit>:
+
+void LatencyExit(uint16_t source) {
+    4b20:	53                   	push   %rbx
+    4b21:	89 fb                	mov    %edi,%ebx
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    4b23:	bf 01 00 00 00       	mov    $0x1,%edi
+    4b28:	48 83 ec 10          	sub    $0x10,%rsp
+    4b2c:	48 89 e6             	mov    %rsp,%rsi
+    4b2f:	e8 9c d5 ff ff       	call   20d0 <clock_gettime@plt>
+    uint32_t now = CyclesRead();
+    latency_vector_t vector = LatencyFind(source);
+    4b34:	0f b7 fb             	movzwl %bx,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    4b37:	4c 8b 0c 24          	mov    (%rsp),%r9
+    4b3b:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    4b40:	e8 1b dd ff ff       	call   2860 <LatencyFind>
+    uint32_t duration;
+
+    if (vector && vector->dispatched) {
+    4b45:	48 85 c0             	test   %rax,%rax
+    4b48:	74 68                	je     4bb2 <LatencyExit+0x92>
+    4b4a:	80 b8 b7 00 00 00 00 	cmpb   $0x0,0xb7(%rax)
+    4b51:	48 89 c1             	mov    %rax,%rcx
+    4b54:	74 5c                	je     4bb2 <LatencyExit+0x92>
+    4b56:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+        duration = now - vector->dispatch;
+        vector->dispatched = false;
+    4b5d:	c6 81 b7 00 00 00 00 	movb   $0x0,0xb7(%rcx)
+    4b64:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    4b6b:	9b c4 20 
+    4b6e:	49 f7 ea             	imul   %r10
+    4b71:	49 c1 fa 3f          	sar    $0x3f,%r10
+    4b75:	48 c1 fa 07          	sar    $0x7,%rdx
+    4b79:	4c 29 d2             	sub    %r10,%rdx
+    4b7c:	41 01 d1             	add    %edx,%r9d
+    uint8_t result = (value == 0) ? 0 : (32 - __builtin_clz(value));
+    4b7f:	44 2b 89 c0 00 00 00 	sub    0xc0(%rcx),%r9d
+    4b86:	74 38                	je     4bc0 <LatencyExit+0xa0>
+    4b88:	41 0f bd d1          	bsr    %r9d,%edx
+    4b8c:	b8 20 00 00 00       	mov    $0x20,%eax
+    4b91:	83 f2 1f             	xor    $0x1f,%edx
+    4b94:	29 d0                	sub    %edx,%eax
+    return (result < LATENCY_BUCKETS) ? result : (LATENCY_BUCKETS - 1);
+    4b96:	ba 13 00 00 00       	mov    $0x13,%edx
+    4b9b:	38 d0                	cmp    %dl,%al
+    4b9d:	0f 47 c2             	cmova  %edx,%eax
+        vector->stats.duration[LatencyBucket(duration)]++;
+    4ba0:	0f b6 c0             	movzbl %al,%eax
+    4ba3:	83 44 81 64 01       	addl   $0x1,0x64(%rcx,%rax,4)
+        if (duration > vector->stats.duration_max) {
+    4ba8:	44 39 49 10          	cmp    %r9d,0x10(%rcx)
+    4bac:	73 04                	jae    4bb2 <LatencyExit+0x92>
+            vector->stats.duration_max = duration;
+    4bae:	44 89 49 10          	mov    %r9d,0x10(%rcx)
+        }
+    }
+}
+    4bb2:	48 83 c4 10          	add    $0x10,%rsp
+    4bb6:	5b                   	pop    %rbx
+    4bb7:	c3                   	ret
+    4bb8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    4bbf:	00 
+        vector->stats.duration[LatencyBucket(duration)]++;
+    4bc0:	83 41 64 01          	addl   $0x1,0x64(%rcx)
+}
+    4bc4:	48 83 c4 10          	add    $0x10,%rsp
+    4bc8:	5b                   	pop    %rbx
+    4bc9:	c3                   	ret
+    4bca:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000004bd0 <tick_dispatch_bench>:
+
+BENCH(tick, dispatch) {
+    4bd0:	41 55                	push   %r13
+    4bd2:	41 54                	push   %r12
+    4bd4:	55                   	push   %rbp
+    4bd5:	89 fd                	mov    %edi,%ebp
+    4bd7:	53                   	push   %rbx
+    4bd8:	48 83 ec 18          	sub    $0x18,%rsp
+    static uint32_t events = 0;
+    static bool started = false;
+
+    if (!started) {
+    4bdc:	80 3d a1 de 06 00 00 	cmpb   $0x0,0x6dea1(%rip)        # 72a84 <started.1>
+    4be3:	0f 84 87 01 00 00    	je     4d70 <tick_dispatch_bench+0x1a0>
+        started = true;
+        TickStart(BenchTickEvent, &events, BENCH_TICK_PERIOD);
+    }
+    for (uint32_t index = 0; index < iterations; index++) {
+    4be9:	85 ed                	test   %ebp,%ebp
+    4beb:	0f 84 5e 01 00 00    	je     4d4f <tick_dispatch_bench+0x17f>
+    4bf1:	49 bd cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%r13
+    4bf8:	9b c4 20 
+    4bfb:	31 db                	xor    %ebx,%ebx
+    4bfd:	49 89 e4             	mov    %rsp,%r12
+    4c00:	e9 89 00 00 00       	jmp    4c8e <tick_dispatch_bench+0xbe>
+    4c05:	0f 1f 00             	nopl   (%rax)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    4c08:	4c 89 e6             	mov    %r12,%rsi
+    4c0b:	bf 01 00 00 00       	mov    $0x1,%edi
+    4c10:	e8 bb d4 ff ff       	call   20d0 <clock_gettime@plt>
+    latency_vector_t vector = LatencyFind(source);
+    4c15:	31 ff                	xor    %edi,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    4c17:	4c 8b 0c 24          	mov    (%rsp),%r9
+    4c1b:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    4c20:	e8 3b dc ff ff       	call   2860 <LatencyFind>
+    4c25:	48 89 c1             	mov    %rax,%rcx
+    if (vector) {
+    4c28:	48 85 c0             	test   %rax,%rax
+    4c2b:	74 22                	je     4c4f <tick_dispatch_bench+0x7f>
+    4c2d:	4c 89 d0             	mov    %r10,%rax
+    4c30:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+    4c37:	49 c1 fa 3f          	sar    $0x3f,%r10
+    4c3b:	49 f7 ed             	imul   %r13
+    4c3e:	48 c1 fa 07          	sar    $0x7,%rdx
+    4c42:	4c 29 d2             	sub    %r10,%rdx
+    4c45:	41 01 d1             	add    %edx,%r9d
+    4c48:	44 89 89 bc 00 00 00 	mov    %r9d,0xbc(%rcx)
+    pthread_create(&instance->thread, NULL, TimerThread, NULL);
+}
+
+void SysTick_Handler(void) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_TICK);
+    if (instance->handler) {
+    4c4f:	48 83 3d 11 de 06 00 	cmpq   $0x0,0x6de11(%rip)        # 72a68 <instance+0x8>
+    4c56:	00 
+    4c57:	74 14                	je     4c6d <tick_dispatch_bench+0x9d>
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_TICK);
+    4c59:	31 ff                	xor    %edi,%edi
+    4c5b:	e8 e0 fd ff ff       	call   4a40 <LatencyDispatch>
+        instance->handler(instance->object);
+    4c60:	48 8b 3d 09 de 06 00 	mov    0x6de09(%rip),%rdi        # 72a70 <instance+0x10>
+    4c67:	ff 15 fb dd 06 00    	call   *0x6ddfb(%rip)        # 72a68 <instance+0x8>
+    }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_TICK);
+    4c6d:	31 ff                	xor    %edi,%edi
+    4c6f:	e8 ac fe ff ff       	call   4b20 <LatencyExit>
+    4c74:	0f b6 05 0a de 06 00 	movzbl 0x6de0a(%rip),%eax        # 72a85 <trace_enabled>
+    4c7b:	84 c0                	test   %al,%al
+    4c7d:	0f 85 b5 00 00 00    	jne    4d38 <tick_dispatch_bench+0x168>
+    4c83:	83 c3 01             	add    $0x1,%ebx
+    4c86:	39 dd                	cmp    %ebx,%ebp
+    4c88:	0f 84 c1 00 00 00    	je     4d4f <tick_dispatch_bench+0x17f>
+    4c8e:	0f b6 05 f0 dd 06 00 	movzbl 0x6ddf0(%rip),%eax        # 72a85 <trace_enabled>
+    4c95:	84 c0                	test   %al,%al
+    4c97:	0f 84 6b ff ff ff    	je     4c08 <tick_dispatch_bench+0x38>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    4c9d:	4c 89 e6             	mov    %r12,%rsi
+    4ca0:	bf 01 00 00 00       	mov    $0x1,%edi
+    4ca5:	e8 26 d4 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    4caa:	48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    4caf:	69 34 24 40 42 0f 00 	imul   $0xf4240,(%rsp),%esi
+    4cb6:	48 89 c8             	mov    %rcx,%rax
+    4cb9:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    4cbd:	49 f7 ed             	imul   %r13
+    if (!FifoReserve(&self->head, &self->tail, self->mask + 1, count, first)) {
+    4cc0:	8b 05 42 68 00 00    	mov    0x6842(%rip),%eax        # b508 <trace_queue+0x8>
+    4cc6:	48 c1 fa 07          	sar    $0x7,%rdx
+    4cca:	48 29 ca             	sub    %rcx,%rdx
+    4ccd:	01 d6                	add    %edx,%esi
+    4ccf:	8d 50 01             	lea    0x1(%rax),%edx
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    4cd2:	8b 05 68 68 00 00    	mov    0x6868(%rip),%eax        # b540 <trace_queue+0x40>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    4cd8:	44 8b 05 a1 68 00 00 	mov    0x68a1(%rip),%r8d        # b580 <trace_queue+0x80>
+        if (index + count - FifoLoad(tail) > capacity) {
+    4cdf:	8d 48 02             	lea    0x2(%rax),%ecx
+    4ce2:	89 cf                	mov    %ecx,%edi
+    4ce4:	44 29 c7             	sub    %r8d,%edi
+    4ce7:	39 fa                	cmp    %edi,%edx
+    4ce9:	72 6f                	jb     4d5a <tick_dispatch_bench+0x18a>
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+    4ceb:	f0 0f b1 0d 4d 68 00 	lock cmpxchg %ecx,0x684d(%rip)        # b540 <trace_queue+0x40>
+    4cf2:	00 
+    4cf3:	75 e3                	jne    4cd8 <tick_dispatch_bench+0x108>
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    4cf5:	48 8b 15 04 68 00 00 	mov    0x6804(%rip),%rdx        # b500 <trace_queue>
+    4cfc:	89 c1                	mov    %eax,%ecx
+    4cfe:	23 0d 04 68 00 00    	and    0x6804(%rip),%ecx        # b508 <trace_queue+0x8>
+    4d04:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+        FifoStore(&cell->sequence, *first + index + 1);
+    4d08:	8d 50 01             	lea    0x1(%rax),%edx
+    4d0b:	83 c0 02             	add    $0x2,%eax
+        cell->value = values[index];
+    4d0e:	89 71 04             	mov    %esi,0x4(%rcx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    4d11:	89 11                	mov    %edx,(%rcx)
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    4d13:	48 8b 0d e6 67 00 00 	mov    0x67e6(%rip),%rcx        # b500 <trace_queue>
+    4d1a:	23 15 e8 67 00 00    	and    0x67e8(%rip),%edx        # b508 <trace_queue+0x8>
+    4d20:	48 8d 14 d1          	lea    (%rcx,%rdx,8),%rdx
+        cell->value = values[index];
+    4d24:	c7 42 04 00 00 00 10 	movl   $0x10000000,0x4(%rdx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    4d2b:	89 02                	mov    %eax,(%rdx)
+    4d2d:	e9 d6 fe ff ff       	jmp    4c08 <tick_dispatch_bench+0x38>
+    4d32:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    4d38:	31 f6                	xor    %esi,%esi
+    4d3a:	bf 11 00 00 00       	mov    $0x11,%edi
+    4d3f:	83 c3 01             	add    $0x1,%ebx
+    4d42:	e8 59 dc ff ff       	call   29a0 <TraceEvent.part.0>
+    4d47:	39 dd                	cmp    %ebx,%ebp
+    4d49:	0f 85 3f ff ff ff    	jne    4c8e <tick_dispatch_bench+0xbe>
+        SysTick_Handler();
+    }
+    BENCH_KEEP(events);
+}
+    4d4f:	48 83 c4 18          	add    $0x18,%rsp
+    4d53:	5b                   	pop    %rbx
+    4d54:	5d                   	pop    %rbp
+    4d55:	41 5c                	pop    %r12
+    4d57:	41 5d                	pop    %r13
+    4d59:	c3                   	ret
+    return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+    4d5a:	f0 83 05 e2 67 00 00 	lock addl $0x2,0x67e2(%rip)        # b544 <trace_queue+0x44>
+    4d61:	02 
+        return false;
+    4d62:	e9 a1 fe ff ff       	jmp    4c08 <tick_dispatch_bench+0x38>
+    4d67:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    4d6e:	00 00 
+    instance->handler = handler;
+    4d70:	48 8d 05 69 da ff ff 	lea    -0x2597(%rip),%rax        # 27e0 <BenchTickEvent>
+    pthread_create(&instance->thread, NULL, TimerThread, NULL);
+    4d77:	31 c9                	xor    %ecx,%ecx
+    4d79:	48 8d 15 30 16 00 00 	lea    0x1630(%rip),%rdx        # 63b0 <TimerThread>
+    4d80:	31 f6                	xor    %esi,%esi
+    instance->handler = handler;
+    4d82:	48 89 05 df dc 06 00 	mov    %rax,0x6dcdf(%rip)        # 72a68 <instance+0x8>
+    pthread_create(&instance->thread, NULL, TimerThread, NULL);
+    4d89:	48 8d 3d d0 dc 06 00 	lea    0x6dcd0(%rip),%rdi        # 72a60 <instance>
+    instance->object = object;
+    4d90:	48 8d 05 e9 dc 06 00 	lea    0x6dce9(%rip),%rax        # 72a80 <events.0>
+        started = true;
+    4d97:	c6 05 e6 dc 06 00 01 	movb   $0x1,0x6dce6(%rip)        # 72a84 <started.1>
+    4d9e:	48 89 05 cb dc 06 00 	mov    %rax,0x6dccb(%rip)        # 72a70 <instance+0x10>
+    instance->period = period;
+    4da5:	c7 05 c9 dc 06 00 3f 	movl   $0xf423f,0x6dcc9(%rip)        # 72a78 <instance+0x18>
+    4dac:	42 0f 00 
+    pthread_create(&instance->thread, NULL, TimerThread, NULL);
+    4daf:	e8 2c d5 ff ff       	call   22e0 <pthread_create@plt>
+}
+    4db4:	e9 30 fe ff ff       	jmp    4be9 <tick_dispatch_bench+0x19>
+    4db9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000004dc0 <GpioDispatchEvent>:
+static void GpioDispatchEvent(uint8_t port, uint8_t bit, bool previous, bool state) {
+    4dc0:	41 57                	push   %r15
+    struct hal_gpio_bit_s gpio = {.gpio = port, .bit = bit};
+    4dc2:	8d 04 f5 00 00 00 00 	lea    0x0(,%rsi,8),%eax
+static void GpioDispatchEvent(uint8_t port, uint8_t bit, bool previous, bool state) {
+    4dc9:	41 56                	push   %r14
+    struct hal_gpio_bit_s gpio = {.gpio = port, .bit = bit};
+    4dcb:	09 f8                	or     %edi,%eax
+static void GpioDispatchEvent(uint8_t port, uint8_t bit, bool previous, bool state) {
+    4dcd:	41 55                	push   %r13
+    4dcf:	41 54                	push   %r12
+    4dd1:	55                   	push   %rbp
+    4dd2:	53                   	push   %rbx
+    4dd3:	48 83 ec 38          	sub    $0x38,%rsp
+    struct hal_gpio_bit_s gpio = {.gpio = port, .bit = bit};
+    4dd7:	88 44 24 1f          	mov    %al,0x1f(%rsp)
+    if (previous != state) {
+    4ddb:	38 d1                	cmp    %dl,%cl
+    4ddd:	75 11                	jne    4df0 <GpioDispatchEvent+0x30>
+}
+    4ddf:	48 83 c4 38          	add    $0x38,%rsp
+    4de3:	5b                   	pop    %rbx
+    4de4:	5d                   	pop    %rbp
+    4de5:	41 5c                	pop    %r12
+    4de7:	41 5d                	pop    %r13
+    4de9:	41 5e                	pop    %r14
+    4deb:	41 5f                	pop    %r15
+    4ded:	c3                   	ret
+    4dee:	66 90                	xchg   %ax,%ax
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    4df0:	40 0f b6 c7          	movzbl %dil,%eax
+    4df4:	41 89 cc             	mov    %ecx,%r12d
+    RefreshStatus(&gpio, previous, state);
+    4df7:	44 0f b6 f1          	movzbl %cl,%r14d
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    4dfb:	89 f9                	mov    %edi,%ecx
+    4dfd:	89 44 24 04          	mov    %eax,0x4(%rsp)
+    4e01:	b8 01 00 00 00       	mov    $0x1,%eax
+    4e06:	89 fb                	mov    %edi,%ebx
+    4e08:	89 f5                	mov    %esi,%ebp
+    4e0a:	d3 e0                	shl    %cl,%eax
+    4e0c:	f0 09 05 b9 1d 07 00 	lock or %eax,0x71db9(%rip)        # 76bcc <gpio_dirty>
+    pthread_once(&vcd_once, VcdOpen);
+    4e13:	48 8d 35 16 df ff ff 	lea    -0x20ea(%rip),%rsi        # 2d30 <VcdOpen>
+    4e1a:	48 8d 3d a7 1d 07 00 	lea    0x71da7(%rip),%rdi        # 76bc8 <vcd_once>
+        VcdGpio(gpio->gpio, gpio->bit, state);
+    4e21:	0f b6 44 24 1f       	movzbl 0x1f(%rsp),%eax
+    4e26:	41 89 c5             	mov    %eax,%r13d
+    4e29:	83 e0 07             	and    $0x7,%eax
+    4e2c:	41 c0 ed 03          	shr    $0x3,%r13b
+    4e30:	41 89 c7             	mov    %eax,%r15d
+    4e33:	e8 b8 d5 ff ff       	call   23f0 <pthread_once@plt>
+    if (vcd_file) {
+    4e38:	48 83 3d 80 1d 07 00 	cmpq   $0x0,0x71d80(%rip)        # 76bc0 <vcd_file>
+    4e3f:	00 
+    4e40:	74 10                	je     4e52 <GpioDispatchEvent+0x92>
+    4e42:	41 0f b6 f5          	movzbl %r13b,%esi
+    4e46:	41 0f b6 ff          	movzbl %r15b,%edi
+    4e4a:	44 89 f2             	mov    %r14d,%edx
+    4e4d:	e8 8e e7 ff ff       	call   35e0 <VcdGpio.part.0>
+        JournalGpio(port, bit, state);
+    4e52:	40 0f b6 c5          	movzbl %bpl,%eax
+    4e56:	48 8d 35 03 e4 ff ff 	lea    -0x1bfd(%rip),%rsi        # 3260 <JournalOpen>
+    4e5d:	48 8d 3d ec db 06 00 	lea    0x6dbec(%rip),%rdi        # 72a50 <journal_once>
+    4e64:	89 04 24             	mov    %eax,(%rsp)
+    4e67:	e8 84 d5 ff ff       	call   23f0 <pthread_once@plt>
+    return journal_replay != NULL;
+}
+
+void JournalGpio(uint8_t port, uint8_t bit, bool state) {
+    JournalStart();
+    if (journal_record) {
+    4e6c:	48 8d 44 24 20       	lea    0x20(%rsp),%rax
+    4e71:	48 83 3d cf db 06 00 	cmpq   $0x0,0x6dbcf(%rip)        # 72a48 <journal_record>
+    4e78:	00 
+    4e79:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    4e7e:	49 89 c7             	mov    %rax,%r15
+    4e81:	0f 84 df 00 00 00    	je     4f66 <GpioDispatchEvent+0x1a6>
+        pthread_mutex_lock(&journal_lock);
+    4e87:	48 8d 3d 92 db 06 00 	lea    0x6db92(%rip),%rdi        # 72a20 <journal_lock>
+    4e8e:	e8 8d d5 ff ff       	call   2420 <pthread_mutex_lock@plt>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    4e93:	4c 89 fe             	mov    %r15,%rsi
+    4e96:	bf 01 00 00 00       	mov    $0x1,%edi
+    4e9b:	e8 30 d2 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    4ea0:	48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    4ea5:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    4eac:	9b c4 20 
+    4eaf:	4c 69 6c 24 20 40 42 	imul   $0xf4240,0x20(%rsp),%r13
+    4eb6:	0f 00 
+    4eb8:	48 f7 e9             	imul   %rcx
+    4ebb:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    if (journal_ticking) {
+    4ebf:	0f b6 05 32 db 06 00 	movzbl 0x6db32(%rip),%eax        # 729f8 <journal_ticking>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    4ec6:	48 c1 fa 07          	sar    $0x7,%rdx
+    4eca:	48 29 ca             	sub    %rcx,%rdx
+    4ecd:	49 01 d5             	add    %rdx,%r13
+    4ed0:	4c 2b 2d 01 db 06 00 	sub    0x6db01(%rip),%r13        # 729d8 <journal_start>
+    if (journal_ticking) {
+    4ed7:	84 c0                	test   %al,%al
+    4ed9:	0f 85 91 01 00 00    	jne    5070 <GpioDispatchEvent+0x2b0>
+    if (now < journal_last) {
+    4edf:	48 8b 05 1a db 06 00 	mov    0x6db1a(%rip),%rax        # 72a00 <journal_last>
+    putc(kind, journal_record);
+    4ee6:	48 8b 35 5b db 06 00 	mov    0x6db5b(%rip),%rsi        # 72a48 <journal_record>
+    4eed:	bf 01 00 00 00       	mov    $0x1,%edi
+    4ef2:	49 39 c5             	cmp    %rax,%r13
+    4ef5:	4c 0f 42 e8          	cmovb  %rax,%r13
+    4ef9:	e8 f2 d2 ff ff       	call   21f0 <putc@plt>
+    JournalWriteNumber(now - journal_last);
+    4efe:	4d 89 ef             	mov    %r13,%r15
+    4f01:	4c 2b 3d f8 da 06 00 	sub    0x6daf8(%rip),%r15        # 72a00 <journal_last>
+    4f08:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    4f0f:	00 
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    4f10:	44 89 ff             	mov    %r15d,%edi
+    4f13:	48 8b 35 2e db 06 00 	mov    0x6db2e(%rip),%rsi        # 72a48 <journal_record>
+    4f1a:	83 e7 7f             	and    $0x7f,%edi
+    4f1d:	49 83 ff 7f          	cmp    $0x7f,%r15
+    4f21:	0f 87 29 01 00 00    	ja     5050 <GpioDispatchEvent+0x290>
+    4f27:	e8 c4 d2 ff ff       	call   21f0 <putc@plt>
+        JournalWriteHeader(JOURNAL_GPIO);
+        putc(port, journal_record);
+    4f2c:	48 8b 35 15 db 06 00 	mov    0x6db15(%rip),%rsi        # 72a48 <journal_record>
+    4f33:	8b 7c 24 04          	mov    0x4(%rsp),%edi
+    journal_last = now;
+    4f37:	4c 89 2d c2 da 06 00 	mov    %r13,0x6dac2(%rip)        # 72a00 <journal_last>
+        putc(port, journal_record);
+    4f3e:	e8 ad d2 ff ff       	call   21f0 <putc@plt>
+        putc(bit | (state ? 0x80 : 0), journal_record);
+    4f43:	8b 04 24             	mov    (%rsp),%eax
+    4f46:	44 89 f7             	mov    %r14d,%edi
+    4f49:	48 8b 35 f8 da 06 00 	mov    0x6daf8(%rip),%rsi        # 72a48 <journal_record>
+    4f50:	c1 e7 07             	shl    $0x7,%edi
+    4f53:	09 c7                	or     %eax,%edi
+    4f55:	e8 96 d2 ff ff       	call   21f0 <putc@plt>
+        pthread_mutex_unlock(&journal_lock);
+    4f5a:	48 8d 3d bf da 06 00 	lea    0x6dabf(%rip),%rdi        # 72a20 <journal_lock>
+    4f61:	e8 fa d2 ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    uint16_t index = port * SOC_GPIO_BITS + bit;
+    4f66:	40 0f b6 ed          	movzbl %bpl,%ebp
+    4f6a:	0f b6 db             	movzbl %bl,%ebx
+    4f6d:	0f b6 05 11 db 06 00 	movzbl 0x6db11(%rip),%eax        # 72a85 <trace_enabled>
+    4f74:	8d 5c dd 00          	lea    0x0(%rbp,%rbx,8),%ebx
+    event_handler_t descriptor = &event_handlers[index];
+    4f78:	0f b7 db             	movzwl %bx,%ebx
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_GPIO + index);
+    4f7b:	8d 6b 40             	lea    0x40(%rbx),%ebp
+    4f7e:	84 c0                	test   %al,%al
+    4f80:	0f 85 1a 01 00 00    	jne    50a0 <GpioDispatchEvent+0x2e0>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    4f86:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    4f8b:	bf 01 00 00 00       	mov    $0x1,%edi
+    4f90:	e8 3b d1 ff ff       	call   20d0 <clock_gettime@plt>
+    latency_vector_t vector = LatencyFind(source);
+    4f95:	89 ef                	mov    %ebp,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    4f97:	4c 8b 4c 24 20       	mov    0x20(%rsp),%r9
+    4f9c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+    4fa1:	e8 ba d8 ff ff       	call   2860 <LatencyFind>
+    4fa6:	48 89 c1             	mov    %rax,%rcx
+    if (vector) {
+    4fa9:	48 85 c0             	test   %rax,%rax
+    4fac:	74 29                	je     4fd7 <GpioDispatchEvent+0x217>
+    4fae:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    4fb5:	9b c4 20 
+    4fb8:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+    4fbf:	49 f7 ea             	imul   %r10
+    4fc2:	49 c1 fa 3f          	sar    $0x3f,%r10
+    4fc6:	48 c1 fa 07          	sar    $0x7,%rdx
+    4fca:	4c 29 d2             	sub    %r10,%rdx
+    4fcd:	41 01 d1             	add    %edx,%r9d
+    4fd0:	44 89 89 bc 00 00 00 	mov    %r9d,0xbc(%rcx)
+        if ((descriptor->handler != NULL) && (state ? descriptor->rising : descriptor->falling)) {
+    4fd7:	4c 8d 3d 62 37 00 00 	lea    0x3762(%rip),%r15        # 8740 <event_handlers.lto_priv.0>
+    4fde:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+    4fe2:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+    4fe6:	4c 8b 28             	mov    (%rax),%r13
+    4fe9:	4d 85 ed             	test   %r13,%r13
+    4fec:	74 28                	je     5016 <GpioDispatchEvent+0x256>
+    4fee:	0f b6 40 10          	movzbl 0x10(%rax),%eax
+    4ff2:	45 84 e4             	test   %r12b,%r12b
+    4ff5:	75 71                	jne    5068 <GpioDispatchEvent+0x2a8>
+    4ff7:	a8 02                	test   $0x2,%al
+    4ff9:	74 1b                	je     5016 <GpioDispatchEvent+0x256>
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_GPIO + index);
+    4ffb:	89 ef                	mov    %ebp,%edi
+    4ffd:	e8 3e fa ff ff       	call   4a40 <LatencyDispatch>
+            descriptor->handler(&gpio, state, descriptor->object);
+    5002:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+    5006:	48 8d 7c 24 1f       	lea    0x1f(%rsp),%rdi
+    500b:	44 89 f6             	mov    %r14d,%esi
+    500e:	49 8b 54 c7 08       	mov    0x8(%r15,%rax,8),%rdx
+    5013:	41 ff d5             	call   *%r13
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_GPIO + index);
+    5016:	89 ef                	mov    %ebp,%edi
+    5018:	e8 03 fb ff ff       	call   4b20 <LatencyExit>
+    501d:	0f b6 05 61 da 06 00 	movzbl 0x6da61(%rip),%eax        # 72a85 <trace_enabled>
+    5024:	84 c0                	test   %al,%al
+    5026:	0f 84 b3 fd ff ff    	je     4ddf <GpioDispatchEvent+0x1f>
+    502c:	89 ee                	mov    %ebp,%esi
+    502e:	bf 11 00 00 00       	mov    $0x11,%edi
+    5033:	e8 68 d9 ff ff       	call   29a0 <TraceEvent.part.0>
+}
+    5038:	48 83 c4 38          	add    $0x38,%rsp
+    503c:	5b                   	pop    %rbx
+    503d:	5d                   	pop    %rbp
+    503e:	41 5c                	pop    %r12
+    5040:	41 5d                	pop    %r13
+    5042:	41 5e                	pop    %r14
+    5044:	41 5f                	pop    %r15
+    5046:	c3                   	ret
+    5047:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    504e:	00 00 
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    5050:	40 80 cf 80          	or     $0x80,%dil
+        value = value >> 7;
+    5054:	49 c1 ef 07          	shr    $0x7,%r15
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    5058:	e8 93 d1 ff ff       	call   21f0 <putc@plt>
+    505d:	e9 ae fe ff ff       	jmp    4f10 <GpioDispatchEvent+0x150>
+    5062:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        if ((descriptor->handler != NULL) && (state ? descriptor->rising : descriptor->falling)) {
+    5068:	a8 01                	test   $0x1,%al
+    506a:	74 aa                	je     5016 <GpioDispatchEvent+0x256>
+    506c:	eb 8d                	jmp    4ffb <GpioDispatchEvent+0x23b>
+    506e:	66 90                	xchg   %ax,%ax
+        if (now >= tick_period) {
+    5070:	8b 15 72 d9 06 00    	mov    0x6d972(%rip),%edx        # 729e8 <tick_period>
+        now = now - tick_wall;
+    5076:	4c 2b 2d 73 d9 06 00 	sub    0x6d973(%rip),%r13        # 729f0 <tick_wall>
+        if (now >= tick_period) {
+    507d:	48 89 d0             	mov    %rdx,%rax
+            now = tick_period - 1;
+    5080:	83 e8 01             	sub    $0x1,%eax
+    5083:	49 39 d5             	cmp    %rdx,%r13
+    5086:	4c 0f 43 e8          	cmovae %rax,%r13
+        now = tick_time + now;
+    508a:	4c 03 2d 4f d9 06 00 	add    0x6d94f(%rip),%r13        # 729e0 <tick_time>
+    5091:	e9 49 fe ff ff       	jmp    4edf <GpioDispatchEvent+0x11f>
+    5096:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    509d:	00 00 00 
+    50a0:	89 ee                	mov    %ebp,%esi
+    50a2:	bf 10 00 00 00       	mov    $0x10,%edi
+    50a7:	e8 f4 d8 ff ff       	call   29a0 <TraceEvent.part.0>
+    50ac:	e9 d5 fe ff ff       	jmp    4f86 <GpioDispatchEvent+0x1c6>
+    50b1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    50b8:	00 00 00 00 
+    50bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000050c0 <GpioInjectState>:
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS) && !(gpio_stuck[port] & mask)) {
+    50c0:	40 80 ff 03          	cmp    $0x3,%dil
+    50c4:	77 4a                	ja     5110 <GpioInjectState+0x50>
+void GpioInjectState(uint8_t port, uint8_t bit, bool state) {
+    50c6:	41 56                	push   %r14
+    50c8:	41 55                	push   %r13
+    50ca:	41 54                	push   %r12
+    50cc:	55                   	push   %rbp
+    50cd:	53                   	push   %rbx
+    50ce:	89 f3                	mov    %esi,%ebx
+    50d0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS) && !(gpio_stuck[port] & mask)) {
+    50d4:	40 80 fe 07          	cmp    $0x7,%sil
+    50d8:	77 20                	ja     50fa <GpioInjectState+0x3a>
+    50da:	41 89 d6             	mov    %edx,%r14d
+    50dd:	48 8d 05 0c 1b 07 00 	lea    0x71b0c(%rip),%rax        # 76bf0 <gpio_stuck>
+    50e4:	40 0f b6 d7          	movzbl %dil,%edx
+    50e8:	89 fd                	mov    %edi,%ebp
+    50ea:	8b 04 90             	mov    (%rax,%rdx,4),%eax
+    uint32_t mask = GPIO_MASK(bit);
+    50ed:	44 0f b6 ee          	movzbl %sil,%r13d
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS) && !(gpio_stuck[port] & mask)) {
+    50f1:	44 0f b6 e7          	movzbl %dil,%r12d
+    50f5:	0f a3 f0             	bt     %esi,%eax
+    50f8:	73 1e                	jae    5118 <GpioInjectState+0x58>
+}
+    50fa:	48 83 c4 10          	add    $0x10,%rsp
+    50fe:	5b                   	pop    %rbx
+    50ff:	5d                   	pop    %rbp
+    5100:	41 5c                	pop    %r12
+    5102:	41 5d                	pop    %r13
+    5104:	41 5e                	pop    %r14
+    5106:	c3                   	ret
+    5107:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    510e:	00 00 
+    5110:	c3                   	ret
+    5111:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    5118:	48 89 e6             	mov    %rsp,%rsi
+    511b:	bf 01 00 00 00       	mov    $0x1,%edi
+    5120:	e8 ab cf ff ff       	call   20d0 <clock_gettime@plt>
+        HAL_HOOK_IRQ_EVENT(HAL_HOOK_GPIO + port * SOC_GPIO_BITS + bit, CyclesRead());
+    5125:	0f b6 fb             	movzbl %bl,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    5128:	4c 8b 0c 24          	mov    (%rsp),%r9
+    512c:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    5131:	42 8d 7c e7 40       	lea    0x40(%rdi,%r12,8),%edi
+    5136:	0f b7 ff             	movzwl %di,%edi
+    latency_vector_t vector = LatencyFind(source);
+    5139:	e8 22 d7 ff ff       	call   2860 <LatencyFind>
+    513e:	48 89 c1             	mov    %rax,%rcx
+    if (vector) {
+    5141:	48 85 c0             	test   %rax,%rax
+    5144:	74 30                	je     5176 <GpioInjectState+0xb6>
+    5146:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+        vector->pending = true;
+    514d:	c6 81 b6 00 00 00 01 	movb   $0x1,0xb6(%rcx)
+    5154:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    515b:	9b c4 20 
+    515e:	49 f7 ea             	imul   %r10
+    5161:	49 c1 fa 3f          	sar    $0x3f,%r10
+    5165:	48 c1 fa 07          	sar    $0x7,%rdx
+    5169:	4c 29 d2             	sub    %r10,%rdx
+    516c:	41 01 d1             	add    %edx,%r9d
+    516f:	44 89 89 b8 00 00 00 	mov    %r9d,0xb8(%rcx)
+            previous = __atomic_fetch_or(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+    5176:	40 0f b6 c5          	movzbl %bpl,%eax
+    517a:	48 8d 15 5f 1a 07 00 	lea    0x71a5f(%rip),%rdx        # 76be0 <gpio_emulation>
+    5181:	48 8d 04 82          	lea    (%rdx,%rax,4),%rax
+        if (state) {
+    5185:	45 84 f6             	test   %r14b,%r14b
+    5188:	74 26                	je     51b0 <GpioInjectState+0xf0>
+            previous = __atomic_fetch_or(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+    518a:	f0 44 0f ab 28       	lock bts %r13d,(%rax)
+    518f:	0f 92 c2             	setb   %dl
+}
+    5192:	48 83 c4 10          	add    $0x10,%rsp
+        GpioDispatchEvent(port, bit, previous, state);
+    5196:	41 0f b6 ce          	movzbl %r14b,%ecx
+    519a:	44 89 ee             	mov    %r13d,%esi
+    519d:	44 89 e7             	mov    %r12d,%edi
+}
+    51a0:	5b                   	pop    %rbx
+        GpioDispatchEvent(port, bit, previous, state);
+    51a1:	0f b6 d2             	movzbl %dl,%edx
+}
+    51a4:	5d                   	pop    %rbp
+    51a5:	41 5c                	pop    %r12
+    51a7:	41 5d                	pop    %r13
+    51a9:	41 5e                	pop    %r14
+        GpioDispatchEvent(port, bit, previous, state);
+    51ab:	e9 10 fc ff ff       	jmp    4dc0 <GpioDispatchEvent>
+            previous = __atomic_fetch_and(&gpio_emulation[port], ~mask, __ATOMIC_RELAXED) & mask;
+    51b0:	f0 44 0f b3 28       	lock btr %r13d,(%rax)
+    51b5:	0f 92 c2             	setb   %dl
+    51b8:	eb d8                	jmp    5192 <GpioInjectState+0xd2>
+    51ba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000051c0 <GpioSetStuck>:
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    51c0:	89 f8                	mov    %edi,%eax
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS)) {
+    51c2:	40 80 ff 03          	cmp    $0x3,%dil
+    51c6:	77 06                	ja     51ce <GpioSetStuck+0xe>
+    51c8:	40 80 fe 07          	cmp    $0x7,%sil
+    51cc:	76 02                	jbe    51d0 <GpioSetStuck+0x10>
+    51ce:	c3                   	ret
+    51cf:	90                   	nop
+    uint32_t mask = GPIO_MASK(bit);
+    51d0:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    51d6:	41 57                	push   %r15
+    51d8:	89 cf                	mov    %ecx,%edi
+    uint32_t mask = GPIO_MASK(bit);
+    51da:	89 f1                	mov    %esi,%ecx
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    51dc:	41 56                	push   %r14
+        __atomic_fetch_and(&gpio_stuck[port], ~mask, __ATOMIC_RELAXED);
+    51de:	44 0f b6 c0          	movzbl %al,%r8d
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    51e2:	41 55                	push   %r13
+    51e4:	41 54                	push   %r12
+    uint32_t mask = GPIO_MASK(bit);
+    51e6:	44 0f b6 e6          	movzbl %sil,%r12d
+        __atomic_fetch_and(&gpio_stuck[port], ~mask, __ATOMIC_RELAXED);
+    51ea:	48 8d 35 ff 19 07 00 	lea    0x719ff(%rip),%rsi        # 76bf0 <gpio_stuck>
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    51f1:	55                   	push   %rbp
+    uint32_t mask = GPIO_MASK(bit);
+    51f2:	44 89 cd             	mov    %r9d,%ebp
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    51f5:	53                   	push   %rbx
+    uint32_t mask = GPIO_MASK(bit);
+    51f6:	d3 e5                	shl    %cl,%ebp
+        __atomic_fetch_and(&gpio_stuck[port], ~mask, __ATOMIC_RELAXED);
+    51f8:	4a 8d 1c 86          	lea    (%rsi,%r8,4),%rbx
+    51fc:	89 e9                	mov    %ebp,%ecx
+    51fe:	f7 d1                	not    %ecx
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    5200:	48 83 ec 08          	sub    $0x8,%rsp
+        __atomic_fetch_and(&gpio_stuck[port], ~mask, __ATOMIC_RELAXED);
+    5204:	f0 21 0b             	lock and %ecx,(%rbx)
+        if (stuck) {
+    5207:	84 d2                	test   %dl,%dl
+    5209:	0f 84 a3 00 00 00    	je     52b2 <GpioSetStuck+0xf2>
+            if (gpio_outputs[port] & mask) {
+    520f:	4c 8d 2d ba 19 07 00 	lea    0x719ba(%rip),%r13        # 76bd0 <gpio_outputs>
+        __atomic_fetch_and(&gpio_stuck[port], ~mask, __ATOMIC_RELAXED);
+    5216:	44 0f b6 f0          	movzbl %al,%r14d
+            if (gpio_outputs[port] & mask) {
+    521a:	4d 89 c7             	mov    %r8,%r15
+    521d:	43 8b 44 85 00       	mov    0x0(%r13,%r8,4),%eax
+    5222:	85 e8                	test   %ebp,%eax
+    5224:	74 7a                	je     52a0 <GpioSetStuck+0xe0>
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    5226:	42 8b 04 86          	mov    (%rsi,%r8,4),%eax
+    if (state) {
+    522a:	40 84 ff             	test   %dil,%dil
+    522d:	0f 84 95 00 00 00    	je     52c8 <GpioSetStuck+0x108>
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    5233:	85 e8                	test   %ebp,%eax
+    5235:	75 78                	jne    52af <GpioSetStuck+0xef>
+        bool previous = __atomic_fetch_or(port, mask, __ATOMIC_RELAXED) & mask;
+    5237:	48 8d 05 a2 19 07 00 	lea    0x719a2(%rip),%rax        # 76be0 <gpio_emulation>
+    523e:	f0 46 0f ab 24 80    	lock bts %r12d,(%rax,%r8,4)
+    if (previous != state) {
+    5244:	72 69                	jb     52af <GpioSetStuck+0xef>
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    5246:	44 89 f1             	mov    %r14d,%ecx
+    5249:	41 d3 e1             	shl    %cl,%r9d
+    524c:	f0 44 09 0d 78 19 07 	lock or %r9d,0x71978(%rip)        # 76bcc <gpio_dirty>
+    5253:	00 
+    pthread_once(&vcd_once, VcdOpen);
+    5254:	48 8d 35 d5 da ff ff 	lea    -0x252b(%rip),%rsi        # 2d30 <VcdOpen>
+    525b:	48 8d 3d 66 19 07 00 	lea    0x71966(%rip),%rdi        # 76bc8 <vcd_once>
+    5262:	e8 89 d1 ff ff       	call   23f0 <pthread_once@plt>
+    if (vcd_file) {
+    5267:	48 83 3d 51 19 07 00 	cmpq   $0x0,0x71951(%rip)        # 76bc0 <vcd_file>
+    526e:	00 
+    526f:	74 10                	je     5281 <GpioSetStuck+0xc1>
+    5271:	ba 01 00 00 00       	mov    $0x1,%edx
+    5276:	44 89 e6             	mov    %r12d,%esi
+    5279:	44 89 f7             	mov    %r14d,%edi
+    527c:	e8 5f e3 ff ff       	call   35e0 <VcdGpio.part.0>
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    5281:	43 8b 44 bd 00       	mov    0x0(%r13,%r15,4),%eax
+    5286:	85 e8                	test   %ebp,%eax
+    5288:	74 25                	je     52af <GpioSetStuck+0xef>
+        WireGpio(gpio->gpio, gpio->bit, state);
+    528a:	ba 01 00 00 00       	mov    $0x1,%edx
+    528f:	44 89 e6             	mov    %r12d,%esi
+    5292:	44 89 f7             	mov    %r14d,%edi
+    5295:	e8 26 ea ff ff       	call   3cc0 <WireGpio>
+    529a:	eb 13                	jmp    52af <GpioSetStuck+0xef>
+    529c:	0f 1f 40 00          	nopl   0x0(%rax)
+                GpioInjectState(port, bit, state);
+    52a0:	40 0f b6 d7          	movzbl %dil,%edx
+    52a4:	44 89 e6             	mov    %r12d,%esi
+    52a7:	44 89 f7             	mov    %r14d,%edi
+    52aa:	e8 11 fe ff ff       	call   50c0 <GpioInjectState>
+            __atomic_fetch_or(&gpio_stuck[port], mask, __ATOMIC_RELAXED);
+    52af:	f0 09 2b             	lock or %ebp,(%rbx)
+}
+    52b2:	48 83 c4 08          	add    $0x8,%rsp
+    52b6:	5b                   	pop    %rbx
+    52b7:	5d                   	pop    %rbp
+    52b8:	41 5c                	pop    %r12
+    52ba:	41 5d                	pop    %r13
+    52bc:	41 5e                	pop    %r14
+    52be:	41 5f                	pop    %r15
+    52c0:	c3                   	ret
+    52c1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    52c8:	85 e8                	test   %ebp,%eax
+    52ca:	75 e3                	jne    52af <GpioSetStuck+0xef>
+        bool previous = __atomic_fetch_and(port, ~mask, __ATOMIC_RELAXED) & mask;
+    52cc:	48 8d 05 0d 19 07 00 	lea    0x7190d(%rip),%rax        # 76be0 <gpio_emulation>
+    52d3:	f0 46 0f b3 24 80    	lock btr %r12d,(%rax,%r8,4)
+    if (previous != state) {
+    52d9:	73 d4                	jae    52af <GpioSetStuck+0xef>
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+    52db:	44 89 f1             	mov    %r14d,%ecx
+    52de:	41 d3 e1             	shl    %cl,%r9d
+    52e1:	f0 44 09 0d e3 18 07 	lock or %r9d,0x718e3(%rip)        # 76bcc <gpio_dirty>
+    52e8:	00 
+    pthread_once(&vcd_once, VcdOpen);
+    52e9:	48 8d 35 40 da ff ff 	lea    -0x25c0(%rip),%rsi        # 2d30 <VcdOpen>
+    52f0:	48 8d 3d d1 18 07 00 	lea    0x718d1(%rip),%rdi        # 76bc8 <vcd_once>
+    52f7:	e8 f4 d0 ff ff       	call   23f0 <pthread_once@plt>
+    if (vcd_file) {
+    52fc:	48 83 3d bc 18 07 00 	cmpq   $0x0,0x718bc(%rip)        # 76bc0 <vcd_file>
+    5303:	00 
+    5304:	74 0d                	je     5313 <GpioSetStuck+0x153>
+    5306:	31 d2                	xor    %edx,%edx
+    5308:	44 89 e6             	mov    %r12d,%esi
+    530b:	44 89 f7             	mov    %r14d,%edi
+    530e:	e8 cd e2 ff ff       	call   35e0 <VcdGpio.part.0>
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+    5313:	43 8b 44 bd 00       	mov    0x0(%r13,%r15,4),%eax
+    5318:	85 c5                	test   %eax,%ebp
+    531a:	74 93                	je     52af <GpioSetStuck+0xef>
+        WireGpio(gpio->gpio, gpio->bit, state);
+    531c:	31 d2                	xor    %edx,%edx
+    531e:	44 89 e6             	mov    %r12d,%esi
+    5321:	44 89 f7             	mov    %r14d,%edi
+    5324:	e8 97 e9 ff ff       	call   3cc0 <WireGpio>
+    5329:	eb 84                	jmp    52af <GpioSetStuck+0xef>
+    532b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000005330 <FaultParse>:
+static bool FaultParse(char const * spec) {
+    5330:	41 57                	push   %r15
+    5332:	48 89 f9             	mov    %rdi,%rcx
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    5335:	48 8d 15 5d 2f 00 00 	lea    0x2f5d(%rip),%rdx        # 8299 <_IO_stdin_used+0x299>
+    533c:	31 c0                	xor    %eax,%eax
+static bool FaultParse(char const * spec) {
+    533e:	41 56                	push   %r14
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    5340:	be 00 01 00 00       	mov    $0x100,%esi
+static bool FaultParse(char const * spec) {
+    5345:	41 55                	push   %r13
+    5347:	41 54                	push   %r12
+    for (item = strtok_r(buffer, " ,\t\r\n", &saveptr); item && result;
+    5349:	4c 8d 25 99 2e 00 00 	lea    0x2e99(%rip),%r12        # 81e9 <_IO_stdin_used+0x1e9>
+static bool FaultParse(char const * spec) {
+    5350:	55                   	push   %rbp
+    5351:	53                   	push   %rbx
+    5352:	48 81 ec 38 01 00 00 	sub    $0x138,%rsp
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    5359:	48 8d 5c 24 30       	lea    0x30(%rsp),%rbx
+    for (item = strtok_r(buffer, " ,\t\r\n", &saveptr); item && result;
+    535e:	4c 8d 6c 24 20       	lea    0x20(%rsp),%r13
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    5363:	48 89 df             	mov    %rbx,%rdi
+    5366:	e8 05 ce ff ff       	call   2170 <snprintf@plt>
+    for (item = strtok_r(buffer, " ,\t\r\n", &saveptr); item && result;
+    536b:	4c 89 ea             	mov    %r13,%rdx
+    536e:	4c 89 e6             	mov    %r12,%rsi
+    5371:	48 89 df             	mov    %rbx,%rdi
+    5374:	e8 27 ce ff ff       	call   21a0 <strtok_r@plt>
+    5379:	48 85 c0             	test   %rax,%rax
+    537c:	0f 84 76 04 00 00    	je     57f8 <FaultParse+0x4c8>
+    5382:	48 89 c3             	mov    %rax,%rbx
+    5385:	0f 1f 00             	nopl   (%rax)
+    char * value = strchr(item, '=');
+    5388:	be 3d 00 00 00       	mov    $0x3d,%esi
+    538d:	48 89 df             	mov    %rbx,%rdi
+    5390:	e8 ab cd ff ff       	call   2140 <strchr@plt>
+    char * name = strchr(item, '.');
+    5395:	be 2e 00 00 00       	mov    $0x2e,%esi
+    539a:	48 89 df             	mov    %rbx,%rdi
+    char * value = strchr(item, '=');
+    539d:	48 89 c5             	mov    %rax,%rbp
+    char * name = strchr(item, '.');
+    53a0:	e8 9b cd ff ff       	call   2140 <strchr@plt>
+    53a5:	49 89 c7             	mov    %rax,%r15
+    if (value == NULL) {
+    53a8:	48 85 ed             	test   %rbp,%rbp
+    53ab:	0f 84 a0 00 00 00    	je     5451 <FaultParse+0x121>
+    *value++ = 0;
+    53b1:	c6 45 00 00          	movb   $0x0,0x0(%rbp)
+    if (strcmp(item, "seed") == 0) {
+    53b5:	48 8d 35 33 2e 00 00 	lea    0x2e33(%rip),%rsi        # 81ef <_IO_stdin_used+0x1ef>
+    53bc:	48 89 df             	mov    %rbx,%rdi
+    *value++ = 0;
+    53bf:	4c 8d 75 01          	lea    0x1(%rbp),%r14
+    if (strcmp(item, "seed") == 0) {
+    53c3:	e8 18 ce ff ff       	call   21e0 <strcmp@plt>
+    53c8:	85 c0                	test   %eax,%eax
+    53ca:	0f 84 a8 00 00 00    	je     5478 <FaultParse+0x148>
+    if (name == NULL) {
+    53d0:	4d 85 ff             	test   %r15,%r15
+    53d3:	74 7c                	je     5451 <FaultParse+0x121>
+    *name++ = 0;
+    53d5:	41 c6 07 00          	movb   $0x0,(%r15)
+    53d9:	49 8d 47 01          	lea    0x1(%r15),%rax
+    if ((sscanf(item, "sci%u", &port) == 1) && (port < FAULT_SCI_PORTS)) {
+    53dd:	48 8d 54 24 1c       	lea    0x1c(%rsp),%rdx
+    53e2:	48 89 df             	mov    %rbx,%rdi
+    *name++ = 0;
+    53e5:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    if ((sscanf(item, "sci%u", &port) == 1) && (port < FAULT_SCI_PORTS)) {
+    53ea:	48 8d 35 50 2d 00 00 	lea    0x2d50(%rip),%rsi        # 8141 <_IO_stdin_used+0x141>
+    53f1:	31 c0                	xor    %eax,%eax
+    fault_used = true;
+    53f3:	c6 05 66 d2 00 00 01 	movb   $0x1,0xd266(%rip)        # 12660 <fault_used>
+    if ((sscanf(item, "sci%u", &port) == 1) && (port < FAULT_SCI_PORTS)) {
+    53fa:	e8 81 ce ff ff       	call   2280 <__isoc99_sscanf@plt>
+    53ff:	83 f8 01             	cmp    $0x1,%eax
+    5402:	0f 84 f8 00 00 00    	je     5500 <FaultParse+0x1d0>
+    } else if (strcmp(item, "tick") == 0) {
+    5408:	48 8d 35 00 2e 00 00 	lea    0x2e00(%rip),%rsi        # 820f <_IO_stdin_used+0x20f>
+    540f:	48 89 df             	mov    %rbx,%rdi
+    5412:	e8 c9 cd ff ff       	call   21e0 <strcmp@plt>
+    5417:	85 c0                	test   %eax,%eax
+    5419:	0f 85 99 01 00 00    	jne    55b8 <FaultParse+0x288>
+        if (strcmp(name, "delay") == 0) {
+    541f:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    5424:	48 8d 35 e9 2d 00 00 	lea    0x2de9(%rip),%rsi        # 8214 <_IO_stdin_used+0x214>
+    542b:	e8 b0 cd ff ff       	call   21e0 <strcmp@plt>
+    5430:	85 c0                	test   %eax,%eax
+    5432:	0f 84 08 02 00 00    	je     5640 <FaultParse+0x310>
+        } else if (strcmp(name, "miss") == 0) {
+    5438:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    543d:	48 8d 35 d6 2d 00 00 	lea    0x2dd6(%rip),%rsi        # 821a <_IO_stdin_used+0x21a>
+    5444:	e8 97 cd ff ff       	call   21e0 <strcmp@plt>
+    5449:	85 c0                	test   %eax,%eax
+    544b:	0f 84 3f 02 00 00    	je     5690 <FaultParse+0x360>
+         item = strtok_r(NULL, " ,\t\r\n", &saveptr)) {
+    5451:	4c 89 ea             	mov    %r13,%rdx
+    5454:	4c 89 e6             	mov    %r12,%rsi
+    5457:	31 ff                	xor    %edi,%edi
+    5459:	31 ed                	xor    %ebp,%ebp
+    545b:	e8 40 cd ff ff       	call   21a0 <strtok_r@plt>
+}
+    5460:	48 81 c4 38 01 00 00 	add    $0x138,%rsp
+    5467:	89 e8                	mov    %ebp,%eax
+    5469:	5b                   	pop    %rbx
+    546a:	5d                   	pop    %rbp
+    546b:	41 5c                	pop    %r12
+    546d:	41 5d                	pop    %r13
+    546f:	41 5e                	pop    %r14
+    5471:	41 5f                	pop    %r15
+    5473:	c3                   	ret
+    5474:	0f 1f 40 00          	nopl   0x0(%rax)
+        fault_seed = strtoull(value, NULL, 0) | 1;
+    5478:	31 d2                	xor    %edx,%edx
+    547a:	31 f6                	xor    %esi,%esi
+    547c:	4c 89 f7             	mov    %r14,%rdi
+    547f:	e8 4c cd ff ff       	call   21d0 <strtoull@plt>
+    5484:	48 83 c8 01          	or     $0x1,%rax
+            fault_sci[index].random = fault_seed + index;
+    5488:	48 8d 50 01          	lea    0x1(%rax),%rdx
+        fault_seed = strtoull(value, NULL, 0) | 1;
+    548c:	48 89 05 c5 5d 00 00 	mov    %rax,0x5dc5(%rip)        # b258 <fault_seed>
+            fault_sci[index].random = fault_seed + index;
+    5493:	48 89 15 7e 03 05 00 	mov    %rdx,0x5037e(%rip)        # 55818 <fault_sci+0x3058>
+    549a:	48 8d 50 02          	lea    0x2(%rax),%rdx
+    549e:	48 89 05 1b d3 04 00 	mov    %rax,0x4d31b(%rip)        # 527c0 <fault_sci>
+    54a5:	48 89 15 c4 33 05 00 	mov    %rdx,0x533c4(%rip)        # 58870 <fault_sci+0x60b0>
+    54ac:	48 8d 50 03          	lea    0x3(%rax),%rdx
+        fault_tick.random = fault_seed + FAULT_SCI_PORTS;
+    54b0:	48 83 c0 04          	add    $0x4,%rax
+            fault_sci[index].random = fault_seed + index;
+    54b4:	48 89 15 0d 64 05 00 	mov    %rdx,0x5640d(%rip)        # 5b8c8 <fault_sci+0x9108>
+        fault_tick.random = fault_seed + FAULT_SCI_PORTS;
+    54bb:	48 89 05 be d2 04 00 	mov    %rax,0x4d2be(%rip)        # 52780 <fault_tick>
+        return true;
+    54c2:	bd 01 00 00 00       	mov    $0x1,%ebp
+    54c7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    54ce:	00 00 
+         item = strtok_r(NULL, " ,\t\r\n", &saveptr)) {
+    54d0:	4c 89 ea             	mov    %r13,%rdx
+    54d3:	4c 89 e6             	mov    %r12,%rsi
+    54d6:	31 ff                	xor    %edi,%edi
+    54d8:	e8 c3 cc ff ff       	call   21a0 <strtok_r@plt>
+    54dd:	48 89 c3             	mov    %rax,%rbx
+    for (item = strtok_r(buffer, " ,\t\r\n", &saveptr); item && result;
+    54e0:	48 85 c0             	test   %rax,%rax
+    54e3:	0f 84 77 ff ff ff    	je     5460 <FaultParse+0x130>
+    54e9:	40 84 ed             	test   %bpl,%bpl
+    54ec:	0f 85 96 fe ff ff    	jne    5388 <FaultParse+0x58>
+    54f2:	e9 69 ff ff ff       	jmp    5460 <FaultParse+0x130>
+    54f7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    54fe:	00 00 
+    if ((sscanf(item, "sci%u", &port) == 1) && (port < FAULT_SCI_PORTS)) {
+    5500:	8b 44 24 1c          	mov    0x1c(%rsp),%eax
+    5504:	41 89 c7             	mov    %eax,%r15d
+    5507:	83 f8 03             	cmp    $0x3,%eax
+    550a:	0f 87 f8 fe ff ff    	ja     5408 <FaultParse+0xd8>
+        if (strcmp(name, "bit") == 0) {
+    5510:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    5515:	48 8d 35 d8 2c 00 00 	lea    0x2cd8(%rip),%rsi        # 81f4 <_IO_stdin_used+0x1f4>
+    551c:	e8 bf cc ff ff       	call   21e0 <strcmp@plt>
+    5521:	85 c0                	test   %eax,%eax
+    5523:	0f 84 6f 02 00 00    	je     5798 <FaultParse+0x468>
+        } else if (strcmp(name, "drop") == 0) {
+    5529:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    552e:	48 8d 35 c3 2c 00 00 	lea    0x2cc3(%rip),%rsi        # 81f8 <_IO_stdin_used+0x1f8>
+    5535:	e8 a6 cc ff ff       	call   21e0 <strcmp@plt>
+    553a:	85 c0                	test   %eax,%eax
+    553c:	0f 84 c6 02 00 00    	je     5808 <FaultParse+0x4d8>
+        } else if (strcmp(name, "dup") == 0) {
+    5542:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    5547:	48 8d 35 af 2c 00 00 	lea    0x2caf(%rip),%rsi        # 81fd <_IO_stdin_used+0x1fd>
+    554e:	e8 8d cc ff ff       	call   21e0 <strcmp@plt>
+    5553:	85 c0                	test   %eax,%eax
+    5555:	0f 84 d2 02 00 00    	je     582d <FaultParse+0x4fd>
+        } else if (strcmp(name, "overrun") == 0) {
+    555b:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    5560:	48 8d 35 9a 2c 00 00 	lea    0x2c9a(%rip),%rsi        # 8201 <_IO_stdin_used+0x201>
+    5567:	e8 74 cc ff ff       	call   21e0 <strcmp@plt>
+    556c:	85 c0                	test   %eax,%eax
+    556e:	0f 84 de 02 00 00    	je     5852 <FaultParse+0x522>
+        } else if (strcmp(name, "break") == 0) {
+    5574:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    5579:	48 8d 35 89 2c 00 00 	lea    0x2c89(%rip),%rsi        # 8209 <_IO_stdin_used+0x209>
+    5580:	e8 5b cc ff ff       	call   21e0 <strcmp@plt>
+    5585:	85 c0                	test   %eax,%eax
+    5587:	0f 85 c4 fe ff ff    	jne    5451 <FaultParse+0x121>
+            return FaultThreshold(value, &sci->brk);
+    558d:	44 89 f8             	mov    %r15d,%eax
+    5590:	48 8d 15 29 d2 04 00 	lea    0x4d229(%rip),%rdx        # 527c0 <fault_sci>
+    5597:	4c 89 f7             	mov    %r14,%rdi
+    559a:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    55a1:	48 8d 74 02 28       	lea    0x28(%rdx,%rax,1),%rsi
+    55a6:	e8 e5 f3 ff ff       	call   4990 <FaultThreshold>
+    55ab:	89 c5                	mov    %eax,%ebp
+    55ad:	e9 1e ff ff ff       	jmp    54d0 <FaultParse+0x1a0>
+    55b2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    } else if (GpioParseName(item, &gpio, &bit)) {
+    55b8:	48 8d 54 24 1b       	lea    0x1b(%rsp),%rdx
+    55bd:	48 8d 74 24 1a       	lea    0x1a(%rsp),%rsi
+    55c2:	48 89 df             	mov    %rbx,%rdi
+    55c5:	e8 76 de ff ff       	call   3440 <GpioParseName>
+    55ca:	84 c0                	test   %al,%al
+    55cc:	0f 84 7f fe ff ff    	je     5451 <FaultParse+0x121>
+        if (strcmp(name, "stuck") == 0) {
+    55d2:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    55d7:	48 8d 35 41 2c 00 00 	lea    0x2c41(%rip),%rsi        # 821f <_IO_stdin_used+0x21f>
+    55de:	e8 fd cb ff ff       	call   21e0 <strcmp@plt>
+    55e3:	85 c0                	test   %eax,%eax
+    55e5:	0f 85 c5 00 00 00    	jne    56b0 <FaultParse+0x380>
+            if (strcmp(value, "off") == 0) {
+    55eb:	48 8d 35 33 2c 00 00 	lea    0x2c33(%rip),%rsi        # 8225 <_IO_stdin_used+0x225>
+    55f2:	4c 89 f7             	mov    %r14,%rdi
+    55f5:	e8 e6 cb ff ff       	call   21e0 <strcmp@plt>
+    55fa:	85 c0                	test   %eax,%eax
+    55fc:	0f 84 bb 01 00 00    	je     57bd <FaultParse+0x48d>
+            } else if ((strcmp(value, "0") == 0) || (strcmp(value, "1") == 0)) {
+    5602:	0f b6 45 01          	movzbl 0x1(%rbp),%eax
+    5606:	83 f8 30             	cmp    $0x30,%eax
+    5609:	0f 85 c9 01 00 00    	jne    57d8 <FaultParse+0x4a8>
+    560f:	41 80 7e 01 00       	cmpb   $0x0,0x1(%r14)
+    5614:	0f 85 be 01 00 00    	jne    57d8 <FaultParse+0x4a8>
+                GpioSetStuck(gpio, bit, true, *value == '1');
+    561a:	31 c9                	xor    %ecx,%ecx
+    561c:	0f b6 74 24 1b       	movzbl 0x1b(%rsp),%esi
+    5621:	80 7d 01 31          	cmpb   $0x31,0x1(%rbp)
+    5625:	ba 01 00 00 00       	mov    $0x1,%edx
+    562a:	0f b6 7c 24 1a       	movzbl 0x1a(%rsp),%edi
+    562f:	0f 94 c1             	sete   %cl
+    5632:	e8 89 fb ff ff       	call   51c0 <GpioSetStuck>
+    5637:	e9 86 fe ff ff       	jmp    54c2 <FaultParse+0x192>
+    563c:	0f 1f 40 00          	nopl   0x0(%rax)
+            width = strchr(value, '/');
+    5640:	be 2f 00 00 00       	mov    $0x2f,%esi
+    5645:	4c 89 f7             	mov    %r14,%rdi
+    5648:	e8 f3 ca ff ff       	call   2140 <strchr@plt>
+            fault_tick.time = width ? strtoul(width + 1, NULL, 10) : 0;
+    564d:	31 d2                	xor    %edx,%edx
+            width = strchr(value, '/');
+    564f:	48 89 44 24 28       	mov    %rax,0x28(%rsp)
+            fault_tick.time = width ? strtoul(width + 1, NULL, 10) : 0;
+    5654:	48 85 c0             	test   %rax,%rax
+    5657:	74 12                	je     566b <FaultParse+0x33b>
+    5659:	ba 0a 00 00 00       	mov    $0xa,%edx
+    565e:	48 8d 78 01          	lea    0x1(%rax),%rdi
+    5662:	31 f6                	xor    %esi,%esi
+    5664:	e8 c7 cc ff ff       	call   2330 <strtoul@plt>
+    5669:	89 c2                	mov    %eax,%edx
+            return FaultThreshold(value, &fault_tick.delay);
+    566b:	48 8d 35 16 d1 04 00 	lea    0x4d116(%rip),%rsi        # 52788 <fault_tick+0x8>
+    5672:	4c 89 f7             	mov    %r14,%rdi
+            fault_tick.time = width ? strtoul(width + 1, NULL, 10) : 0;
+    5675:	89 15 15 d1 04 00    	mov    %edx,0x4d115(%rip)        # 52790 <fault_tick+0x10>
+            return FaultThreshold(value, &fault_tick.delay);
+    567b:	e8 10 f3 ff ff       	call   4990 <FaultThreshold>
+    5680:	89 c5                	mov    %eax,%ebp
+    5682:	e9 49 fe ff ff       	jmp    54d0 <FaultParse+0x1a0>
+    5687:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    568e:	00 00 
+            return FaultThreshold(value, &fault_tick.miss);
+    5690:	48 8d 35 01 d1 04 00 	lea    0x4d101(%rip),%rsi        # 52798 <fault_tick+0x18>
+    5697:	4c 89 f7             	mov    %r14,%rdi
+    569a:	e8 f1 f2 ff ff       	call   4990 <FaultThreshold>
+    569f:	89 c5                	mov    %eax,%ebp
+    56a1:	e9 2a fe ff ff       	jmp    54d0 <FaultParse+0x1a0>
+    56a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    56ad:	00 00 00 
+        } else if (strcmp(name, "glitch") == 0) {
+    56b0:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    56b5:	48 8d 35 6d 2b 00 00 	lea    0x2b6d(%rip),%rsi        # 8229 <_IO_stdin_used+0x229>
+    56bc:	e8 1f cb ff ff       	call   21e0 <strcmp@plt>
+    56c1:	89 c3                	mov    %eax,%ebx
+    56c3:	85 c0                	test   %eax,%eax
+    56c5:	0f 85 86 fd ff ff    	jne    5451 <FaultParse+0x121>
+            double rate = strtod(value, &width);
+    56cb:	48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+    56d0:	4c 89 f7             	mov    %r14,%rdi
+    56d3:	e8 c8 c9 ff ff       	call   20a0 <strtod@plt>
+            if ((rate < 0) || (rate * FAULT_GLITCH_SLOT > 1000000)) {
+    56d8:	66 0f ef c9          	pxor   %xmm1,%xmm1
+    56dc:	66 0f 2f c8          	comisd %xmm0,%xmm1
+    56e0:	0f 87 6b fd ff ff    	ja     5451 <FaultParse+0x121>
+    56e6:	f2 0f 59 05 7a 33 00 	mulsd  0x337a(%rip),%xmm0        # 8a68 <data.2+0x28>
+    56ed:	00 
+    56ee:	66 0f 2f 05 7a 33 00 	comisd 0x337a(%rip),%xmm0        # 8a70 <data.2+0x30>
+    56f5:	00 
+    56f6:	0f 87 55 fd ff ff    	ja     5451 <FaultParse+0x121>
+            for (int index = 0; index < fault_glitch_count; index++) {
+    56fc:	0f b6 05 8e ce 00 00 	movzbl 0xce8e(%rip),%eax        # 12591 <fault_glitch_count>
+    5703:	84 c0                	test   %al,%al
+    5705:	0f 84 6c 01 00 00    	je     5877 <FaultParse+0x547>
+                if ((fault_glitches[index].port == gpio) && (fault_glitches[index].bit == bit)) {
+    570b:	0f b6 4c 24 1a       	movzbl 0x1a(%rsp),%ecx
+    5710:	0f b6 74 24 1b       	movzbl 0x1b(%rsp),%esi
+    5715:	48 8d 15 84 ce 00 00 	lea    0xce84(%rip),%rdx        # 125a0 <fault_glitches>
+            struct fault_glitch_s * glitch = NULL;
+    571c:	31 ed                	xor    %ebp,%ebp
+    571e:	66 90                	xchg   %ax,%ax
+                if ((fault_glitches[index].port == gpio) && (fault_glitches[index].bit == bit)) {
+    5720:	3a 0a                	cmp    (%rdx),%cl
+    5722:	75 08                	jne    572c <FaultParse+0x3fc>
+                    glitch = &fault_glitches[index];
+    5724:	40 3a 72 01          	cmp    0x1(%rdx),%sil
+    5728:	48 0f 44 ea          	cmove  %rdx,%rbp
+            for (int index = 0; index < fault_glitch_count; index++) {
+    572c:	0f b6 05 5e ce 00 00 	movzbl 0xce5e(%rip),%eax        # 12591 <fault_glitch_count>
+    5733:	83 c3 01             	add    $0x1,%ebx
+    5736:	48 83 c2 18          	add    $0x18,%rdx
+    573a:	39 c3                	cmp    %eax,%ebx
+    573c:	7c e2                	jl     5720 <FaultParse+0x3f0>
+            if ((glitch == NULL) && (fault_glitch_count < FAULT_GLITCHES)) {
+    573e:	48 85 ed             	test   %rbp,%rbp
+    5741:	0f 84 30 01 00 00    	je     5877 <FaultParse+0x547>
+            if (!fault_glitching) {
+    5747:	80 3d 42 ce 00 00 00 	cmpb   $0x0,0xce42(%rip)        # 12590 <fault_glitching>
+    574e:	0f 84 82 01 00 00    	je     58d6 <FaultParse+0x5a6>
+            glitch->width = (*width == '/') ? strtoul(width + 1, NULL, 10) : 1;
+    5754:	48 8b 54 24 28       	mov    0x28(%rsp),%rdx
+    5759:	b8 01 00 00 00       	mov    $0x1,%eax
+    575e:	80 3a 2f             	cmpb   $0x2f,(%rdx)
+    5761:	0f 84 9e 01 00 00    	je     5905 <FaultParse+0x5d5>
+            glitch->rate = (uint64_t)(rate * FAULT_GLITCH_SLOT * 18446744073709.551616);
+    5767:	f2 0f 59 05 09 33 00 	mulsd  0x3309(%rip),%xmm0        # 8a78 <data.2+0x38>
+    576e:	00 
+    576f:	f2 0f 10 0d e9 32 00 	movsd  0x32e9(%rip),%xmm1        # 8a60 <data.2+0x20>
+    5776:	00 
+            glitch->width = (*width == '/') ? strtoul(width + 1, NULL, 10) : 1;
+    5777:	89 45 10             	mov    %eax,0x10(%rbp)
+            glitch->rate = (uint64_t)(rate * FAULT_GLITCH_SLOT * 18446744073709.551616);
+    577a:	66 0f 2f c1          	comisd %xmm1,%xmm0
+    577e:	0f 83 3a 01 00 00    	jae    58be <FaultParse+0x58e>
+    5784:	f2 48 0f 2c c0       	cvttsd2si %xmm0,%rax
+    5789:	48 89 45 08          	mov    %rax,0x8(%rbp)
+    578d:	e9 30 fd ff ff       	jmp    54c2 <FaultParse+0x192>
+    5792:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            return FaultThreshold(value, &sci->bit);
+    5798:	44 89 f8             	mov    %r15d,%eax
+    579b:	48 8d 15 1e d0 04 00 	lea    0x4d01e(%rip),%rdx        # 527c0 <fault_sci>
+    57a2:	4c 89 f7             	mov    %r14,%rdi
+    57a5:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    57ac:	48 8d 74 02 08       	lea    0x8(%rdx,%rax,1),%rsi
+    57b1:	e8 da f1 ff ff       	call   4990 <FaultThreshold>
+    57b6:	89 c5                	mov    %eax,%ebp
+    57b8:	e9 13 fd ff ff       	jmp    54d0 <FaultParse+0x1a0>
+                GpioSetStuck(gpio, bit, false, false);
+    57bd:	0f b6 74 24 1b       	movzbl 0x1b(%rsp),%esi
+    57c2:	0f b6 7c 24 1a       	movzbl 0x1a(%rsp),%edi
+    57c7:	31 c9                	xor    %ecx,%ecx
+    57c9:	31 d2                	xor    %edx,%edx
+    57cb:	e8 f0 f9 ff ff       	call   51c0 <GpioSetStuck>
+    57d0:	e9 ed fc ff ff       	jmp    54c2 <FaultParse+0x192>
+    57d5:	0f 1f 00             	nopl   (%rax)
+            } else if ((strcmp(value, "0") == 0) || (strcmp(value, "1") == 0)) {
+    57d8:	83 f8 31             	cmp    $0x31,%eax
+    57db:	0f 85 70 fc ff ff    	jne    5451 <FaultParse+0x121>
+    57e1:	41 80 7e 01 00       	cmpb   $0x0,0x1(%r14)
+    57e6:	0f 84 2e fe ff ff    	je     561a <FaultParse+0x2ea>
+    57ec:	e9 60 fc ff ff       	jmp    5451 <FaultParse+0x121>
+    57f1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    bool result = true;
+    57f8:	bd 01 00 00 00       	mov    $0x1,%ebp
+    return result;
+    57fd:	e9 5e fc ff ff       	jmp    5460 <FaultParse+0x130>
+    5802:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            return FaultThreshold(value, &sci->drop);
+    5808:	44 89 f8             	mov    %r15d,%eax
+    580b:	48 8d 15 ae cf 04 00 	lea    0x4cfae(%rip),%rdx        # 527c0 <fault_sci>
+    5812:	4c 89 f7             	mov    %r14,%rdi
+    5815:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    581c:	48 8d 74 02 10       	lea    0x10(%rdx,%rax,1),%rsi
+    5821:	e8 6a f1 ff ff       	call   4990 <FaultThreshold>
+    5826:	89 c5                	mov    %eax,%ebp
+    5828:	e9 a3 fc ff ff       	jmp    54d0 <FaultParse+0x1a0>
+            return FaultThreshold(value, &sci->dup);
+    582d:	44 89 f8             	mov    %r15d,%eax
+    5830:	48 8d 15 89 cf 04 00 	lea    0x4cf89(%rip),%rdx        # 527c0 <fault_sci>
+    5837:	4c 89 f7             	mov    %r14,%rdi
+    583a:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    5841:	48 8d 74 02 18       	lea    0x18(%rdx,%rax,1),%rsi
+    5846:	e8 45 f1 ff ff       	call   4990 <FaultThreshold>
+    584b:	89 c5                	mov    %eax,%ebp
+    584d:	e9 7e fc ff ff       	jmp    54d0 <FaultParse+0x1a0>
+            return FaultThreshold(value, &sci->overrun);
+    5852:	44 89 f8             	mov    %r15d,%eax
+    5855:	48 8d 15 64 cf 04 00 	lea    0x4cf64(%rip),%rdx        # 527c0 <fault_sci>
+    585c:	4c 89 f7             	mov    %r14,%rdi
+    585f:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    5866:	48 8d 74 02 20       	lea    0x20(%rdx,%rax,1),%rsi
+    586b:	e8 20 f1 ff ff       	call   4990 <FaultThreshold>
+    5870:	89 c5                	mov    %eax,%ebp
+    5872:	e9 59 fc ff ff       	jmp    54d0 <FaultParse+0x1a0>
+            if ((glitch == NULL) && (fault_glitch_count < FAULT_GLITCHES)) {
+    5877:	0f b6 05 13 cd 00 00 	movzbl 0xcd13(%rip),%eax        # 12591 <fault_glitch_count>
+    587e:	3c 07                	cmp    $0x7,%al
+    5880:	0f 87 cb fb ff ff    	ja     5451 <FaultParse+0x121>
+                glitch = &fault_glitches[fault_glitch_count];
+    5886:	0f b6 15 04 cd 00 00 	movzbl 0xcd04(%rip),%edx        # 12591 <fault_glitch_count>
+                glitch->port = gpio;
+    588d:	0f b6 44 24 1a       	movzbl 0x1a(%rsp),%eax
+    5892:	8a 64 24 1b          	mov    0x1b(%rsp),%ah
+                glitch = &fault_glitches[fault_glitch_count];
+    5896:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+    589a:	48 8d 15 ff cc 00 00 	lea    0xccff(%rip),%rdx        # 125a0 <fault_glitches>
+                glitch->port = gpio;
+    58a1:	66 89 04 ca          	mov    %ax,(%rdx,%rcx,8)
+                __atomic_store_n(&fault_glitch_count, fault_glitch_count + 1, __ATOMIC_RELEASE);
+    58a5:	0f b6 05 e5 cc 00 00 	movzbl 0xcce5(%rip),%eax        # 12591 <fault_glitch_count>
+                glitch = &fault_glitches[fault_glitch_count];
+    58ac:	48 8d 2c ca          	lea    (%rdx,%rcx,8),%rbp
+                __atomic_store_n(&fault_glitch_count, fault_glitch_count + 1, __ATOMIC_RELEASE);
+    58b0:	83 c0 01             	add    $0x1,%eax
+    58b3:	88 05 d8 cc 00 00    	mov    %al,0xccd8(%rip)        # 12591 <fault_glitch_count>
+            if (glitch == NULL) {
+    58b9:	e9 89 fe ff ff       	jmp    5747 <FaultParse+0x417>
+            glitch->rate = (uint64_t)(rate * FAULT_GLITCH_SLOT * 18446744073709.551616);
+    58be:	f2 0f 5c c1          	subsd  %xmm1,%xmm0
+    58c2:	f2 48 0f 2c c0       	cvttsd2si %xmm0,%rax
+    58c7:	48 89 45 08          	mov    %rax,0x8(%rbp)
+    58cb:	48 0f ba 7d 08 3f    	btcq   $0x3f,0x8(%rbp)
+            return true;
+    58d1:	e9 ec fb ff ff       	jmp    54c2 <FaultParse+0x192>
+                pthread_create(&fault_thread, NULL, GlitchThread, NULL);
+    58d6:	31 c9                	xor    %ecx,%ecx
+    58d8:	48 8d 15 01 02 00 00 	lea    0x201(%rip),%rdx        # 5ae0 <GlitchThread>
+    58df:	31 f6                	xor    %esi,%esi
+    58e1:	f2 0f 11 44 24 08    	movsd  %xmm0,0x8(%rsp)
+    58e7:	48 8d 3d 9a cc 00 00 	lea    0xcc9a(%rip),%rdi        # 12588 <fault_thread>
+                fault_glitching = true;
+    58ee:	c6 05 9b cc 00 00 01 	movb   $0x1,0xcc9b(%rip)        # 12590 <fault_glitching>
+                pthread_create(&fault_thread, NULL, GlitchThread, NULL);
+    58f5:	e8 e6 c9 ff ff       	call   22e0 <pthread_create@plt>
+    58fa:	f2 0f 10 44 24 08    	movsd  0x8(%rsp),%xmm0
+    5900:	e9 4f fe ff ff       	jmp    5754 <FaultParse+0x424>
+            glitch->width = (*width == '/') ? strtoul(width + 1, NULL, 10) : 1;
+    5905:	48 8d 7a 01          	lea    0x1(%rdx),%rdi
+    5909:	31 f6                	xor    %esi,%esi
+    590b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    5910:	f2 0f 11 44 24 08    	movsd  %xmm0,0x8(%rsp)
+    5916:	e8 15 ca ff ff       	call   2330 <strtoul@plt>
+    591b:	f2 0f 10 44 24 08    	movsd  0x8(%rsp),%xmm0
+    5921:	e9 41 fe ff ff       	jmp    5767 <FaultParse+0x437>
+    5926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    592d:	00 00 00 
+
+0000000000005930 <FaultOpen>:
+
+static void FaultOpen(void) {
+    5930:	55                   	push   %rbp
+    char const * spec = getenv(FAULT_ENVIRONMENT);
+    5931:	48 8d 3d f8 28 00 00 	lea    0x28f8(%rip),%rdi        # 8230 <_IO_stdin_used+0x230>
+static void FaultOpen(void) {
+    5938:	53                   	push   %rbx
+    5939:	48 83 ec 08          	sub    $0x8,%rsp
+    char const * spec = getenv(FAULT_ENVIRONMENT);
+    593d:	e8 ee c6 ff ff       	call   2030 <getenv@plt>
+
+    for (int index = 0; index < FAULT_SCI_PORTS; index++) {
+        fault_sci[index].random = fault_seed + index;
+    5942:	48 8b 0d 0f 59 00 00 	mov    0x590f(%rip),%rcx        # b258 <fault_seed>
+    char const * spec = getenv(FAULT_ENVIRONMENT);
+    5949:	48 89 c3             	mov    %rax,%rbx
+        fault_sci[index].random = fault_seed + index;
+    594c:	48 8d 41 01          	lea    0x1(%rcx),%rax
+    5950:	48 89 0d 69 ce 04 00 	mov    %rcx,0x4ce69(%rip)        # 527c0 <fault_sci>
+    5957:	48 89 05 ba fe 04 00 	mov    %rax,0x4feba(%rip)        # 55818 <fault_sci+0x3058>
+    595e:	48 8d 41 02          	lea    0x2(%rcx),%rax
+    5962:	48 89 05 07 2f 05 00 	mov    %rax,0x52f07(%rip)        # 58870 <fault_sci+0x60b0>
+    5969:	48 8d 41 03          	lea    0x3(%rcx),%rax
+    }
+    fault_tick.random = fault_seed + FAULT_SCI_PORTS;
+    596d:	48 83 c1 04          	add    $0x4,%rcx
+        fault_sci[index].random = fault_seed + index;
+    5971:	48 89 05 50 5f 05 00 	mov    %rax,0x55f50(%rip)        # 5b8c8 <fault_sci+0x9108>
+    fault_tick.random = fault_seed + FAULT_SCI_PORTS;
+    5978:	48 89 0d 01 ce 04 00 	mov    %rcx,0x4ce01(%rip)        # 52780 <fault_tick>
+    if (spec) {
+    597f:	48 85 db             	test   %rbx,%rbx
+    5982:	74 23                	je     59a7 <FaultOpen+0x77>
+        pthread_mutex_lock(&fault_lock);
+    5984:	48 8d 2d d5 cb 00 00 	lea    0xcbd5(%rip),%rbp        # 12560 <fault_lock>
+    598b:	48 89 ef             	mov    %rbp,%rdi
+    598e:	e8 8d ca ff ff       	call   2420 <pthread_mutex_lock@plt>
+        if (!FaultParse(spec)) {
+    5993:	48 89 df             	mov    %rbx,%rdi
+    5996:	e8 95 f9 ff ff       	call   5330 <FaultParse>
+    599b:	84 c0                	test   %al,%al
+    599d:	74 21                	je     59c0 <FaultOpen+0x90>
+            fprintf(stderr, "fault: error in %s\n", spec);
+        }
+        pthread_mutex_unlock(&fault_lock);
+    599f:	48 89 ef             	mov    %rbp,%rdi
+    59a2:	e8 b9 c8 ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    }
+    atexit(FaultReport);
+}
+    59a7:	48 83 c4 08          	add    $0x8,%rsp
+    atexit(FaultReport);
+    59ab:	48 8d 3d ee d5 ff ff 	lea    -0x2a12(%rip),%rdi        # 2fa0 <FaultReport>
+}
+    59b2:	5b                   	pop    %rbx
+    59b3:	5d                   	pop    %rbp
+    atexit(FaultReport);
+    59b4:	e9 07 1c 00 00       	jmp    75c0 <atexit>
+    59b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            fprintf(stderr, "fault: error in %s\n", spec);
+    59c0:	48 8b 05 19 56 00 00 	mov    0x5619(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    59c7:	48 89 da             	mov    %rbx,%rdx
+    59ca:	48 8d 35 6b 28 00 00 	lea    0x286b(%rip),%rsi        # 823c <_IO_stdin_used+0x23c>
+    59d1:	48 8b 38             	mov    (%rax),%rdi
+    59d4:	31 c0                	xor    %eax,%eax
+    59d6:	e8 35 c8 ff ff       	call   2210 <fprintf@plt>
+    59db:	eb c2                	jmp    599f <FaultOpen+0x6f>
+    59dd:	0f 1f 00             	nopl   (%rax)
+
+00000000000059e0 <GpioInjectToggle.isra.0>:
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS)) {
+    59e0:	40 80 ff 03          	cmp    $0x3,%dil
+    59e4:	0f 87 e6 00 00 00    	ja     5ad0 <GpioInjectToggle.isra.0+0xf0>
+bool GpioInjectToggle(uint8_t port, uint8_t bit) {
+    59ea:	41 55                	push   %r13
+    59ec:	41 54                	push   %r12
+    59ee:	55                   	push   %rbp
+    59ef:	53                   	push   %rbx
+    59f0:	89 f3                	mov    %esi,%ebx
+    59f2:	48 83 ec 18          	sub    $0x18,%rsp
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS)) {
+    59f6:	40 80 fe 07          	cmp    $0x7,%sil
+    59fa:	77 27                	ja     5a23 <GpioInjectToggle.isra.0+0x43>
+        if (gpio_stuck[port] & mask) {
+    59fc:	40 0f b6 c7          	movzbl %dil,%eax
+    5a00:	89 fd                	mov    %edi,%ebp
+    uint32_t mask = GPIO_MASK(bit);
+    5a02:	44 0f b6 ee          	movzbl %sil,%r13d
+        if (gpio_stuck[port] & mask) {
+    5a06:	44 0f b6 e7          	movzbl %dil,%r12d
+    5a0a:	48 8d 15 df 11 07 00 	lea    0x711df(%rip),%rdx        # 76bf0 <gpio_stuck>
+    5a11:	8b 14 82             	mov    (%rdx,%rax,4),%edx
+    5a14:	0f a3 f2             	bt     %esi,%edx
+    5a17:	73 17                	jae    5a30 <GpioInjectToggle.isra.0+0x50>
+            return (gpio_emulation[port] & mask) != 0;
+    5a19:	48 8d 15 c0 11 07 00 	lea    0x711c0(%rip),%rdx        # 76be0 <gpio_emulation>
+    5a20:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+}
+    5a23:	48 83 c4 18          	add    $0x18,%rsp
+    5a27:	5b                   	pop    %rbx
+    5a28:	5d                   	pop    %rbp
+    5a29:	41 5c                	pop    %r12
+    5a2b:	41 5d                	pop    %r13
+    5a2d:	c3                   	ret
+    5a2e:	66 90                	xchg   %ax,%ax
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    5a30:	48 89 e6             	mov    %rsp,%rsi
+    5a33:	bf 01 00 00 00       	mov    $0x1,%edi
+    5a38:	e8 93 c6 ff ff       	call   20d0 <clock_gettime@plt>
+        HAL_HOOK_IRQ_EVENT(HAL_HOOK_GPIO + port * SOC_GPIO_BITS + bit, CyclesRead());
+    5a3d:	0f b6 fb             	movzbl %bl,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    5a40:	4c 8b 0c 24          	mov    (%rsp),%r9
+    5a44:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    5a49:	42 8d 7c e7 40       	lea    0x40(%rdi,%r12,8),%edi
+    5a4e:	0f b7 ff             	movzwl %di,%edi
+    latency_vector_t vector = LatencyFind(source);
+    5a51:	e8 0a ce ff ff       	call   2860 <LatencyFind>
+    5a56:	48 89 c1             	mov    %rax,%rcx
+    if (vector) {
+    5a59:	48 85 c0             	test   %rax,%rax
+    5a5c:	74 30                	je     5a8e <GpioInjectToggle.isra.0+0xae>
+    5a5e:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+        vector->pending = true;
+    5a65:	c6 81 b6 00 00 00 01 	movb   $0x1,0xb6(%rcx)
+    5a6c:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    5a73:	9b c4 20 
+    5a76:	49 f7 ea             	imul   %r10
+    5a79:	49 c1 fa 3f          	sar    $0x3f,%r10
+    5a7d:	48 c1 fa 07          	sar    $0x7,%rdx
+    5a81:	4c 29 d2             	sub    %r10,%rdx
+    5a84:	41 01 d1             	add    %edx,%r9d
+    5a87:	44 89 89 b8 00 00 00 	mov    %r9d,0xb8(%rcx)
+        previous = __atomic_fetch_xor(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+    5a8e:	40 0f b6 ed          	movzbl %bpl,%ebp
+    5a92:	48 8d 05 47 11 07 00 	lea    0x71147(%rip),%rax        # 76be0 <gpio_emulation>
+    5a99:	f0 44 0f bb 2c a8    	lock btc %r13d,(%rax,%rbp,4)
+    5a9f:	0f 92 c0             	setb   %al
+        GpioDispatchEvent(port, bit, previous, !previous);
+    5aa2:	31 c9                	xor    %ecx,%ecx
+    5aa4:	44 89 ee             	mov    %r13d,%esi
+    5aa7:	44 89 e7             	mov    %r12d,%edi
+        previous = __atomic_fetch_xor(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+    5aaa:	0f b6 c0             	movzbl %al,%eax
+        GpioDispatchEvent(port, bit, previous, !previous);
+    5aad:	85 c0                	test   %eax,%eax
+        previous = __atomic_fetch_xor(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+    5aaf:	0f 95 c2             	setne  %dl
+        GpioDispatchEvent(port, bit, previous, !previous);
+    5ab2:	0f 94 c1             	sete   %cl
+}
+    5ab5:	48 83 c4 18          	add    $0x18,%rsp
+    5ab9:	5b                   	pop    %rbx
+        previous = __atomic_fetch_xor(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+    5aba:	0f b6 d2             	movzbl %dl,%edx
+}
+    5abd:	5d                   	pop    %rbp
+    5abe:	41 5c                	pop    %r12
+    5ac0:	41 5d                	pop    %r13
+        GpioDispatchEvent(port, bit, previous, !previous);
+    5ac2:	e9 f9 f2 ff ff       	jmp    4dc0 <GpioDispatchEvent>
+    5ac7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    5ace:	00 00 
+    5ad0:	c3                   	ret
+    5ad1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    5ad8:	00 00 00 00 
+    5adc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000005ae0 <GlitchThread>:
+static void * GlitchThread(void * _) {
+    5ae0:	41 56                	push   %r14
+    clock_gettime(CLOCK_MONOTONIC, &slot);
+    5ae2:	bf 01 00 00 00       	mov    $0x1,%edi
+static void * GlitchThread(void * _) {
+    5ae7:	41 55                	push   %r13
+    return *state * 0x2545F4914F6CDD1DULL;
+    5ae9:	49 bd 1d dd 6c 4f 91 	movabs $0x2545f4914f6cdd1d,%r13
+    5af0:	f4 45 25 
+static void * GlitchThread(void * _) {
+    5af3:	41 54                	push   %r12
+    5af5:	55                   	push   %rbp
+    uint64_t random = fault_seed ^ 0x5851F42D4C957F2DULL;
+    5af6:	48 bd 2d 7f 95 4c 2d 	movabs $0x5851f42d4c957f2d,%rbp
+    5afd:	f4 51 58 
+static void * GlitchThread(void * _) {
+    5b00:	53                   	push   %rbx
+    5b01:	48 83 ec 10          	sub    $0x10,%rsp
+    uint64_t random = fault_seed ^ 0x5851F42D4C957F2DULL;
+    5b05:	48 33 2d 4c 57 00 00 	xor    0x574c(%rip),%rbp        # b258 <fault_seed>
+    clock_gettime(CLOCK_MONOTONIC, &slot);
+    5b0c:	49 89 e4             	mov    %rsp,%r12
+    5b0f:	4c 89 e6             	mov    %r12,%rsi
+    5b12:	e8 b9 c5 ff ff       	call   20d0 <clock_gettime@plt>
+    5b17:	eb 36                	jmp    5b4f <GlitchThread+0x6f>
+    5b19:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        slot.tv_nsec += FAULT_GLITCH_SLOT * 1000;
+    5b20:	48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &slot, NULL);
+    5b25:	31 c9                	xor    %ecx,%ecx
+    5b27:	4c 89 e2             	mov    %r12,%rdx
+    5b2a:	be 01 00 00 00       	mov    $0x1,%esi
+    5b2f:	bf 01 00 00 00       	mov    $0x1,%edi
+    5b34:	e8 87 c8 ff ff       	call   23c0 <clock_nanosleep@plt>
+        for (int index = 0; index < __atomic_load_n(&fault_glitch_count, __ATOMIC_ACQUIRE);
+    5b39:	48 8d 1d 60 ca 00 00 	lea    0xca60(%rip),%rbx        # 125a0 <fault_glitches>
+    5b40:	45 31 f6             	xor    %r14d,%r14d
+    5b43:	0f b6 05 47 ca 00 00 	movzbl 0xca47(%rip),%eax        # 12591 <fault_glitch_count>
+    5b4a:	44 39 f0             	cmp    %r14d,%eax
+    5b4d:	7f 31                	jg     5b80 <GlitchThread+0xa0>
+        slot.tv_nsec += FAULT_GLITCH_SLOT * 1000;
+    5b4f:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    5b54:	48 8d 90 a0 86 01 00 	lea    0x186a0(%rax),%rdx
+        if (slot.tv_nsec >= 1000000000) {
+    5b5b:	48 81 fa ff c9 9a 3b 	cmp    $0x3b9ac9ff,%rdx
+    5b62:	7e bc                	jle    5b20 <GlitchThread+0x40>
+            slot.tv_sec++;
+    5b64:	f3 0f 7e 04 24       	movq   (%rsp),%xmm0
+    5b69:	66 48 0f 6e c8       	movq   %rax,%xmm1
+    5b6e:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    5b72:	66 0f d4 05 16 2f 00 	paddq  0x2f16(%rip),%xmm0        # 8a90 <data.2+0x50>
+    5b79:	00 
+    5b7a:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    5b7e:	eb a5                	jmp    5b25 <GlitchThread+0x45>
+            if (FaultHappens(&random, glitch->rate)) {
+    5b80:	48 8b 43 08          	mov    0x8(%rbx),%rax
+    return threshold && (FaultRandom(state) < threshold);
+    5b84:	48 85 c0             	test   %rax,%rax
+    5b87:	74 4e                	je     5bd7 <GlitchThread+0xf7>
+    *state ^= *state >> 12;
+    5b89:	48 89 e9             	mov    %rbp,%rcx
+    5b8c:	48 c1 e9 0c          	shr    $0xc,%rcx
+    5b90:	48 31 e9             	xor    %rbp,%rcx
+    *state ^= *state << 25;
+    5b93:	48 89 ca             	mov    %rcx,%rdx
+    5b96:	48 c1 e2 19          	shl    $0x19,%rdx
+    5b9a:	48 31 ca             	xor    %rcx,%rdx
+    *state ^= *state >> 27;
+    5b9d:	48 89 d5             	mov    %rdx,%rbp
+    5ba0:	48 c1 ed 1b          	shr    $0x1b,%rbp
+    5ba4:	48 31 d5             	xor    %rdx,%rbp
+    return *state * 0x2545F4914F6CDD1DULL;
+    5ba7:	48 89 ea             	mov    %rbp,%rdx
+    5baa:	49 0f af d5          	imul   %r13,%rdx
+    return threshold && (FaultRandom(state) < threshold);
+    5bae:	48 39 c2             	cmp    %rax,%rdx
+    5bb1:	73 24                	jae    5bd7 <GlitchThread+0xf7>
+                GpioInjectToggle(glitch->port, glitch->bit);
+    5bb3:	0f b6 73 01          	movzbl 0x1(%rbx),%esi
+    5bb7:	0f b6 3b             	movzbl (%rbx),%edi
+    5bba:	e8 21 fe ff ff       	call   59e0 <GpioInjectToggle.isra.0>
+                usleep(glitch->width);
+    5bbf:	8b 7b 10             	mov    0x10(%rbx),%edi
+    5bc2:	e8 69 c8 ff ff       	call   2430 <usleep@plt>
+                GpioInjectToggle(glitch->port, glitch->bit);
+    5bc7:	0f b6 73 01          	movzbl 0x1(%rbx),%esi
+    5bcb:	0f b6 3b             	movzbl (%rbx),%edi
+    5bce:	e8 0d fe ff ff       	call   59e0 <GpioInjectToggle.isra.0>
+                glitch->count++;
+    5bd3:	83 43 14 01          	addl   $0x1,0x14(%rbx)
+             index++) {
+    5bd7:	41 83 c6 01          	add    $0x1,%r14d
+    5bdb:	48 83 c3 18          	add    $0x18,%rbx
+    5bdf:	e9 5f ff ff ff       	jmp    5b43 <GlitchThread+0x63>
+    5be4:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    5beb:	00 00 00 00 
+    5bef:	90                   	nop
+
+0000000000005bf0 <SciInjectEvent.part.0>:
+    JournalStart();
+    ConsoleStart(port);
+    WireStart();
+}
+
+void SciInjectEvent(uint8_t port) {
+    5bf0:	41 57                	push   %r15
+    5bf2:	41 56                	push   %r14
+    5bf4:	41 55                	push   %r13
+    5bf6:	41 54                	push   %r12
+    5bf8:	41 89 fc             	mov    %edi,%r12d
+    5bfb:	55                   	push   %rbp
+    5bfc:	53                   	push   %rbx
+    event_handler_t event_handler;
+    hal_sci_event_t handler;
+    struct sci_status_s status;
+
+    if (port < SOC_SCI_PORTS) {
+        event_handler = &event_handlers[port];
+    5bfd:	40 0f b6 df          	movzbl %dil,%ebx
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_SCI + port);
+    5c01:	8d 43 10             	lea    0x10(%rbx),%eax
+void SciInjectEvent(uint8_t port) {
+    5c04:	48 83 ec 38          	sub    $0x38,%rsp
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_SCI + port);
+    5c08:	89 44 24 0c          	mov    %eax,0xc(%rsp)
+    5c0c:	0f b6 05 72 ce 06 00 	movzbl 0x6ce72(%rip),%eax        # 72a85 <trace_enabled>
+    5c13:	84 c0                	test   %al,%al
+    5c15:	0f 85 ed 01 00 00    	jne    5e08 <SciInjectEvent.part.0+0x218>
+    5c1b:	41 0f b6 c4          	movzbl %r12b,%eax
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    5c1f:	4c 8d 6c 24 20       	lea    0x20(%rsp),%r13
+    5c24:	bf 01 00 00 00       	mov    $0x1,%edi
+    5c29:	8d 68 10             	lea    0x10(%rax),%ebp
+    5c2c:	4c 89 ee             	mov    %r13,%rsi
+    5c2f:	e8 9c c4 ff ff       	call   20d0 <clock_gettime@plt>
+    latency_vector_t vector = LatencyFind(source);
+    5c34:	89 ef                	mov    %ebp,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    5c36:	4c 8b 4c 24 20       	mov    0x20(%rsp),%r9
+    5c3b:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+    5c40:	e8 1b cc ff ff       	call   2860 <LatencyFind>
+    5c45:	48 89 c1             	mov    %rax,%rcx
+    if (vector) {
+    5c48:	48 85 c0             	test   %rax,%rax
+    5c4b:	74 2c                	je     5c79 <SciInjectEvent.part.0+0x89>
+    5c4d:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    5c54:	9b c4 20 
+    5c57:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+    5c5e:	49 f7 ea             	imul   %r10
+    5c61:	4c 89 d0             	mov    %r10,%rax
+    5c64:	48 c1 f8 3f          	sar    $0x3f,%rax
+    5c68:	48 c1 fa 07          	sar    $0x7,%rdx
+    5c6c:	48 29 c2             	sub    %rax,%rdx
+    5c6f:	41 8d 04 11          	lea    (%r9,%rdx,1),%eax
+    5c73:	89 81 bc 00 00 00    	mov    %eax,0xbc(%rcx)
+        handler = __atomic_load_n(&event_handler->handler, __ATOMIC_ACQUIRE);
+    5c79:	45 0f b6 e4          	movzbl %r12b,%r12d
+    5c7d:	48 8d 05 a4 8c 05 00 	lea    0x58ca4(%rip),%rax        # 5e928 <event_handlers.lto_priv.1+0x8>
+    5c84:	4b 8d 14 64          	lea    (%r12,%r12,2),%rdx
+    5c88:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+    5c8c:	4c 8b 20             	mov    (%rax),%r12
+        if (handler) {
+    5c8f:	4d 85 e4             	test   %r12,%r12
+    5c92:	0f 84 4c 01 00 00    	je     5de4 <SciInjectEvent.part.0+0x1f4>
+            SciReadStatus(event_handler->sci, &status);
+    5c98:	4c 8d 3d 81 8c 05 00 	lea    0x58c81(%rip),%r15        # 5e920 <event_handlers.lto_priv.1>
+    5c9f:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+    5ca3:	49 8b 14 c7          	mov    (%r15,%rax,8),%rdx
+    uint8_t port = sci ? sci->index : 0;
+    5ca7:	48 85 d2             	test   %rdx,%rdx
+    5caa:	0f 84 b0 01 00 00    	je     5e60 <SciInjectEvent.part.0+0x270>
+    5cb0:	44 0f b6 02          	movzbl (%rdx),%r8d
+}
+
+uint8_t FaultSciStatus(uint8_t port) {
+    struct fault_sci_s * sci = &fault_sci[port % FAULT_SCI_PORTS];
+
+    return __atomic_exchange_n(&sci->flags, 0, __ATOMIC_RELAXED);
+    5cb4:	48 8d 15 36 cb 04 00 	lea    0x4cb36(%rip),%rdx        # 527f1 <fault_sci+0x31>
+    struct fault_sci_s * sci = &fault_sci[port % FAULT_SCI_PORTS];
+    5cbb:	44 89 c0             	mov    %r8d,%eax
+    return __atomic_exchange_n(&sci->flags, 0, __ATOMIC_RELAXED);
+    5cbe:	44 88 44 24 14       	mov    %r8b,0x14(%rsp)
+    struct fault_sci_s * sci = &fault_sci[port % FAULT_SCI_PORTS];
+    5cc3:	83 e0 03             	and    $0x3,%eax
+    5cc6:	89 44 24 10          	mov    %eax,0x10(%rsp)
+    return __atomic_exchange_n(&sci->flags, 0, __ATOMIC_RELAXED);
+    5cca:	4c 89 c0             	mov    %r8,%rax
+    5ccd:	83 e0 03             	and    $0x3,%eax
+    5cd0:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    5cd7:	48 01 d0             	add    %rdx,%rax
+    5cda:	31 d2                	xor    %edx,%edx
+    5cdc:	86 10                	xchg   %dl,(%rax)
+    pthread_once(&journal_once, JournalOpen);
+    5cde:	48 8d 35 7b d5 ff ff 	lea    -0x2a85(%rip),%rsi        # 3260 <JournalOpen>
+    5ce5:	48 8d 3d 64 cd 06 00 	lea    0x6cd64(%rip),%rdi        # 72a50 <journal_once>
+    memset(result, 0, sizeof(*result));
+    5cec:	c6 44 24 20 00       	movb   $0x0,0x20(%rsp)
+    5cf1:	41 89 d6             	mov    %edx,%r14d
+    5cf4:	e8 f7 c6 ff ff       	call   23f0 <pthread_once@plt>
+    if (JournalReplaying()) {
+    5cf9:	48 83 3d cf cc 06 00 	cmpq   $0x0,0x6cccf(%rip)        # 729d0 <journal_replay>
+    5d00:	00 
+    5d01:	44 0f b6 44 24 14    	movzbl 0x14(%rsp),%r8d
+    5d07:	0f 85 33 01 00 00    	jne    5e40 <SciInjectEvent.part.0+0x250>
+    uint8_t faults = FaultSciStatus(port);
+    5d0d:	41 0f b6 c0          	movzbl %r8b,%eax
+    pthread_once(&wire_once, WireOpen);
+    5d11:	48 8d 35 78 dd ff ff 	lea    -0x2288(%rip),%rsi        # 3a90 <WireOpen>
+    5d18:	44 88 44 24 18       	mov    %r8b,0x18(%rsp)
+    5d1d:	48 8d 3d 94 0e 07 00 	lea    0x70e94(%rip),%rdi        # 76bb8 <wire_once>
+    5d24:	89 44 24 14          	mov    %eax,0x14(%rsp)
+    5d28:	e8 c3 c6 ff ff       	call   23f0 <pthread_once@plt>
+    return bus && (port < WIRE_SCI_PORTS) && (sci_links[port].transmit != WIRE_NONE);
+    5d2d:	48 8b 05 7c 0e 07 00 	mov    0x70e7c(%rip),%rax        # 76bb0 <bus>
+    5d34:	44 0f b6 44 24 18    	movzbl 0x18(%rsp),%r8d
+    5d3a:	48 85 c0             	test   %rax,%rax
+    5d3d:	0f 84 5d 02 00 00    	je     5fa0 <SciInjectEvent.part.0+0x3b0>
+    5d43:	41 80 f8 03          	cmp    $0x3,%r8b
+    5d47:	0f 86 76 01 00 00    	jbe    5ec3 <SciInjectEvent.part.0+0x2d3>
+    ConsoleStart(port);
+    5d4d:	8b 7c 24 14          	mov    0x14(%rsp),%edi
+    5d51:	e8 8a e5 ff ff       	call   42e0 <ConsoleStart>
+        result->fifo_empty = true;
+    5d56:	0f b6 4c 24 20       	movzbl 0x20(%rsp),%ecx
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5d5b:	be 01 00 00 00       	mov    $0x1,%esi
+        result->fifo_empty = true;
+    5d60:	83 c9 20             	or     $0x20,%ecx
+    5d63:	88 4c 24 20          	mov    %cl,0x20(%rsp)
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5d67:	83 e1 01             	and    $0x1,%ecx
+    5d6a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    return fault_sci[port % FAULT_SCI_PORTS].carried;
+    5d70:	48 63 44 24 10       	movslq 0x10(%rsp),%rax
+    5d75:	48 8d 3d 44 ca 04 00 	lea    0x4ca44(%rip),%rdi        # 527c0 <fault_sci>
+    result->break_signal = (faults & FAULT_SCI_BREAK) != 0;
+    5d7c:	43 8d 14 36          	lea    (%r14,%r14,1),%edx
+    5d80:	48 69 c0 58 30 00 00 	imul   $0x3058,%rax,%rax
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5d87:	8b 44 07 34          	mov    0x34(%rdi,%rax,1),%eax
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_SCI + port);
+    5d8b:	89 ef                	mov    %ebp,%edi
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5d8d:	85 c0                	test   %eax,%eax
+    5d8f:	0f 95 c0             	setne  %al
+    5d92:	83 e2 10             	and    $0x10,%edx
+    5d95:	c1 e6 06             	shl    $0x6,%esi
+    5d98:	09 c8                	or     %ecx,%eax
+    5d9a:	43 8d 0c 36          	lea    (%r14,%r14,1),%ecx
+    5d9e:	83 e1 02             	and    $0x2,%ecx
+    5da1:	09 c8                	or     %ecx,%eax
+    result->parity_error = (faults & FAULT_SCI_PARITY) != 0;
+    5da3:	43 8d 0c 36          	lea    (%r14,%r14,1),%ecx
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5da7:	83 e1 04             	and    $0x4,%ecx
+    5daa:	09 c8                	or     %ecx,%eax
+    result->framing_error = (faults & FAULT_SCI_FRAMING) != 0;
+    5dac:	43 8d 0c 36          	lea    (%r14,%r14,1),%ecx
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5db0:	83 e1 08             	and    $0x8,%ecx
+    5db3:	09 c8                	or     %ecx,%eax
+    5db5:	09 d0                	or     %edx,%eax
+    5db7:	0f b6 54 24 20       	movzbl 0x20(%rsp),%edx
+    5dbc:	09 f0                	or     %esi,%eax
+    5dbe:	83 e2 a0             	and    $0xffffffa0,%edx
+    5dc1:	83 e0 5f             	and    $0x5f,%eax
+    5dc4:	09 d0                	or     %edx,%eax
+    5dc6:	88 44 24 20          	mov    %al,0x20(%rsp)
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_SCI + port);
+    5dca:	e8 71 ec ff ff       	call   4a40 <LatencyDispatch>
+            handler(event_handler->sci, &status, event_handler->data);
+    5dcf:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+    5dd3:	4c 89 ee             	mov    %r13,%rsi
+    5dd6:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+    5dda:	48 8b 50 10          	mov    0x10(%rax),%rdx
+    5dde:	48 8b 38             	mov    (%rax),%rdi
+    5de1:	41 ff d4             	call   *%r12
+        }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_SCI + port);
+    5de4:	89 ef                	mov    %ebp,%edi
+    5de6:	e8 35 ed ff ff       	call   4b20 <LatencyExit>
+    5deb:	0f b6 05 93 cc 06 00 	movzbl 0x6cc93(%rip),%eax        # 72a85 <trace_enabled>
+    5df2:	84 c0                	test   %al,%al
+    5df4:	75 2a                	jne    5e20 <SciInjectEvent.part.0+0x230>
+    }
+}
+    5df6:	48 83 c4 38          	add    $0x38,%rsp
+    5dfa:	5b                   	pop    %rbx
+    5dfb:	5d                   	pop    %rbp
+    5dfc:	41 5c                	pop    %r12
+    5dfe:	41 5d                	pop    %r13
+    5e00:	41 5e                	pop    %r14
+    5e02:	41 5f                	pop    %r15
+    5e04:	c3                   	ret
+    5e05:	0f 1f 00             	nopl   (%rax)
+    5e08:	8b 74 24 0c          	mov    0xc(%rsp),%esi
+    5e0c:	bf 10 00 00 00       	mov    $0x10,%edi
+    5e11:	e8 8a cb ff ff       	call   29a0 <TraceEvent.part.0>
+    5e16:	e9 00 fe ff ff       	jmp    5c1b <SciInjectEvent.part.0+0x2b>
+    5e1b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    5e20:	8b 74 24 0c          	mov    0xc(%rsp),%esi
+    5e24:	bf 11 00 00 00       	mov    $0x11,%edi
+    5e29:	e8 72 cb ff ff       	call   29a0 <TraceEvent.part.0>
+    5e2e:	48 83 c4 38          	add    $0x38,%rsp
+    5e32:	5b                   	pop    %rbx
+    5e33:	5d                   	pop    %rbp
+    5e34:	41 5c                	pop    %r12
+    5e36:	41 5d                	pop    %r13
+    5e38:	41 5e                	pop    %r14
+    5e3a:	41 5f                	pop    %r15
+    5e3c:	c3                   	ret
+    5e3d:	0f 1f 00             	nopl   (%rax)
+
+uint32_t JournalSciPending(uint8_t port) {
+    struct journal_sci_s * sci;
+
+    /* The ports without a buffer never receive data, they aren't merged with the others */
+    if (port >= JOURNAL_SCI_PORTS) {
+    5e40:	31 c9                	xor    %ecx,%ecx
+    5e42:	41 80 f8 03          	cmp    $0x3,%r8b
+    5e46:	0f 86 d4 01 00 00    	jbe    6020 <SciInjectEvent.part.0+0x430>
+        result->fifo_empty = true;
+    5e4c:	80 4c 24 20 20       	orb    $0x20,0x20(%rsp)
+    5e51:	be 01 00 00 00       	mov    $0x1,%esi
+    5e56:	e9 15 ff ff ff       	jmp    5d70 <SciInjectEvent.part.0+0x180>
+    5e5b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    return __atomic_exchange_n(&sci->flags, 0, __ATOMIC_RELAXED);
+    5e60:	41 89 d6             	mov    %edx,%r14d
+    5e63:	44 86 35 87 c9 04 00 	xchg   %r14b,0x4c987(%rip)        # 527f1 <fault_sci+0x31>
+    pthread_once(&journal_once, JournalOpen);
+    5e6a:	48 8d 35 ef d3 ff ff 	lea    -0x2c11(%rip),%rsi        # 3260 <JournalOpen>
+    5e71:	48 8d 3d d8 cb 06 00 	lea    0x6cbd8(%rip),%rdi        # 72a50 <journal_once>
+    memset(result, 0, sizeof(*result));
+    5e78:	c6 44 24 20 00       	movb   $0x0,0x20(%rsp)
+    5e7d:	e8 6e c5 ff ff       	call   23f0 <pthread_once@plt>
+    if (JournalReplaying()) {
+    5e82:	48 83 3d 46 cb 06 00 	cmpq   $0x0,0x6cb46(%rip)        # 729d0 <journal_replay>
+    5e89:	00 
+    5e8a:	0f 85 e8 00 00 00    	jne    5f78 <SciInjectEvent.part.0+0x388>
+    pthread_once(&wire_once, WireOpen);
+    5e90:	48 8d 35 f9 db ff ff 	lea    -0x2407(%rip),%rsi        # 3a90 <WireOpen>
+    5e97:	48 8d 3d 1a 0d 07 00 	lea    0x70d1a(%rip),%rdi        # 76bb8 <wire_once>
+    5e9e:	e8 4d c5 ff ff       	call   23f0 <pthread_once@plt>
+    return bus && (port < WIRE_SCI_PORTS) && (sci_links[port].transmit != WIRE_NONE);
+    5ea3:	48 8b 05 06 0d 07 00 	mov    0x70d06(%rip),%rax        # 76bb0 <bus>
+    uint8_t faults = FaultSciStatus(port);
+    5eaa:	c7 44 24 14 00 00 00 	movl   $0x0,0x14(%rsp)
+    5eb1:	00 
+    struct fault_sci_s * sci = &fault_sci[port % FAULT_SCI_PORTS];
+    5eb2:	c7 44 24 10 00 00 00 	movl   $0x0,0x10(%rsp)
+    5eb9:	00 
+    5eba:	48 85 c0             	test   %rax,%rax
+    5ebd:	0f 84 85 01 00 00    	je     6048 <SciInjectEvent.part.0+0x458>
+    5ec3:	48 63 4c 24 14       	movslq 0x14(%rsp),%rcx
+    5ec8:	48 8d 35 d1 0c 07 00 	lea    0x70cd1(%rip),%rsi        # 76ba0 <sci_links>
+    5ecf:	48 8d 3c 49          	lea    (%rcx,%rcx,2),%rdi
+    5ed3:	48 01 fe             	add    %rdi,%rsi
+    5ed6:	80 3e ff             	cmpb   $0xff,(%rsi)
+    5ed9:	0f 84 81 01 00 00    	je     6060 <SciInjectEvent.part.0+0x470>
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].receive];
+    5edf:	44 0f b6 46 01       	movzbl 0x1(%rsi),%r8d
+    return __atomic_load_n(&pipe->head, __ATOMIC_ACQUIRE) - pipe->tail;
+    5ee4:	4c 89 c7             	mov    %r8,%rdi
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].receive];
+    5ee7:	4c 89 c1             	mov    %r8,%rcx
+    return __atomic_load_n(&pipe->head, __ATOMIC_ACQUIRE) - pipe->tail;
+    5eea:	48 c1 e7 09          	shl    $0x9,%rdi
+    5eee:	4c 01 c7             	add    %r8,%rdi
+    5ef1:	48 8d 3c f8          	lea    (%rax,%rdi,8),%rdi
+    5ef5:	44 8b 47 48          	mov    0x48(%rdi),%r8d
+    5ef9:	48 89 cf             	mov    %rcx,%rdi
+    5efc:	48 c1 e7 09          	shl    $0x9,%rdi
+    5f00:	48 01 f9             	add    %rdi,%rcx
+    5f03:	48 8d 04 c8          	lea    (%rax,%rcx,8),%rax
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].transmit];
+    5f07:	0f b6 36             	movzbl (%rsi),%esi
+    5f0a:	48 8b 3d 9f 0c 07 00 	mov    0x70c9f(%rip),%rdi        # 76bb0 <bus>
+    return __atomic_load_n(&pipe->head, __ATOMIC_ACQUIRE) - pipe->tail;
+    5f11:	8b 40 4c             	mov    0x4c(%rax),%eax
+        result->data_ready = (WireSciPending(port) > 0);
+    5f14:	41 39 c0             	cmp    %eax,%r8d
+    5f17:	0f b6 44 24 20       	movzbl 0x20(%rsp),%eax
+    5f1c:	0f 95 c1             	setne  %cl
+    5f1f:	83 e0 fe             	and    $0xfffffffe,%eax
+    5f22:	09 c8                	or     %ecx,%eax
+    return WIRE_PIPE_SIZE - (pipe->head - __atomic_load_n(&pipe->tail, __ATOMIC_ACQUIRE));
+    5f24:	48 89 f1             	mov    %rsi,%rcx
+    5f27:	88 44 24 20          	mov    %al,0x20(%rsp)
+    5f2b:	48 c1 e1 09          	shl    $0x9,%rcx
+    5f2f:	48 89 f0             	mov    %rsi,%rax
+    5f32:	48 01 f1             	add    %rsi,%rcx
+    5f35:	48 c1 e6 09          	shl    $0x9,%rsi
+    5f39:	48 8d 0c cf          	lea    (%rdi,%rcx,8),%rcx
+    5f3d:	48 01 f0             	add    %rsi,%rax
+    5f40:	8b 49 4c             	mov    0x4c(%rcx),%ecx
+    5f43:	48 8d 04 c7          	lea    (%rdi,%rax,8),%rax
+    5f47:	8b 70 48             	mov    0x48(%rax),%esi
+    5f4a:	89 c8                	mov    %ecx,%eax
+        result->fifo_empty = (WireSciSpace(port) > 0);
+    5f4c:	0f b6 4c 24 20       	movzbl 0x20(%rsp),%ecx
+    5f51:	29 f0                	sub    %esi,%eax
+    5f53:	3d 00 f0 ff ff       	cmp    $0xfffff000,%eax
+    5f58:	40 0f 95 c6          	setne  %sil
+    5f5c:	83 e1 df             	and    $0xffffffdf,%ecx
+    5f5f:	89 f0                	mov    %esi,%eax
+    5f61:	c1 e0 05             	shl    $0x5,%eax
+    5f64:	09 c1                	or     %eax,%ecx
+    5f66:	88 4c 24 20          	mov    %cl,0x20(%rsp)
+    result->data_ready |= (FaultSciPending(port) > 0);
+    5f6a:	83 e1 01             	and    $0x1,%ecx
+    5f6d:	e9 fe fd ff ff       	jmp    5d70 <SciInjectEvent.part.0+0x180>
+    5f72:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    5f78:	c7 44 24 10 00 00 00 	movl   $0x0,0x10(%rsp)
+    5f7f:	00 
+    if (JournalReplaying()) {
+    5f80:	48 8d 0d 19 8a 05 00 	lea    0x58a19(%rip),%rcx        # 5e9a0 <journal_sci>
+    5f87:	b8 04 00 00 00       	mov    $0x4,%eax
+    5f8c:	48 89 ce             	mov    %rcx,%rsi
+        return 0;
+    }
+    sci = &journal_sci[port];
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+    5f8f:	8b 36                	mov    (%rsi),%esi
+           __atomic_load_n(&sci->tail, __ATOMIC_ACQUIRE);
+    5f91:	8b 04 01             	mov    (%rcx,%rax,1),%eax
+        result->data_ready = (JournalSciPending(port) > 0);
+    5f94:	39 c6                	cmp    %eax,%esi
+    5f96:	0f 95 c1             	setne  %cl
+    5f99:	e9 ae fe ff ff       	jmp    5e4c <SciInjectEvent.part.0+0x25c>
+    5f9e:	66 90                	xchg   %ax,%ax
+    5fa0:	8b 7c 24 14          	mov    0x14(%rsp),%edi
+    5fa4:	44 88 44 24 18       	mov    %r8b,0x18(%rsp)
+    5fa9:	e8 32 e3 ff ff       	call   42e0 <ConsoleStart>
+    return (port < SOC_SCI_PORTS) && console_ports[port].attached;
+    5fae:	44 0f b6 44 24 18    	movzbl 0x18(%rsp),%r8d
+    5fb4:	41 80 f8 03          	cmp    $0x3,%r8b
+    5fb8:	0f 87 98 fd ff ff    	ja     5d56 <SciInjectEvent.part.0+0x166>
+    5fbe:	48 63 4c 24 14       	movslq 0x14(%rsp),%rcx
+    5fc3:	48 89 c8             	mov    %rcx,%rax
+    5fc6:	48 8d 35 d3 ca 06 00 	lea    0x6cad3(%rip),%rsi        # 72aa0 <console_ports>
+    5fcd:	48 c1 e0 06          	shl    $0x6,%rax
+    5fd1:	48 01 c8             	add    %rcx,%rax
+    5fd4:	48 c1 e0 06          	shl    $0x6,%rax
+    5fd8:	48 01 c6             	add    %rax,%rsi
+    5fdb:	80 7e 29 00          	cmpb   $0x0,0x29(%rsi)
+    5fdf:	0f 84 71 fd ff ff    	je     5d56 <SciInjectEvent.part.0+0x166>
+}
+
+uint32_t ConsolePending(uint8_t port) {
+    struct console_port_s * console = &console_ports[port];
+
+    return __atomic_load_n(&console->head, __ATOMIC_ACQUIRE) - console->tail;
+    5fe5:	48 8d 0d ec ca 06 00 	lea    0x6caec(%rip),%rcx        # 72ad8 <console_ports+0x38>
+    5fec:	48 01 c8             	add    %rcx,%rax
+    5fef:	8b 08                	mov    (%rax),%ecx
+    5ff1:	8b 46 3c             	mov    0x3c(%rsi),%eax
+}
+
+bool ConsoleWritable(uint8_t port) {
+    return !console_ports[port].blocked;
+    5ff4:	0f b6 76 34          	movzbl 0x34(%rsi),%esi
+        result->data_ready = (ConsolePending(port) > 0);
+    5ff8:	39 c1                	cmp    %eax,%ecx
+        result->fifo_empty = ConsoleWritable(port);
+    5ffa:	0f b6 44 24 20       	movzbl 0x20(%rsp),%eax
+        result->data_ready = (ConsolePending(port) > 0);
+    5fff:	0f 95 c1             	setne  %cl
+    6002:	83 f6 01             	xor    $0x1,%esi
+        result->fifo_empty = ConsoleWritable(port);
+    6005:	89 f7                	mov    %esi,%edi
+    6007:	83 e0 df             	and    $0xffffffdf,%eax
+    600a:	83 e7 01             	and    $0x1,%edi
+    600d:	c1 e7 05             	shl    $0x5,%edi
+    6010:	09 f8                	or     %edi,%eax
+    6012:	88 44 24 20          	mov    %al,0x20(%rsp)
+    6016:	e9 55 fd ff ff       	jmp    5d70 <SciInjectEvent.part.0+0x180>
+    601b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    6020:	4c 89 c0             	mov    %r8,%rax
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+    6023:	48 8d 0d 76 89 05 00 	lea    0x58976(%rip),%rcx        # 5e9a0 <journal_sci>
+    602a:	48 c1 e0 09          	shl    $0x9,%rax
+    602e:	4c 01 c0             	add    %r8,%rax
+    6031:	48 c1 e0 03          	shl    $0x3,%rax
+    6035:	48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+    6039:	48 83 c0 04          	add    $0x4,%rax
+    603d:	e9 4d ff ff ff       	jmp    5f8f <SciInjectEvent.part.0+0x39f>
+    6042:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    ConsoleStart(port);
+    6048:	31 ff                	xor    %edi,%edi
+    604a:	e8 91 e2 ff ff       	call   42e0 <ConsoleStart>
+    return (port < SOC_SCI_PORTS) && console_ports[port].attached;
+    604f:	31 c9                	xor    %ecx,%ecx
+    6051:	e9 6d ff ff ff       	jmp    5fc3 <SciInjectEvent.part.0+0x3d3>
+    6056:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    605d:	00 00 00 
+    ConsoleStart(port);
+    6060:	8b 7c 24 14          	mov    0x14(%rsp),%edi
+    6064:	48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+    6069:	e8 72 e2 ff ff       	call   42e0 <ConsoleStart>
+    return (port < SOC_SCI_PORTS) && console_ports[port].attached;
+    606e:	48 8b 4c 24 18       	mov    0x18(%rsp),%rcx
+    6073:	e9 4b ff ff ff       	jmp    5fc3 <SciInjectEvent.part.0+0x3d3>
+    6078:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    607f:	00 
+
+0000000000006080 <JournalDeliver>:
+static void JournalDeliver(uint64_t until) {
+    6080:	41 57                	push   %r15
+    6082:	41 56                	push   %r14
+    6084:	4c 8d 35 35 c9 05 00 	lea    0x5c935(%rip),%r14        # 629c0 <journal_next>
+    608b:	41 55                	push   %r13
+           __atomic_load_n(&sci->tail, __ATOMIC_ACQUIRE);
+    608d:	4c 8d 2d 10 89 05 00 	lea    0x58910(%rip),%r13        # 5e9a4 <journal_sci+0x4>
+static void JournalDeliver(uint64_t until) {
+    6094:	41 54                	push   %r12
+    6096:	49 89 fc             	mov    %rdi,%r12
+    6099:	55                   	push   %rbp
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    609a:	49 8d 6d fc          	lea    -0x4(%r13),%rbp
+static void JournalDeliver(uint64_t until) {
+    609e:	53                   	push   %rbx
+    609f:	48 83 ec 18          	sub    $0x18,%rsp
+    while (journal_pending && (journal_next.time < until)) {
+    60a3:	80 3d de 88 05 00 00 	cmpb   $0x0,0x588de(%rip)        # 5e988 <journal_pending>
+    60aa:	75 27                	jne    60d3 <JournalDeliver+0x53>
+    60ac:	e9 c8 01 00 00       	jmp    6279 <JournalDeliver+0x1f9>
+    60b1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        } else if (journal_next.kind == JOURNAL_TICK) {
+    60b8:	3c 03                	cmp    $0x3,%al
+    60ba:	0f 84 b9 01 00 00    	je     6279 <JournalDeliver+0x1f9>
+        journal_pending = JournalRead();
+    60c0:	e8 7b d0 ff ff       	call   3140 <JournalRead>
+    60c5:	88 05 bd 88 05 00    	mov    %al,0x588bd(%rip)        # 5e988 <journal_pending>
+        if (!journal_pending) {
+    60cb:	84 c0                	test   %al,%al
+    60cd:	0f 84 7a 01 00 00    	je     624d <JournalDeliver+0x1cd>
+    while (journal_pending && (journal_next.time < until)) {
+    60d3:	49 8b 06             	mov    (%r14),%rax
+    60d6:	4c 39 e0             	cmp    %r12,%rax
+    60d9:	0f 83 9a 01 00 00    	jae    6279 <JournalDeliver+0x1f9>
+        journal_last = journal_next.time;
+    60df:	48 89 05 1a c9 06 00 	mov    %rax,0x6c91a(%rip)        # 72a00 <journal_last>
+        if (journal_next.kind == JOURNAL_GPIO) {
+    60e6:	0f b6 05 db c8 05 00 	movzbl 0x5c8db(%rip),%eax        # 629c8 <journal_next+0x8>
+    60ed:	3c 01                	cmp    $0x1,%al
+    60ef:	0f 84 2b 01 00 00    	je     6220 <JournalDeliver+0x1a0>
+        } else if ((journal_next.kind == JOURNAL_SCI) && (journal_next.port < JOURNAL_SCI_PORTS)) {
+    60f5:	3c 02                	cmp    $0x2,%al
+    60f7:	75 bf                	jne    60b8 <JournalDeliver+0x38>
+    60f9:	0f b6 05 c9 c8 05 00 	movzbl 0x5c8c9(%rip),%eax        # 629c9 <journal_next+0x9>
+    6100:	3c 03                	cmp    $0x3,%al
+    6102:	77 bc                	ja     60c0 <JournalDeliver+0x40>
+            for (uint16_t index = 0; index < journal_next.size; index++) {
+    6104:	66 83 3d c0 c8 05 00 	cmpw   $0x0,0x5c8c0(%rip)        # 629cc <journal_next+0xc>
+    610b:	00 
+            sci = &journal_sci[journal_next.port];
+    610c:	0f b6 f8             	movzbl %al,%edi
+            for (uint16_t index = 0; index < journal_next.size; index++) {
+    610f:	0f 84 8c 01 00 00    	je     62a1 <JournalDeliver+0x221>
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    6115:	0f b6 c8             	movzbl %al,%ecx
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+    6118:	49 89 ff             	mov    %rdi,%r15
+            for (uint16_t index = 0; index < journal_next.size; index++) {
+    611b:	31 db                	xor    %ebx,%ebx
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    611d:	48 89 ca             	mov    %rcx,%rdx
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+    6120:	49 c1 e7 09          	shl    $0x9,%r15
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    6124:	48 c1 e2 09          	shl    $0x9,%rdx
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+    6128:	49 01 ff             	add    %rdi,%r15
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    612b:	48 01 ca             	add    %rcx,%rdx
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+    612e:	49 c1 e7 03          	shl    $0x3,%r15
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    6132:	48 8d 4c d5 00       	lea    0x0(%rbp,%rdx,8),%rcx
+    6137:	eb 40                	jmp    6179 <JournalDeliver+0xf9>
+    6139:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+    6140:	4a 8d 44 3d 00       	lea    0x0(%rbp,%r15,1),%rax
+    6145:	0f b7 f3             	movzwl %bx,%esi
+            for (uint16_t index = 0; index < journal_next.size; index++) {
+    6148:	83 c3 01             	add    $0x1,%ebx
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+    614b:	8b 10                	mov    (%rax),%edx
+    614d:	41 0f b6 74 36 0e    	movzbl 0xe(%r14,%rsi,1),%esi
+    6153:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    6159:	40 88 74 10 08       	mov    %sil,0x8(%rax,%rdx,1)
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+    615e:	8b 00                	mov    (%rax),%eax
+    6160:	83 c0 01             	add    $0x1,%eax
+    6163:	89 01                	mov    %eax,(%rcx)
+            for (uint16_t index = 0; index < journal_next.size; index++) {
+    6165:	66 3b 1d 60 c8 05 00 	cmp    0x5c860(%rip),%bx        # 629cc <journal_next+0xc>
+    616c:	0f 83 1e 01 00 00    	jae    6290 <JournalDeliver+0x210>
+            SciInjectEvent(journal_next.port);
+    6172:	0f b6 05 50 c8 05 00 	movzbl 0x5c850(%rip),%eax        # 629c9 <journal_next+0x9>
+    if (port >= JOURNAL_SCI_PORTS) {
+    6179:	3c 03                	cmp    $0x3,%al
+    617b:	77 c3                	ja     6140 <JournalDeliver+0xc0>
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+    617d:	48 89 c2             	mov    %rax,%rdx
+    6180:	48 c1 e2 09          	shl    $0x9,%rdx
+    6184:	48 01 d0             	add    %rdx,%rax
+    6187:	8b 54 c5 00          	mov    0x0(%rbp,%rax,8),%edx
+           __atomic_load_n(&sci->tail, __ATOMIC_ACQUIRE);
+    618b:	41 8b 74 c5 00       	mov    0x0(%r13,%rax,8),%esi
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+    6190:	89 d0                	mov    %edx,%eax
+    6192:	29 f0                	sub    %esi,%eax
+                if (JournalSciPending(journal_next.port) >= JOURNAL_SCI_BUFFER) {
+    6194:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    6199:	76 a5                	jbe    6140 <JournalDeliver+0xc0>
+                    SciInjectEvent(journal_next.port);
+    619b:	0f b6 3d 27 c8 05 00 	movzbl 0x5c827(%rip),%edi        # 629c9 <journal_next+0x9>
+    if (port < SOC_SCI_PORTS) {
+    61a2:	40 80 ff 03          	cmp    $0x3,%dil
+    61a6:	77 98                	ja     6140 <JournalDeliver+0xc0>
+    61a8:	48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    61ad:	e8 3e fa ff ff       	call   5bf0 <SciInjectEvent.part.0>
+                    if (JournalSciPending(journal_next.port) >= JOURNAL_SCI_BUFFER) {
+    61b2:	0f b6 05 10 c8 05 00 	movzbl 0x5c810(%rip),%eax        # 629c9 <journal_next+0x9>
+    if (port >= JOURNAL_SCI_PORTS) {
+    61b9:	48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    61be:	3c 03                	cmp    $0x3,%al
+    61c0:	0f 87 7a ff ff ff    	ja     6140 <JournalDeliver+0xc0>
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+    61c6:	48 89 c2             	mov    %rax,%rdx
+    61c9:	48 c1 e2 09          	shl    $0x9,%rdx
+    61cd:	48 01 d0             	add    %rdx,%rax
+    61d0:	8b 54 c5 00          	mov    0x0(%rbp,%rax,8),%edx
+           __atomic_load_n(&sci->tail, __ATOMIC_ACQUIRE);
+    61d4:	41 8b 74 c5 00       	mov    0x0(%r13,%rax,8),%esi
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+    61d9:	89 d0                	mov    %edx,%eax
+    61db:	29 f0                	sub    %esi,%eax
+                    if (JournalSciPending(journal_next.port) >= JOURNAL_SCI_BUFFER) {
+    61dd:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    61e2:	0f 86 58 ff ff ff    	jbe    6140 <JournalDeliver+0xc0>
+                        fprintf(stderr, "journal: data of sci%u not read at %llu us\n",
+    61e8:	48 8b 05 f1 4d 00 00 	mov    0x4df1(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    61ef:	0f b6 15 d3 c7 05 00 	movzbl 0x5c7d3(%rip),%edx        # 629c9 <journal_next+0x9>
+    61f6:	48 8d 35 83 23 00 00 	lea    0x2383(%rip),%rsi        # 8580 <_IO_stdin_used+0x580>
+    61fd:	48 8b 0d fc c7 06 00 	mov    0x6c7fc(%rip),%rcx        # 72a00 <journal_last>
+    6204:	48 8b 38             	mov    (%rax),%rdi
+    6207:	31 c0                	xor    %eax,%eax
+    6209:	e8 02 c0 ff ff       	call   2210 <fprintf@plt>
+                        exit(EXIT_FAILURE);
+    620e:	bf 01 00 00 00       	mov    $0x1,%edi
+    6213:	e8 78 c1 ff ff       	call   2390 <exit@plt>
+    6218:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    621f:	00 
+            GpioInjectState(journal_next.port, journal_next.bit, journal_next.state);
+    6220:	0f b6 15 a4 c7 05 00 	movzbl 0x5c7a4(%rip),%edx        # 629cb <journal_next+0xb>
+    6227:	0f b6 35 9c c7 05 00 	movzbl 0x5c79c(%rip),%esi        # 629ca <journal_next+0xa>
+    622e:	0f b6 3d 94 c7 05 00 	movzbl 0x5c794(%rip),%edi        # 629c9 <journal_next+0x9>
+    6235:	e8 86 ee ff ff       	call   50c0 <GpioInjectState>
+        journal_pending = JournalRead();
+    623a:	e8 01 cf ff ff       	call   3140 <JournalRead>
+    623f:	88 05 43 87 05 00    	mov    %al,0x58743(%rip)        # 5e988 <journal_pending>
+        if (!journal_pending) {
+    6245:	84 c0                	test   %al,%al
+    6247:	0f 85 86 fe ff ff    	jne    60d3 <JournalDeliver+0x53>
+            fprintf(stderr, "journal: replay finished at %llu us\n",
+    624d:	48 8b 05 8c 4d 00 00 	mov    0x4d8c(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    6254:	48 8b 15 a5 c7 06 00 	mov    0x6c7a5(%rip),%rdx        # 72a00 <journal_last>
+    625b:	48 8d 35 4e 23 00 00 	lea    0x234e(%rip),%rsi        # 85b0 <_IO_stdin_used+0x5b0>
+    6262:	48 8b 38             	mov    (%rax),%rdi
+    6265:	31 c0                	xor    %eax,%eax
+    6267:	e8 a4 bf ff ff       	call   2210 <fprintf@plt>
+    while (journal_pending && (journal_next.time < until)) {
+    626c:	80 3d 15 87 05 00 00 	cmpb   $0x0,0x58715(%rip)        # 5e988 <journal_pending>
+    6273:	0f 85 5a fe ff ff    	jne    60d3 <JournalDeliver+0x53>
+}
+    6279:	48 83 c4 18          	add    $0x18,%rsp
+    627d:	5b                   	pop    %rbx
+    627e:	5d                   	pop    %rbp
+    627f:	41 5c                	pop    %r12
+    6281:	41 5d                	pop    %r13
+    6283:	41 5e                	pop    %r14
+    6285:	41 5f                	pop    %r15
+    6287:	c3                   	ret
+    6288:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    628f:	00 
+            SciInjectEvent(journal_next.port);
+    6290:	0f b6 3d 32 c7 05 00 	movzbl 0x5c732(%rip),%edi        # 629c9 <journal_next+0x9>
+    6297:	40 80 ff 03          	cmp    $0x3,%dil
+    629b:	0f 87 1f fe ff ff    	ja     60c0 <JournalDeliver+0x40>
+    62a1:	e8 4a f9 ff ff       	call   5bf0 <SciInjectEvent.part.0>
+    62a6:	e9 15 fe ff ff       	jmp    60c0 <JournalDeliver+0x40>
+    62ab:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000062b0 <ReplayThread>:
+static void * ReplayThread(void * _) {
+    62b0:	41 57                	push   %r15
+    62b2:	41 56                	push   %r14
+    62b4:	41 55                	push   %r13
+    62b6:	41 54                	push   %r12
+    62b8:	55                   	push   %rbp
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    62b9:	48 bd cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rbp
+    62c0:	9b c4 20 
+static void * ReplayThread(void * _) {
+    62c3:	53                   	push   %rbx
+    62c4:	48 8d 1d 55 c7 06 00 	lea    0x6c755(%rip),%rbx        # 72a20 <journal_lock>
+    62cb:	48 83 ec 18          	sub    $0x18,%rsp
+    62cf:	49 89 e4             	mov    %rsp,%r12
+    while (waiting) {
+    62d2:	eb 3b                	jmp    630f <ReplayThread+0x5f>
+    62d4:	0f 1f 40 00          	nopl   0x0(%rax)
+        waiting = journal_pending && (journal_next.kind != JOURNAL_TICK) && !journal_ticking;
+    62d8:	80 3d e9 c6 05 00 03 	cmpb   $0x3,0x5c6e9(%rip)        # 629c8 <journal_next+0x8>
+    62df:	0f 84 83 00 00 00    	je     6368 <ReplayThread+0xb8>
+    62e5:	0f b6 05 0c c7 06 00 	movzbl 0x6c70c(%rip),%eax        # 729f8 <journal_ticking>
+    62ec:	84 c0                	test   %al,%al
+    62ee:	75 78                	jne    6368 <ReplayThread+0xb8>
+        now = journal_next.time > now ? journal_next.time - now : 0;
+    62f0:	48 8b 05 c9 c6 05 00 	mov    0x5c6c9(%rip),%rax        # 629c0 <journal_next>
+    62f7:	49 39 c7             	cmp    %rax,%r15
+    62fa:	0f 82 88 00 00 00    	jb     6388 <ReplayThread+0xd8>
+        pthread_mutex_unlock(&journal_lock);
+    6300:	48 89 df             	mov    %rbx,%rdi
+    6303:	e8 58 bf ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    6308:	31 ff                	xor    %edi,%edi
+            usleep(now < 1000 ? now : 1000);
+    630a:	e8 21 c1 ff ff       	call   2430 <usleep@plt>
+        pthread_mutex_lock(&journal_lock);
+    630f:	48 89 df             	mov    %rbx,%rdi
+    6312:	e8 09 c1 ff ff       	call   2420 <pthread_mutex_lock@plt>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    6317:	4c 89 e6             	mov    %r12,%rsi
+    631a:	bf 01 00 00 00       	mov    $0x1,%edi
+    631f:	e8 ac bd ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6324:	48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    6329:	4c 69 2c 24 40 42 0f 	imul   $0xf4240,(%rsp),%r13
+    6330:	00 
+    6331:	4c 8b 35 a0 c6 06 00 	mov    0x6c6a0(%rip),%r14        # 729d8 <journal_start>
+    6338:	48 89 c8             	mov    %rcx,%rax
+    633b:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    633f:	48 f7 ed             	imul   %rbp
+    6342:	48 c1 fa 07          	sar    $0x7,%rdx
+    6346:	48 29 ca             	sub    %rcx,%rdx
+    6349:	49 01 d5             	add    %rdx,%r13
+    634c:	4d 89 ef             	mov    %r13,%r15
+    634f:	4d 29 f7             	sub    %r14,%r15
+        JournalDeliver(now + 1);
+    6352:	49 8d 7f 01          	lea    0x1(%r15),%rdi
+    6356:	e8 25 fd ff ff       	call   6080 <JournalDeliver>
+        waiting = journal_pending && (journal_next.kind != JOURNAL_TICK) && !journal_ticking;
+    635b:	80 3d 26 86 05 00 00 	cmpb   $0x0,0x58626(%rip)        # 5e988 <journal_pending>
+    6362:	0f 85 70 ff ff ff    	jne    62d8 <ReplayThread+0x28>
+        pthread_mutex_unlock(&journal_lock);
+    6368:	48 89 df             	mov    %rbx,%rdi
+    636b:	e8 f0 be ff ff       	call   2260 <pthread_mutex_unlock@plt>
+}
+    6370:	48 83 c4 18          	add    $0x18,%rsp
+    6374:	31 c0                	xor    %eax,%eax
+    6376:	5b                   	pop    %rbx
+    6377:	5d                   	pop    %rbp
+    6378:	41 5c                	pop    %r12
+    637a:	41 5d                	pop    %r13
+    637c:	41 5e                	pop    %r14
+    637e:	41 5f                	pop    %r15
+    6380:	c3                   	ret
+    6381:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        now = journal_next.time > now ? journal_next.time - now : 0;
+    6388:	49 8d 3c 06          	lea    (%r14,%rax,1),%rdi
+    638c:	4c 29 ef             	sub    %r13,%rdi
+    638f:	49 89 fe             	mov    %rdi,%r14
+        pthread_mutex_unlock(&journal_lock);
+    6392:	48 89 df             	mov    %rbx,%rdi
+    6395:	e8 c6 be ff ff       	call   2260 <pthread_mutex_unlock@plt>
+            usleep(now < 1000 ? now : 1000);
+    639a:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+    639f:	49 39 c6             	cmp    %rax,%r14
+    63a2:	49 0f 46 c6          	cmovbe %r14,%rax
+    63a6:	48 89 c7             	mov    %rax,%rdi
+    63a9:	e9 5c ff ff ff       	jmp    630a <ReplayThread+0x5a>
+    63ae:	66 90                	xchg   %ax,%ax
+
+00000000000063b0 <TimerThread>:
+static void * TimerThread(void * _) {
+    63b0:	41 57                	push   %r15
+    63b2:	4c 8d 3d c7 c3 04 00 	lea    0x4c3c7(%rip),%r15        # 52780 <fault_tick>
+    63b9:	41 56                	push   %r14
+    63bb:	41 55                	push   %r13
+    63bd:	49 bd cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%r13
+    63c4:	9b c4 20 
+    63c7:	41 54                	push   %r12
+    63c9:	55                   	push   %rbp
+    63ca:	53                   	push   %rbx
+    63cb:	48 83 ec 38          	sub    $0x38,%rsp
+    63cf:	4c 8d 64 24 20       	lea    0x20(%rsp),%r12
+    63d4:	0f 1f 40 00          	nopl   0x0(%rax)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    63d8:	4c 89 e6             	mov    %r12,%rsi
+    63db:	bf 01 00 00 00       	mov    $0x1,%edi
+    63e0:	e8 eb bc ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    63e5:	48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+    63ea:	69 4c 24 20 40 42 0f 	imul   $0xf4240,0x20(%rsp),%ecx
+    63f1:	00 
+    pthread_once(&journal_once, JournalOpen);
+    63f2:	48 8d 3d 57 c6 06 00 	lea    0x6c657(%rip),%rdi        # 72a50 <journal_once>
+        instance->wakeup = CyclesRead() + instance->period;
+    63f9:	8b 1d 79 c6 06 00    	mov    0x6c679(%rip),%ebx        # 72a78 <instance+0x18>
+    63ff:	48 89 f0             	mov    %rsi,%rax
+    6402:	48 c1 fe 3f          	sar    $0x3f,%rsi
+    6406:	49 f7 ed             	imul   %r13
+    6409:	48 c1 fa 07          	sar    $0x7,%rdx
+    640d:	48 29 f2             	sub    %rsi,%rdx
+    6410:	48 8d 35 49 ce ff ff 	lea    -0x31b7(%rip),%rsi        # 3260 <JournalOpen>
+    6417:	01 d1                	add    %edx,%ecx
+    6419:	01 d9                	add    %ebx,%ecx
+    641b:	89 0d 5b c6 06 00    	mov    %ecx,0x6c65b(%rip)        # 72a7c <instance+0x1c>
+    6421:	e8 ca bf ff ff       	call   23f0 <pthread_once@plt>
+
+bool JournalTick(uint32_t period) {
+    bool result = false;
+
+    JournalStart();
+    pthread_mutex_lock(&journal_lock);
+    6426:	48 8d 3d f3 c5 06 00 	lea    0x6c5f3(%rip),%rdi        # 72a20 <journal_lock>
+    642d:	e8 ee bf ff ff       	call   2420 <pthread_mutex_lock@plt>
+    if (journal_record) {
+    6432:	4c 8b 05 0f c6 06 00 	mov    0x6c60f(%rip),%r8        # 72a48 <journal_record>
+    6439:	4d 85 c0             	test   %r8,%r8
+    643c:	0f 84 7e 02 00 00    	je     66c0 <TimerThread+0x310>
+        if (!journal_ticking) {
+    6442:	0f b6 05 af c5 06 00 	movzbl 0x6c5af(%rip),%eax        # 729f8 <journal_ticking>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6449:	4c 8b 15 88 c5 06 00 	mov    0x6c588(%rip),%r10        # 729d8 <journal_start>
+        if (now >= tick_period) {
+    6450:	89 dd                	mov    %ebx,%ebp
+        if (!journal_ticking) {
+    6452:	84 c0                	test   %al,%al
+    6454:	0f 84 ee 02 00 00    	je     6748 <TimerThread+0x398>
+            tick_period = period;
+            JournalWriteHeader(JOURNAL_TICK);
+            JournalWriteNumber(period);
+            journal_ticking = true;
+        } else {
+            tick_time += period;
+    645a:	48 01 2d 7f c5 06 00 	add    %rbp,0x6c57f(%rip)        # 729e0 <tick_time>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    6461:	4c 89 e6             	mov    %r12,%rsi
+    6464:	bf 01 00 00 00       	mov    $0x1,%edi
+    6469:	e8 62 bc ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    646e:	48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+    6473:	48 69 4c 24 20 40 42 	imul   $0xf4240,0x20(%rsp),%rcx
+    647a:	0f 00 
+        }
+        tick_time += period;
+        JournalDeliver(tick_time);
+        result = true;
+    }
+    pthread_mutex_unlock(&journal_lock);
+    647c:	48 8d 3d 9d c5 06 00 	lea    0x6c59d(%rip),%rdi        # 72a20 <journal_lock>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6483:	48 89 f0             	mov    %rsi,%rax
+    6486:	48 c1 fe 3f          	sar    $0x3f,%rsi
+    648a:	49 f7 ed             	imul   %r13
+    648d:	48 c1 fa 07          	sar    $0x7,%rdx
+    6491:	48 29 f2             	sub    %rsi,%rdx
+    6494:	48 01 d1             	add    %rdx,%rcx
+    6497:	48 2b 0d 3a c5 06 00 	sub    0x6c53a(%rip),%rcx        # 729d8 <journal_start>
+        tick_wall = JournalClock();
+    649e:	48 89 0d 4b c5 06 00 	mov    %rcx,0x6c54b(%rip)        # 729f0 <tick_wall>
+    pthread_mutex_unlock(&journal_lock);
+    64a5:	e8 b6 bd ff ff       	call   2260 <pthread_mutex_unlock@plt>
+            usleep(instance->period);
+    64aa:	8b 3d c8 c5 06 00    	mov    0x6c5c8(%rip),%edi        # 72a78 <instance+0x18>
+    64b0:	e8 7b bf ff ff       	call   2430 <usleep@plt>
+    pthread_once(&fault_once, FaultOpen);
+    64b5:	48 8d 35 74 f4 ff ff 	lea    -0xb8c(%rip),%rsi        # 5930 <FaultOpen>
+    64bc:	48 8d 3d e5 c2 04 00 	lea    0x4c2e5(%rip),%rdi        # 527a8 <fault_once>
+    64c3:	e8 28 bf ff ff       	call   23f0 <pthread_once@plt>
+}
+
+bool FaultTick(uint32_t * delay) {
+    FaultStart();
+    *delay = 0;
+    if (FaultHappens(&fault_tick.random, fault_tick.miss)) {
+    64c8:	48 8b 15 c9 c2 04 00 	mov    0x4c2c9(%rip),%rdx        # 52798 <fault_tick+0x18>
+    return threshold && (FaultRandom(state) < threshold);
+    64cf:	48 85 d2             	test   %rdx,%rdx
+    64d2:	74 4c                	je     6520 <TimerThread+0x170>
+    return *state * 0x2545F4914F6CDD1DULL;
+    64d4:	48 bb 1d dd 6c 4f 91 	movabs $0x2545f4914f6cdd1d,%rbx
+    64db:	f4 45 25 
+    *state ^= *state >> 12;
+    64de:	49 8b 0f             	mov    (%r15),%rcx
+    64e1:	48 89 c8             	mov    %rcx,%rax
+    64e4:	48 c1 e8 0c          	shr    $0xc,%rax
+    64e8:	48 31 c8             	xor    %rcx,%rax
+    *state ^= *state << 25;
+    64eb:	48 89 c1             	mov    %rax,%rcx
+    64ee:	48 c1 e1 19          	shl    $0x19,%rcx
+    64f2:	48 31 c1             	xor    %rax,%rcx
+    *state ^= *state >> 27;
+    64f5:	48 89 c8             	mov    %rcx,%rax
+    64f8:	48 c1 e8 1b          	shr    $0x1b,%rax
+    64fc:	48 31 c8             	xor    %rcx,%rax
+    64ff:	49 89 07             	mov    %rax,(%r15)
+    return *state * 0x2545F4914F6CDD1DULL;
+    6502:	48 0f af c3          	imul   %rbx,%rax
+    return threshold && (FaultRandom(state) < threshold);
+    6506:	48 39 d0             	cmp    %rdx,%rax
+    6509:	73 15                	jae    6520 <TimerThread+0x170>
+        fault_tick.misses++;
+    650b:	83 05 92 c2 04 00 01 	addl   $0x1,0x4c292(%rip)        # 527a4 <fault_tick+0x24>
+        return false;
+    6512:	e9 c1 fe ff ff       	jmp    63d8 <TimerThread+0x28>
+    6517:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    651e:	00 00 
+    }
+    if (FaultHappens(&fault_tick.random, fault_tick.delay)) {
+    6520:	48 8b 05 61 c2 04 00 	mov    0x4c261(%rip),%rax        # 52788 <fault_tick+0x8>
+    return threshold && (FaultRandom(state) < threshold);
+    6527:	48 85 c0             	test   %rax,%rax
+    652a:	74 4d                	je     6579 <TimerThread+0x1c9>
+    return *state * 0x2545F4914F6CDD1DULL;
+    652c:	48 bb 1d dd 6c 4f 91 	movabs $0x2545f4914f6cdd1d,%rbx
+    6533:	f4 45 25 
+    *state ^= *state >> 12;
+    6536:	49 8b 0f             	mov    (%r15),%rcx
+    6539:	48 89 ca             	mov    %rcx,%rdx
+    653c:	48 c1 ea 0c          	shr    $0xc,%rdx
+    6540:	48 31 ca             	xor    %rcx,%rdx
+    *state ^= *state << 25;
+    6543:	48 89 d1             	mov    %rdx,%rcx
+    6546:	48 c1 e1 19          	shl    $0x19,%rcx
+    654a:	48 31 d1             	xor    %rdx,%rcx
+    *state ^= *state >> 27;
+    654d:	48 89 ca             	mov    %rcx,%rdx
+    6550:	48 c1 ea 1b          	shr    $0x1b,%rdx
+    6554:	48 31 ca             	xor    %rcx,%rdx
+    6557:	49 89 17             	mov    %rdx,(%r15)
+    return *state * 0x2545F4914F6CDD1DULL;
+    655a:	48 0f af d3          	imul   %rbx,%rdx
+    return threshold && (FaultRandom(state) < threshold);
+    655e:	48 39 c2             	cmp    %rax,%rdx
+    6561:	73 16                	jae    6579 <TimerThread+0x1c9>
+        fault_tick.delays++;
+        *delay = fault_tick.time;
+    6563:	8b 3d 27 c2 04 00    	mov    0x4c227(%rip),%edi        # 52790 <fault_tick+0x10>
+        fault_tick.delays++;
+    6569:	83 05 30 c2 04 00 01 	addl   $0x1,0x4c230(%rip)        # 527a0 <fault_tick+0x20>
+        if (delay) {
+    6570:	85 ff                	test   %edi,%edi
+    6572:	74 05                	je     6579 <TimerThread+0x1c9>
+            usleep(delay);
+    6574:	e8 b7 be ff ff       	call   2430 <usleep@plt>
+    6579:	0f b6 05 05 c5 06 00 	movzbl 0x6c505(%rip),%eax        # 72a85 <trace_enabled>
+    6580:	84 c0                	test   %al,%al
+    6582:	0f 85 80 03 00 00    	jne    6908 <TimerThread+0x558>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    6588:	4c 89 e6             	mov    %r12,%rsi
+    658b:	bf 01 00 00 00       	mov    $0x1,%edi
+    6590:	e8 3b bb ff ff       	call   20d0 <clock_gettime@plt>
+    latency_vector_t vector = LatencyFind(source);
+    6595:	31 ff                	xor    %edi,%edi
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    6597:	4c 8b 4c 24 20       	mov    0x20(%rsp),%r9
+    659c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+    65a1:	e8 ba c2 ff ff       	call   2860 <LatencyFind>
+    65a6:	48 89 c1             	mov    %rax,%rcx
+    if (vector) {
+    65a9:	48 85 c0             	test   %rax,%rax
+    65ac:	74 22                	je     65d0 <TimerThread+0x220>
+    65ae:	4c 89 d0             	mov    %r10,%rax
+    65b1:	45 69 c9 40 42 0f 00 	imul   $0xf4240,%r9d,%r9d
+    65b8:	49 c1 fa 3f          	sar    $0x3f,%r10
+    65bc:	49 f7 ed             	imul   %r13
+    65bf:	48 c1 fa 07          	sar    $0x7,%rdx
+    65c3:	4c 29 d2             	sub    %r10,%rdx
+    65c6:	41 01 d1             	add    %edx,%r9d
+    65c9:	44 89 89 bc 00 00 00 	mov    %r9d,0xbc(%rcx)
+    latency_vector_t vector = LatencyFind(source);
+    65d0:	31 ff                	xor    %edi,%edi
+        HAL_HOOK_IRQ_EVENT(HAL_HOOK_TICK, instance->wakeup);
+    65d2:	44 8b 0d a3 c4 06 00 	mov    0x6c4a3(%rip),%r9d        # 72a7c <instance+0x1c>
+    65d9:	e8 82 c2 ff ff       	call   2860 <LatencyFind>
+    if (vector) {
+    65de:	48 85 c0             	test   %rax,%rax
+    65e1:	74 0e                	je     65f1 <TimerThread+0x241>
+        vector->event = cycles;
+    65e3:	44 89 88 b8 00 00 00 	mov    %r9d,0xb8(%rax)
+        vector->pending = true;
+    65ea:	c6 80 b6 00 00 00 01 	movb   $0x1,0xb6(%rax)
+        if (instance->handler) {
+    65f1:	48 83 3d 6f c4 06 00 	cmpq   $0x0,0x6c46f(%rip)        # 72a68 <instance+0x8>
+    65f8:	00 
+    65f9:	74 14                	je     660f <TimerThread+0x25f>
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_TICK);
+    65fb:	31 ff                	xor    %edi,%edi
+    65fd:	e8 3e e4 ff ff       	call   4a40 <LatencyDispatch>
+            instance->handler(instance->object);
+    6602:	48 8b 3d 67 c4 06 00 	mov    0x6c467(%rip),%rdi        # 72a70 <instance+0x10>
+    6609:	ff 15 59 c4 06 00    	call   *0x6c459(%rip)        # 72a68 <instance+0x8>
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_TICK);
+    660f:	31 ff                	xor    %edi,%edi
+    6611:	e8 0a e5 ff ff       	call   4b20 <LatencyExit>
+    6616:	0f b6 05 68 c4 06 00 	movzbl 0x6c468(%rip),%eax        # 72a85 <trace_enabled>
+    661d:	84 c0                	test   %al,%al
+    661f:	0f 84 b3 fd ff ff    	je     63d8 <TimerThread+0x28>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    6625:	4c 89 e6             	mov    %r12,%rsi
+    6628:	bf 01 00 00 00       	mov    $0x1,%edi
+    662d:	e8 9e ba ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    6632:	48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    6637:	69 74 24 20 40 42 0f 	imul   $0xf4240,0x20(%rsp),%esi
+    663e:	00 
+    663f:	48 89 c8             	mov    %rcx,%rax
+    6642:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    6646:	49 f7 ed             	imul   %r13
+    if (!FifoReserve(&self->head, &self->tail, self->mask + 1, count, first)) {
+    6649:	8b 05 b9 4e 00 00    	mov    0x4eb9(%rip),%eax        # b508 <trace_queue+0x8>
+    664f:	48 c1 fa 07          	sar    $0x7,%rdx
+    6653:	48 29 ca             	sub    %rcx,%rdx
+    6656:	01 d6                	add    %edx,%esi
+    6658:	8d 50 01             	lea    0x1(%rax),%edx
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    665b:	8b 05 df 4e 00 00    	mov    0x4edf(%rip),%eax        # b540 <trace_queue+0x40>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    6661:	44 8b 05 18 4f 00 00 	mov    0x4f18(%rip),%r8d        # b580 <trace_queue+0x80>
+        if (index + count - FifoLoad(tail) > capacity) {
+    6668:	8d 48 02             	lea    0x2(%rax),%ecx
+    666b:	89 cf                	mov    %ecx,%edi
+    666d:	44 29 c7             	sub    %r8d,%edi
+    6670:	39 fa                	cmp    %edi,%edx
+    6672:	0f 82 5a 03 00 00    	jb     69d2 <TimerThread+0x622>
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+    6678:	f0 0f b1 0d c0 4e 00 	lock cmpxchg %ecx,0x4ec0(%rip)        # b540 <trace_queue+0x40>
+    667f:	00 
+    6680:	75 df                	jne    6661 <TimerThread+0x2b1>
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    6682:	48 8d 1d 77 4e 00 00 	lea    0x4e77(%rip),%rbx        # b500 <trace_queue>
+    6689:	89 c1                	mov    %eax,%ecx
+    668b:	23 0d 77 4e 00 00    	and    0x4e77(%rip),%ecx        # b508 <trace_queue+0x8>
+    6691:	48 8b 13             	mov    (%rbx),%rdx
+    6694:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+        FifoStore(&cell->sequence, *first + index + 1);
+    6698:	8d 50 01             	lea    0x1(%rax),%edx
+    669b:	83 c0 02             	add    $0x2,%eax
+        cell->value = values[index];
+    669e:	89 71 04             	mov    %esi,0x4(%rcx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    66a1:	89 11                	mov    %edx,(%rcx)
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    66a3:	48 8b 0b             	mov    (%rbx),%rcx
+    66a6:	23 15 5c 4e 00 00    	and    0x4e5c(%rip),%edx        # b508 <trace_queue+0x8>
+    66ac:	48 8d 14 d1          	lea    (%rcx,%rdx,8),%rdx
+        cell->value = values[index];
+    66b0:	c7 42 04 00 00 00 11 	movl   $0x11000000,0x4(%rdx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    66b7:	89 02                	mov    %eax,(%rdx)
+    66b9:	e9 1a fd ff ff       	jmp    63d8 <TimerThread+0x28>
+    66be:	66 90                	xchg   %ax,%ax
+    } else if (journal_replay && journal_pending) {
+    66c0:	48 83 3d 08 c3 06 00 	cmpq   $0x0,0x6c308(%rip)        # 729d0 <journal_replay>
+    66c7:	00 
+    66c8:	0f 84 22 02 00 00    	je     68f0 <TimerThread+0x540>
+    66ce:	80 3d b3 82 05 00 00 	cmpb   $0x0,0x582b3(%rip)        # 5e988 <journal_pending>
+    66d5:	0f 84 15 02 00 00    	je     68f0 <TimerThread+0x540>
+        if (!journal_ticking) {
+    66db:	0f b6 05 16 c3 06 00 	movzbl 0x6c316(%rip),%eax        # 729f8 <journal_ticking>
+    66e2:	84 c0                	test   %al,%al
+    66e4:	0f 84 be 02 00 00    	je     69a8 <TimerThread+0x5f8>
+        tick_time += period;
+    66ea:	89 df                	mov    %ebx,%edi
+    66ec:	48 03 3d ed c2 06 00 	add    0x6c2ed(%rip),%rdi        # 729e0 <tick_time>
+    66f3:	48 89 3d e6 c2 06 00 	mov    %rdi,0x6c2e6(%rip)        # 729e0 <tick_time>
+        JournalDeliver(tick_time);
+    66fa:	e8 81 f9 ff ff       	call   6080 <JournalDeliver>
+    pthread_mutex_unlock(&journal_lock);
+    66ff:	48 8d 3d 1a c3 06 00 	lea    0x6c31a(%rip),%rdi        # 72a20 <journal_lock>
+    6706:	e8 55 bb ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    670b:	4c 89 e6             	mov    %r12,%rsi
+    670e:	bf 01 00 00 00       	mov    $0x1,%edi
+    6713:	e8 b8 b9 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    6718:	48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    671d:	69 74 24 20 40 42 0f 	imul   $0xf4240,0x20(%rsp),%esi
+    6724:	00 
+    6725:	48 89 c8             	mov    %rcx,%rax
+    6728:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    672c:	49 f7 ed             	imul   %r13
+    672f:	48 c1 fa 07          	sar    $0x7,%rdx
+    6733:	48 29 ca             	sub    %rcx,%rdx
+    6736:	01 d6                	add    %edx,%esi
+            instance->wakeup = CyclesRead();
+    6738:	89 35 3e c3 06 00    	mov    %esi,0x6c33e(%rip)        # 72a7c <instance+0x1c>
+    673e:	e9 72 fd ff ff       	jmp    64b5 <TimerThread+0x105>
+    6743:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    6748:	4c 89 e6             	mov    %r12,%rsi
+    674b:	bf 01 00 00 00       	mov    $0x1,%edi
+    6750:	4c 89 54 24 10       	mov    %r10,0x10(%rsp)
+    6755:	4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    675a:	e8 71 b9 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    675f:	48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    6764:	4c 8b 54 24 10       	mov    0x10(%rsp),%r10
+    6769:	4c 69 74 24 20 40 42 	imul   $0xf4240,0x20(%rsp),%r14
+    6770:	0f 00 
+    if (journal_ticking) {
+    6772:	4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6777:	48 89 c8             	mov    %rcx,%rax
+    677a:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    677e:	49 f7 ed             	imul   %r13
+    if (journal_ticking) {
+    6781:	0f b6 05 70 c2 06 00 	movzbl 0x6c270(%rip),%eax        # 729f8 <journal_ticking>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6788:	48 c1 fa 07          	sar    $0x7,%rdx
+    678c:	48 29 ca             	sub    %rcx,%rdx
+    678f:	49 01 d6             	add    %rdx,%r14
+    6792:	4d 29 d6             	sub    %r10,%r14
+    if (journal_ticking) {
+    6795:	84 c0                	test   %al,%al
+    6797:	74 21                	je     67ba <TimerThread+0x40a>
+        if (now >= tick_period) {
+    6799:	8b 15 49 c2 06 00    	mov    0x6c249(%rip),%edx        # 729e8 <tick_period>
+        now = now - tick_wall;
+    679f:	4c 2b 35 4a c2 06 00 	sub    0x6c24a(%rip),%r14        # 729f0 <tick_wall>
+        if (now >= tick_period) {
+    67a6:	48 89 d0             	mov    %rdx,%rax
+            now = tick_period - 1;
+    67a9:	83 e8 01             	sub    $0x1,%eax
+    67ac:	49 39 d6             	cmp    %rdx,%r14
+    67af:	4c 0f 43 f0          	cmovae %rax,%r14
+        now = tick_time + now;
+    67b3:	4c 03 35 26 c2 06 00 	add    0x6c226(%rip),%r14        # 729e0 <tick_time>
+    if (now < journal_last) {
+    67ba:	4c 8b 0d 3f c2 06 00 	mov    0x6c23f(%rip),%r9        # 72a00 <journal_last>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    67c1:	4c 89 e6             	mov    %r12,%rsi
+    67c4:	bf 01 00 00 00       	mov    $0x1,%edi
+    67c9:	4c 89 54 24 18       	mov    %r10,0x18(%rsp)
+    67ce:	4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    if (now < journal_last) {
+    67d3:	4d 39 f1             	cmp    %r14,%r9
+    67d6:	4c 89 4c 24 08       	mov    %r9,0x8(%rsp)
+    67db:	4d 0f 43 f1          	cmovae %r9,%r14
+            tick_period = period;
+    67df:	89 1d 03 c2 06 00    	mov    %ebx,0x6c203(%rip)        # 729e8 <tick_period>
+            tick_time = JournalNow();
+    67e5:	4c 89 35 f4 c1 06 00 	mov    %r14,0x6c1f4(%rip)        # 729e0 <tick_time>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    67ec:	e8 df b8 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    67f1:	48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+    67f6:	4c 8b 54 24 18       	mov    0x18(%rsp),%r10
+    67fb:	48 69 4c 24 20 40 42 	imul   $0xf4240,0x20(%rsp),%rcx
+    6802:	0f 00 
+    if (journal_ticking) {
+    6804:	4c 8b 4c 24 08       	mov    0x8(%rsp),%r9
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6809:	48 89 f0             	mov    %rsi,%rax
+    680c:	48 c1 fe 3f          	sar    $0x3f,%rsi
+    if (journal_ticking) {
+    6810:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    6815:	49 f7 ed             	imul   %r13
+    6818:	48 c1 fa 07          	sar    $0x7,%rdx
+    681c:	48 29 f2             	sub    %rsi,%rdx
+    681f:	48 8d 04 11          	lea    (%rcx,%rdx,1),%rax
+    if (journal_ticking) {
+    6823:	0f b6 15 ce c1 06 00 	movzbl 0x6c1ce(%rip),%edx        # 729f8 <journal_ticking>
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+    682a:	4c 29 d0             	sub    %r10,%rax
+    if (journal_ticking) {
+    682d:	84 d2                	test   %dl,%dl
+    682f:	74 14                	je     6845 <TimerThread+0x495>
+        now = now - tick_wall;
+    6831:	48 2b 05 b8 c1 06 00 	sub    0x6c1b8(%rip),%rax        # 729f0 <tick_wall>
+            now = tick_period - 1;
+    6838:	8d 53 ff             	lea    -0x1(%rbx),%edx
+    683b:	48 39 e8             	cmp    %rbp,%rax
+    683e:	48 0f 43 c2          	cmovae %rdx,%rax
+        now = tick_time + now;
+    6842:	4c 01 f0             	add    %r14,%rax
+    if (now < journal_last) {
+    6845:	49 39 c1             	cmp    %rax,%r9
+    putc(kind, journal_record);
+    6848:	4c 89 c6             	mov    %r8,%rsi
+    684b:	bf 03 00 00 00       	mov    $0x3,%edi
+    6850:	49 0f 43 c1          	cmovae %r9,%rax
+    6854:	49 89 c6             	mov    %rax,%r14
+    6857:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    685c:	e8 8f b9 ff ff       	call   21f0 <putc@plt>
+    JournalWriteNumber(now - journal_last);
+    6861:	4c 2b 35 98 c1 06 00 	sub    0x6c198(%rip),%r14        # 72a00 <journal_last>
+    6868:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    686f:	00 
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    6870:	44 89 f7             	mov    %r14d,%edi
+    6873:	48 8b 35 ce c1 06 00 	mov    0x6c1ce(%rip),%rsi        # 72a48 <journal_record>
+    687a:	83 e7 7f             	and    $0x7f,%edi
+    687d:	49 83 fe 7f          	cmp    $0x7f,%r14
+    6881:	77 5d                	ja     68e0 <TimerThread+0x530>
+    6883:	e8 68 b9 ff ff       	call   21f0 <putc@plt>
+    journal_last = now;
+    6888:	48 8b 44 24 08       	mov    0x8(%rsp),%rax
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    688d:	83 e3 7f             	and    $0x7f,%ebx
+    6890:	48 8b 35 b1 c1 06 00 	mov    0x6c1b1(%rip),%rsi        # 72a48 <journal_record>
+    6897:	89 df                	mov    %ebx,%edi
+    journal_last = now;
+    6899:	48 89 05 60 c1 06 00 	mov    %rax,0x6c160(%rip)        # 72a00 <journal_last>
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    68a0:	48 83 fd 7f          	cmp    $0x7f,%rbp
+    68a4:	76 1f                	jbe    68c5 <TimerThread+0x515>
+    68a6:	40 80 cf 80          	or     $0x80,%dil
+        value = value >> 7;
+    68aa:	48 c1 ed 07          	shr    $0x7,%rbp
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    68ae:	e8 3d b9 ff ff       	call   21f0 <putc@plt>
+    68b3:	89 ef                	mov    %ebp,%edi
+    68b5:	48 8b 35 8c c1 06 00 	mov    0x6c18c(%rip),%rsi        # 72a48 <journal_record>
+    68bc:	83 e7 7f             	and    $0x7f,%edi
+    68bf:	48 83 fd 7f          	cmp    $0x7f,%rbp
+    68c3:	77 e1                	ja     68a6 <TimerThread+0x4f6>
+    68c5:	e8 26 b9 ff ff       	call   21f0 <putc@plt>
+            journal_ticking = true;
+    68ca:	c6 05 27 c1 06 00 01 	movb   $0x1,0x6c127(%rip)        # 729f8 <journal_ticking>
+    68d1:	e9 8b fb ff ff       	jmp    6461 <TimerThread+0xb1>
+    68d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    68dd:	00 00 00 
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    68e0:	40 80 cf 80          	or     $0x80,%dil
+        value = value >> 7;
+    68e4:	49 c1 ee 07          	shr    $0x7,%r14
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+    68e8:	e8 03 b9 ff ff       	call   21f0 <putc@plt>
+    68ed:	eb 81                	jmp    6870 <TimerThread+0x4c0>
+    68ef:	90                   	nop
+    pthread_mutex_unlock(&journal_lock);
+    68f0:	48 8d 3d 29 c1 06 00 	lea    0x6c129(%rip),%rdi        # 72a20 <journal_lock>
+    68f7:	e8 64 b9 ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    return result;
+    68fc:	e9 a9 fb ff ff       	jmp    64aa <TimerThread+0xfa>
+    6901:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    6908:	4c 89 e6             	mov    %r12,%rsi
+    690b:	bf 01 00 00 00       	mov    $0x1,%edi
+    6910:	e8 bb b7 ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+    6915:	48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    691a:	69 74 24 20 40 42 0f 	imul   $0xf4240,0x20(%rsp),%esi
+    6921:	00 
+    6922:	48 89 c8             	mov    %rcx,%rax
+    6925:	48 c1 f9 3f          	sar    $0x3f,%rcx
+    6929:	49 f7 ed             	imul   %r13
+    if (!FifoReserve(&self->head, &self->tail, self->mask + 1, count, first)) {
+    692c:	8b 05 d6 4b 00 00    	mov    0x4bd6(%rip),%eax        # b508 <trace_queue+0x8>
+    6932:	48 c1 fa 07          	sar    $0x7,%rdx
+    6936:	48 29 ca             	sub    %rcx,%rdx
+    6939:	01 d6                	add    %edx,%esi
+    693b:	8d 50 01             	lea    0x1(%rax),%edx
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    693e:	8b 05 fc 4b 00 00    	mov    0x4bfc(%rip),%eax        # b540 <trace_queue+0x40>
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+    6944:	44 8b 05 35 4c 00 00 	mov    0x4c35(%rip),%r8d        # b580 <trace_queue+0x80>
+        if (index + count - FifoLoad(tail) > capacity) {
+    694b:	8d 48 02             	lea    0x2(%rax),%ecx
+    694e:	89 cf                	mov    %ecx,%edi
+    6950:	44 29 c7             	sub    %r8d,%edi
+    6953:	39 fa                	cmp    %edi,%edx
+    6955:	0f 82 84 00 00 00    	jb     69df <TimerThread+0x62f>
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+    695b:	f0 0f b1 0d dd 4b 00 	lock cmpxchg %ecx,0x4bdd(%rip)        # b540 <trace_queue+0x40>
+    6962:	00 
+    6963:	75 df                	jne    6944 <TimerThread+0x594>
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    6965:	48 8d 1d 94 4b 00 00 	lea    0x4b94(%rip),%rbx        # b500 <trace_queue>
+    696c:	89 c1                	mov    %eax,%ecx
+    696e:	23 0d 94 4b 00 00    	and    0x4b94(%rip),%ecx        # b508 <trace_queue+0x8>
+    6974:	48 8b 13             	mov    (%rbx),%rdx
+    6977:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+        FifoStore(&cell->sequence, *first + index + 1);
+    697b:	8d 50 01             	lea    0x1(%rax),%edx
+    697e:	83 c0 02             	add    $0x2,%eax
+        cell->value = values[index];
+    6981:	89 71 04             	mov    %esi,0x4(%rcx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    6984:	89 11                	mov    %edx,(%rcx)
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+    6986:	48 8b 0b             	mov    (%rbx),%rcx
+    6989:	23 15 79 4b 00 00    	and    0x4b79(%rip),%edx        # b508 <trace_queue+0x8>
+    698f:	48 8d 14 d1          	lea    (%rcx,%rdx,8),%rdx
+        cell->value = values[index];
+    6993:	c7 42 04 00 00 00 10 	movl   $0x10000000,0x4(%rdx)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+    699a:	89 02                	mov    %eax,(%rdx)
+    699c:	e9 e7 fb ff ff       	jmp    6588 <TimerThread+0x1d8>
+    69a1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            JournalDeliver(UINT64_MAX);
+    69a8:	48 c7 c7 ff ff ff ff 	mov    $0xffffffffffffffff,%rdi
+    69af:	e8 cc f6 ff ff       	call   6080 <JournalDeliver>
+            if (journal_pending && (journal_next.kind == JOURNAL_TICK)) {
+    69b4:	80 3d cd 7f 05 00 00 	cmpb   $0x0,0x57fcd(%rip)        # 5e988 <journal_pending>
+    69bb:	74 09                	je     69c6 <TimerThread+0x616>
+    69bd:	80 3d 04 c0 05 00 03 	cmpb   $0x3,0x5c004(%rip)        # 629c8 <journal_next+0x8>
+    69c4:	74 26                	je     69ec <TimerThread+0x63c>
+            journal_ticking = true;
+    69c6:	c6 05 2b c0 06 00 01 	movb   $0x1,0x6c02b(%rip)        # 729f8 <journal_ticking>
+    69cd:	e9 18 fd ff ff       	jmp    66ea <TimerThread+0x33a>
+    return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+    69d2:	f0 83 05 6a 4b 00 00 	lock addl $0x2,0x4b6a(%rip)        # b544 <trace_queue+0x44>
+    69d9:	02 
+        return false;
+    69da:	e9 f9 f9 ff ff       	jmp    63d8 <TimerThread+0x28>
+    return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+    69df:	f0 83 05 5d 4b 00 00 	lock addl $0x2,0x4b5d(%rip)        # b544 <trace_queue+0x44>
+    69e6:	02 
+        return false;
+    69e7:	e9 9c fb ff ff       	jmp    6588 <TimerThread+0x1d8>
+                tick_time = journal_next.time;
+    69ec:	48 8d 05 cd bf 05 00 	lea    0x5bfcd(%rip),%rax        # 629c0 <journal_next>
+    69f3:	48 8b 00             	mov    (%rax),%rax
+    69f6:	48 89 05 e3 bf 06 00 	mov    %rax,0x6bfe3(%rip)        # 729e0 <tick_time>
+                journal_pending = JournalRead();
+    69fd:	e8 3e c7 ff ff       	call   3140 <JournalRead>
+    6a02:	88 05 80 7f 05 00    	mov    %al,0x57f80(%rip)        # 5e988 <journal_pending>
+    6a08:	eb bc                	jmp    69c6 <TimerThread+0x616>
+    6a0a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000006a10 <WireThread>:
+static void * WireThread(void * _) {
+    6a10:	41 57                	push   %r15
+    6a12:	4c 8d 3d e7 bc 00 00 	lea    0xbce7(%rip),%r15        # 12700 <gpio_nets>
+    6a19:	41 56                	push   %r14
+    6a1b:	41 55                	push   %r13
+    6a1d:	41 54                	push   %r12
+    6a1f:	4c 8d 25 9a bc 00 00 	lea    0xbc9a(%rip),%r12        # 126c0 <gpio_levels>
+    6a26:	55                   	push   %rbp
+    6a27:	48 8d 2d a2 01 07 00 	lea    0x701a2(%rip),%rbp        # 76bd0 <gpio_outputs>
+    6a2e:	53                   	push   %rbx
+    return (port < SOC_GPIO_PORTS) && (gpio_outputs[port] & GPIO_MASK(bit));
+    6a2f:	bb 01 00 00 00       	mov    $0x1,%ebx
+    6a34:	48 83 ec 18          	sub    $0x18,%rsp
+    6a38:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    6a3f:	00 
+        generation = __atomic_load_n(&bus->generation, __ATOMIC_SEQ_CST);
+    6a40:	48 8b 05 69 01 07 00 	mov    0x70169(%rip),%rax        # 76bb0 <bus>
+        refresh = __atomic_exchange_n(&wire_refresh, false, __ATOMIC_ACQUIRE);
+    6a47:	45 31 f6             	xor    %r14d,%r14d
+        generation = __atomic_load_n(&bus->generation, __ATOMIC_SEQ_CST);
+    6a4a:	8b 00                	mov    (%rax),%eax
+    6a4c:	89 44 24 08          	mov    %eax,0x8(%rsp)
+        refresh = __atomic_exchange_n(&wire_refresh, false, __ATOMIC_ACQUIRE);
+    6a50:	44 86 35 09 48 00 00 	xchg   %r14b,0x4809(%rip)        # b260 <wire_refresh>
+    6a57:	45 31 ed             	xor    %r13d,%r13d
+    6a5a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            if ((gpio_nets[index] != WIRE_NONE) && !GpioIsOutput(port, bit) &&
+    6a60:	43 0f b6 14 2f       	movzbl (%r15,%r13,1),%edx
+    6a65:	80 fa ff             	cmp    $0xff,%dl
+    6a68:	74 56                	je     6ac0 <WireThread+0xb0>
+            uint8_t port = index / SOC_GPIO_BITS;
+    6a6a:	44 89 ef             	mov    %r13d,%edi
+            uint8_t bit = index % SOC_GPIO_BITS;
+    6a6d:	44 89 e9             	mov    %r13d,%ecx
+    6a70:	41 89 d9             	mov    %ebx,%r9d
+            uint8_t port = index / SOC_GPIO_BITS;
+    6a73:	c1 ff 03             	sar    $0x3,%edi
+            uint8_t bit = index % SOC_GPIO_BITS;
+    6a76:	83 e1 07             	and    $0x7,%ecx
+    6a79:	48 63 f7             	movslq %edi,%rsi
+    6a7c:	41 d3 e1             	shl    %cl,%r9d
+    6a7f:	8b 74 b5 00          	mov    0x0(%rbp,%rsi,4),%esi
+    6a83:	41 85 f1             	test   %esi,%r9d
+    6a86:	75 38                	jne    6ac0 <WireThread+0xb0>
+                (refresh || (bus->nets[gpio_nets[index]] != gpio_levels[index]))) {
+    6a88:	48 8b 35 21 01 07 00 	mov    0x70121(%rip),%rsi        # 76bb0 <bus>
+    6a8f:	48 63 d2             	movslq %edx,%rdx
+            if ((gpio_nets[index] != WIRE_NONE) && !GpioIsOutput(port, bit) &&
+    6a92:	45 84 f6             	test   %r14b,%r14b
+    6a95:	75 0c                	jne    6aa3 <WireThread+0x93>
+                (refresh || (bus->nets[gpio_nets[index]] != gpio_levels[index]))) {
+    6a97:	44 0f b6 4c 16 08    	movzbl 0x8(%rsi,%rdx,1),%r9d
+    6a9d:	47 3a 0c 2c          	cmp    (%r12,%r13,1),%r9b
+    6aa1:	74 1d                	je     6ac0 <WireThread+0xb0>
+                gpio_levels[index] = bus->nets[gpio_nets[index]];
+    6aa3:	0f b6 54 16 08       	movzbl 0x8(%rsi,%rdx,1),%edx
+                GpioInjectState(port, bit, gpio_levels[index]);
+    6aa8:	89 ce                	mov    %ecx,%esi
+                gpio_levels[index] = bus->nets[gpio_nets[index]];
+    6aaa:	84 d2                	test   %dl,%dl
+    6aac:	0f 95 c2             	setne  %dl
+    6aaf:	43 88 14 2c          	mov    %dl,(%r12,%r13,1)
+                GpioInjectState(port, bit, gpio_levels[index]);
+    6ab3:	0f b6 d2             	movzbl %dl,%edx
+    6ab6:	e8 05 e6 ff ff       	call   50c0 <GpioInjectState>
+    6abb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        for (int index = 0; index < SOC_GPIO_PORTS * SOC_GPIO_BITS; index++) {
+    6ac0:	49 83 c5 01          	add    $0x1,%r13
+    6ac4:	49 83 fd 20          	cmp    $0x20,%r13
+    6ac8:	75 96                	jne    6a60 <WireThread+0x50>
+    6aca:	4c 8d 35 cf 00 07 00 	lea    0x700cf(%rip),%r14        # 76ba0 <sci_links>
+        for (int port = 0; port < WIRE_SCI_PORTS; port++) {
+    6ad1:	45 31 ed             	xor    %r13d,%r13d
+    pthread_once(&wire_once, WireOpen);
+    6ad4:	48 8d 35 b5 cf ff ff 	lea    -0x304b(%rip),%rsi        # 3a90 <WireOpen>
+    6adb:	48 8d 3d d6 00 07 00 	lea    0x700d6(%rip),%rdi        # 76bb8 <wire_once>
+    6ae2:	e8 09 b9 ff ff       	call   23f0 <pthread_once@plt>
+    return bus && (port < WIRE_SCI_PORTS) && (sci_links[port].transmit != WIRE_NONE);
+    6ae7:	48 8b 05 c2 00 07 00 	mov    0x700c2(%rip),%rax        # 76bb0 <bus>
+    6aee:	48 85 c0             	test   %rax,%rax
+    6af1:	0f 84 85 00 00 00    	je     6b7c <WireThread+0x16c>
+    6af7:	41 0f b6 36          	movzbl (%r14),%esi
+    6afb:	40 80 fe ff          	cmp    $0xff,%sil
+    6aff:	74 7b                	je     6b7c <WireThread+0x16c>
+                bool writable = sci_links[port].blocked && WireSciSpace(port);
+    6b01:	41 80 7e 02 00       	cmpb   $0x0,0x2(%r14)
+    6b06:	74 3c                	je     6b44 <WireThread+0x134>
+    return WIRE_PIPE_SIZE - (pipe->head - __atomic_load_n(&pipe->tail, __ATOMIC_ACQUIRE));
+    6b08:	44 0f b6 c6          	movzbl %sil,%r8d
+    6b0c:	4c 89 c7             	mov    %r8,%rdi
+    6b0f:	4c 89 c6             	mov    %r8,%rsi
+    6b12:	48 c1 e7 09          	shl    $0x9,%rdi
+    6b16:	4c 01 c7             	add    %r8,%rdi
+    6b19:	49 c1 e0 09          	shl    $0x9,%r8
+    6b1d:	48 8d 3c f8          	lea    (%rax,%rdi,8),%rdi
+    6b21:	4c 01 c6             	add    %r8,%rsi
+    6b24:	8b 7f 4c             	mov    0x4c(%rdi),%edi
+    6b27:	48 8d 04 f0          	lea    (%rax,%rsi,8),%rax
+    6b2b:	8b 70 48             	mov    0x48(%rax),%esi
+    6b2e:	89 f8                	mov    %edi,%eax
+    6b30:	29 f0                	sub    %esi,%eax
+                bool writable = sci_links[port].blocked && WireSciSpace(port);
+    6b32:	3d 00 f0 ff ff       	cmp    $0xfffff000,%eax
+    6b37:	0f 85 9b 00 00 00    	jne    6bd8 <WireThread+0x1c8>
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].receive];
+    6b3d:	48 8b 05 6c 00 07 00 	mov    0x7006c(%rip),%rax        # 76bb0 <bus>
+    6b44:	45 0f b6 46 01       	movzbl 0x1(%r14),%r8d
+    return __atomic_load_n(&pipe->head, __ATOMIC_ACQUIRE) - pipe->tail;
+    6b49:	4c 89 c7             	mov    %r8,%rdi
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].receive];
+    6b4c:	4c 89 c6             	mov    %r8,%rsi
+    return __atomic_load_n(&pipe->head, __ATOMIC_ACQUIRE) - pipe->tail;
+    6b4f:	48 c1 e7 09          	shl    $0x9,%rdi
+    6b53:	4c 01 c7             	add    %r8,%rdi
+    6b56:	48 8d 3c f8          	lea    (%rax,%rdi,8),%rdi
+    6b5a:	44 8b 47 48          	mov    0x48(%rdi),%r8d
+    6b5e:	48 89 f7             	mov    %rsi,%rdi
+    6b61:	48 c1 e7 09          	shl    $0x9,%rdi
+    6b65:	48 01 fe             	add    %rdi,%rsi
+    6b68:	48 8d 04 f0          	lea    (%rax,%rsi,8),%rax
+    6b6c:	8b 40 4c             	mov    0x4c(%rax),%eax
+                if (writable || WireSciPending(port)) {
+    6b6f:	41 39 c0             	cmp    %eax,%r8d
+    6b72:	74 08                	je     6b7c <WireThread+0x16c>
+    6b74:	44 89 ef             	mov    %r13d,%edi
+    6b77:	e8 74 f0 ff ff       	call   5bf0 <SciInjectEvent.part.0>
+        for (int port = 0; port < WIRE_SCI_PORTS; port++) {
+    6b7c:	41 83 c5 01          	add    $0x1,%r13d
+    6b80:	49 83 c6 03          	add    $0x3,%r14
+    6b84:	41 83 fd 04          	cmp    $0x4,%r13d
+    6b88:	0f 85 46 ff ff ff    	jne    6ad4 <WireThread+0xc4>
+        __atomic_add_fetch(&bus->waiters, 1, __ATOMIC_SEQ_CST);
+    6b8e:	48 8b 05 1b 00 07 00 	mov    0x7001b(%rip),%rax        # 76bb0 <bus>
+    6b95:	f0 83 40 04 01       	lock addl $0x1,0x4(%rax)
+        syscall(SYS_futex, &bus->generation, FUTEX_WAIT, generation, NULL, NULL, 0);
+    6b9a:	48 8b 35 0f 00 07 00 	mov    0x7000f(%rip),%rsi        # 76bb0 <bus>
+    6ba1:	45 31 c9             	xor    %r9d,%r9d
+    6ba4:	45 31 c0             	xor    %r8d,%r8d
+    6ba7:	31 d2                	xor    %edx,%edx
+    6ba9:	bf ca 00 00 00       	mov    $0xca,%edi
+    6bae:	31 c0                	xor    %eax,%eax
+    6bb0:	48 83 ec 08          	sub    $0x8,%rsp
+    6bb4:	6a 00                	push   $0x0
+    6bb6:	8b 4c 24 18          	mov    0x18(%rsp),%ecx
+    6bba:	48 89 74 24 18       	mov    %rsi,0x18(%rsp)
+    6bbf:	e8 5c b6 ff ff       	call   2220 <syscall@plt>
+        __atomic_sub_fetch(&bus->waiters, 1, __ATOMIC_SEQ_CST);
+    6bc4:	48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    6bc9:	f0 83 6e 04 01       	lock subl $0x1,0x4(%rsi)
+        generation = __atomic_load_n(&bus->generation, __ATOMIC_SEQ_CST);
+    6bce:	58                   	pop    %rax
+    6bcf:	5a                   	pop    %rdx
+    6bd0:	e9 6b fe ff ff       	jmp    6a40 <WireThread+0x30>
+    6bd5:	0f 1f 00             	nopl   (%rax)
+                    sci_links[port].blocked = false;
+    6bd8:	41 c6 46 02 00       	movb   $0x0,0x2(%r14)
+                if (writable || WireSciPending(port)) {
+    6bdd:	eb 95                	jmp    6b74 <WireThread+0x164>
+    6bdf:	90                   	nop
+
+0000000000006be0 <ConsoleThread>:
+static void * ConsoleThread(void * _) {
+    6be0:	41 57                	push   %r15
+    6be2:	41 56                	push   %r14
+    6be4:	4c 8d 35 b5 be 06 00 	lea    0x6beb5(%rip),%r14        # 72aa0 <console_ports>
+    6beb:	41 55                	push   %r13
+    6bed:	41 54                	push   %r12
+    6bef:	55                   	push   %rbp
+    6bf0:	53                   	push   %rbx
+    6bf1:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+    6bf8:	48 8d 44 24 40       	lea    0x40(%rsp),%rax
+    6bfd:	4c 8d 64 24 30       	lea    0x30(%rsp),%r12
+    6c02:	48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    6c07:	4c 8d 7c 24 70       	lea    0x70(%rsp),%r15
+                if (space > CONSOLE_BUFFER_SIZE - offset) {
+    6c0c:	4d 89 e5             	mov    %r12,%r13
+    6c0f:	90                   	nop
+        waits[count++] = (struct pollfd){.fd = console_wake[0], .events = POLLIN};
+    6c10:	48 8d 05 51 46 00 00 	lea    0x4651(%rip),%rax        # b268 <console_wake>
+    6c17:	c7 44 24 74 01 00 00 	movl   $0x1,0x74(%rsp)
+    6c1e:	00 
+        for (int port = 0; port < SOC_SCI_PORTS; port++) {
+    6c1f:	31 d2                	xor    %edx,%edx
+        waits[count++] = (struct pollfd){.fd = console_wake[0], .events = POLLIN};
+    6c21:	bd 01 00 00 00       	mov    $0x1,%ebp
+    6c26:	8b 00                	mov    (%rax),%eax
+    6c28:	89 44 24 70          	mov    %eax,0x70(%rsp)
+    6c2c:	48 8d 05 6d be 06 00 	lea    0x6be6d(%rip),%rax        # 72aa0 <console_ports>
+            if (!console->attached) {
+    6c33:	80 78 29 00          	cmpb   $0x0,0x29(%rax)
+    6c37:	74 6c                	je     6ca5 <ConsoleThread+0xc5>
+            if ((console->server >= 0) && (console->client < 0)) {
+    6c39:	8b 48 2c             	mov    0x2c(%rax),%ecx
+    6c3c:	8b 78 30             	mov    0x30(%rax),%edi
+    6c3f:	85 c9                	test   %ecx,%ecx
+    6c41:	0f 88 a1 01 00 00    	js     6de8 <ConsoleThread+0x208>
+    6c47:	85 ff                	test   %edi,%edi
+    6c49:	0f 88 a9 01 00 00    	js     6df8 <ConsoleThread+0x218>
+                short events = console->blocked ? POLLOUT : 0;
+    6c4f:	48 63 f2             	movslq %edx,%rsi
+    6c52:	48 89 f1             	mov    %rsi,%rcx
+    6c55:	48 c1 e1 06          	shl    $0x6,%rcx
+    6c59:	48 01 f1             	add    %rsi,%rcx
+    6c5c:	48 c1 e1 06          	shl    $0x6,%rcx
+    6c60:	4c 01 f1             	add    %r14,%rcx
+    6c63:	0f b6 71 34          	movzbl 0x34(%rcx),%esi
+                if (console->head - console->tail < CONSOLE_BUFFER_SIZE) {
+    6c67:	44 8b 41 38          	mov    0x38(%rcx),%r8d
+    6c6b:	44 8b 49 3c          	mov    0x3c(%rcx),%r9d
+                short events = console->blocked ? POLLOUT : 0;
+    6c6f:	c1 e6 02             	shl    $0x2,%esi
+                if (console->head - console->tail < CONSOLE_BUFFER_SIZE) {
+    6c72:	44 89 c1             	mov    %r8d,%ecx
+    6c75:	44 29 c9             	sub    %r9d,%ecx
+                    events |= POLLIN;
+    6c78:	41 89 f0             	mov    %esi,%r8d
+    6c7b:	41 83 c8 01          	or     $0x1,%r8d
+    6c7f:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+                owners[count] = port;
+    6c85:	48 63 cd             	movslq %ebp,%rcx
+                    events |= POLLIN;
+    6c88:	41 0f 42 f0          	cmovb  %r8d,%esi
+                owners[count] = port;
+    6c8c:	89 54 8c 40          	mov    %edx,0x40(%rsp,%rcx,4)
+                waits[count++] = (struct pollfd){.fd = console->client, .events = events};
+    6c90:	83 c5 01             	add    $0x1,%ebp
+    6c93:	48 c7 44 cc 70 00 00 	movq   $0x0,0x70(%rsp,%rcx,8)
+    6c9a:	00 00 
+    6c9c:	89 7c cc 70          	mov    %edi,0x70(%rsp,%rcx,8)
+    6ca0:	66 89 74 cc 74       	mov    %si,0x74(%rsp,%rcx,8)
+        for (int port = 0; port < SOC_SCI_PORTS; port++) {
+    6ca5:	83 c2 01             	add    $0x1,%edx
+    6ca8:	48 05 40 10 00 00    	add    $0x1040,%rax
+    6cae:	83 fa 04             	cmp    $0x4,%edx
+    6cb1:	75 80                	jne    6c33 <ConsoleThread+0x53>
+        if (poll(waits, count, -1) < 0) {
+    6cb3:	48 63 f5             	movslq %ebp,%rsi
+    6cb6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    6cbb:	4c 89 ff             	mov    %r15,%rdi
+    6cbe:	e8 fd b5 ff ff       	call   22c0 <poll@plt>
+    6cc3:	85 c0                	test   %eax,%eax
+    6cc5:	0f 88 45 ff ff ff    	js     6c10 <ConsoleThread+0x30>
+        if (waits[0].revents) {
+    6ccb:	66 83 7c 24 76 00    	cmpw   $0x0,0x76(%rsp)
+    6cd1:	0f 85 e9 00 00 00    	jne    6dc0 <ConsoleThread+0x1e0>
+        for (int index = 1; index < count; index++) {
+    6cd7:	bb 01 00 00 00       	mov    $0x1,%ebx
+    6cdc:	83 fd 01             	cmp    $0x1,%ebp
+    6cdf:	0f 84 2b ff ff ff    	je     6c10 <ConsoleThread+0x30>
+    6ce5:	4d 89 f8             	mov    %r15,%r8
+    6ce8:	4c 89 2c 24          	mov    %r13,(%rsp)
+    6cec:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+    6cf1:	41 89 ef             	mov    %ebp,%r15d
+    6cf4:	eb 47                	jmp    6d3d <ConsoleThread+0x15d>
+    6cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    6cfd:	00 00 00 
+            if ((waits[index].revents & (POLLIN | POLLHUP | POLLERR)) &&
+    6d00:	a8 19                	test   $0x19,%al
+    6d02:	74 2c                	je     6d30 <ConsoleThread+0x150>
+                (console->head - console->tail < CONSOLE_BUFFER_SIZE)) {
+    6d04:	4d 89 e5             	mov    %r12,%r13
+    6d07:	49 c1 e5 06          	shl    $0x6,%r13
+    6d0b:	4d 01 e5             	add    %r12,%r13
+    6d0e:	49 c1 e5 06          	shl    $0x6,%r13
+    6d12:	4b 8d 0c 2e          	lea    (%r14,%r13,1),%rcx
+    6d16:	8b 41 38             	mov    0x38(%rcx),%eax
+    6d19:	8b 51 3c             	mov    0x3c(%rcx),%edx
+    6d1c:	29 d0                	sub    %edx,%eax
+            if ((waits[index].revents & (POLLIN | POLLHUP | POLLERR)) &&
+    6d1e:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    6d23:	0f 86 07 01 00 00    	jbe    6e30 <ConsoleThread+0x250>
+    6d29:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        for (int index = 1; index < count; index++) {
+    6d30:	48 83 c3 01          	add    $0x1,%rbx
+    6d34:	41 39 df             	cmp    %ebx,%r15d
+    6d37:	0f 8e e3 00 00 00    	jle    6e20 <ConsoleThread+0x240>
+            if (!waits[index].revents) {
+    6d3d:	41 0f b7 44 d8 06    	movzwl 0x6(%r8,%rbx,8),%eax
+            uint8_t port = owners[index];
+    6d43:	41 8b 2c 9a          	mov    (%r10,%rbx,4),%ebp
+            if (!waits[index].revents) {
+    6d47:	66 85 c0             	test   %ax,%ax
+    6d4a:	74 e4                	je     6d30 <ConsoleThread+0x150>
+            if (waits[index].fd == console->server) {
+    6d4c:	44 0f b6 e5          	movzbl %bpl,%r12d
+    6d50:	44 0f b6 dd          	movzbl %bpl,%r11d
+    6d54:	4d 89 e5             	mov    %r12,%r13
+    6d57:	49 c1 e5 06          	shl    $0x6,%r13
+    6d5b:	4d 01 e5             	add    %r12,%r13
+    6d5e:	49 c1 e5 06          	shl    $0x6,%r13
+    6d62:	4d 01 f5             	add    %r14,%r13
+    6d65:	41 8b 7d 2c          	mov    0x2c(%r13),%edi
+    6d69:	41 39 3c d8          	cmp    %edi,(%r8,%rbx,8)
+    6d6d:	0f 84 ad 01 00 00    	je     6f20 <ConsoleThread+0x340>
+            if (waits[index].revents & POLLOUT) {
+    6d73:	a8 04                	test   $0x4,%al
+    6d75:	74 89                	je     6d00 <ConsoleThread+0x120>
+                console->blocked = false;
+    6d77:	41 c6 45 34 00       	movb   $0x0,0x34(%r13)
+    6d7c:	40 80 fd 03          	cmp    $0x3,%bpl
+    6d80:	0f 87 7a ff ff ff    	ja     6d00 <ConsoleThread+0x120>
+    6d86:	44 89 df             	mov    %r11d,%edi
+    6d89:	4c 89 44 24 18       	mov    %r8,0x18(%rsp)
+    6d8e:	4c 89 54 24 10       	mov    %r10,0x10(%rsp)
+    6d93:	44 89 5c 24 08       	mov    %r11d,0x8(%rsp)
+    6d98:	e8 53 ee ff ff       	call   5bf0 <SciInjectEvent.part.0>
+            if ((waits[index].revents & (POLLIN | POLLHUP | POLLERR)) &&
+    6d9d:	4c 8b 44 24 18       	mov    0x18(%rsp),%r8
+    6da2:	4c 8b 54 24 10       	mov    0x10(%rsp),%r10
+    6da7:	44 8b 5c 24 08       	mov    0x8(%rsp),%r11d
+    6dac:	41 0f b7 44 d8 06    	movzwl 0x6(%r8,%rbx,8),%eax
+    6db2:	e9 49 ff ff ff       	jmp    6d00 <ConsoleThread+0x120>
+    6db7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    6dbe:	00 00 
+            while (read(console_wake[0], signals, sizeof(signals)) == sizeof(signals)) {
+    6dc0:	48 8d 05 a1 44 00 00 	lea    0x44a1(%rip),%rax        # b268 <console_wake>
+    6dc7:	ba 10 00 00 00       	mov    $0x10,%edx
+    6dcc:	4c 89 ee             	mov    %r13,%rsi
+    6dcf:	8b 38                	mov    (%rax),%edi
+    6dd1:	e8 da b3 ff ff       	call   21b0 <read@plt>
+    6dd6:	48 83 f8 10          	cmp    $0x10,%rax
+    6dda:	74 e4                	je     6dc0 <ConsoleThread+0x1e0>
+    6ddc:	e9 f6 fe ff ff       	jmp    6cd7 <ConsoleThread+0xf7>
+    6de1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            if (console->client >= 0) {
+    6de8:	85 ff                	test   %edi,%edi
+    6dea:	0f 89 5f fe ff ff    	jns    6c4f <ConsoleThread+0x6f>
+    6df0:	e9 b0 fe ff ff       	jmp    6ca5 <ConsoleThread+0xc5>
+    6df5:	0f 1f 00             	nopl   (%rax)
+                owners[count] = port;
+    6df8:	48 63 f5             	movslq %ebp,%rsi
+                waits[count++] = (struct pollfd){.fd = console->server, .events = POLLIN};
+    6dfb:	83 c5 01             	add    $0x1,%ebp
+    6dfe:	48 c7 44 f4 70 00 00 	movq   $0x0,0x70(%rsp,%rsi,8)
+    6e05:	00 00 
+    6e07:	89 4c f4 70          	mov    %ecx,0x70(%rsp,%rsi,8)
+    6e0b:	b9 01 00 00 00       	mov    $0x1,%ecx
+                owners[count] = port;
+    6e10:	89 54 b4 40          	mov    %edx,0x40(%rsp,%rsi,4)
+                waits[count++] = (struct pollfd){.fd = console->server, .events = POLLIN};
+    6e14:	66 89 4c f4 74       	mov    %cx,0x74(%rsp,%rsi,8)
+            if (console->client >= 0) {
+    6e19:	e9 87 fe ff ff       	jmp    6ca5 <ConsoleThread+0xc5>
+    6e1e:	66 90                	xchg   %ax,%ax
+    6e20:	4c 8b 2c 24          	mov    (%rsp),%r13
+    6e24:	4d 89 c7             	mov    %r8,%r15
+    6e27:	e9 e4 fd ff ff       	jmp    6c10 <ConsoleThread+0x30>
+    6e2c:	0f 1f 40 00          	nopl   0x0(%rax)
+                uint32_t head = console->head;
+    6e30:	44 8b 49 38          	mov    0x38(%rcx),%r9d
+                uint32_t space = CONSOLE_BUFFER_SIZE - (head - console->tail);
+    6e34:	8b 41 3c             	mov    0x3c(%rcx),%eax
+                if (space > CONSOLE_BUFFER_SIZE - offset) {
+    6e37:	ba 00 10 00 00       	mov    $0x1000,%edx
+    6e3c:	4c 89 44 24 18       	mov    %r8,0x18(%rsp)
+                size = read(console->client, &console->data[offset], space);
+    6e41:	8b 79 30             	mov    0x30(%rcx),%edi
+    6e44:	4c 89 54 24 10       	mov    %r10,0x10(%rsp)
+                uint32_t offset = head % CONSOLE_BUFFER_SIZE;
+    6e49:	44 89 ce             	mov    %r9d,%esi
+                uint32_t space = CONSOLE_BUFFER_SIZE - (head - console->tail);
+    6e4c:	05 00 10 00 00       	add    $0x1000,%eax
+                size = read(console->client, &console->data[offset], space);
+    6e51:	48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+                uint32_t offset = head % CONSOLE_BUFFER_SIZE;
+    6e56:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+                uint32_t space = CONSOLE_BUFFER_SIZE - (head - console->tail);
+    6e5c:	44 29 c8             	sub    %r9d,%eax
+    6e5f:	44 89 5c 24 24       	mov    %r11d,0x24(%rsp)
+                if (space > CONSOLE_BUFFER_SIZE - offset) {
+    6e64:	29 f2                	sub    %esi,%edx
+                size = read(console->client, &console->data[offset], space);
+    6e66:	49 8d 74 35 40       	lea    0x40(%r13,%rsi,1),%rsi
+                uint32_t space = CONSOLE_BUFFER_SIZE - (head - console->tail);
+    6e6b:	44 89 4c 24 20       	mov    %r9d,0x20(%rsp)
+                size = read(console->client, &console->data[offset], space);
+    6e70:	39 d0                	cmp    %edx,%eax
+    6e72:	0f 47 c2             	cmova  %edx,%eax
+    6e75:	4c 01 f6             	add    %r14,%rsi
+    6e78:	89 c2                	mov    %eax,%edx
+    6e7a:	e8 31 b3 ff ff       	call   21b0 <read@plt>
+                if (size > 0) {
+    6e7f:	48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    6e84:	4c 8b 54 24 10       	mov    0x10(%rsp),%r10
+    6e89:	48 85 c0             	test   %rax,%rax
+    6e8c:	4c 8b 44 24 18       	mov    0x18(%rsp),%r8
+    6e91:	0f 8f c9 00 00 00    	jg     6f60 <ConsoleThread+0x380>
+                } else if ((console->server >= 0) && (size == 0 || errno != EAGAIN)) {
+    6e97:	8b 51 2c             	mov    0x2c(%rcx),%edx
+    6e9a:	85 d2                	test   %edx,%edx
+    6e9c:	0f 88 8e fe ff ff    	js     6d30 <ConsoleThread+0x150>
+    6ea2:	48 85 c0             	test   %rax,%rax
+    6ea5:	74 22                	je     6ec9 <ConsoleThread+0x2e9>
+    6ea7:	4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    6eac:	4c 89 54 24 08       	mov    %r10,0x8(%rsp)
+    6eb1:	e8 aa b1 ff ff       	call   2060 <__errno_location@plt>
+    6eb6:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    6ebb:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    6ec0:	83 38 0b             	cmpl   $0xb,(%rax)
+    6ec3:	0f 84 67 fe ff ff    	je     6d30 <ConsoleThread+0x150>
+    close(console->client);
+    6ec9:	4c 89 e5             	mov    %r12,%rbp
+    pthread_mutex_lock(&console->lock);
+    6ecc:	4d 01 f5             	add    %r14,%r13
+    6ecf:	4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    close(console->client);
+    6ed4:	48 c1 e5 06          	shl    $0x6,%rbp
+    pthread_mutex_lock(&console->lock);
+    6ed8:	4c 89 ef             	mov    %r13,%rdi
+    6edb:	4c 89 54 24 08       	mov    %r10,0x8(%rsp)
+    6ee0:	e8 3b b5 ff ff       	call   2420 <pthread_mutex_lock@plt>
+    close(console->client);
+    6ee5:	4c 01 e5             	add    %r12,%rbp
+    6ee8:	48 c1 e5 06          	shl    $0x6,%rbp
+    6eec:	4c 01 f5             	add    %r14,%rbp
+    6eef:	8b 7d 30             	mov    0x30(%rbp),%edi
+    6ef2:	e8 99 b2 ff ff       	call   2190 <close@plt>
+    pthread_mutex_unlock(&console->lock);
+    6ef7:	4c 89 ef             	mov    %r13,%rdi
+    console->client = -1;
+    6efa:	c7 45 30 ff ff ff ff 	movl   $0xffffffff,0x30(%rbp)
+    console->blocked = false;
+    6f01:	c6 45 34 00          	movb   $0x0,0x34(%rbp)
+    pthread_mutex_unlock(&console->lock);
+    6f05:	e8 56 b3 ff ff       	call   2260 <pthread_mutex_unlock@plt>
+    6f0a:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    6f0f:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+}
+    6f14:	e9 17 fe ff ff       	jmp    6d30 <ConsoleThread+0x150>
+    6f19:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                pthread_mutex_lock(&console->lock);
+    6f20:	4c 89 ef             	mov    %r13,%rdi
+    6f23:	4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    6f28:	4c 89 54 24 08       	mov    %r10,0x8(%rsp)
+    6f2d:	e8 ee b4 ff ff       	call   2420 <pthread_mutex_lock@plt>
+                console->client = accept4(console->server, NULL, NULL, SOCK_NONBLOCK);
+    6f32:	41 8b 7d 2c          	mov    0x2c(%r13),%edi
+    6f36:	b9 00 08 00 00       	mov    $0x800,%ecx
+    6f3b:	31 d2                	xor    %edx,%edx
+    6f3d:	31 f6                	xor    %esi,%esi
+    6f3f:	e8 dc b1 ff ff       	call   2120 <accept4@plt>
+                pthread_mutex_unlock(&console->lock);
+    6f44:	4c 89 ef             	mov    %r13,%rdi
+                console->client = accept4(console->server, NULL, NULL, SOCK_NONBLOCK);
+    6f47:	41 89 45 30          	mov    %eax,0x30(%r13)
+                pthread_mutex_unlock(&console->lock);
+    6f4b:	e8 10 b3 ff ff       	call   2260 <pthread_mutex_unlock@plt>
+                continue;
+    6f50:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    6f55:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    6f5a:	e9 d1 fd ff ff       	jmp    6d30 <ConsoleThread+0x150>
+    6f5f:	90                   	nop
+                    __atomic_store_n(&console->head, head + size, __ATOMIC_RELEASE);
+    6f60:	44 8b 4c 24 20       	mov    0x20(%rsp),%r9d
+    6f65:	48 8d 3d 6c bb 06 00 	lea    0x6bb6c(%rip),%rdi        # 72ad8 <console_ports+0x38>
+    6f6c:	44 01 c8             	add    %r9d,%eax
+    6f6f:	40 80 fd 03          	cmp    $0x3,%bpl
+    6f73:	42 89 04 2f          	mov    %eax,(%rdi,%r13,1)
+    6f77:	44 8b 5c 24 24       	mov    0x24(%rsp),%r11d
+    6f7c:	0f 87 ae fd ff ff    	ja     6d30 <ConsoleThread+0x150>
+    6f82:	44 89 df             	mov    %r11d,%edi
+    6f85:	4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    6f8a:	4c 89 54 24 08       	mov    %r10,0x8(%rsp)
+    6f8f:	e8 5c ec ff ff       	call   5bf0 <SciInjectEvent.part.0>
+    6f94:	4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    6f99:	4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    6f9e:	e9 8d fd ff ff       	jmp    6d30 <ConsoleThread+0x150>
+    6fa3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    6faa:	00 00 00 00 
+    6fae:	66 90                	xchg   %ax,%ax
+
+0000000000006fb0 <TestRunAll>:
+}
+    6fb0:	31 c0                	xor    %eax,%eax
+    6fb2:	c3                   	ret
+    6fb3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    6fba:	00 00 00 00 
+    6fbe:	66 90                	xchg   %ax,%ax
+
+0000000000006fc0 <BenchRunAll>:
+                       double tolerance) {
+    6fc0:	41 57                	push   %r15
+    6fc2:	41 56                	push   %r14
+    6fc4:	49 89 f6             	mov    %rsi,%r14
+    6fc7:	41 55                	push   %r13
+    6fc9:	41 54                	push   %r12
+    6fcb:	55                   	push   %rbp
+    6fcc:	53                   	push   %rbx
+    6fcd:	48 81 ec 68 01 00 00 	sub    $0x168,%rsp
+    6fd4:	48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    int known = baseline ? BenchLoad(baseline, previous) : 0;
+    6fd9:	c7 44 24 48 00 00 00 	movl   $0x0,0x48(%rsp)
+    6fe0:	00 
+                       double tolerance) {
+    6fe1:	f2 0f 11 44 24 30    	movsd  %xmm0,0x30(%rsp)
+    int known = baseline ? BenchLoad(baseline, previous) : 0;
+    6fe7:	48 85 d2             	test   %rdx,%rdx
+    6fea:	0f 84 8d 00 00 00    	je     707d <BenchRunAll+0xbd>
+    FILE * file = fopen(filename, "r");
+    6ff0:	48 8d 35 d9 12 00 00 	lea    0x12d9(%rip),%rsi        # 82d0 <_IO_stdin_used+0x2d0>
+    6ff7:	48 89 d7             	mov    %rdx,%rdi
+    6ffa:	48 8d 5c 24 60       	lea    0x60(%rsp),%rbx
+    6fff:	45 31 ff             	xor    %r15d,%r15d
+    7002:	e8 19 b3 ff ff       	call   2320 <fopen@plt>
+        bench_result_t result = &results[count];
+    7007:	4c 8d 2d 12 57 00 00 	lea    0x5712(%rip),%r13        # c720 <previous.0>
+        if (sscanf(line, BENCH_SCAN, result->name, &result->iterations, &result->ns,
+    700e:	4c 8d 25 53 16 00 00 	lea    0x1653(%rip),%r12        # 8668 <_IO_stdin_used+0x668>
+    FILE * file = fopen(filename, "r");
+    7015:	48 89 c5             	mov    %rax,%rbp
+    while (file && (count < BENCH_BASELINE) && fgets(line, sizeof(line), file)) {
+    7018:	48 85 c0             	test   %rax,%rax
+    701b:	74 60                	je     707d <BenchRunAll+0xbd>
+    701d:	0f 1f 00             	nopl   (%rax)
+    7020:	48 89 ea             	mov    %rbp,%rdx
+    7023:	be 00 01 00 00       	mov    $0x100,%esi
+    7028:	48 89 df             	mov    %rbx,%rdi
+    702b:	e8 90 b1 ff ff       	call   21c0 <fgets@plt>
+    7030:	48 85 c0             	test   %rax,%rax
+    7033:	74 3b                	je     7070 <BenchRunAll+0xb0>
+        bench_result_t result = &results[count];
+    7035:	49 63 c7             	movslq %r15d,%rax
+        if (sscanf(line, BENCH_SCAN, result->name, &result->iterations, &result->ns,
+    7038:	4c 89 e6             	mov    %r12,%rsi
+    703b:	48 89 df             	mov    %rbx,%rdi
+        bench_result_t result = &results[count];
+    703e:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    7042:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+    7046:	49 8d 54 c5 00       	lea    0x0(%r13,%rax,8),%rdx
+        if (sscanf(line, BENCH_SCAN, result->name, &result->iterations, &result->ns,
+    704b:	31 c0                	xor    %eax,%eax
+    704d:	48 8d 4a 40          	lea    0x40(%rdx),%rcx
+    7051:	4c 8d 4a 50          	lea    0x50(%rdx),%r9
+    7055:	4c 8d 42 48          	lea    0x48(%rdx),%r8
+    7059:	e8 22 b2 ff ff       	call   2280 <__isoc99_sscanf@plt>
+    705e:	83 f8 04             	cmp    $0x4,%eax
+    7061:	75 bd                	jne    7020 <BenchRunAll+0x60>
+            count++;
+    7063:	41 83 c7 01          	add    $0x1,%r15d
+    while (file && (count < BENCH_BASELINE) && fgets(line, sizeof(line), file)) {
+    7067:	41 81 ff 00 01 00 00 	cmp    $0x100,%r15d
+    706e:	75 b0                	jne    7020 <BenchRunAll+0x60>
+        fclose(file);
+    7070:	48 89 ef             	mov    %rbp,%rdi
+    7073:	44 89 7c 24 48       	mov    %r15d,0x48(%rsp)
+    7078:	e8 73 b0 ff ff       	call   20f0 <fclose@plt>
+    if (output) {
+    707d:	4d 85 f6             	test   %r14,%r14
+    7080:	0f 84 fb 04 00 00    	je     7581 <bench_hal.c.32ed9fbe+0x62>
+        file = fopen(output, "w");
+    7086:	48 8d 35 87 0f 00 00 	lea    0xf87(%rip),%rsi        # 8014 <_IO_stdin_used+0x14>
+    708d:	4c 89 f7             	mov    %r14,%rdi
+    7090:	e8 8b b2 ff ff       	call   2320 <fopen@plt>
+    7095:	49 89 c0             	mov    %rax,%r8
+        if (!file) {
+    7098:	48 85 c0             	test   %rax,%rax
+    709b:	0f 84 c5 04 00 00    	je     7566 <bench_hal.c.32ed9fbe+0x47>
+    for (bench_case_t bench = benchs; bench; bench = bench->next) {
+    70a1:	4c 8b 25 60 56 00 00 	mov    0x5660(%rip),%r12        # c708 <benchs>
+    70a8:	4d 85 e4             	test   %r12,%r12
+    70ab:	0f 84 ee 04 00 00    	je     759f <bench_hal.c.32ed9fbe+0x80>
+    70b1:	48 63 44 24 48       	movslq 0x48(%rsp),%rax
+    70b6:	48 8d 35 63 56 00 00 	lea    0x5663(%rip),%rsi        # c720 <previous.0>
+    bool first = true;
+    70bd:	c6 44 24 1f 01       	movb   $0x1,0x1f(%rsp)
+    int slower = 0;
+    70c2:	c7 44 24 4c 00 00 00 	movl   $0x0,0x4c(%rsp)
+    70c9:	00 
+    70ca:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+                printf("%+9.1f%%", change);
+    70ce:	4c 89 44 24 38       	mov    %r8,0x38(%rsp)
+    70d3:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+    70d7:	4c 8d 3c c6          	lea    (%rsi,%rax,8),%r15
+    70db:	4c 89 7c 24 40       	mov    %r15,0x40(%rsp)
+    return !filter || strstr(group, filter) || strstr(name, filter);
+    70e0:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+        if (!Selected(bench->group, bench->name, filter)) {
+    70e5:	49 8b 5c 24 08       	mov    0x8(%r12),%rbx
+    70ea:	49 8b 3c 24          	mov    (%r12),%rdi
+    return !filter || strstr(group, filter) || strstr(name, filter);
+    70ee:	48 85 c0             	test   %rax,%rax
+    70f1:	74 11                	je     7104 <BenchRunAll+0x144>
+    70f3:	48 89 c6             	mov    %rax,%rsi
+    70f6:	e8 15 b3 ff ff       	call   2410 <strstr@plt>
+    70fb:	48 85 c0             	test   %rax,%rax
+    70fe:	0f 84 0c 04 00 00    	je     7510 <BenchRunAll+0x550>
+        if (first) {
+    7104:	80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    7109:	0f 85 21 04 00 00    	jne    7530 <bench_hal.c.32ed9fbe+0x11>
+    int slower = 0;
+    710f:	41 bd 1f 00 00 00    	mov    $0x1f,%r13d
+    7115:	bd 01 00 00 00       	mov    $0x1,%ebp
+    711a:	48 8d 5c 24 50       	lea    0x50(%rsp),%rbx
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    711f:	48 89 de             	mov    %rbx,%rsi
+    7122:	bf 01 00 00 00       	mov    $0x1,%edi
+    7127:	e8 a4 af ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    712c:	4c 8b 7c 24 58       	mov    0x58(%rsp),%r15
+        bench->function(iterations);
+    7131:	89 ef                	mov    %ebp,%edi
+    7133:	4c 69 74 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%r14
+    713a:	9a 3b 
+    713c:	41 ff 54 24 10       	call   *0x10(%r12)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    7141:	48 89 de             	mov    %rbx,%rsi
+    7144:	bf 01 00 00 00       	mov    $0x1,%edi
+    7149:	e8 82 af ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    714e:	48 69 4c 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%rcx
+    7155:	9a 3b 
+    7157:	4c 29 f9             	sub    %r15,%rcx
+        elapsed = BenchTime() - start;
+    715a:	48 03 4c 24 58       	add    0x58(%rsp),%rcx
+    715f:	4c 29 f1             	sub    %r14,%rcx
+        if (elapsed < BENCH_DURATION / 10) {
+    7162:	48 81 f9 7f 84 1e 00 	cmp    $0x1e847f,%rcx
+    7169:	0f 86 b1 01 00 00    	jbe    7320 <BenchRunAll+0x360>
+    if (elapsed && (elapsed < BENCH_DURATION)) {
+    716f:	48 8d 41 ff          	lea    -0x1(%rcx),%rax
+    7173:	48 3d fe 2c 31 01    	cmp    $0x1312cfe,%rax
+    7179:	77 20                	ja     719b <BenchRunAll+0x1db>
+        uint64_t scaled = iterations * BENCH_DURATION / elapsed;
+    717b:	89 e8                	mov    %ebp,%eax
+    717d:	31 d2                	xor    %edx,%edx
+    717f:	48 69 c0 00 2d 31 01 	imul   $0x1312d00,%rax,%rax
+    7186:	48 f7 f1             	div    %rcx
+        iterations = (scaled < UINT32_MAX) ? (uint32_t)scaled : UINT32_MAX;
+    7189:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+    718e:	48 39 c2             	cmp    %rax,%rdx
+    7191:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    7196:	0f 43 d0             	cmovae %eax,%edx
+    7199:	89 d5                	mov    %edx,%ebp
+    snprintf(result->name, sizeof(result->name), "%s.%s", bench->group, bench->name);
+    719b:	4c 8d 74 24 60       	lea    0x60(%rsp),%r14
+    71a0:	49 8b 0c 24          	mov    (%r12),%rcx
+    71a4:	4d 8b 44 24 08       	mov    0x8(%r12),%r8
+    71a9:	31 c0                	xor    %eax,%eax
+    71ab:	4c 89 f7             	mov    %r14,%rdi
+    71ae:	48 8d 15 e1 10 00 00 	lea    0x10e1(%rip),%rdx        # 8296 <_IO_stdin_used+0x296>
+    71b5:	be 40 00 00 00       	mov    $0x40,%esi
+    for (int sample = 0; sample < BENCH_SAMPLES; sample++) {
+    71ba:	45 31 ed             	xor    %r13d,%r13d
+    snprintf(result->name, sizeof(result->name), "%s.%s", bench->group, bench->name);
+    71bd:	e8 ae af ff ff       	call   2170 <snprintf@plt>
+    result->iterations = iterations;
+    71c2:	89 e8                	mov    %ebp,%eax
+    71c4:	4c 89 74 24 28       	mov    %r14,0x28(%rsp)
+    71c9:	45 89 ee             	mov    %r13d,%r14d
+    71cc:	89 ac 24 a0 00 00 00 	mov    %ebp,0xa0(%rsp)
+    result->ns = 0;
+    71d3:	48 c7 84 24 a8 00 00 	movq   $0x0,0xa8(%rsp)
+    71da:	00 00 00 00 00 
+    for (int sample = 0; sample < BENCH_SAMPLES; sample++) {
+    71df:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    71e4:	4c 89 64 24 10       	mov    %r12,0x10(%rsp)
+    71e9:	89 6c 24 18          	mov    %ebp,0x18(%rsp)
+    71ed:	eb 41                	jmp    7230 <BenchRunAll+0x270>
+    71ef:	90                   	nop
+            result->ns = (double)elapsed / iterations;
+    71f0:	66 0f ef c0          	pxor   %xmm0,%xmm0
+            result->cycles = (double)cycles / iterations;
+    71f4:	4c 89 e9             	mov    %r13,%rcx
+            result->ns = (double)elapsed / iterations;
+    71f7:	f2 48 0f 2a c2       	cvtsi2sd %rdx,%xmm0
+            result->cycles = (double)cycles / iterations;
+    71fc:	4c 29 f9             	sub    %r15,%rcx
+    71ff:	0f 88 fd 00 00 00    	js     7302 <BenchRunAll+0x342>
+    7205:	66 0f ef d2          	pxor   %xmm2,%xmm2
+    7209:	f2 48 0f 2a d1       	cvtsi2sd %rcx,%xmm2
+            result->ns = (double)elapsed / iterations;
+    720e:	66 0f 14 c2          	unpcklpd %xmm2,%xmm0
+    7212:	66 0f 14 c9          	unpcklpd %xmm1,%xmm1
+    7216:	66 0f 5e c1          	divpd  %xmm1,%xmm0
+    721a:	0f 11 84 24 a8 00 00 	movups %xmm0,0xa8(%rsp)
+    7221:	00 
+    for (int sample = 0; sample < BENCH_SAMPLES; sample++) {
+    7222:	41 83 c6 01          	add    $0x1,%r14d
+    7226:	41 83 fe 0a          	cmp    $0xa,%r14d
+    722a:	0f 84 30 01 00 00    	je     7360 <BenchRunAll+0x3a0>
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    7230:	48 89 de             	mov    %rbx,%rsi
+    7233:	bf 01 00 00 00       	mov    $0x1,%edi
+    7238:	e8 93 ae ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    723d:	48 8b 6c 24 58       	mov    0x58(%rsp),%rbp
+    7242:	4c 69 64 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%r12
+    7249:	9a 3b 
+    return __builtin_ia32_rdtsc();
+    724b:	0f 31                	rdtsc
+        bench->function(iterations);
+    724d:	8b 7c 24 18          	mov    0x18(%rsp),%edi
+    return __builtin_ia32_rdtsc();
+    7251:	49 89 c7             	mov    %rax,%r15
+        bench->function(iterations);
+    7254:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    return __builtin_ia32_rdtsc();
+    7259:	48 c1 e2 20          	shl    $0x20,%rdx
+    725d:	49 09 d7             	or     %rdx,%r15
+        bench->function(iterations);
+    7260:	ff 50 10             	call   *0x10(%rax)
+    return __builtin_ia32_rdtsc();
+    7263:	0f 31                	rdtsc
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    7265:	bf 01 00 00 00       	mov    $0x1,%edi
+    726a:	48 c1 e2 20          	shl    $0x20,%rdx
+    726e:	49 89 c5             	mov    %rax,%r13
+    7271:	48 89 de             	mov    %rbx,%rsi
+    7274:	49 09 d5             	or     %rdx,%r13
+    7277:	e8 54 ae ff ff       	call   20d0 <clock_gettime@plt>
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    727c:	48 69 54 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%rdx
+    7283:	9a 3b 
+    7285:	48 29 ea             	sub    %rbp,%rdx
+        elapsed = BenchTime() - start;
+    7288:	48 03 54 24 58       	add    0x58(%rsp),%rdx
+    728d:	4c 29 e2             	sub    %r12,%rdx
+        if ((sample == 0) || ((double)elapsed / iterations < result->ns)) {
+    7290:	45 85 f6             	test   %r14d,%r14d
+    7293:	74 34                	je     72c9 <BenchRunAll+0x309>
+    7295:	48 85 d2             	test   %rdx,%rdx
+    7298:	0f 88 9a 00 00 00    	js     7338 <BenchRunAll+0x378>
+    729e:	66 0f ef c0          	pxor   %xmm0,%xmm0
+    72a2:	f2 48 0f 2a c2       	cvtsi2sd %rdx,%xmm0
+    72a7:	66 0f ef c9          	pxor   %xmm1,%xmm1
+    72ab:	f2 48 0f 2a 4c 24 08 	cvtsi2sdq 0x8(%rsp),%xmm1
+    72b2:	f2 0f 5e c1          	divsd  %xmm1,%xmm0
+    72b6:	f2 0f 10 8c 24 a8 00 	movsd  0xa8(%rsp),%xmm1
+    72bd:	00 00 
+    72bf:	66 0f 2f c8          	comisd %xmm0,%xmm1
+    72c3:	0f 86 59 ff ff ff    	jbe    7222 <BenchRunAll+0x262>
+            result->ns = (double)elapsed / iterations;
+    72c9:	66 0f ef c9          	pxor   %xmm1,%xmm1
+    72cd:	f2 48 0f 2a 4c 24 08 	cvtsi2sdq 0x8(%rsp),%xmm1
+    72d4:	48 85 d2             	test   %rdx,%rdx
+    72d7:	0f 89 13 ff ff ff    	jns    71f0 <BenchRunAll+0x230>
+    72dd:	48 89 d0             	mov    %rdx,%rax
+    72e0:	83 e2 01             	and    $0x1,%edx
+    72e3:	66 0f ef c0          	pxor   %xmm0,%xmm0
+            result->cycles = (double)cycles / iterations;
+    72e7:	4c 89 e9             	mov    %r13,%rcx
+            result->ns = (double)elapsed / iterations;
+    72ea:	48 d1 e8             	shr    %rax
+    72ed:	48 09 d0             	or     %rdx,%rax
+    72f0:	f2 48 0f 2a c0       	cvtsi2sd %rax,%xmm0
+    72f5:	f2 0f 58 c0          	addsd  %xmm0,%xmm0
+            result->cycles = (double)cycles / iterations;
+    72f9:	4c 29 f9             	sub    %r15,%rcx
+    72fc:	0f 89 03 ff ff ff    	jns    7205 <BenchRunAll+0x245>
+    7302:	48 89 c8             	mov    %rcx,%rax
+    7305:	83 e1 01             	and    $0x1,%ecx
+    7308:	66 0f ef d2          	pxor   %xmm2,%xmm2
+    730c:	48 d1 e8             	shr    %rax
+    730f:	48 09 c8             	or     %rcx,%rax
+    7312:	f2 48 0f 2a d0       	cvtsi2sd %rax,%xmm2
+    7317:	f2 0f 58 d2          	addsd  %xmm2,%xmm2
+    731b:	e9 ee fe ff ff       	jmp    720e <BenchRunAll+0x24e>
+            iterations = iterations * 2;
+    7320:	01 ed                	add    %ebp,%ebp
+    } while ((elapsed < BENCH_DURATION / 10) && (iterations < UINT32_MAX / 2));
+    7322:	41 83 ed 01          	sub    $0x1,%r13d
+    7326:	0f 85 f3 fd ff ff    	jne    711f <BenchRunAll+0x15f>
+    732c:	e9 3e fe ff ff       	jmp    716f <BenchRunAll+0x1af>
+    7331:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        if ((sample == 0) || ((double)elapsed / iterations < result->ns)) {
+    7338:	48 89 d0             	mov    %rdx,%rax
+    733b:	48 89 d6             	mov    %rdx,%rsi
+    733e:	66 0f ef c0          	pxor   %xmm0,%xmm0
+    7342:	48 d1 e8             	shr    %rax
+    7345:	83 e6 01             	and    $0x1,%esi
+    7348:	48 09 f0             	or     %rsi,%rax
+    734b:	f2 48 0f 2a c0       	cvtsi2sd %rax,%xmm0
+    7350:	f2 0f 58 c0          	addsd  %xmm0,%xmm0
+    7354:	e9 4e ff ff ff       	jmp    72a7 <BenchRunAll+0x2e7>
+    7359:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        printf("%-36s%12u%12.2f%12.2f", result.name, result.iterations, result.ns, result.cycles);
+    7360:	4c 8b 74 24 28       	mov    0x28(%rsp),%r14
+    7365:	8b 94 24 a0 00 00 00 	mov    0xa0(%rsp),%edx
+    736c:	48 8d 3d 29 0f 00 00 	lea    0xf29(%rip),%rdi        # 829c <_IO_stdin_used+0x29c>
+    7373:	b8 02 00 00 00       	mov    $0x2,%eax
+    7378:	f2 0f 10 8c 24 b0 00 	movsd  0xb0(%rsp),%xmm1
+    737f:	00 00 
+    7381:	4c 8b 64 24 10       	mov    0x10(%rsp),%r12
+    7386:	f2 0f 10 84 24 a8 00 	movsd  0xa8(%rsp),%xmm0
+    738d:	00 00 
+    738f:	4c 89 f6             	mov    %r14,%rsi
+    7392:	e8 b9 ad ff ff       	call   2150 <printf@plt>
+        for (int index = 0; index < known; index++) {
+    7397:	8b 4c 24 48          	mov    0x48(%rsp),%ecx
+    739b:	85 c9                	test   %ecx,%ecx
+    739d:	0f 84 ad 00 00 00    	je     7450 <BenchRunAll+0x490>
+            if (strcmp(previous[index].name, result.name) == 0 && previous[index].ns > 0) {
+    73a3:	4c 8b 7c 24 40       	mov    0x40(%rsp),%r15
+        for (int index = 0; index < known; index++) {
+    73a8:	48 8d 1d 71 53 00 00 	lea    0x5371(%rip),%rbx        # c720 <previous.0>
+    73af:	eb 14                	jmp    73c5 <BenchRunAll+0x405>
+    73b1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    73b8:	48 83 c3 58          	add    $0x58,%rbx
+    73bc:	4c 39 fb             	cmp    %r15,%rbx
+    73bf:	0f 84 8b 00 00 00    	je     7450 <BenchRunAll+0x490>
+            if (strcmp(previous[index].name, result.name) == 0 && previous[index].ns > 0) {
+    73c5:	4c 89 f6             	mov    %r14,%rsi
+    73c8:	48 89 df             	mov    %rbx,%rdi
+    73cb:	e8 10 ae ff ff       	call   21e0 <strcmp@plt>
+    73d0:	85 c0                	test   %eax,%eax
+    73d2:	75 e4                	jne    73b8 <BenchRunAll+0x3f8>
+    73d4:	f2 0f 10 4b 48       	movsd  0x48(%rbx),%xmm1
+    73d9:	66 0f ef db          	pxor   %xmm3,%xmm3
+    73dd:	66 0f 2f cb          	comisd %xmm3,%xmm1
+    73e1:	76 d5                	jbe    73b8 <BenchRunAll+0x3f8>
+                double change = 100.0 * (result.ns - previous[index].ns) / previous[index].ns;
+    73e3:	f2 0f 10 84 24 a8 00 	movsd  0xa8(%rsp),%xmm0
+    73ea:	00 00 
+                printf("%+9.1f%%", change);
+    73ec:	48 8d 3d bf 0e 00 00 	lea    0xebf(%rip),%rdi        # 82b2 <_IO_stdin_used+0x2b2>
+    73f3:	b8 01 00 00 00       	mov    $0x1,%eax
+                double change = 100.0 * (result.ns - previous[index].ns) / previous[index].ns;
+    73f8:	f2 0f 5c c1          	subsd  %xmm1,%xmm0
+    73fc:	f2 0f 59 05 64 16 00 	mulsd  0x1664(%rip),%xmm0        # 8a68 <data.2+0x28>
+    7403:	00 
+    7404:	f2 0f 5e c1          	divsd  %xmm1,%xmm0
+                printf("%+9.1f%%", change);
+    7408:	f2 0f 11 44 24 08    	movsd  %xmm0,0x8(%rsp)
+    740e:	e8 3d ad ff ff       	call   2150 <printf@plt>
+                if ((tolerance >= 0) && (change > tolerance)) {
+    7413:	f2 0f 10 64 24 30    	movsd  0x30(%rsp),%xmm4
+    7419:	66 0f ef ed          	pxor   %xmm5,%xmm5
+    741d:	66 0f 2f e5          	comisd %xmm5,%xmm4
+    7421:	72 95                	jb     73b8 <BenchRunAll+0x3f8>
+    7423:	f2 0f 10 44 24 08    	movsd  0x8(%rsp),%xmm0
+    7429:	66 0f 2f c4          	comisd %xmm4,%xmm0
+    742d:	76 89                	jbe    73b8 <BenchRunAll+0x3f8>
+                    printf("  slower");
+    742f:	48 8d 3d 85 0e 00 00 	lea    0xe85(%rip),%rdi        # 82bb <_IO_stdin_used+0x2bb>
+    7436:	31 c0                	xor    %eax,%eax
+        for (int index = 0; index < known; index++) {
+    7438:	48 83 c3 58          	add    $0x58,%rbx
+                    printf("  slower");
+    743c:	e8 0f ad ff ff       	call   2150 <printf@plt>
+                    slower++;
+    7441:	83 44 24 4c 01       	addl   $0x1,0x4c(%rsp)
+        for (int index = 0; index < known; index++) {
+    7446:	4c 39 fb             	cmp    %r15,%rbx
+    7449:	0f 85 76 ff ff ff    	jne    73c5 <BenchRunAll+0x405>
+    744f:	90                   	nop
+        printf("\n");
+    7450:	bf 0a 00 00 00       	mov    $0xa,%edi
+    7455:	e8 f6 ab ff ff       	call   2050 <putchar@plt>
+        if (file) {
+    745a:	48 8b 7c 24 38       	mov    0x38(%rsp),%rdi
+    745f:	48 85 ff             	test   %rdi,%rdi
+    7462:	74 3d                	je     74a1 <BenchRunAll+0x4e1>
+            fprintf(file, first ? "[\n    " BENCH_FORMAT : ",\n    " BENCH_FORMAT, result.name,
+    7464:	48 8d 05 b5 11 00 00 	lea    0x11b5(%rip),%rax        # 8620 <_IO_stdin_used+0x620>
+    746b:	80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    7470:	4c 89 f2             	mov    %r14,%rdx
+    7473:	f2 0f 10 8c 24 b0 00 	movsd  0xb0(%rsp),%xmm1
+    747a:	00 00 
+    747c:	48 8d 35 55 11 00 00 	lea    0x1155(%rip),%rsi        # 85d8 <_IO_stdin_used+0x5d8>
+    7483:	8b 8c 24 a0 00 00 00 	mov    0xa0(%rsp),%ecx
+    748a:	f2 0f 10 84 24 a8 00 	movsd  0xa8(%rsp),%xmm0
+    7491:	00 00 
+    7493:	48 0f 44 f0          	cmove  %rax,%rsi
+    7497:	b8 02 00 00 00       	mov    $0x2,%eax
+    749c:	e8 6f ad ff ff       	call   2210 <fprintf@plt>
+        first = false;
+    74a1:	c6 44 24 1f 00       	movb   $0x0,0x1f(%rsp)
+    for (bench_case_t bench = benchs; bench; bench = bench->next) {
+    74a6:	4d 8b 64 24 18       	mov    0x18(%r12),%r12
+    74ab:	4d 85 e4             	test   %r12,%r12
+    74ae:	0f 85 2c fc ff ff    	jne    70e0 <BenchRunAll+0x120>
+    if (file) {
+    74b4:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+    74b9:	4d 85 c0             	test   %r8,%r8
+    74bc:	74 37                	je     74f5 <BenchRunAll+0x535>
+        fprintf(file, "%s]\n", first ? "[\n" : "\n");
+    74be:	80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    74c3:	48 8d 15 23 0d 00 00 	lea    0xd23(%rip),%rdx        # 81ed <_IO_stdin_used+0x1ed>
+    74ca:	48 8d 05 7f 0d 00 00 	lea    0xd7f(%rip),%rax        # 8250 <_IO_stdin_used+0x250>
+    74d1:	48 0f 45 d0          	cmovne %rax,%rdx
+    74d5:	4c 89 c7             	mov    %r8,%rdi
+    74d8:	48 8d 35 e5 0d 00 00 	lea    0xde5(%rip),%rsi        # 82c4 <_IO_stdin_used+0x2c4>
+    74df:	31 c0                	xor    %eax,%eax
+    74e1:	4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    74e6:	e8 25 ad ff ff       	call   2210 <fprintf@plt>
+        fclose(file);
+    74eb:	48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    74f0:	e8 fb ab ff ff       	call   20f0 <fclose@plt>
+}
+    74f5:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+    74f9:	48 81 c4 68 01 00 00 	add    $0x168,%rsp
+    7500:	5b                   	pop    %rbx
+    7501:	5d                   	pop    %rbp
+    7502:	41 5c                	pop    %r12
+    7504:	41 5d                	pop    %r13
+    7506:	41 5e                	pop    %r14
+    7508:	41 5f                	pop    %r15
+    750a:	c3                   	ret
+    750b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    return !filter || strstr(group, filter) || strstr(name, filter);
+    7510:	48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    7515:	48 89 df             	mov    %rbx,%rdi
+    7518:	e8 f3 ae ff ff       	call   2410 <strstr@plt>
+    751d:	48 85 c0             	test   %rax,%rax
+    7520:	74 84                	je     74a6 <BenchRunAll+0x4e6>
+        if (first) {
+    7522:	80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    7527:	0f 84 e2 fb ff ff    	je     710f <BenchRunAll+0x14f>
+    752d:	0f 1f 00             	nopl   (%rax)
+            printf("%-36s%12s%12s%12s%10s\n", "Benchmark", "Iterations", "ns/op", "cycles/op",
+    7530:	4c 8d 0d 1c 0d 00 00 	lea    0xd1c(%rip),%r9        # 8253 <_IO_stdin_used+0x253>
+    7537:	4c 8d 05 1c 0d 00 00 	lea    0xd1c(%rip),%r8        # 825a <_IO_stdin_used+0x25a>
+    753e:	31 c0                	xor    %eax,%eax
+    7540:	48 8d 0d 1d 0d 00 00 	lea    0xd1d(%rip),%rcx        # 8264 <_IO_stdin_used+0x264>
+    7547:	48 8d 15 1c 0d 00 00 	lea    0xd1c(%rip),%rdx        # 826a <_IO_stdin_used+0x26a>
+    754e:	48 8d 35 20 0d 00 00 	lea    0xd20(%rip),%rsi        # 8275 <_IO_stdin_used+0x275>
+    7555:	48 8d 3d 23 0d 00 00 	lea    0xd23(%rip),%rdi        # 827f <_IO_stdin_used+0x27f>
+    755c:	e8 ef ab ff ff       	call   2150 <printf@plt>
+    7561:	e9 a9 fb ff ff       	jmp    710f <BenchRunAll+0x14f>
+            fprintf(stderr, "unable to write the results to %s\n", output);
+    7566:	48 8b 05 73 3a 00 00 	mov    0x3a73(%rip),%rax        # afe0 <stderr@GLIBC_2.2.5>
+    756d:	4c 89 f2             	mov    %r14,%rdx
+    7570:	48 8d 35 31 11 00 00 	lea    0x1131(%rip),%rsi        # 86a8 <_IO_stdin_used+0x6a8>
+    7577:	48 8b 38             	mov    (%rax),%rdi
+    757a:	31 c0                	xor    %eax,%eax
+    757c:	e8 8f ac ff ff       	call   2210 <fprintf@plt>
+    for (bench_case_t bench = benchs; bench; bench = bench->next) {
+    7581:	4c 8b 25 80 51 00 00 	mov    0x5180(%rip),%r12        # c708 <benchs>
+    7588:	45 31 c0             	xor    %r8d,%r8d
+    758b:	4d 85 e4             	test   %r12,%r12
+    758e:	0f 85 1d fb ff ff    	jne    70b1 <BenchRunAll+0xf1>
+    int slower = 0;
+    7594:	31 d2                	xor    %edx,%edx
+    7596:	89 54 24 4c          	mov    %edx,0x4c(%rsp)
+    759a:	e9 56 ff ff ff       	jmp    74f5 <BenchRunAll+0x535>
+    759f:	31 c0                	xor    %eax,%eax
+        fprintf(file, "%s]\n", first ? "[\n" : "\n");
+    75a1:	48 8d 15 a8 0c 00 00 	lea    0xca8(%rip),%rdx        # 8250 <_IO_stdin_used+0x250>
+    int slower = 0;
+    75a8:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+    75ac:	e9 24 ff ff ff       	jmp    74d5 <BenchRunAll+0x515>
+    75b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    75b8:	00 00 00 
+    75bb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000075c0 <atexit>:
+    75c0:	48 8b 15 81 3c 00 00 	mov    0x3c81(%rip),%rdx        # b248 <__dso_handle>
+    75c7:	31 f6                	xor    %esi,%esi
+    75c9:	e9 82 ad ff ff       	jmp    2350 <__cxa_atexit@plt>
+
+Disassembly of section .fini:
+
+00000000000075d0 <_fini>:
+    75d0:	48 83 ec 08          	sub    $0x8,%rsp
+    75d4:	48 83 c4 08          	add    $0x8,%rsp
+    75d8:	c3                   	ret
@@ -0,0 +1,246 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Stress test of the lock free queues with POSIX threads
+ **
+ ** A producer thread writes a known sequence of bytes in the byte ring with blocks of random
+ ** sizes while the main thread reads and verifies it. Then many producer threads write tagged
+ ** sequences in the multiple producers queue and the main thread verifies that no value was lost
+ ** or duplicated and that the values of every producer arrive in order.
+ **
+ ** @addtogroup samples Samples
+ ** @brief Samples applications with MUJU Framwork
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#ifndef POSIX
+#error "This program can only be compiled for the POSIX board"
+#endif
+
+#include "fifo.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define FIFO_SIZE     1024     //!< Capacity of the byte ring
+#define FIFO_TOTAL    50000000 //!< Amount of bytes transfered by the byte ring test
+
+#define MPSC_SIZE     256      //!< Capacity of the multiple producers queue
+#define MPSC_THREADS  4        //!< Amount of producer threads
+#define MPSC_TOTAL    2000000  //!< Amount of values written by every producer thread
+#define MPSC_BATCH    4        //!< Maximum amount of values written in a single operation
+
+#define PRODUCER_BITS 24       //!< Amount of bits of a value used by the sequence number
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to obtain the elapsed time in seconds since a reference
+ *
+ * @param   start  Reference time obtained when the test started
+ * @return         Seconds elapsed since the reference time
+ */
+static double Elapsed(struct timespec const * start);
+
+/**
+ * @brief Thread that writes the test sequence in the byte ring
+ *
+ * @param   arguments  Unused
+ * @return             Unused
+ */
+static void * FifoProducer(void * arguments);
+
+/**
+ * @brief Thread that writes a tagged sequence of values in the multiple producers queue
+ *
+ * @param   arguments  Number of the producer used as tag of the values
+ * @return             Unused
+ */
+static void * MpscProducer(void * arguments);
+
+/**
+ * @brief Function to run the byte ring test
+ *
+ * @return  Amount of errors found
+ */
+static int FifoTest(void);
+
+/**
+ * @brief Function to run the multiple producers queue test
+ *
+ * @return  Amount of errors found
+ */
+static int MpscTest(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+FIFO_DEFINE(ring, FIFO_SIZE);
+
+MPSC_DEFINE(queue, MPSC_SIZE);
+
+/* === Private function implementation ========================================================= */
+
+static double Elapsed(struct timespec const * start) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static void * FifoProducer(void * arguments) {
+    uint8_t block[FIFO_SIZE / 2];
+    uint32_t sent = 0;
+    unsigned int seed = 1;
+
+    (void)arguments;
+    while (sent < FIFO_TOTAL) {
+        uint32_t size = 1 + rand_r(&seed) % sizeof(block);
+        if (size > FIFO_TOTAL - sent) {
+            size = FIFO_TOTAL - sent;
+        }
+        for (uint32_t index = 0; index < size; index++) {
+            block[index] = (uint8_t)(sent + index);
+        }
+        size = FifoWrite(ring, block, size);
+        if (size == 0) {
+            sched_yield();
+        }
+        sent += size;
+    }
+    return NULL;
+}
+
+static void * MpscProducer(void * arguments) {
+    uint32_t producer = (uint32_t)(uintptr_t)arguments;
+    uint32_t values[MPSC_BATCH];
+    uint32_t sequence = 0;
+    unsigned int seed = producer;
+
+    while (sequence < MPSC_TOTAL) {
+        uint32_t count = 1 + rand_r(&seed) % MPSC_BATCH;
+        if (count > MPSC_TOTAL - sequence) {
+            count = MPSC_TOTAL - sequence;
+        }
+        for (uint32_t index = 0; index < count; index++) {
+            values[index] = (producer << PRODUCER_BITS) | (sequence + index);
+        }
+        if (MpscPushBatch(queue, values, count)) {
+            sequence += count;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static int FifoTest(void) {
+    uint8_t block[FIFO_SIZE];
+    uint32_t received = 0;
+    int errors = 0;
+    pthread_t thread;
+    struct timespec start;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_create(&thread, NULL, FifoProducer, NULL);
+    while (received < FIFO_TOTAL) {
+        uint32_t size = FifoRead(ring, block, sizeof(block));
+        if (size == 0) {
+            sched_yield();
+        }
+        for (uint32_t index = 0; index < size; index++) {
+            if (block[index] != (uint8_t)(received + index)) {
+                errors++;
+            }
+        }
+        received += size;
+    }
+    pthread_join(thread, NULL);
+
+    printf("Fifo: %u bytes in %.3f s, %d errors\r\n", received, Elapsed(&start), errors);
+    return errors;
+}
+
+static int MpscTest(void) {
+    uint32_t values[MPSC_SIZE];
+    uint32_t expected[MPSC_THREADS] = {0};
+    uint32_t received = 0;
+    int errors = 0;
+    pthread_t threads[MPSC_THREADS];
+    struct timespec start;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uintptr_t index = 0; index < MPSC_THREADS; index++) {
+        pthread_create(&threads[index], NULL, MpscProducer, (void *)index);
+    }
+    while (received < MPSC_THREADS * MPSC_TOTAL) {
+        uint32_t count = MpscPopBatch(queue, values, MPSC_SIZE);
+        if (count == 0) {
+            sched_yield();
+        }
+        for (uint32_t index = 0; index < count; index++) {
+            uint32_t producer = values[index] >> PRODUCER_BITS;
+            uint32_t sequence = values[index] & ((1 << PRODUCER_BITS) - 1);
+            if ((producer >= MPSC_THREADS) || (sequence != expected[producer])) {
+                errors++;
+            } else {
+                expected[producer]++;
+            }
+        }
+        received += count;
+    }
+    for (int index = 0; index < MPSC_THREADS; index++) {
+        pthread_join(threads[index], NULL);
+    }
+
+    printf("Mpsc: %u values from %d threads in %.3f s, %u rejected, %d errors\r\n", received,
+           MPSC_THREADS, Elapsed(&start), queue->dropped, errors);
+    return errors;
+}
+
+/* === Public function implementation ========================================================= */
+
+int main(void) {
+    int errors = 0;
+
+    errors += FifoTest();
+    errors += MpscTest();
+    return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -78,6 +78,14 @@ static board_t AssignResources(struct hal_sci_pins_s * console_pins) {
     board.console = HAL_SCI_USART1;
     console_pins->txd_pin = HAL_PIN_PA9;
     console_pins->rxd_pin = HAL_PIN_PA10;
+#elif LONGAN_NANO
+    board.led_rgb[0].red = HAL_GPIO_PC13;
+    board.led_rgb[0].green = HAL_GPIO_PA1;
+    board.led_rgb[0].blue = HAL_GPIO_PA2;
+
+    board.console = HAL_SCI_USART0;
+    console_pins->txd_pin = HAL_PIN_PA9;
+    console_pins->rxd_pin = HAL_PIN_PA10;
 #elif POSIX
     board.led_rgb[0].red = HAL_GPIO3_7;
     board.led_rgb[0].green = HAL_GPIO3_6;
@@ -42,7 +42,12 @@
 
 /* clang-format off */
 
+#ifdef STATIC_ONLY
+#define configSUPPORT_STATIC_ALLOCATION  1
+#define configSUPPORT_DYNAMIC_ALLOCATION 0
+#else
 #define configSUPPORT_STATIC_ALLOCATION  0
+#endif
 
 #define configUSE_PREEMPTION             1
 #define configUSE_IDLE_HOOK              0
@@ -65,7 +70,15 @@
 #define configUSE_MALLOC_FAILED_HOOK     0
 #define configUSE_APPLICATION_TASK_TAG   0
 #define configUSE_COUNTING_SEMAPHORES    1
+#ifdef USE_RUNTIME_STATS
+#include "runtime_counter.h"
+#else
 #define configGENERATE_RUN_TIME_STATS    0
+#endif
+
+#ifdef USE_TRACE
+#include "trace_freertos.h"
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
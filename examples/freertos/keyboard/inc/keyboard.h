@@ -73,6 +73,18 @@ typedef struct keyboard_s * keyboard_t;
  */
 keyboard_t KeyboardCreate(board_t board);
 
+/**
+ * @brief Function to create a keyboard descriptor without using the kernel heap
+ *
+ * The task and the events group are created on statically allocated memory, so this function is
+ * the only one available when the project is built with static only allocation.
+ *
+ * @param  board   Pointer to board descriptor
+ *
+ * @return keyboard_t Pointer to keyboard descriptor
+ */
+keyboard_t KeyboardCreateStatic(board_t board);
+
 /**
  * @brief Functio to wait a keyboard event
  *
@@ -50,6 +50,11 @@ typedef struct keyboard_s {
     board_t board;                 //!< Pointer to board descriptor
     TaskHandle_t task;             //!< Pointer to task descriptor
     EventGroupHandle_t key_events; //!< Events group to comunicate key actions
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    StaticTask_t task_buffer;           //!< Memory to store the task control block
+    StackType_t task_stack[TASK_STACK]; //!< Memory used as stack by the task
+    StaticEventGroup_t events_buffer;   //!< Memory to store the events group control block
+#endif
 };
 
 /* === Private variable declarations =========================================================== */
@@ -117,6 +122,7 @@ static void KeyTask(void * object) {
 
 /* === Public function implementation ========================================================= */
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 keyboard_t KeyboardCreate(board_t board) {
     keyboard_t self = CreateInstance();
 
@@ -133,6 +139,21 @@ keyboard_t KeyboardCreate(board_t board) {
 
     return self;
 }
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+keyboard_t KeyboardCreateStatic(board_t board) {
+    keyboard_t self = CreateInstance();
+
+    if (self) {
+        self->board = board;
+        self->key_events = xEventGroupCreateStatic(&self->events_buffer);
+        self->task = xTaskCreateStatic(KeyTask, "Keyboard", TASK_STACK, self, TASK_PRIORITY,
+                                       self->task_stack, &self->task_buffer);
+    }
+    return self;
+}
+#endif
 
 uint8_t KeyboardWait(keyboard_t keyboard, uint8_t events) {
     return xEventGroupWaitBits(keyboard->key_events, events, TRUE, FALSE, portMAX_DELAY);
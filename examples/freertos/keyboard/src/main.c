@@ -40,6 +40,8 @@ SPDX-License-Identifier: MIT
 
 /* === Macros definitions ====================================================================== */
 
+#define TASK_STACK     256
+
 #define EVENT_TEC1_ON  (1 << 0)
 #define EVENT_TEC2_ON  (1 << 1)
 #define EVENT_TEC3_ON  (1 << 2)
@@ -116,10 +118,18 @@ static void FlashTask(void * object) {
 
 int main(void) {
     static struct flash_s flash[3];
+#ifdef STATIC_ONLY
+    static StaticTask_t tasks[3];
+    static StackType_t stacks[3][TASK_STACK];
+#endif
 
     /* Inicializaciones y configuraciones de dispositivos */
     board_t board = BoardCreate();
+#ifdef STATIC_ONLY
+    keyboard_t keyboard = KeyboardCreateStatic(board);
+#else
     keyboard_t keyboard = KeyboardCreate(board);
+#endif
 
     if (keyboard == NULL) {
         StopByError(board, 0);
@@ -141,15 +151,33 @@ int main(void) {
     flash[2].delay = 750;
 
     /* Creación de las tareas */
-    if (xTaskCreate(FlashTask, "Red", 256, &flash[0], tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+#ifdef STATIC_ONLY
+    if (xTaskCreateStatic(FlashTask, "Red", TASK_STACK, &flash[0], tskIDLE_PRIORITY + 1, stacks[0],
+                          &tasks[0]) == NULL) {
+        StopByError(board, 1);
+    }
+    if (xTaskCreateStatic(FlashTask, "Yellow", TASK_STACK, &flash[1], tskIDLE_PRIORITY + 1,
+                          stacks[1], &tasks[1]) == NULL) {
+        StopByError(board, 2);
+    }
+    if (xTaskCreateStatic(FlashTask, "Green", TASK_STACK, &flash[2], tskIDLE_PRIORITY + 1,
+                          stacks[2], &tasks[2]) == NULL) {
+        StopByError(board, 3);
+    }
+#else
+    if (xTaskCreate(FlashTask, "Red", TASK_STACK, &flash[0], tskIDLE_PRIORITY + 1, NULL) !=
+        pdPASS) {
         StopByError(board, 1);
     }
-    if (xTaskCreate(FlashTask, "Yellow", 256, &flash[1], tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+    if (xTaskCreate(FlashTask, "Yellow", TASK_STACK, &flash[1], tskIDLE_PRIORITY + 1, NULL) !=
+        pdPASS) {
         StopByError(board, 2);
     }
-    if (xTaskCreate(FlashTask, "Green", 256, &flash[2], tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+    if (xTaskCreate(FlashTask, "Green", TASK_STACK, &flash[2], tskIDLE_PRIORITY + 1, NULL) !=
+        pdPASS) {
         StopByError(board, 3);
     }
+#endif
 
     /* Arranque del sistema operativo */
     vTaskStartScheduler();
@@ -0,0 +1,287 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Sample to measure the context switch time and the interrupt latency of FreeRTOS
+ **
+ ** Two tasks with the same priority yield the processor to each other, the time from the yield
+ ** of one task until the other one resumes is the context switch time. The tick hook notifies a
+ ** task with the highest priority, the time from the notification until the task resumes is the
+ ** interrupt to task latency. Both times are measured with the cycle counter of the hal and a
+ ** summary is sent through the console every second, so the same program can be used to compare
+ ** the ports of the kernel on any board.
+ **
+ ** @addtogroup sample-freertos FreeRTOS Sample
+ ** @ingroup samples
+ ** @brief Samples applications with MUJU Framwork
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bsp.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Amount of ticks between the notifications sent by the tick hook
+ */
+#define LATENCY_PERIOD_TICKS 2
+
+/**
+ * @brief Time between the reports of the measurements, in milliseconds
+ */
+#define REPORT_PERIOD_MS     1000
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Structure with the statistics of a measured time, in cycles of the counter
+ */
+typedef struct stats_s {
+    uint32_t count;   /**< Amount of accumulated samples */
+    uint32_t minimum; /**< Minimum measured time */
+    uint32_t maximum; /**< Maximum measured time */
+    uint64_t total;   /**< Sum of the measured times to calculate the average */
+} * stats_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to add a sample to the statistics of a measured time
+ *
+ * @param  stats    Pointer to the structure with the statistics to update
+ * @param  sample   Time measured, in cycles of the counter
+ */
+static void StatsAddSample(stats_t stats, uint32_t sample);
+
+/**
+ * @brief Function to send the statistics of a measured time through the console and clear them
+ *
+ * @param  console  Pointer to structure with descriptor of serial port used as console
+ * @param  name     Name of the measured time
+ * @param  stats    Pointer to the structure with the statistics to report
+ */
+static void StatsReport(hal_sci_t console, char const * name, stats_t stats);
+
+/**
+ * @brief Function to make a blocking sending of a string through the serial port used as console
+ *
+ * @param  console  Pointer to structure with descriptor of serial port used as console
+ * @param  message  Pointer to string to send by serial port used as console
+ */
+static void ConsoleSend(hal_sci_t console, char const * message);
+
+/**
+ * @brief Function to yield the processor to another task with the same priority
+ *
+ * @param  object   Not used, all the instances share the measurement of the switch time
+ */
+static void SwitchTask(void * object);
+
+/**
+ * @brief Function to wait the notifications sent from the tick interrupt
+ *
+ * @param  object   Not used, the notification time is written by the tick hook
+ */
+static void LatencyTask(void * object);
+
+/**
+ * @brief Function to send periodically the measurements through the console
+ *
+ * @param  object   Pointer to board structure, used as parameter when task created
+ */
+static void ReportTask(void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Statistics of the time from a yield until the other task resumes
+ */
+static struct stats_s switch_stats;
+
+/**
+ * @brief Statistics of the time from the notification in the tick interrupt until the task resumes
+ */
+static struct stats_s latency_stats;
+
+/**
+ * @brief Value of the cycle counter just before the last yield
+ */
+static volatile uint32_t switch_start;
+
+/**
+ * @brief Flag to indicate that the switch start time is valid
+ */
+static volatile bool switch_started;
+
+/**
+ * @brief Value of the cycle counter just before the last notification of the tick hook
+ */
+static volatile uint32_t latency_start;
+
+/**
+ * @brief Handle of the task notified by the tick hook
+ */
+static TaskHandle_t latency_task;
+
+/* === Private function implementation ========================================================= */
+
+static void StatsAddSample(stats_t stats, uint32_t sample) {
+    if ((stats->count == 0) || (sample < stats->minimum)) {
+        stats->minimum = sample;
+    }
+    if ((stats->count == 0) || (sample > stats->maximum)) {
+        stats->maximum = sample;
+    }
+    stats->total += sample;
+    stats->count++;
+}
+
+static void StatsReport(hal_sci_t console, char const * name, stats_t stats) {
+    struct stats_s current;
+    char line[96];
+
+    taskENTER_CRITICAL();
+    current = *stats;
+    memset(stats, 0, sizeof(*stats));
+    taskEXIT_CRITICAL();
+
+    if (current.count) {
+        snprintf(line, sizeof(line), "%s: %lu samples, min %lu, avg %lu, max %lu cycles\r\n", name,
+                 (unsigned long)current.count, (unsigned long)current.minimum,
+                 (unsigned long)(current.total / current.count), (unsigned long)current.maximum);
+        ConsoleSend(console, line);
+    }
+}
+
+static void ConsoleSend(hal_sci_t console, char const * message) {
+    uint16_t pending = strlen(message);
+    uint16_t sended;
+
+    while (pending) {
+        sended = SciSendData(console, message, pending);
+        message += sended;
+        pending -= sended;
+    }
+}
+
+static void SwitchTask(void * object) {
+    uint32_t now;
+
+    while (true) {
+        now = CyclesRead();
+
+        /* The report task has a greater priority, so the update is protected to not lose it */
+        taskENTER_CRITICAL();
+        if (switch_started) {
+            StatsAddSample(&switch_stats, now - switch_start);
+        }
+        switch_started = true;
+        taskEXIT_CRITICAL();
+
+        switch_start = CyclesRead();
+        taskYIELD();
+    }
+}
+
+static void LatencyTask(void * object) {
+    uint32_t now;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        now = CyclesRead();
+
+        /* The yield of a switch task could be interrupted by the tick, the time of that switch is
+         * discarded because it includes the execution of this task */
+        switch_started = false;
+        StatsAddSample(&latency_stats, now - latency_start);
+    }
+}
+
+static void ReportTask(void * object) {
+    board_t board = object;
+    char line[64];
+
+    snprintf(line, sizeof(line), "Cycle counter at %lu Hz\r\n", (unsigned long)CyclesFrequency());
+    ConsoleSend(board->console, line);
+
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(REPORT_PERIOD_MS));
+
+        switch_started = false;
+        GpioBitToggle(board->led_rgb->green);
+        StatsReport(board->console, "Context switch", &switch_stats);
+        StatsReport(board->console, "Interrupt to task", &latency_stats);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void vApplicationTickHook(void) {
+    static uint32_t ticks = 0;
+
+    if (++ticks >= LATENCY_PERIOD_TICKS) {
+        ticks = 0;
+        latency_start = CyclesRead();
+
+        /* The notified task has the highest priority, the kernel requests the switch itself when
+         * the tick interrupt returns */
+        vTaskNotifyGiveFromISR(latency_task, NULL);
+    }
+}
+
+int main(void) {
+    /* Inicializaciones y configuraciones de dispositivos */
+    board_t board = BoardCreate();
+    CyclesStart();
+
+    /* Creación de las tareas */
+    xTaskCreate(LatencyTask, "Latency", 256, NULL, tskIDLE_PRIORITY + 3, &latency_task);
+    xTaskCreate(ReportTask, "Report", 256, (void *)board, tskIDLE_PRIORITY + 2, NULL);
+    xTaskCreate(SwitchTask, "Ping", 256, NULL, tskIDLE_PRIORITY + 1, NULL);
+    xTaskCreate(SwitchTask, "Pong", 256, NULL, tskIDLE_PRIORITY + 1, NULL);
+
+    /* Arranque del sistema operativo */
+    vTaskStartScheduler();
+
+    /* vTaskStartScheduler solo retorna si se detiene el sistema operativo */
+    while (true) {
+    }
+
+    /* El valor de retorno es solo para evitar errores en el compilador*/
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -42,7 +42,11 @@
 
 /* clang-format off */
 
-#define configSUPPORT_STATIC_ALLOCATION  0
+/* The tasks of this example are created dynamically, only the keyboard example supports the
+ * static only allocation mode */
+#ifdef STATIC_ONLY
+#error "This example can not be built with STATIC_ONLY=y"
+#endif
 
 #define configUSE_PREEMPTION             1
 #define configUSE_IDLE_HOOK              0
@@ -65,7 +69,15 @@
 #define configUSE_MALLOC_FAILED_HOOK     0
 #define configUSE_APPLICATION_TASK_TAG   0
 #define configUSE_COUNTING_SEMAPHORES    1
+#ifdef USE_RUNTIME_STATS
+#include "runtime_counter.h"
+#else
 #define configGENERATE_RUN_TIME_STATS    0
+#endif
+
+#ifdef USE_TRACE
+#include "trace_freertos.h"
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
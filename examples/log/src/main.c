@@ -0,0 +1,98 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Deferred binary logging sample on the POSIX board
+ **
+ ** The program writes log messages and sends the encoded records to the standard output, so the
+ ** whole pipeline can be tested in the host with the decoder of the log module:
+ **
+ **     ./build/bin/log.out | ../../module/log/tools/log_decode.py build/bin/log.out
+ **
+ ** @addtogroup samples Samples
+ ** @brief Samples applications with MUJU Framwork
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#ifndef POSIX
+#error "This program can only be compiled for the POSIX board"
+#endif
+
+#include "log.h"
+#include <stdio.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define MESSAGES 20 //!< Amount of iterations of the messages loop
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to send the encoded records in the log ring to the standard output
+ */
+static void SendRecords(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void SendRecords(void) {
+    uint8_t buffer[256];
+    size_t size;
+
+    do {
+        size = LogRead(buffer, sizeof(buffer));
+        fwrite(buffer, 1, size, stdout);
+    } while (size > 0);
+    fflush(stdout);
+}
+
+/* === Public function implementation ========================================================= */
+
+int main(void) {
+    LogInfo("Log sample started");
+    for (int index = 0; index < MESSAGES; index++) {
+        LogInfo("Iteration %d of %d, value 0x%08X", index, MESSAGES, index * 0x01010101);
+        if (index % 5 == 0) {
+            LogWarning("Temperature %d.%d C out of range", -10 - index, index % 10);
+        }
+        LogDebug("This message is removed with the default level");
+        SendRecords();
+    }
+    LogError("Sample finished, %u messages lost, char %c", LogLost(), 'A');
+    SendRecords();
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,336 @@
+/*
+ * FreeRTOS Kernel V10.4.3 LTS Patch 2
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Nuclei N200 core
+ * with the ECLIC interrupt controller, as found on the GD32VF103.
+ *----------------------------------------------------------*/
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The machine timer and its compare register are 64-bit values, the timer
+runs with a quarter of the core clock on the GD32VF103. */
+#ifndef configMTIME_HZ
+	#define configMTIME_HZ ( ( configCPU_CLOCK_HZ ) / 4UL )
+#endif
+
+#define portMTIME_ADDRESS			( 0xd1000000UL )
+#define portMTIMECMP_ADDRESS		( 0xd1000008UL )
+
+/* ECLIC registers, each interrupt source has four byte wide registers for the
+pending, enable, attributes and control. */
+#define portECLIC_CFG_ADDRESS		( 0xd2000000UL )
+#define portECLIC_INT_ADDRESS( x )	( 0xd2001000UL + ( ( x ) * 4UL ) )
+#define portECLIC_INT_IP			0
+#define portECLIC_INT_IE			1
+#define portECLIC_INT_ATTR			2
+#define portECLIC_INT_CTRL			3
+
+/* The software and the timer interrupts of the core. */
+#define portECLIC_MSIP_SOURCE		3
+#define portECLIC_MTIP_SOURCE		7
+
+/* Hardware vectored, level triggered interrupt. */
+#define portECLIC_ATTR_VECTORED		0x01
+
+/* All the bits of the interrupt control register are used for the level. */
+#define portECLIC_CFG_NLBITS		( portECLIC_LEVEL_BITS << 1 )
+
+#define portKERNEL_INTERRUPT_CTRL	( ( portKERNEL_INTERRUPT_LEVEL << ( 8 - portECLIC_LEVEL_BITS ) ) | ( ( 1 << ( 8 - portECLIC_LEVEL_BITS ) ) - 1 ) )
+
+/* The mtvec mode field selects the ECLIC interrupt mode. */
+#define portMTVEC_MODE_MASK			0x3fUL
+#define portMTVEC_MODE_ECLIC		0x03UL
+
+/* The N200 interrupt status register, its most significant byte holds the
+level of the interrupt being served. */
+#define portCSR_MINTSTATUS			"0x346"
+
+/* On the N200 the mcause register mirrors the previous privilege mode and
+interrupt enable of mstatus, and also holds the previous interrupt level that
+is restored by mret.  Tasks start in machine mode with the interrupts enabled
+and at the thread level. */
+#define portINITIAL_MCAUSE			0x38000000UL
+
+/* The context saved by the software interrupt handler, see portASM.s. */
+#define portCONTEXT_SIZE_WORDS		32
+#define portCONTEXT_MEPC			0
+#define portCONTEXT_RA				1
+#define portCONTEXT_A0				8
+#define portCONTEXT_MCAUSE			30
+
+/* Let the user override the pre-loading of the initial RA with the address of
+prvTaskExitError() in case it messes up unwinding of the stack in the
+debugger. */
+#ifdef configTASK_RETURN_ADDRESS
+	#define portTASK_RETURN_ADDRESS	configTASK_RETURN_ADDRESS
+#else
+	#define portTASK_RETURN_ADDRESS	prvTaskExitError
+#endif
+
+/*
+ * Setup the timer to generate the tick interrupts.  The implementation in this
+ * file is weak to allow application writers to change the timer used to
+ * generate the tick interrupt.
+ */
+void vPortSetupTimerInterrupt( void ) __attribute__(( weak ));
+
+/*
+ * The tick interrupt, its address is placed in the vector table of the ECLIC
+ * by the startup code.  The handler does not switch the context, it only pends
+ * the software interrupt when a switch is required.
+ */
+void eclic_mtip_handler( void ) __attribute__(( interrupt ));
+
+/*
+ * Start first task is a separate function so it can be tested in isolation.
+ */
+extern void xPortStartFirstTask( void );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+/*
+ * Configure an interrupt of the core as hardware vectored at the kernel level.
+ */
+static void prvEnableKernelInterrupt( uint32_t ulSource );
+
+/*
+ * Program the 64-bit compare register of the machine timer.
+ */
+static void prvSetTimerCompare( uint64_t ullCompare );
+
+/*-----------------------------------------------------------*/
+
+/* The software interrupt is masked while the count is not zero, so the context
+is never switched inside a critical section and a single count is enough. */
+static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+
+/* Used to program the machine timer compare register. */
+static uint64_t ullNextTime = 0ULL;
+static uint32_t ulTimerIncrementsForOneTick = 0UL;
+
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+UBaseType_t uxIndex;
+
+	/* Simulate the stack frame as it would be created by a context switch
+	interrupt.  The registers that are not initialised with a known value are
+	cleared. */
+	pxTopOfStack -= portCONTEXT_SIZE_WORDS;
+	for( uxIndex = 0; uxIndex < portCONTEXT_SIZE_WORDS; uxIndex++ )
+	{
+		pxTopOfStack[ uxIndex ] = 0;
+	}
+
+	pxTopOfStack[ portCONTEXT_MEPC ] = ( StackType_t ) pxCode;
+	pxTopOfStack[ portCONTEXT_RA ] = ( StackType_t ) portTASK_RETURN_ADDRESS;
+	pxTopOfStack[ portCONTEXT_A0 ] = ( StackType_t ) pvParameters;
+	pxTopOfStack[ portCONTEXT_MCAUSE ] = portINITIAL_MCAUSE;
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+volatile uint32_t ulDummy = 0UL;
+
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ).
+
+	Artificially force an assert() to be triggered if configASSERT() is
+	defined, then stop here so application writers can catch the error. */
+	configASSERT( uxCriticalNesting == ~0UL );
+	portDISABLE_INTERRUPTS();
+	while( ulDummy == 0 )
+	{
+		/* This file calls prvTaskExitError() after the scheduler has been
+		started to remove a compiler warning about the function being defined
+		but never called.  ulDummy is used purely to quieten other warnings
+		about code appearing after this function is called - making ulDummy
+		volatile makes the compiler think the function could return and
+		therefore not output an 'unreachable code' warning for code that appears
+		after it. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEnableKernelInterrupt( uint32_t ulSource )
+{
+volatile uint8_t * const pucInterrupt = ( volatile uint8_t * ) portECLIC_INT_ADDRESS( ulSource );
+
+	pucInterrupt[ portECLIC_INT_IE ] = 0;
+	pucInterrupt[ portECLIC_INT_IP ] = 0;
+	pucInterrupt[ portECLIC_INT_ATTR ] = portECLIC_ATTR_VECTORED;
+	pucInterrupt[ portECLIC_INT_CTRL ] = portKERNEL_INTERRUPT_CTRL;
+	pucInterrupt[ portECLIC_INT_IE ] = 1;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+uint32_t ulMtvec;
+
+	/* Select the ECLIC interrupt mode and use all the bits of the interrupt
+	control registers as level, so the threshold compares the levels only. */
+	__asm volatile( "csrr %0, mtvec" : "=r"( ulMtvec ) );
+	ulMtvec = ( ulMtvec & ~portMTVEC_MODE_MASK ) | portMTVEC_MODE_ECLIC;
+	__asm volatile( "csrw mtvec, %0" :: "r"( ulMtvec ) );
+	*( ( volatile uint8_t * ) portECLIC_CFG_ADDRESS ) = portECLIC_CFG_NLBITS;
+
+	/* Both kernel interrupts are at the lowest level, so a context switch
+	requested by an interrupt is taken just after it returns, without a switch
+	for every nested interrupt. */
+	*( ( volatile uint32_t * ) portMSIP_ADDRESS ) = 0UL;
+	prvEnableKernelInterrupt( portECLIC_MSIP_SOURCE );
+
+	/* Start the timer that generates the tick ISR.  Interrupts are disabled
+	here already. */
+	vPortSetupTimerInterrupt();
+	prvEnableKernelInterrupt( portECLIC_MTIP_SOURCE );
+
+	/* Initialise the critical nesting count ready for the first task. */
+	uxCriticalNesting = 0;
+
+	/* Start the first task. */
+	xPortStartFirstTask();
+
+	/* Should never get here as the tasks will now be executing!  Call the task
+	exit error function to prevent compiler warnings about a static function
+	not being called in the case that the application writer overrides this
+	functionality by defining configTASK_RETURN_ADDRESS. */
+	prvTaskExitError();
+
+	/* Should not get here! */
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	/* Not implemented in ports where there is nothing to return to.
+	Artificially force an assert. */
+	configASSERT( uxCriticalNesting == 1000UL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	portDISABLE_INTERRUPTS();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		portENABLE_INTERRUPTS();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetTimerCompare( uint64_t ullCompare )
+{
+volatile uint32_t * const pulCompare = ( volatile uint32_t * ) portMTIMECMP_ADDRESS;
+
+	/* The high word is written first with its greatest value, so the compare
+	can not match while the low word is updated. */
+	pulCompare[ 1 ] = UINT32_MAX;
+	pulCompare[ 0 ] = ( uint32_t ) ullCompare;
+	pulCompare[ 1 ] = ( uint32_t ) ( ullCompare >> 32 );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetupTimerInterrupt( void )
+{
+volatile uint32_t * const pulTime = ( volatile uint32_t * ) portMTIME_ADDRESS;
+uint32_t ulCurrentTimeHigh, ulCurrentTimeLow;
+
+	/* The core clock could be a variable, so the increment is calculated when
+	the scheduler starts. */
+	ulTimerIncrementsForOneTick = ( uint32_t ) ( ( configMTIME_HZ ) / ( configTICK_RATE_HZ ) );
+
+	do
+	{
+		ulCurrentTimeHigh = pulTime[ 1 ];
+		ulCurrentTimeLow = pulTime[ 0 ];
+	} while( ulCurrentTimeHigh != pulTime[ 1 ] );
+
+	ullNextTime = ( ( uint64_t ) ulCurrentTimeHigh << 32 ) | ulCurrentTimeLow;
+	ullNextTime += ulTimerIncrementsForOneTick;
+	prvSetTimerCompare( ullNextTime );
+}
+/*-----------------------------------------------------------*/
+
+void eclic_mtip_handler( void )
+{
+	/* The next compare is calculated from the previous one and not from the
+	current time, so the latency of this handler does not add drift to the
+	tick.  Writing the compare clears the interrupt request. */
+	ullNextTime += ulTimerIncrementsForOneTick;
+	prvSetTimerCompare( ullNextTime );
+
+	/* The interrupt is hardware vectored so it runs with the interrupts
+	disabled, there is no need to raise the threshold here. */
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		/* A context switch is required, it is performed by the software
+		interrupt once this handler returns. */
+		portYIELD();
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configASSERT_DEFINED == 1 )
+
+	void vPortValidateInterruptPriority( void )
+	{
+	uint32_t ulCurrentLevel;
+
+		/* The current interrupt level is held in the most significant byte of
+		the mintstatus register. */
+		__asm volatile( "csrr %0, " portCSR_MINTSTATUS : "=r"( ulCurrentLevel ) );
+		ulCurrentLevel >>= 24;
+
+		/* Interrupts that use the FreeRTOS API must not have a level greater
+		than configMAX_SYSCALL_INTERRUPT_LEVEL, otherwise they could preempt a
+		critical section of the kernel. */
+		configASSERT( ulCurrentLevel <= portMAX_SYSCALL_MTH );
+	}
+
+#endif /* configASSERT_DEFINED */
@@ -0,0 +1,170 @@
+/*
+ * FreeRTOS Kernel V10.4.3 LTS Patch 2
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Context switch of the Nuclei N200 port.  The software interrupt of the core
+ * is hardware vectored by the ECLIC, so its handler is entered directly from
+ * the vector table with the interrupts disabled and mepc and mcause holding
+ * the state of the interrupted task.  It is configured at the lowest level, as
+ * the tick, so it is only taken when no other interrupt is being served and the
+ * context is switched once however many interrupts requested it.
+ *
+ * The context frame is 32 words, keeping the stack aligned to 16 bytes:
+ *
+ *  [0]      mepc
+ *  [1]      x1 (ra)
+ *  [2..29]  x4 to x31
+ *  [30]     mcause, with the previous interrupt enable, mode and level
+ *  [31]     unused
+ *
+ * sp is kept in the TCB and gp is never changed by the tasks.
+ */
+
+#define portWORD_SIZE			4
+#define portCONTEXT_SIZE		( 32 * portWORD_SIZE )
+#define portCONTEXT_MCAUSE		( 30 * portWORD_SIZE )
+
+#define portMSIP_ADDRESS		0xd1000ffc
+#define portECLIC_MTH_ADDRESS	0xd200000b
+
+#define portMSTATUS_MIE			0x08
+
+.global xPortStartFirstTask
+.global eclic_msip_handler
+.extern pxCurrentTCB
+.extern vTaskSwitchContext
+
+/*-----------------------------------------------------------*/
+
+.section .text
+
+.align 2
+xPortStartFirstTask:
+	csrci mstatus, portMSTATUS_MIE
+
+	/* The scheduler was started with the interrupts disabled through the
+	threshold, the first task runs with all of them enabled. */
+	li t0, portECLIC_MTH_ADDRESS
+	sb zero, 0( t0 )
+
+	lw sp, pxCurrentTCB
+	lw sp, 0( sp )
+	j prvRestoreContext
+
+/*-----------------------------------------------------------*/
+
+.align 2
+eclic_msip_handler:
+	addi sp, sp, -portCONTEXT_SIZE
+	sw x1, 1 * portWORD_SIZE( sp )
+	sw x4, 2 * portWORD_SIZE( sp )
+	sw x5, 3 * portWORD_SIZE( sp )
+	sw x6, 4 * portWORD_SIZE( sp )
+	sw x7, 5 * portWORD_SIZE( sp )
+	sw x8, 6 * portWORD_SIZE( sp )
+	sw x9, 7 * portWORD_SIZE( sp )
+	sw x10, 8 * portWORD_SIZE( sp )
+	sw x11, 9 * portWORD_SIZE( sp )
+	sw x12, 10 * portWORD_SIZE( sp )
+	sw x13, 11 * portWORD_SIZE( sp )
+	sw x14, 12 * portWORD_SIZE( sp )
+	sw x15, 13 * portWORD_SIZE( sp )
+	sw x16, 14 * portWORD_SIZE( sp )
+	sw x17, 15 * portWORD_SIZE( sp )
+	sw x18, 16 * portWORD_SIZE( sp )
+	sw x19, 17 * portWORD_SIZE( sp )
+	sw x20, 18 * portWORD_SIZE( sp )
+	sw x21, 19 * portWORD_SIZE( sp )
+	sw x22, 20 * portWORD_SIZE( sp )
+	sw x23, 21 * portWORD_SIZE( sp )
+	sw x24, 22 * portWORD_SIZE( sp )
+	sw x25, 23 * portWORD_SIZE( sp )
+	sw x26, 24 * portWORD_SIZE( sp )
+	sw x27, 25 * portWORD_SIZE( sp )
+	sw x28, 26 * portWORD_SIZE( sp )
+	sw x29, 27 * portWORD_SIZE( sp )
+	sw x30, 28 * portWORD_SIZE( sp )
+	sw x31, 29 * portWORD_SIZE( sp )
+
+	csrr t0, mepc
+	sw t0, 0( sp )
+	csrr t0, mcause
+	sw t0, portCONTEXT_MCAUSE( sp )
+
+	lw t0, pxCurrentTCB
+	sw sp, 0( t0 )
+
+	/* Clear the request served by this switch, any later one is taken once
+	the interrupts are enabled again by mret. */
+	li t0, portMSIP_ADDRESS
+	sw zero, 0( t0 )
+
+	call vTaskSwitchContext
+
+	lw sp, pxCurrentTCB
+	lw sp, 0( sp )
+
+prvRestoreContext:
+	/* Restoring mcause also restores the interrupt enable, mode and level
+	of the task, they are applied by mret. */
+	lw t0, 0( sp )
+	csrw mepc, t0
+	lw t0, portCONTEXT_MCAUSE( sp )
+	csrw mcause, t0
+
+	lw x1, 1 * portWORD_SIZE( sp )
+	lw x4, 2 * portWORD_SIZE( sp )
+	lw x5, 3 * portWORD_SIZE( sp )
+	lw x6, 4 * portWORD_SIZE( sp )
+	lw x7, 5 * portWORD_SIZE( sp )
+	lw x8, 6 * portWORD_SIZE( sp )
+	lw x9, 7 * portWORD_SIZE( sp )
+	lw x10, 8 * portWORD_SIZE( sp )
+	lw x11, 9 * portWORD_SIZE( sp )
+	lw x12, 10 * portWORD_SIZE( sp )
+	lw x13, 11 * portWORD_SIZE( sp )
+	lw x14, 12 * portWORD_SIZE( sp )
+	lw x15, 13 * portWORD_SIZE( sp )
+	lw x16, 14 * portWORD_SIZE( sp )
+	lw x17, 15 * portWORD_SIZE( sp )
+	lw x18, 16 * portWORD_SIZE( sp )
+	lw x19, 17 * portWORD_SIZE( sp )
+	lw x20, 18 * portWORD_SIZE( sp )
+	lw x21, 19 * portWORD_SIZE( sp )
+	lw x22, 20 * portWORD_SIZE( sp )
+	lw x23, 21 * portWORD_SIZE( sp )
+	lw x24, 22 * portWORD_SIZE( sp )
+	lw x25, 23 * portWORD_SIZE( sp )
+	lw x26, 24 * portWORD_SIZE( sp )
+	lw x27, 25 * portWORD_SIZE( sp )
+	lw x28, 26 * portWORD_SIZE( sp )
+	lw x29, 27 * portWORD_SIZE( sp )
+	lw x30, 28 * portWORD_SIZE( sp )
+	lw x31, 29 * portWORD_SIZE( sp )
+	addi sp, sp, portCONTEXT_SIZE
+
+	mret
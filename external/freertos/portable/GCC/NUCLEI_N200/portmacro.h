@@ -0,0 +1,201 @@
+/*
+ * FreeRTOS Kernel V10.4.3 LTS Patch 2
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	uint32_t
+#define portBASE_TYPE	long
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+
+	/* 32-bit tick type on a 32-bit architecture, so reads of the tick count do
+	not need to be guarded with a critical section. */
+	#define portTICK_TYPE_IS_ATOMIC 1
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			16
+/*-----------------------------------------------------------*/
+
+/* ECLIC levels, unlike the Cortex-M priorities a greater number is a more
+urgent interrupt.  The kernel uses the lowest level for both the tick and the
+software interrupt that switches the context, so the switch is only taken once
+every other pending interrupt has been served.  The critical sections only mask
+the interrupts up to configMAX_SYSCALL_INTERRUPT_LEVEL, the interrupts with a
+greater level are never delayed by the kernel but must not call its API. */
+#define portKERNEL_INTERRUPT_LEVEL	0
+
+#ifndef configMAX_SYSCALL_INTERRUPT_LEVEL
+	#define configMAX_SYSCALL_INTERRUPT_LEVEL 7
+#endif
+
+#if( configMAX_SYSCALL_INTERRUPT_LEVEL < 1 ) || ( configMAX_SYSCALL_INTERRUPT_LEVEL > 15 )
+	#error configMAX_SYSCALL_INTERRUPT_LEVEL must be between 1 and 15
+#endif
+
+/* The GD32VF103 implements four bits of each interrupt control register and
+they are all used for the level, the unimplemented low bits read as ones. */
+#define portECLIC_LEVEL_BITS		4
+#define portECLIC_MTH_ADDRESS		( 0xd200000bUL )
+#define portMSIP_ADDRESS			( 0xd1000ffcUL )
+
+#define portMAX_SYSCALL_MTH			( ( configMAX_SYSCALL_INTERRUPT_LEVEL << ( 8 - portECLIC_LEVEL_BITS ) ) | ( ( 1 << ( 8 - portECLIC_LEVEL_BITS ) ) - 1 ) )
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities. */
+#define portYIELD()																	\
+{																					\
+	/* Pend the software interrupt, it is taken as soon as the threshold		\
+	allows it. */																	\
+	*( ( volatile uint32_t * ) portMSIP_ADDRESS ) = 1UL;							\
+	__asm volatile( "fence" ::: "memory" );											\
+}
+
+#define portEND_SWITCHING_ISR( xSwitchRequired ) if( xSwitchRequired != pdFALSE ) portYIELD()
+#define portYIELD_FROM_ISR( x ) portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management. */
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+
+#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortRaiseThreshold()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortSetThreshold(x)
+#define portDISABLE_INTERRUPTS()				( void ) ulPortRaiseThreshold()
+#define portENABLE_INTERRUPTS()					vPortSetThreshold(0)
+#define portENTER_CRITICAL()					vPortEnterCritical()
+#define portEXIT_CRITICAL()						vPortExitCritical()
+
+#if( configASSERT_DEFINED == 1 )
+	void vPortValidateInterruptPriority( void );
+	#define portASSERT_IF_INTERRUPT_PRIORITY_INVALID() 	vPortValidateInterruptPriority()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
+#endif
+
+#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+
+	/* Check the configuration. */
+	#if( configMAX_PRIORITIES > 32 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+	#endif
+
+	/* Store/clear the ready priorities in a bit map. */
+	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+	/*-----------------------------------------------------------*/
+
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31UL - __builtin_clz( uxReadyPriorities ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site.  These are
+not necessary for to use this port.  They are defined so the common demo files
+(which build with all the ports) will build. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+#define portNOP() __asm volatile 	( " nop " )
+
+#define portINLINE	__inline
+
+#ifndef portFORCE_INLINE
+	#define portFORCE_INLINE inline __attribute__(( always_inline))
+#endif
+
+#define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
+/*-----------------------------------------------------------*/
+
+portFORCE_INLINE static uint32_t ulPortRaiseThreshold( void )
+{
+volatile uint8_t * const pucMth = ( volatile uint8_t * ) portECLIC_MTH_ADDRESS;
+uint32_t ulOriginalMth = *pucMth;
+
+	/* Only the interrupts with a level greater than the threshold are taken,
+	the fence completes the write before any code of the critical section. */
+	*pucMth = portMAX_SYSCALL_MTH;
+	__asm volatile( "fence" ::: "memory" );
+
+	return ulOriginalMth;
+}
+/*-----------------------------------------------------------*/
+
+portFORCE_INLINE static void vPortSetThreshold( uint32_t ulNewMth )
+{
+volatile uint8_t * const pucMth = ( volatile uint8_t * ) portECLIC_MTH_ADDRESS;
+
+	__asm volatile( "fence" ::: "memory" );
+	*pucMth = ( uint8_t ) ulNewMth;
+}
+/*-----------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
+
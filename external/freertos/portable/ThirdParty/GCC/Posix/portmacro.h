@@ -124,8 +124,10 @@ extern void vPortCancelThread( void *pxTaskToDelete );
 #define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
 
 extern unsigned long ulPortGetRunTime( void );
+#ifndef portGET_RUN_TIME_COUNTER_VALUE
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() /* no-op */
 #define portGET_RUN_TIME_COUNTER_VALUE()         ulPortGetRunTime()
+#endif
 
 #ifdef __cplusplus
 }
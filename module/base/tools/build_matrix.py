@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Build of every example project for every board, in parallel, with a summary of the results
+
+Every folder of the examples with a makefile, a src folder or c source files is a project. The
+projects with their own makefile are built in its folder and the rest with the makefile of the
+repository, as when PROJECT is given in the command line. Every build uses its own folder inside
+the output folder, where the log of the build is saved.
+
+The summary shows the result, the size of the sections of the binary file and the time of every
+build. The results can be saved and used as baseline of a next execution, then the changes of the
+size are shown and the program ends with an error when a build that was successful in the baseline
+fails, or when any build fails if there is no baseline, unless the check is disabled to save a new
+baseline.
+
+    build_matrix.py --root . --output build/matrix --save matrix_baseline.json --no-check
+    build_matrix.py --root . --output build/matrix --baseline matrix_baseline.json --jobs 8
+"""
+
+import argparse
+import concurrent.futures
+import json
+import os
+import struct
+import subprocess
+import sys
+import time
+
+# Variables exported by a parent make that would replace the values selected by every board
+INHERITED = [
+    "MAKEFLAGS",
+    "MFLAGS",
+    "MAKELEVEL",
+    "MAKEOVERRIDES",
+    "BOARD",
+    "MCU",
+    "SOC",
+    "CPU",
+]
+INHERITED += ["ARCH", "RTOS", "MODULES", "PROJECT", "BUILD_DIR"]
+
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+SHT_NOBITS = 8
+
+
+def find_boards(root):
+    """Returns the names of the boards, the folders with a makefile in the board folder"""
+    folder = os.path.join(root, "board")
+    boards = [
+        name for name in os.listdir(folder) if os.path.isdir(os.path.join(folder, name))
+    ]
+    return sorted(
+        name
+        for name in boards
+        if os.path.exists(os.path.join(folder, name, "makefile"))
+    )
+
+
+def find_projects(root):
+    """Returns the paths of the example projects relative to the root of the repository"""
+    projects = []
+    for path, folders, files in os.walk(os.path.join(root, "examples")):
+        if (
+            "makefile" in files
+            or "src" in folders
+            or any(name.endswith(".c") for name in files)
+        ):
+            projects.append(os.path.relpath(path, root))
+            folders.clear()
+        folders.sort()
+    return sorted(projects)
+
+
+def elf_size(filename):
+    """Returns the bytes of code, initialized data and uninitialized data of an elf file"""
+    with open(filename, "rb") as file:
+        data = file.read()
+    if data[:4] != b"\x7fELF":
+        return None
+    wide = data[4] == 2
+    order = "<" if data[5] == 1 else ">"
+    if wide:
+        (offset,) = struct.unpack_from(order + "Q", data, 0x28)
+        entry, count = struct.unpack_from(order + "HH", data, 0x3A)
+        layout = order + "IIQQQQIIQQ"
+    else:
+        (offset,) = struct.unpack_from(order + "I", data, 0x20)
+        entry, count = struct.unpack_from(order + "HH", data, 0x2E)
+        layout = order + "IIIIIIIIII"
+
+    sizes = {"text": 0, "data": 0, "bss": 0}
+    for index in range(count):
+        fields = struct.unpack_from(layout, data, offset + index * entry)
+        kind, flags, size = fields[1], fields[2], fields[5]
+        if not flags & SHF_ALLOC:
+            continue
+        if kind == SHT_NOBITS:
+            sizes["bss"] += size
+        elif flags & SHF_WRITE:
+            sizes["data"] += size
+        else:
+            sizes["text"] += size
+    return sizes
+
+
+def build(root, output, project, board):
+    """Builds a project for a board and returns the result of the build"""
+    folder = os.path.abspath(os.path.join(output, board, project.replace(os.sep, "_")))
+    os.makedirs(folder, exist_ok=True)
+    environment = {
+        name: value for name, value in os.environ.items() if name not in INHERITED
+    }
+    command = ["make", f"BOARD={board}", f"BUILD_DIR={folder}"]
+    if os.path.exists(os.path.join(root, project, "makefile")):
+        command += ["-C", os.path.join(root, project)]
+    else:
+        command += ["-C", root, f"PROJECT={project}"]
+
+    start = time.monotonic()
+    with open(os.path.join(folder, "build.log"), "w", encoding="utf-8") as log:
+        process = subprocess.run(
+            command, stdout=log, stderr=subprocess.STDOUT, env=environment
+        )
+    result = {"project": project, "board": board, "time": time.monotonic() - start}
+    result["ok"] = process.returncode == 0
+
+    for name in ("project.elf", "project.out") if result["ok"] else ():
+        path = os.path.join(folder, "bin", name)
+        if os.path.exists(path):
+            result.update(elf_size(path) or {})
+            break
+    return result
+
+
+def show_summary(results, baseline):
+    """Prints the table with the result of every build and returns the builds that failed"""
+    print(
+        f"{'Project':<32}{'Board':<16}{'Result':<8}{'Text':>9}{'Data':>9}{'Bss':>9}",
+        end="",
+    )
+    print(f"{'Change':>9}{'Time':>8}")
+    failures = []
+    for result in results:
+        key = f"{result['project']}@{result['board']}"
+        old = baseline.get(key) if baseline else None
+        sizes = "".join(
+            f"{result.get(kind, ''):>9}" for kind in ("text", "data", "bss")
+        )
+        change = ""
+        if old and old.get("ok") and result["ok"] and "text" in result:
+            difference = sum(
+                result[kind] - old.get(kind, 0) for kind in ("text", "data")
+            )
+            change = f"{difference:+d}" if difference else "="
+        status = "ok" if result["ok"] else "FAIL"
+        print(f"{result['project']:<32}{result['board']:<16}{status:<8}{sizes}", end="")
+        print(f"{change:>9}{result['time']:>7.1f}s")
+        if not result["ok"] and (baseline is None or (old and old.get("ok"))):
+            failures.append(key)
+    built = sum(1 for result in results if result["ok"])
+    print(f"\n{built} of {len(results)} builds successful")
+    return failures
+
+
+def main():
+    root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", "..", ".."))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-r", "--root", default=root, help="folder of the repository")
+    parser.add_argument(
+        "-o", "--output", default="build/matrix", help="folder for the builds"
+    )
+    parser.add_argument(
+        "-p", "--projects", nargs="*", help="projects to build, all by default"
+    )
+    parser.add_argument(
+        "-B", "--boards", nargs="*", help="boards to use, all by default"
+    )
+    parser.add_argument(
+        "-j", "--jobs", type=int, default=os.cpu_count(), help="parallel builds"
+    )
+    parser.add_argument(
+        "-b", "--baseline", help="JSON file with previous results to compare"
+    )
+    parser.add_argument("-s", "--save", help="JSON file to save the results")
+    parser.add_argument(
+        "-n", "--no-check", action="store_true", help="don't fail on failed builds"
+    )
+    arguments = parser.parse_args()
+
+    root = os.path.abspath(arguments.root)
+    projects = arguments.projects or find_projects(root)
+    boards = arguments.boards or find_boards(root)
+
+    baseline = None
+    if arguments.baseline and os.path.exists(arguments.baseline):
+        with open(arguments.baseline, "r", encoding="utf-8") as file:
+            baseline = json.load(file)
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=arguments.jobs) as executor:
+        builds = [
+            executor.submit(build, root, arguments.output, project, board)
+            for project in projects
+            for board in boards
+        ]
+        results = [future.result() for future in builds]
+
+    failures = show_summary(results, baseline)
+
+    if arguments.save:
+        with open(arguments.save, "w", encoding="utf-8") as file:
+            report = {
+                f"{result['project']}@{result['board']}": result for result in results
+            }
+            json.dump(report, file, indent=4, sort_keys=True)
+
+    for failure in failures:
+        print(f"build failed: {failure}", file=sys.stderr)
+    sys.exit(1 if failures and not arguments.no_check else 0)
+
+
+if __name__ == "__main__":
+    main()
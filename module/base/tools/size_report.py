@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Report of the flash, ram and stack used by every module of a firmware image
+
+Reads the map file written by the linker and the stack usage files written by the compiler with
+-fstack-usage and shows the memory used in every region of the microcontroller, the bytes of
+every kind of section used by every module and the biggest stack frames. The current values are
+compared with a baseline saved before and checked against the budgets of a configuration file:
+
+    [regions]
+    FLASH = 60K
+
+    [flash]
+    freertos = 12K
+
+    [ram]
+    hal = 1K
+
+    [stack]
+    frame = 512
+
+The program ends with an error when any budget is exceeded. With link time optimization the code
+of all the modules is merged by the linker and reported as lto, so the image must be built with
+LTO=N to know the share of every module.
+
+    size_report.py build/bin/project.map --objects build/obj --budget size_budget.ini
+    size_report.py build/bin/project.map --objects build/obj --save size_baseline.json
+"""
+
+import argparse
+import configparser
+import json
+import os
+import re
+import sys
+
+KINDS = ["text", "rodata", "data", "bss", "other"]
+
+IGNORED_SECTIONS = re.compile(
+    r"^\.(debug|comment|stab|ARM\.attributes|riscv\.attributes)"
+)
+
+OUTPUT_SECTION = re.compile(
+    r"^(\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)(?:\s+load address 0x([0-9a-f]+))?"
+)
+INPUT_SECTION = re.compile(r"^ (\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s*(.*)$")
+REGION = re.compile(r"^(\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s*(\S*)")
+ARCHIVE_MEMBER = re.compile(r"^(.*)\((.*)\)$")
+LTO_PARTITION = re.compile(r"\.ltrans\d*\.ltrans\.o$")
+
+
+def parse_bytes(text):
+    """Converts a size with an optional K or M suffix to bytes"""
+    text = text.strip().upper()
+    scale = {"K": 1024, "M": 1024 * 1024}.get(text[-1:], 1)
+    return int(text.rstrip("KM"), 0) * scale
+
+
+def section_kind(name):
+    """Returns the kind of content of an input section from its name"""
+    for prefix, kind in [(".text", "text"), (".rodata", "rodata"), (".data", "data")]:
+        if name.startswith(prefix):
+            return kind
+    if name.startswith((".bss", ".sbss", ".tbss", "COMMON", ".noinit")):
+        return "bss"
+    if name.startswith((".sdata", ".tdata")):
+        return "data"
+    if name.startswith(".srodata"):
+        return "rodata"
+    return "other"
+
+
+class Modules:
+    """Finds the module that owns an object file from its path in the objects folder"""
+
+    def __init__(self, objects):
+        self.objects = os.path.abspath(objects) if objects else None
+        self.members = {}
+        if self.objects:
+            for folder, _, files in os.walk(self.objects):
+                for name in files:
+                    if name.endswith(".o"):
+                        path = os.path.relpath(os.path.join(folder, name), self.objects)
+                        self.members.setdefault(name, set()).add(self.classify(path))
+
+    @staticmethod
+    def classify(path):
+        """Returns the module of an object from its path relative to the objects folder"""
+        parts = path.replace(os.sep, "/").split("/")
+        if parts[0] == "module" and len(parts) > 2:
+            return parts[1]
+        if parts[0] == "board":
+            return "board"
+        if parts[0] == "external" and len(parts) > 2:
+            if parts[1] != "base":
+                return parts[1]
+            if "src" in parts:
+                return parts[parts.index("src") - 1]
+            return parts[-2]
+        return "project"
+
+    def owner(self, filename):
+        """Returns the module that owns an input file of the linker"""
+        if not filename:
+            return "linker"
+        if LTO_PARTITION.search(filename):
+            return "lto"
+        member = ARCHIVE_MEMBER.match(filename)
+        if member:
+            archive, name = member.groups()
+            archive = os.path.basename(archive)
+            archive = archive[:-2] if archive.endswith(".a") else archive
+            candidates = self.members.get(name, set())
+            if len(candidates) == 1:
+                return next(iter(candidates))
+            return archive
+        path = os.path.abspath(filename)
+        if self.objects and path.startswith(self.objects + os.sep):
+            return self.classify(os.path.relpath(path, self.objects))
+        parts = filename.replace(os.sep, "/").split("/")
+        if "obj" in parts[:-1]:
+            return self.classify("/".join(parts[parts.index("obj") + 1 :]))
+        return os.path.splitext(os.path.basename(filename))[0]
+
+
+def map_lines(filename):
+    """Returns the lines of the memory map with the long section names joined to their values"""
+    lines = []
+    state = None
+    with open(filename, "r", encoding="utf-8", errors="replace") as file:
+        for line in file:
+            line = line.rstrip()
+            if line.startswith("Memory Configuration"):
+                state = "regions"
+            elif line.startswith("Linker script and memory map"):
+                state = "map"
+            elif line.startswith("Cross Reference Table"):
+                break
+            elif lines and lines[-1][1] and line.startswith("                "):
+                lines[-1] = (lines[-1][0], False, lines[-1][2] + " " + line.strip())
+            elif state and line:
+                wrapped = len(line.split()) == 1 and not line.strip().startswith("*")
+                lines.append((state, wrapped, line))
+    return [(state, line) for state, _, line in lines]
+
+
+def parse_map(filename, modules):
+    """Reads the memory regions and the bytes used by every module from the linker map file"""
+    regions = {}
+    usage = {}
+    output = None
+
+    def region_of(address):
+        for name, region in regions.items():
+            if region["origin"] <= address < region["origin"] + region["length"]:
+                return name
+        return None
+
+    def writable(region):
+        return region is not None and "w" in regions[region]["attributes"]
+
+    for state, line in map_lines(filename):
+        if state == "regions":
+            match = REGION.match(line)
+            if match and match.group(1) != "Name":
+                name, origin, length, attributes = match.groups()
+                regions[name] = {
+                    "origin": int(origin, 16),
+                    "length": int(length, 16),
+                    "attributes": attributes,
+                    "used": 0,
+                }
+            continue
+
+        if not line[0].isspace():
+            match = OUTPUT_SECTION.match(line)
+            output = None
+            if match and not IGNORED_SECTIONS.match(match.group(1)):
+                name, address, size, load = match.groups()
+                output = {"name": name, "address": int(address, 16)}
+                output["load"] = int(load, 16) if load else output["address"]
+            continue
+
+        match = INPUT_SECTION.match(line)
+        if not output or not match:
+            continue
+        name, address, size, filename = match.groups()
+        address, size = int(address, 16), int(size, 16)
+        if not size:
+            continue
+
+        if name == "*fill*":
+            module, kind = "linker", section_kind(output["name"])
+        else:
+            module, kind = modules.owner(filename), section_kind(name)
+        placed = region_of(address)
+        loaded = region_of(output["load"] + address - output["address"])
+        if placed == "*default*":
+            in_ram = kind in ["data", "bss"]
+        else:
+            in_ram = writable(placed)
+        in_flash = kind != "bss" and not writable(loaded) if in_ram else True
+
+        entry = usage.setdefault(module, {key: 0 for key in KINDS + ["flash", "ram"]})
+        entry[kind] += size
+        entry["ram"] += size if in_ram else 0
+        entry["flash"] += size if in_flash else 0
+        if placed:
+            regions[placed]["used"] += size
+        if loaded and loaded != placed and kind != "bss":
+            regions[loaded]["used"] += size
+    return regions, usage
+
+
+def parse_stack(objects, modules):
+    """Reads the stack frames of every function from the files written with -fstack-usage"""
+    frames = []
+    for folder, _, files in os.walk(objects) if objects else []:
+        for name in files:
+            if not name.endswith(".su"):
+                continue
+            path = os.path.join(folder, name)
+            module = modules.classify(os.path.relpath(path, objects))
+            with open(path, "r", encoding="utf-8", errors="replace") as file:
+                for line in file:
+                    fields = line.rstrip("\n").split("\t")
+                    if len(fields) == 3:
+                        function = fields[0].rsplit(":", 1)[-1]
+                        frames.append((int(fields[1]), module, function, fields[2]))
+    return sorted(frames, reverse=True)
+
+
+def delta(current, baseline):
+    """Returns the difference with the baseline as text, empty when there is no baseline"""
+    if baseline is None:
+        return ""
+    return f"{current - baseline:+d}" if current != baseline else "="
+
+
+def show_report(regions, usage, frames, baseline, top):
+    """Prints the tables with the memory used by regions, modules and functions"""
+    old_regions = baseline.get("regions", {}) if baseline else {}
+    old_modules = baseline.get("modules", {}) if baseline else {}
+
+    used = {name: region for name, region in regions.items() if region["used"]}
+    used.pop("*default*", None)
+    if used:
+        print(
+            f"{'Region':<16}{'Origin':>12}{'Size':>10}{'Used':>10}{'%':>7}{'Change':>10}"
+        )
+    for name, region in used.items():
+        percent = 100.0 * region["used"] / region["length"] if region["length"] else 0
+        change = delta(region["used"], old_regions.get(name)) if baseline else ""
+        print(
+            f"{name:<16}{region['origin']:>#12x}{region['length']:>10}{region['used']:>10}"
+            f"{percent:>6.1f}%{change:>10}"
+        )
+
+    if used:
+        print()
+    print(f"{'Module':<16}" + "".join(f"{kind:>9}" for kind in KINDS), end="")
+    print(f"{'Flash':>9}{'Ram':>9}{'Change':>10}{'Stack':>8}")
+    for module in sorted(usage, key=lambda name: -usage[name]["flash"]):
+        entry = usage[module]
+        old = old_modules.get(module, {"flash": 0, "ram": 0}) if baseline else None
+        change = delta(entry["flash"] + entry["ram"], old and old["flash"] + old["ram"])
+        stack = max(
+            (size for size, owner, _, _ in frames if owner == module), default=0
+        )
+        print(f"{module:<16}" + "".join(f"{entry[kind]:>9}" for kind in KINDS), end="")
+        print(f"{entry['flash']:>9}{entry['ram']:>9}{change:>10}{stack or '':>8}")
+    for module in sorted(set(old_modules) - set(usage)):
+        print(f"{module:<16}{'removed':>54}")
+
+    if frames and top:
+        print()
+        print(f"{'Stack frame':<40}{'Module':<16}{'Bytes':>8}  Kind")
+        for size, module, function, kind in frames[:top]:
+            print(f"{function:<40}{module:<16}{size:>8}  {kind}")
+
+
+def check_budget(filename, regions, usage, frames):
+    """Returns the list of the budgets of the configuration file that are exceeded"""
+    config = configparser.ConfigParser()
+    config.optionxform = str
+    config.read(filename)
+    failures = []
+    for name, budget in (
+        config.items("regions") if config.has_section("regions") else []
+    ):
+        used = regions.get(name, {}).get("used", 0)
+        if used > parse_bytes(budget):
+            failures.append(f"region {name} uses {used} bytes of a budget of {budget}")
+    for memory in ["flash", "ram"]:
+        for name, budget in config.items(memory) if config.has_section(memory) else []:
+            used = usage.get(name, {}).get(memory, 0)
+            if used > parse_bytes(budget):
+                failures.append(
+                    f"module {name} uses {used} bytes of {memory}, budget {budget}"
+                )
+    if config.has_option("stack", "frame") and frames:
+        budget = parse_bytes(config.get("stack", "frame"))
+        for size, module, function, _ in frames:
+            if size > budget:
+                failures.append(
+                    f"function {function} of {module} uses {size} bytes of stack"
+                )
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("map", help="map file written by the linker")
+    parser.add_argument(
+        "-o", "--objects", help="folder with the objects and the stack usage files"
+    )
+    parser.add_argument(
+        "-b", "--baseline", help="JSON file with a previous report to compare"
+    )
+    parser.add_argument(
+        "-c", "--budget", help="configuration file with the memory budgets"
+    )
+    parser.add_argument(
+        "-s", "--save", help="JSON file to save the report as the new baseline"
+    )
+    parser.add_argument(
+        "-t", "--top", type=int, default=10, help="amount of stack frames to show"
+    )
+    arguments = parser.parse_args()
+
+    modules = Modules(arguments.objects)
+    try:
+        regions, usage = parse_map(arguments.map, modules)
+    except OSError as error:
+        sys.exit(f"unable to read {arguments.map}: {error.strerror}")
+    frames = parse_stack(arguments.objects, modules)
+
+    baseline = None
+    if arguments.baseline and os.path.exists(arguments.baseline):
+        with open(arguments.baseline, "r", encoding="utf-8") as file:
+            baseline = json.load(file)
+
+    show_report(regions, usage, frames, baseline, arguments.top)
+
+    if arguments.save:
+        with open(arguments.save, "w", encoding="utf-8") as file:
+            report = {
+                "regions": {name: region["used"] for name, region in regions.items()}
+            }
+            report["modules"] = usage
+            json.dump(report, file, indent=4, sort_keys=True)
+
+    failures = (
+        check_budget(arguments.budget, regions, usage, frames)
+        if arguments.budget
+        else []
+    )
+    for failure in failures:
+        print(f"budget exceeded: {failure}", file=sys.stderr)
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
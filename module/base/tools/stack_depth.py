@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Worst case stack depth of the tasks and the interrupt handlers of a firmware image
+
+Reads the call graph files written by the compiler with -fcallgraph-info=su and finds the deepest
+path from every task entry point and every interrupt handler. The tasks are the functions passed to
+xTaskCreate or xTaskCreateStatic in the sources, the handlers are the functions named as the vector
+table entries, ending with IRQHandler, _Handler or _handler, and the handlers of the kernel port.
+The stack needed by a task adds the context saved by the kernel on a task switch, and the stack used
+by the interrupts adds the exception frame of every nesting level. Calls through pointers and
+functions without stack information, as the ones of the C library, are shown in the notes and can be
+completed with a configuration file:
+
+    [calls]
+    SciInjectEvent = SerialEvent, KeyboardEvent
+
+    [frames]
+    printf = 512
+
+The stack sizes in words for xTaskCreate can be written to a header file to size the tasks from
+the measured values instead of the guessed ones.
+
+    stack_depth.py --objects build/obj --sources src --cpu cortex-m4f --header stack_sizes.h
+"""
+
+import argparse
+import configparser
+import math
+import os
+import re
+import sys
+import textwrap
+
+NODE = re.compile(r'node: \{ title: "([^"]*)" label: "([^"]*)"')
+EDGE = re.compile(r'edge: \{ sourcename: "([^"]*)" targetname: "([^"]*)"')
+FRAME = re.compile(r"(\d+) bytes \(([^)]*)\)")
+TASK_CREATE = re.compile(
+    r"xTaskCreate(?:Static)?\s*\(\s*(\w+)\s*,\s*\"([^\"]*)\"\s*,\s*([^,]+),"
+)
+DEFINE = re.compile(
+    r"^\s*#\s*define\s+(\w+)\s+\(?\s*(?:\(\w+\)\s*)?(\d+)\s*\)?\s*$", re.M
+)
+HANDLER = re.compile(r"(IRQHandler|_Handler|_handler)$|^[xv]Port\w+Handler$")
+
+INDIRECT_CALL = "__indirect_call"
+
+# Bytes pushed on the stack of a task by a context switch, and by the hardware on every exception
+CPU_CONTEXT = {
+    "cortex-m3": {"task": 64, "exception": 32},
+    "cortex-m4f": {"task": 204, "exception": 104},
+    "nuclei-n200": {"task": 128, "exception": 0},
+}
+
+# Tasks created by the kernel when the scheduler starts, with the name of their stack constant
+KERNEL_TASKS = {"prvIdleTask": "IdleTask", "prvTimerTask": "TimerTask"}
+
+
+class CallGraph:
+    """Functions with their own stack frame and the functions called by every one"""
+
+    def __init__(self):
+        self.names = {}
+        self.frames = {}
+        self.dynamic = set()
+        self.calls = {}
+
+    def load(self, filename):
+        """Adds the nodes and the edges of a call graph file written by the compiler"""
+        with open(filename, "r", encoding="utf-8", errors="replace") as file:
+            for line in file:
+                node = NODE.search(line)
+                if node:
+                    title, label = node.groups()
+                    self.names[title] = label.split("\\n")[0]
+                    frame = FRAME.search(label)
+                    if frame:
+                        self.frames[title] = int(frame.group(1))
+                        if frame.group(2).startswith(
+                            "dynamic"
+                        ) and "bounded" not in frame.group(2):
+                            self.dynamic.add(title)
+                    continue
+                edge = EDGE.search(line)
+                if edge:
+                    source, target = edge.groups()
+                    self.calls.setdefault(source, set()).add(target)
+
+    def find(self, name, source=None):
+        """Returns the title of a function from its name, preferring the one defined in a file"""
+        titles = [title for title, label in self.names.items() if label == name]
+        if source:
+            local = [
+                title
+                for title in titles
+                if title.startswith(os.path.basename(source) + ":")
+            ]
+            titles = local or titles
+        defined = [title for title in titles if title in self.frames]
+        return (defined or titles or [None])[0]
+
+    def configure(self, config):
+        """Adds the calls through pointers and the frames of the functions without information"""
+        if config.has_section("calls"):
+            for name, targets in config.items("calls"):
+                source = self.find(name) or name
+                for target in targets.split(","):
+                    target = target.strip()
+                    self.calls.setdefault(source, set()).add(
+                        self.find(target) or target
+                    )
+                self.calls.get(source, set()).discard(INDIRECT_CALL)
+        if config.has_section("frames"):
+            for name, size in config.items("frames"):
+                self.frames[self.find(name) or name] = int(size)
+
+    def depth(self, title):
+        """Returns the worst stack depth from a function, the deepest path and the warnings"""
+        results = {}
+
+        def visit(title, active):
+            if title in results:
+                return results[title]
+            name = self.names.get(title, title)
+            if title in active:
+                return 0, [name], {f"recursion in {name}"}
+            notes = set()
+            if title == INDIRECT_CALL:
+                return 0, [], notes
+            if title not in self.frames:
+                notes.add(f"unknown frame of {name}")
+            if title in self.dynamic:
+                notes.add(f"dynamic frame in {name}")
+            worst, path = 0, []
+            for callee in sorted(self.calls.get(title, [])):
+                if callee == INDIRECT_CALL:
+                    notes.add(f"call through pointer in {name}")
+                    continue
+                size, callee_path, callee_notes = visit(callee, active | {title})
+                notes |= callee_notes
+                if size > worst or not path:
+                    worst, path = size, callee_path
+            result = self.frames.get(title, 0) + worst, [name] + path, notes
+            if not any(note.startswith("recursion") for note in notes):
+                results[title] = result
+            return result
+
+        return visit(title, frozenset())
+
+
+def find_tasks(folders):
+    """Returns the functions used as tasks in the sources with the stack size declared for them"""
+    tasks = []
+    for folder in folders:
+        for root, _, files in os.walk(folder):
+            for name in sorted(files):
+                if not name.endswith(".c"):
+                    continue
+                path = os.path.join(root, name)
+                with open(path, "r", encoding="utf-8", errors="replace") as file:
+                    source = file.read()
+                defines = dict(DEFINE.findall(source))
+                for function, task, size in TASK_CREATE.findall(source):
+                    size = defines.get(size.strip(), size.strip())
+                    size = int(size) if size.isdigit() else None
+                    if all(function != item[0] for item in tasks):
+                        tasks.append((function, task, size, path))
+    return tasks
+
+
+def macro_name(function):
+    """Converts the name of the task function to the name of its stack size constant"""
+    words = re.sub(r"([a-z0-9])([A-Z])", r"\1_\2", function).upper()
+    return f"{words}_STACK_SIZE"
+
+
+def write_header(filename, sizes):
+    """Writes the stack sizes in words of the tasks as constants to be used with xTaskCreate"""
+    os.makedirs(os.path.dirname(os.path.abspath(filename)), exist_ok=True)
+    guard = re.sub(r"\W", "_", os.path.basename(filename)).upper()
+    with open(filename, "w", encoding="utf-8") as file:
+        file.write(
+            "/* Stack sizes in words of the tasks, measured by stack_depth.py */\n\n"
+        )
+        file.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        for function, words in sizes:
+            file.write(f"#define {macro_name(function):<40} {words}\n")
+        file.write(f"\n#endif /* {guard} */\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "-o", "--objects", required=True, help="folder with the call graph files"
+    )
+    parser.add_argument(
+        "-s", "--sources", nargs="*", default=[], help="folders with the sources"
+    )
+    parser.add_argument(
+        "-c", "--config", help="configuration file with calls and frames"
+    )
+    parser.add_argument(
+        "--cpu", default="", help="processor to know the size of the contexts"
+    )
+    parser.add_argument(
+        "--nesting", type=int, default=1, help="levels of nested interrupts"
+    )
+    parser.add_argument(
+        "--margin", type=int, default=10, help="percent added to the task stacks"
+    )
+    parser.add_argument(
+        "--word", type=int, default=4, help="bytes of every word of the stacks"
+    )
+    parser.add_argument(
+        "--header", help="header file to write the stack sizes of the tasks"
+    )
+    arguments = parser.parse_args()
+
+    graph = CallGraph()
+    for root, _, files in os.walk(arguments.objects):
+        for name in files:
+            if name.endswith(".ci"):
+                graph.load(os.path.join(root, name))
+    if not graph.names:
+        sys.exit(
+            "no call graph files found, build with STACK_ANALYSIS=Y and without LTO"
+        )
+    if arguments.config:
+        config = configparser.ConfigParser()
+        config.optionxform = str
+        config.read(arguments.config)
+        graph.configure(config)
+
+    context = CPU_CONTEXT.get(arguments.cpu, {"task": 0, "exception": 0})
+    notes = set()
+    sizes = []
+    print(f"{'Entry':<28}{'Kind':<10}{'Depth':>7}{'Context':>9}{'Needed':>8}", end="")
+    print(f"{'Words':>7}{'Declared':>10}")
+
+    tasks = find_tasks(arguments.sources)
+    tasks += [(function, None, None, None) for function in KERNEL_TASKS]
+    for function, _, declared, source in tasks:
+        title = graph.find(function, source)
+        if title is None:
+            continue
+        depth, path, warnings = graph.depth(title)
+        needed = depth + context["task"]
+        words = math.ceil(needed * (100 + arguments.margin) / 100 / arguments.word)
+        sizes.append((KERNEL_TASKS.get(function, function), words))
+        declared = "" if declared is None else declared
+        print(
+            f"{function:<28}{'task':<10}{depth:>7}{context['task']:>9}{needed:>8}",
+            end="",
+        )
+        print(f"{words:>7}{declared:>10}")
+        print(f"    {' > '.join(path)}")
+        notes |= warnings
+
+    handlers = []
+    for title in sorted(graph.frames):
+        if HANDLER.search(graph.names.get(title, "")):
+            depth, path, warnings = graph.depth(title)
+            needed = depth + context["exception"]
+            print(f"{graph.names[title]:<28}{'interrupt':<10}{depth:>7}", end="")
+            print(f"{context['exception']:>9}{needed:>8}")
+            print(f"    {' > '.join(path)}")
+            handlers.append(needed)
+            notes |= warnings
+
+    main_title = graph.find("main")
+    if main_title:
+        depth, path, warnings = graph.depth(main_title)
+        nested = sum(sorted(handlers, reverse=True)[: arguments.nesting])
+        print(f"{'main':<28}{'main':<10}{depth:>7}{nested:>9}{depth + nested:>8}")
+        print(f"    {' > '.join(path)}")
+        print(
+            f"    interrupts use the main stack, {arguments.nesting} nesting level(s) included"
+        )
+        notes |= warnings
+
+    unknown = sorted(
+        note.split()[-1] for note in notes if note.startswith("unknown frame")
+    )
+    notes = sorted(note for note in notes if not note.startswith("unknown frame"))
+    if unknown:
+        notes.append("functions without stack information: " + ", ".join(unknown))
+    if notes:
+        print()
+        print("The depth can be higher than shown because of:")
+        for note in notes:
+            print(
+                textwrap.fill(
+                    note, 100, initial_indent="    ", subsequent_indent="        "
+                )
+            )
+
+    if arguments.header:
+        write_header(arguments.header, sizes)
+
+
+if __name__ == "__main__":
+    main()
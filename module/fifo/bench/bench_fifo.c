@@ -0,0 +1,89 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Microbenchmarks of the lock free queues
+ **
+ ** @addtogroup fifo FIFO
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "fifo.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+FIFO_DEFINE(bench_fifo, 256);
+
+MPSC_DEFINE(bench_mpsc, 256);
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+BENCH(fifo, put_get) {
+    uint8_t value;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        FifoPut(bench_fifo, (uint8_t)index);
+        FifoGet(bench_fifo, &value);
+        BENCH_KEEP(value);
+    }
+}
+
+BENCH(fifo, write_read_block) {
+    uint8_t block[32] = {0};
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        FifoWrite(bench_fifo, block, sizeof(block));
+        FifoRead(bench_fifo, block, sizeof(block));
+        BENCH_KEEP(block[0]);
+    }
+}
+
+BENCH(mpsc, push_pop) {
+    uint32_t value;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        MpscPush(bench_mpsc, index);
+        MpscPop(bench_mpsc, &value);
+        BENCH_KEEP(value);
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,695 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef FIFO_H
+#define FIFO_H
+
+/** @file
+ ** @brief Lock free queues to transfer data from interrupts to tasks
+ **
+ ** Header only implementation of two bounded queues that don't require locks or kernel calls. The
+ ** byte ring allows a single producer and a single consumer, and the word queue allows many
+ ** producers (tasks or interrupts of any priority) and a single consumer. Both queues use free
+ ** running indexes with a power of two capacity, so the position in the buffer is obtained with a
+ ** mask and the amount of used elements is the difference between the indexes.
+ **
+ ** The indexes written by producers and consumers are placed in diferent cache lines to avoid
+ ** false sharing on hosts with many cores. When the FreeRTOS kernel is used, the helpers with
+ ** notifications wake the consumer task only when the queue changes from empty to not empty.
+ ** When the hardware abstraction layer is used, the drain helper sends the data encoded from a
+ ** queue through a serial port without waiting for it.
+ **
+ ** @addtogroup fifo FIFO
+ ** @brief Lock free queues
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
+#ifdef USE_HAL
+#include "hal_sci.h"
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef FIFO_CACHE_LINE
+#if defined(__x86_64__) || defined(__i386__)
+#define FIFO_CACHE_LINE 64
+#else
+#define FIFO_CACHE_LINE 32
+#endif
+#endif
+
+//! Attribute to place a field of the queue descriptors at the begin of a cache line
+#define FIFO_ALIGNED __attribute__((aligned(FIFO_CACHE_LINE)))
+
+/**
+ * @brief Macro to define a static byte ring with a capacity that must be a power of two
+ *
+ * @param  NAME  Name of the descriptor variable, it can be used as a fifo_t value
+ * @param  SIZE  Capacity of the ring in bytes
+ */
+#define FIFO_DEFINE(NAME, SIZE)                                                                    \
+    _Static_assert((SIZE) > 0 && ((SIZE) & ((SIZE)-1)) == 0, "Fifo size must be a power of two"); \
+    static uint8_t NAME##_buffer[SIZE];                                                            \
+    static struct fifo_s NAME[1] = {{.buffer = NAME##_buffer, .mask = (SIZE)-1}}
+
+/**
+ * @brief Macro to define a static multiple producers queue with a capacity that must be a power
+ * of two
+ *
+ * @param  NAME  Name of the descriptor variable, it can be used as a mpsc_t value
+ * @param  SIZE  Capacity of the queue in words
+ */
+#define MPSC_DEFINE(NAME, SIZE)                                                                    \
+    _Static_assert((SIZE) > 0 && ((SIZE) & ((SIZE)-1)) == 0, "Mpsc size must be a power of two"); \
+    static struct mpsc_cell_s NAME##_cells[SIZE];                                                  \
+    static struct mpsc_s NAME[1] = {{.cells = NAME##_cells, .mask = (SIZE)-1}}
+
+/**
+ * @brief Macro to define a static buffer to send the data of a queue through a serial port
+ *
+ * @param  NAME  Name of the descriptor variable, it can be used as a fifo_drain_t value
+ * @param  SIZE  Size of the buffer in bytes, it must hold at least one encoded element
+ */
+#define FIFO_DRAIN_DEFINE(NAME, SIZE)                                                              \
+    _Static_assert((SIZE) > 0 && (SIZE) <= UINT16_MAX, "Drain size must fit in 16 bits");         \
+    static uint8_t NAME##_buffer[SIZE];                                                            \
+    static struct fifo_drain_s NAME[1] = {{.buffer = NAME##_buffer, .size = (SIZE)}}
+
+/* === Public data type declarations =========================================================== */
+
+//! Descriptor of a ring of bytes with a single producer and a single consumer
+typedef struct fifo_s {
+    uint8_t * buffer;                    /**< Pointer to the memory used to store the data */
+    uint32_t mask;                       /**< Capacity of the ring minus one */
+    volatile uint32_t head FIFO_ALIGNED; /**< Index of the next byte to write, owned by producer */
+    volatile uint32_t tail FIFO_ALIGNED; /**< Index of the next byte to read, owned by consumer */
+} * fifo_t;
+
+//! Element of a queue with multiple producers
+struct mpsc_cell_s {
+    volatile uint32_t sequence; /**< Index of the last write plus one when the value is ready */
+    uint32_t value;             /**< Value stored in the element */
+};
+
+//! Descriptor of a queue of words with multiple producers and a single consumer
+typedef struct mpsc_s {
+    struct mpsc_cell_s * cells;          /**< Pointer to the memory used to store the values */
+    uint32_t mask;                       /**< Capacity of the queue minus one */
+    volatile uint32_t head FIFO_ALIGNED; /**< Index of the next element to reserve */
+    volatile uint32_t dropped;           /**< Amount of values discarded with the queue full */
+    volatile uint32_t tail FIFO_ALIGNED; /**< Index of the next element to read */
+} * mpsc_t;
+
+#ifdef USE_HAL
+//! Function to encode the values of a queue in a buffer, as LogRead or TraceRead
+typedef size_t (*fifo_drain_read_t)(void * buffer, size_t size);
+
+//! Descriptor of the data encoded from a queue that is pending to be sent through a serial port
+typedef struct fifo_drain_s {
+    uint8_t * buffer; /**< Pointer to the memory used to store the encoded data */
+    uint16_t size;    /**< Size of the memory in bytes */
+    uint16_t count;   /**< Amount of bytes stored in the memory */
+    uint16_t sent;    /**< Amount of bytes of the memory already sent */
+} * fifo_drain_t;
+#endif
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to read an index shared between a producer and a consumer
+ *
+ * @param   index  Pointer to the index to read
+ * @return         Value of the index, the data written before the index update is visible
+ */
+static inline uint32_t FifoLoad(volatile uint32_t const * index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Function to update an index shared between a producer and a consumer
+ *
+ * @param  index  Pointer to the index to update
+ * @param  value  New value of the index, the data written before the update is visible first
+ */
+static inline void FifoStore(volatile uint32_t * index, uint32_t value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Function to increment a counter shared by interrupts of diferent priorities
+ *
+ * @param  counter   Pointer to the counter to increment
+ * @param  value     Value to add to the counter
+ * @return uint32_t  Value of the counter after the increment
+ */
+static inline uint32_t FifoAtomicAdd(volatile uint32_t * counter, uint32_t value) {
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    uint32_t current, status;
+    do {
+        __asm volatile("ldrex %0, [%1]" : "=&r"(current) : "r"(counter) : "memory");
+        current += value;
+        __asm volatile("strex %0, %2, [%1]"
+                       : "=&r"(status)
+                       : "r"(counter), "r"(current)
+                       : "memory");
+    } while (status != 0);
+    return current;
+#elif defined(__riscv_atomic)
+    uint32_t previous;
+    __asm volatile("amoadd.w %0, %2, (%1)"
+                   : "=r"(previous)
+                   : "r"(counter), "r"(value)
+                   : "memory");
+    return previous + value;
+#else
+    return __atomic_add_fetch(counter, value, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * @brief Function to reserve consecutive elements of a queue shared by many producers
+ *
+ * @param   head      Pointer to the index of the next element to reserve
+ * @param   tail      Pointer to the index of the next element to read by the consumer
+ * @param   capacity  Total amount of elements in the queue
+ * @param   count     Amount of elements to reserve
+ * @param   first     Pointer to return the index of the first element reserved
+ * @return  true      The elements were reserved and must be written by the caller
+ * @return  false     There isn't enough free space in the queue
+ */
+static inline bool FifoReserve(volatile uint32_t * head, volatile uint32_t const * tail,
+                               uint32_t capacity, uint32_t count, uint32_t * first) {
+    uint32_t index;
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    uint32_t status;
+    do {
+        uint32_t used = FifoLoad(tail);
+        __asm volatile("ldrex %0, [%1]" : "=&r"(index) : "r"(head) : "memory");
+        if (index + count - used > capacity) {
+            __asm volatile("clrex" : : : "memory");
+            return false;
+        }
+        __asm volatile("strex %0, %2, [%1]"
+                       : "=&r"(status)
+                       : "r"(head), "r"(index + count)
+                       : "memory");
+    } while (status != 0);
+#elif defined(__riscv_atomic)
+    uint32_t status;
+    do {
+        uint32_t used = FifoLoad(tail);
+        __asm volatile("lr.w %0, (%1)" : "=&r"(index) : "r"(head) : "memory");
+        if (index + count - used > capacity) {
+            return false;
+        }
+        __asm volatile("sc.w %0, %2, (%1)"
+                       : "=&r"(status)
+                       : "r"(head), "r"(index + count)
+                       : "memory");
+    } while (status != 0);
+#else
+    index = __atomic_load_n(head, __ATOMIC_RELAXED);
+    do {
+        if (index + count - FifoLoad(tail) > capacity) {
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(head, &index, index + count, true, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+#endif
+    *first = index;
+    return true;
+}
+
+/**
+ * @brief Function to initialize a byte ring using a buffer provided by the caller
+ *
+ * @param   self    Pointer to the descriptor of the ring
+ * @param   buffer  Pointer to the memory used to store the data
+ * @param   size    Size of the buffer, it must be a power of two
+ * @return  true    The ring was initialized
+ * @return  false   The size of the buffer isn't a power of two
+ */
+static inline bool FifoInit(fifo_t self, uint8_t * buffer, uint32_t size) {
+    if ((size == 0) || (size & (size - 1))) {
+        return false;
+    }
+    self->buffer = buffer;
+    self->mask = size - 1;
+    self->head = 0;
+    self->tail = 0;
+    return true;
+}
+
+/**
+ * @brief Function to get the amount of bytes stored in a ring
+ *
+ * @param   self  Pointer to the descriptor of the ring
+ * @return        Amount of bytes ready to be read
+ */
+static inline uint32_t FifoCount(fifo_t self) {
+    return FifoLoad(&self->head) - FifoLoad(&self->tail);
+}
+
+/**
+ * @brief Function to get the amount of free bytes in a ring
+ *
+ * @param   self  Pointer to the descriptor of the ring
+ * @return        Amount of bytes that can be written
+ */
+static inline uint32_t FifoSpace(fifo_t self) {
+    return self->mask + 1 - FifoCount(self);
+}
+
+/**
+ * @brief Function to write a block of bytes in a ring, it must be called only by the producer
+ *
+ * @param   self  Pointer to the descriptor of the ring
+ * @param   data  Pointer to the bytes to write
+ * @param   size  Amount of bytes to write
+ * @return        Amount of bytes written, it is lower than size when the ring is full
+ */
+static inline uint32_t FifoWrite(fifo_t self, void const * data, uint32_t size) {
+    uint32_t head = self->head;
+    uint32_t space = self->mask + 1 - (head - FifoLoad(&self->tail));
+    uint32_t offset = head & self->mask;
+    uint32_t first;
+
+    if (size > space) {
+        size = space;
+    }
+    first = self->mask + 1 - offset;
+    if (first > size) {
+        first = size;
+    }
+    memcpy(&self->buffer[offset], data, first);
+    memcpy(self->buffer, (uint8_t const *)data + first, size - first);
+    FifoStore(&self->head, head + size);
+    return size;
+}
+
+/**
+ * @brief Function to read a block of bytes from a ring, it must be called only by the consumer
+ *
+ * @param   self  Pointer to the descriptor of the ring
+ * @param   data  Pointer to the memory to store the bytes read
+ * @param   size  Maximum amount of bytes to read
+ * @return        Amount of bytes read, it is lower than size when the ring gets empty
+ */
+static inline uint32_t FifoRead(fifo_t self, void * data, uint32_t size) {
+    uint32_t tail = self->tail;
+    uint32_t count = FifoLoad(&self->head) - tail;
+    uint32_t offset = tail & self->mask;
+    uint32_t first;
+
+    if (size > count) {
+        size = count;
+    }
+    first = self->mask + 1 - offset;
+    if (first > size) {
+        first = size;
+    }
+    memcpy(data, &self->buffer[offset], first);
+    memcpy((uint8_t *)data + first, self->buffer, size - first);
+    FifoStore(&self->tail, tail + size);
+    return size;
+}
+
+/**
+ * @brief Function to write a single byte in a ring, it must be called only by the producer
+ *
+ * @param   self   Pointer to the descriptor of the ring
+ * @param   value  Byte to write
+ * @return  true   The byte was written
+ * @return  false  The ring is full and the byte was discarded
+ */
+static inline bool FifoPut(fifo_t self, uint8_t value) {
+    uint32_t head = self->head;
+
+    if (head - FifoLoad(&self->tail) > self->mask) {
+        return false;
+    }
+    self->buffer[head & self->mask] = value;
+    FifoStore(&self->head, head + 1);
+    return true;
+}
+
+/**
+ * @brief Function to read a single byte from a ring, it must be called only by the consumer
+ *
+ * @param   self   Pointer to the descriptor of the ring
+ * @param   value  Pointer to store the byte read
+ * @return  true   The byte was read
+ * @return  false  The ring is empty
+ */
+static inline bool FifoGet(fifo_t self, uint8_t * value) {
+    uint32_t tail = self->tail;
+
+    if (FifoLoad(&self->head) == tail) {
+        return false;
+    }
+    *value = self->buffer[tail & self->mask];
+    FifoStore(&self->tail, tail + 1);
+    return true;
+}
+
+/**
+ * @brief Function to initialize a multiple producers queue using memory provided by the caller
+ *
+ * @param   self   Pointer to the descriptor of the queue
+ * @param   cells  Pointer to the memory used to store the values
+ * @param   size   Amount of elements in the memory, it must be a power of two
+ * @return  true   The queue was initialized
+ * @return  false  The amount of elements isn't a power of two
+ */
+static inline bool MpscInit(mpsc_t self, struct mpsc_cell_s * cells, uint32_t size) {
+    if ((size == 0) || (size & (size - 1))) {
+        return false;
+    }
+    memset(cells, 0, size * sizeof(struct mpsc_cell_s));
+    self->cells = cells;
+    self->mask = size - 1;
+    self->head = 0;
+    self->dropped = 0;
+    self->tail = 0;
+    return true;
+}
+
+/**
+ * @brief Function to get the amount of values stored in a multiple producers queue
+ *
+ * @param   self  Pointer to the descriptor of the queue
+ * @return        Amount of elements reserved by the producers, some of them could still be
+ *                being written
+ */
+static inline uint32_t MpscCount(mpsc_t self) {
+    return FifoLoad(&self->head) - FifoLoad(&self->tail);
+}
+
+/**
+ * @brief Function to reserve and write a block of values in a multiple producers queue
+ *
+ * @param   self    Pointer to the descriptor of the queue
+ * @param   values  Pointer to the values to write
+ * @param   count   Amount of values to write
+ * @param   first   Pointer to return the index of the first element written
+ * @return  true    The values were written
+ * @return  false   The queue doesn't have enough space and the values were discarded
+ */
+static inline bool MpscWrite(mpsc_t self, uint32_t const * values, uint32_t count,
+                             uint32_t * first) {
+    if (!FifoReserve(&self->head, &self->tail, self->mask + 1, count, first)) {
+        FifoAtomicAdd(&self->dropped, count);
+        return false;
+    }
+    for (uint32_t index = 0; index < count; index++) {
+        struct mpsc_cell_s * cell = &self->cells[(*first + index) & self->mask];
+        cell->value = values[index];
+        FifoStore(&cell->sequence, *first + index + 1);
+    }
+    return true;
+}
+
+/**
+ * @brief Function to write a block of values in a multiple producers queue
+ *
+ * The elements are reserved with a single atomic operation, so the values of a block are stored
+ * together even when other producers preempt the caller. When there isn't enough space for the
+ * whole block none of the values is written and the drop counter of the queue is incremented.
+ *
+ * @param   self    Pointer to the descriptor of the queue
+ * @param   values  Pointer to the values to write
+ * @param   count   Amount of values to write
+ * @return  true    The values were written
+ * @return  false   The queue doesn't have enough space and the values were discarded
+ */
+static inline bool MpscPushBatch(mpsc_t self, uint32_t const * values, uint32_t count) {
+    uint32_t first;
+
+    return MpscWrite(self, values, count, &first);
+}
+
+/**
+ * @brief Function to write a single value in a multiple producers queue
+ *
+ * @param   self   Pointer to the descriptor of the queue
+ * @param   value  Value to write
+ * @return  true   The value was written
+ * @return  false  The queue is full and the value was discarded
+ */
+static inline bool MpscPush(mpsc_t self, uint32_t value) {
+    return MpscPushBatch(self, &value, 1);
+}
+
+/**
+ * @brief Function to read a block of values from a multiple producers queue, it must be called
+ * only by the consumer
+ *
+ * The read stops at the first element reserved by a producer that has not finished the write,
+ * the rest of the values will be available in a next call.
+ *
+ * @param   self    Pointer to the descriptor of the queue
+ * @param   values  Pointer to the memory to store the values read
+ * @param   count   Maximum amount of values to read
+ * @return          Amount of values read
+ */
+static inline uint32_t MpscPopBatch(mpsc_t self, uint32_t * values, uint32_t count) {
+    uint32_t tail = self->tail;
+    uint32_t index;
+
+    for (index = 0; index < count; index++) {
+        struct mpsc_cell_s * cell = &self->cells[(tail + index) & self->mask];
+        if (FifoLoad(&cell->sequence) != tail + index + 1) {
+            break;
+        }
+        values[index] = cell->value;
+    }
+    FifoStore(&self->tail, tail + index);
+    return index;
+}
+
+/**
+ * @brief Function to read a single value from a multiple producers queue, it must be called only
+ * by the consumer
+ *
+ * @param   self   Pointer to the descriptor of the queue
+ * @param   value  Pointer to store the value read
+ * @return  true   The value was read
+ * @return  false  The queue is empty
+ */
+static inline bool MpscPop(mpsc_t self, uint32_t * value) {
+    return (MpscPopBatch(self, value, 1) == 1);
+}
+
+/**
+ * @brief Function to encode a block of words after a synchronization byte
+ *
+ * The words are stored in little endian order, so the decoders on the host don't depend on the
+ * byte order of the target.
+ *
+ * @param   buffer  Pointer to the memory to store the encoded words, of 1 + 4 * count bytes
+ * @param   sync    Value of the synchronization byte
+ * @param   words   Pointer to the words to encode
+ * @param   count   Amount of words to encode
+ * @return          Amount of bytes stored in the buffer
+ */
+static inline size_t FifoEncodeWords(uint8_t * buffer, uint8_t sync, uint32_t const * words,
+                                     uint32_t count) {
+    size_t result = 0;
+
+    buffer[result++] = sync;
+    for (uint32_t index = 0; index < count; index++) {
+        buffer[result++] = (uint8_t)(words[index]);
+        buffer[result++] = (uint8_t)(words[index] >> 8);
+        buffer[result++] = (uint8_t)(words[index] >> 16);
+        buffer[result++] = (uint8_t)(words[index] >> 24);
+    }
+    return result;
+}
+
+#ifdef FREERTOS
+
+/**
+ * @brief Function to write a block of bytes in a ring from an interrupt and wake the consumer
+ *
+ * @param   self      Pointer to the descriptor of the ring
+ * @param   data      Pointer to the bytes to write
+ * @param   size      Amount of bytes to write
+ * @param   consumer  Task that reads the ring, it is notified only when it could be waiting
+ * @param   woken     Pointer to inform that a context switch is required at the interrupt exit
+ * @return            Amount of bytes written
+ */
+static inline uint32_t FifoWriteFromISR(fifo_t self, void const * data, uint32_t size,
+                                        TaskHandle_t consumer, BaseType_t * woken) {
+    uint32_t head = self->head;
+    uint32_t count = FifoWrite(self, data, size);
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if ((count > 0) && (FifoLoad(&self->tail) == head)) {
+        vTaskNotifyGiveFromISR(consumer, woken);
+    }
+    return count;
+}
+
+/**
+ * @brief Function to read a block of bytes from a ring waiting for data if it is empty
+ *
+ * @param   self     Pointer to the descriptor of the ring
+ * @param   data     Pointer to the memory to store the bytes read
+ * @param   size     Maximum amount of bytes to read
+ * @param   timeout  Maximum amount of ticks to wait for data
+ * @return           Amount of bytes read, zero when the timeout expires with the ring empty
+ */
+static inline uint32_t FifoReadWait(fifo_t self, void * data, uint32_t size, TickType_t timeout) {
+    TimeOut_t start;
+    uint32_t count;
+
+    /* A notification left by a previous write wakes the task with the ring still empty, so it
+     * waits again for the remaining ticks until data arrives or the timeout expires */
+    vTaskSetTimeOutState(&start);
+    while (true) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        count = FifoRead(self, data, size);
+        if ((count > 0) || (xTaskCheckForTimeOut(&start, &timeout) != pdFALSE)) {
+            break;
+        }
+        ulTaskNotifyTake(pdTRUE, timeout);
+    }
+    return count;
+}
+
+/**
+ * @brief Function to write a block of values in a multiple producers queue from an interrupt and
+ * wake the consumer
+ *
+ * @param   self      Pointer to the descriptor of the queue
+ * @param   values    Pointer to the values to write
+ * @param   count     Amount of values to write
+ * @param   consumer  Task that reads the queue, it is notified only when it could be waiting
+ * @param   woken     Pointer to inform that a context switch is required at the interrupt exit
+ * @return  true      The values were written
+ * @return  false     The queue doesn't have enough space and the values were discarded
+ */
+static inline bool MpscPushFromISR(mpsc_t self, uint32_t const * values, uint32_t count,
+                                   TaskHandle_t consumer, BaseType_t * woken) {
+    uint32_t first;
+
+    if (!MpscWrite(self, values, count, &first)) {
+        return false;
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (FifoLoad(&self->tail) == first) {
+        vTaskNotifyGiveFromISR(consumer, woken);
+    }
+    return true;
+}
+
+/**
+ * @brief Function to read a block of values from a multiple producers queue waiting for data if
+ * it is empty
+ *
+ * @param   self     Pointer to the descriptor of the queue
+ * @param   values   Pointer to the memory to store the values read
+ * @param   count    Maximum amount of values to read
+ * @param   timeout  Maximum amount of ticks to wait for data
+ * @return           Amount of values read, zero when the timeout expires with the queue empty
+ */
+static inline uint32_t MpscPopWait(mpsc_t self, uint32_t * values, uint32_t count,
+                                   TickType_t timeout) {
+    TimeOut_t start;
+    uint32_t result;
+
+    /* Waits again for the remaining ticks when woken by a notification of a previous write */
+    vTaskSetTimeOutState(&start);
+    while (true) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        result = MpscPopBatch(self, values, count);
+        if ((result > 0) || (xTaskCheckForTimeOut(&start, &timeout) != pdFALSE)) {
+            break;
+        }
+        ulTaskNotifyTake(pdTRUE, timeout);
+    }
+    return result;
+}
+
+#endif
+
+#ifdef USE_HAL
+
+/**
+ * @brief Function to send the data encoded from a queue through a serial port
+ *
+ * The function doesn't wait for the serial port, it sends only the data accepted by the hardware
+ * and keeps the rest in the buffer for the next call, so it can be called from the idle hook. At
+ * most limit bytes are encoded in every call, so the values written in the queue while the data
+ * is sent, as the events recorded by the hooks of the serial port, are left for the next call.
+ *
+ * @param   self   Pointer to the descriptor of the buffer with the pending data
+ * @param   sci    Pointer to the structure with the serial port descriptor
+ * @param   read   Function to encode the values taken from the queue
+ * @param   limit  Maximum amount of bytes to encode from the queue
+ */
+static inline void FifoDrain(fifo_drain_t self, hal_sci_t sci, fifo_drain_read_t read,
+                             size_t limit) {
+    do {
+        if (self->sent == self->count) {
+            self->count = read(self->buffer, (limit < self->size) ? limit : self->size);
+            self->sent = 0;
+            limit -= self->count;
+        }
+        if (self->sent < self->count) {
+            self->sent += SciSendData(sci, &self->buffer[self->sent], self->count - self->sent);
+        }
+    } while ((self->count != 0) && (self->sent == self->count));
+}
+
+#endif
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* FIFO_H */
@@ -0,0 +1,109 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Unit tests of the lock free queues
+ **
+ ** @addtogroup fifo FIFO
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "fifo.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+TEST(fifo, init_rejects_invalid_sizes) {
+    static uint8_t buffer[16];
+    struct fifo_s fifo[1];
+
+    TEST_ASSERT(!FifoInit(fifo, buffer, 12));
+    TEST_ASSERT(FifoInit(fifo, buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL(0, FifoCount(fifo));
+    TEST_ASSERT_EQUAL(sizeof(buffer), FifoSpace(fifo));
+}
+
+TEST(fifo, put_and_get_keep_the_order) {
+    FIFO_DEFINE(fifo, 4);
+    uint8_t value;
+
+    for (uint8_t index = 0; index < 4; index++) {
+        TEST_ASSERT(FifoPut(fifo, index));
+    }
+    TEST_ASSERT(!FifoPut(fifo, 4));
+    for (uint8_t index = 0; index < 4; index++) {
+        TEST_ASSERT(FifoGet(fifo, &value));
+        TEST_ASSERT_EQUAL(index, value);
+    }
+    TEST_ASSERT(!FifoGet(fifo, &value));
+}
+
+TEST(fifo, blocks_wrap_around_the_end) {
+    FIFO_DEFINE(fifo, 8);
+    static const uint8_t data[] = "abcdef";
+    uint8_t result[8];
+
+    TEST_ASSERT_EQUAL(6, FifoWrite(fifo, data, 6));
+    TEST_ASSERT_EQUAL(6, FifoRead(fifo, result, sizeof(result)));
+    TEST_ASSERT_EQUAL(6, FifoWrite(fifo, data, 6));
+    TEST_ASSERT_EQUAL(2, FifoWrite(fifo, data, 6));
+    TEST_ASSERT_EQUAL(8, FifoRead(fifo, result, sizeof(result)));
+    TEST_ASSERT_EQUAL_MEMORY("abcdefab", result, 8);
+}
+
+TEST(mpsc, push_and_pop_keep_the_order) {
+    MPSC_DEFINE(queue, 4);
+    uint32_t value;
+
+    for (uint32_t index = 0; index < 4; index++) {
+        TEST_ASSERT(MpscPush(queue, index * 10));
+    }
+    TEST_ASSERT(!MpscPush(queue, 40));
+    TEST_ASSERT_EQUAL(1, queue->dropped);
+    for (uint32_t index = 0; index < 4; index++) {
+        TEST_ASSERT(MpscPop(queue, &value));
+        TEST_ASSERT_EQUAL(index * 10, value);
+    }
+    TEST_ASSERT(!MpscPop(queue, &value));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,56 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef RUNTIME_COUNTER_H
+#define RUNTIME_COUNTER_H
+
+/** @file
+ ** @brief Time base of the run time statistics
+ **
+ ** Included from the FreeRTOSConfig.h file of the projects when the module is built with the
+ ** RUNTIME_STATS option, it enables the run time statistics of the kernel using the cycle
+ ** counter of the hardware abstraction layer as time base.
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS integration module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#ifndef __ASSEMBLER__
+#include "hal_cycles.h"
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define configGENERATE_RUN_TIME_STATS            1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() CyclesStart()
+#define portGET_RUN_TIME_COUNTER_VALUE()         CyclesRead()
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
+
+#endif /* RUNTIME_COUNTER_H */
@@ -0,0 +1,91 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef RUNTIME_STATS_H
+#define RUNTIME_STATS_H
+
+/** @file
+ ** @brief Run time statistics reporter declarations
+ **
+ ** Periodic report with the processor usage and the stack high water mark of every task and the
+ ** free space in the heap, sent through a serial port. The processor usage is calculated from the
+ ** time used by every task since the previous report.
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS integration module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "FreeRTOS.h"
+#include "hal_sci.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to send a report with the statistics since the previous call
+ *
+ * @remark The processor usage is calculated with the 32 bits cycle counter, so the time between
+ *         two reports must be shorter than a wrap of the counter, about 21 seconds at 204 MHz
+ *
+ * @param  sci      Pointer to the structure with the descriptor of the serial port
+ */
+void RuntimeStatsReport(hal_sci_t sci);
+
+/**
+ * @brief Function to create a task that sends periodic reports with the statistics
+ *
+ * @param  sci      Pointer to the structure with the descriptor of the serial port
+ * @param  period   Period, in milliseconds, between each report, shorter than a wrap of the
+ *                  cycle counter
+ * @param  priority Priority of the reporter task
+ * @return true     The reporter task was created
+ * @return false    The reporter task could not be created
+ */
+bool RuntimeStatsStart(hal_sci_t sci, uint32_t period, UBaseType_t priority);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* RUNTIME_STATS_H */
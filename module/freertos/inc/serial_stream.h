@@ -0,0 +1,159 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SERIAL_STREAM_H
+#define SERIAL_STREAM_H
+
+/** @file
+ ** @brief Serial ports with stream buffers declarations
+ **
+ ** Binds a serial port of the hardware abstraction layer to a transmission and a reception stream
+ ** buffer of the kernel. The interrupt handler moves the data between the hardware and the stream
+ ** buffers in chunks, so the tasks blocked in SerialRead or SerialWrite are woken once per chunk
+ ** instead of once per byte.
+ **
+ ** As the stream buffers of the kernel, every direction of a serial port allows only one task
+ ** reading or writing at the same time. The interrupt priority of the serial ports, defined with
+ ** HAL_SCI_NVIC_PRIORITY, must be lower than configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS integration module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "FreeRTOS.h"
+#include "hal_sci.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Pointer to the structure with the descriptor of a serial port with stream buffers
+ */
+typedef struct serial_stream_s * serial_stream_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * @brief Function to bind a configured serial port to stream buffers allocated by the kernel
+ *
+ * @param  sci          Pointer to the structure with the serial port descriptor
+ * @param  tx_size      Capacity in bytes of the transmission stream buffer
+ * @param  rx_size      Capacity in bytes of the reception stream buffer
+ * @param  rx_trigger   Amount of received bytes required to wake a task blocked in SerialRead
+ * @return              Pointer to the serial port descriptor, NULL when it could not be created or
+ *                      the capacities are not greater than the size of a size_t
+ */
+serial_stream_t SerialCreate(hal_sci_t sci, size_t tx_size, size_t rx_size, size_t rx_trigger);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief Function to bind a configured serial port to stream buffers in memory given by caller
+ *
+ * @remark The capacity of every stream buffer is one byte less than the size of its memory, and
+ *         the sizes must be greater than the size of a size_t as required by the kernel
+ *
+ * @param  sci          Pointer to the structure with the serial port descriptor
+ * @param  tx_buffer    Pointer to the memory used by the transmission stream buffer
+ * @param  tx_size      Size in bytes of the memory used by the transmission stream buffer
+ * @param  rx_buffer    Pointer to the memory used by the reception stream buffer
+ * @param  rx_size      Size in bytes of the memory used by the reception stream buffer
+ * @param  rx_trigger   Amount of received bytes required to wake a task blocked in SerialRead
+ * @return              Pointer to the serial port descriptor, NULL when it could not be created
+ */
+serial_stream_t SerialCreateStatic(hal_sci_t sci, uint8_t * tx_buffer, size_t tx_size,
+                                   uint8_t * rx_buffer, size_t rx_size, size_t rx_trigger);
+#endif
+
+/**
+ * @brief Function to send data through a serial port
+ *
+ * The data is copied in the transmission stream buffer and the transmission is started if the
+ * port was idle. When the buffer is full the calling task is blocked until the interrupt handler
+ * frees enough space or the timeout expires.
+ *
+ * @param  self     Pointer to the serial port descriptor
+ * @param  data     Pointer to the data to send
+ * @param  size     Amount of bytes to send
+ * @param  timeout  Maximum amount of ticks to wait for free space in the transmission buffer
+ * @return size_t   Amount of bytes copied in the transmission buffer
+ */
+size_t SerialWrite(serial_stream_t self, void const * data, size_t size, TickType_t timeout);
+
+/**
+ * @brief Function to get data received by a serial port
+ *
+ * The calling task is blocked until the amount of bytes defined by the trigger level are
+ * available in the reception stream buffer or the timeout expires.
+ *
+ * @param  self     Pointer to the serial port descriptor
+ * @param  data     Pointer to the memory to store the received bytes
+ * @param  size     Maximum amount of bytes to get
+ * @param  timeout  Maximum amount of ticks to wait for received data
+ * @return size_t   Amount of bytes stored in data, zero if the timeout expires without data
+ */
+size_t SerialRead(serial_stream_t self, void * data, size_t size, TickType_t timeout);
+
+/**
+ * @brief Function to change the amount of received bytes required to wake a task in SerialRead
+ *
+ * @param  self     Pointer to the serial port descriptor
+ * @param  level    Amount of received bytes required to wake the task
+ * @return true     The trigger level was changed
+ * @return false    The trigger level is greater than the capacity of the reception buffer
+ */
+bool SerialSetTrigger(serial_stream_t self, size_t level);
+
+/**
+ * @brief Function to get the amount of received bytes discarded with the reception buffer full
+ *
+ * @param  self     Pointer to the serial port descriptor
+ * @return uint32_t Amount of bytes discarded since the port was created
+ */
+uint32_t SerialLostBytes(serial_stream_t self);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SERIAL_STREAM_H */
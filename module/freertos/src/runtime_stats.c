@@ -0,0 +1,245 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Run time statistics reporter implementation
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS integration module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#ifdef USE_RUNTIME_STATS
+
+#include "runtime_stats.h"
+#include "task.h"
+#include <stdio.h>
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef RUNTIME_STATS_TASKS
+#define RUNTIME_STATS_TASKS 16
+#endif
+
+#ifndef RUNTIME_STATS_STACK
+#define RUNTIME_STATS_STACK (configMINIMAL_STACK_SIZE * 3)
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the parameters of the reporter task
+typedef struct reporter_s {
+    hal_sci_t sci;    /**< Serial port used to send the reports */
+    TickType_t delay; /**< Amount of ticks between each report */
+} * reporter_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to send a text line through a serial port waiting until it is accepted
+ *
+ * @remark While the port doesn't accept data the calling task is blocked for one tick
+ *
+ * @param   sci   Pointer to the structure with the descriptor of the serial port
+ * @param   line  Text to send
+ * @param   size  Length of the text to send
+ */
+static void SendLine(hal_sci_t sci, char const * line, int size);
+
+/**
+ * @brief Function to find the run time of a task in the previous report
+ *
+ * @param   number  Unique number assigned by the kernel to the task
+ * @param   current Run time of the task in the current report, it is stored for the next report
+ * @return          Run time of the task in the previous report, zero for a new task
+ */
+static uint32_t PreviousRunTime(UBaseType_t number, uint32_t current);
+
+/**
+ * @brief Function to release the entries of the previous report used by deleted tasks
+ *
+ * @param   count   Amount of tasks in the current report
+ */
+static void ForgetDeletedTasks(UBaseType_t count);
+
+/**
+ * @brief Function implementing the reporter task
+ *
+ * @param   object  Pointer to the structure with the parameters of the task
+ */
+static void ReporterTask(void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Status of the tasks taken from the kernel
+static TaskStatus_t tasks[RUNTIME_STATS_TASKS];
+
+//! Run time of every task in the previous report
+static struct {
+    UBaseType_t number; /**< Unique number assigned by the kernel to the task */
+    uint32_t run_time;  /**< Run time of the task in the previous report */
+} previous[RUNTIME_STATS_TASKS];
+
+//! Total run time in the previous report
+static uint32_t previous_total;
+
+//! Parameters of the reporter task
+static struct reporter_s reporter[1];
+
+/* === Private function implementation ========================================================= */
+
+static void SendLine(hal_sci_t sci, char const * line, int size) {
+    while (size > 0) {
+        uint16_t sent = SciSendData(sci, line, size);
+        line += sent;
+        size -= sent;
+        if (sent == 0) {
+            /* Blocks until the next tick, so the lower priority tasks run while the port sends */
+            vTaskDelay(1);
+        }
+    }
+}
+
+static uint32_t PreviousRunTime(UBaseType_t number, uint32_t current) {
+    uint32_t result = 0;
+    int free = -1;
+
+    for (int index = 0; index < RUNTIME_STATS_TASKS; index++) {
+        if (previous[index].number == number) {
+            result = previous[index].run_time;
+            free = index;
+            break;
+        } else if ((free < 0) && (previous[index].number == 0)) {
+            free = index;
+        }
+    }
+    if (free >= 0) {
+        previous[free].number = number;
+        previous[free].run_time = current;
+    }
+    return result;
+}
+
+static void ForgetDeletedTasks(UBaseType_t count) {
+    for (int index = 0; index < RUNTIME_STATS_TASKS; index++) {
+        bool found = (previous[index].number == 0);
+
+        for (UBaseType_t task = 0; (task < count) && !found; task++) {
+            found = (previous[index].number == tasks[task].xTaskNumber + 1);
+        }
+        if (!found) {
+            previous[index].number = 0;
+        }
+    }
+}
+
+static void ReporterTask(void * object) {
+    reporter_t parameters = object;
+    TickType_t last_report = xTaskGetTickCount();
+
+    while (true) {
+        vTaskDelayUntil(&last_report, parameters->delay);
+        RuntimeStatsReport(parameters->sci);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void RuntimeStatsReport(hal_sci_t sci) {
+    /* Letters of the states running, ready, blocked, suspended, deleted and invalid */
+    static char const * const states = "XRBSDI";
+    char line[80];
+    uint32_t total;
+    uint32_t elapsed;
+    UBaseType_t count;
+    int size;
+
+    /* The run time counter is the 32 bits cycle counter, that wraps every 2^32 cycles, about
+     * 21 seconds with the 204 MHz clock of the LPC4337. The unsigned difference is right only when
+     * the reports are closer than one wrap, the time of every task is accumulated by the kernel
+     * on each switch so it is not affected */
+    count = uxTaskGetSystemState(tasks, RUNTIME_STATS_TASKS, &total);
+    elapsed = total - previous_total;
+    previous_total = total;
+    if (count > 0) {
+        /* The entries of the deleted tasks are released before the new tasks take one */
+        ForgetDeletedTasks(count);
+    }
+
+    size = snprintf(line, sizeof(line), "\r\n%-*s State Prio   CPU%%  Stack\r\n",
+                    configMAX_TASK_NAME_LEN, "Task");
+    SendLine(sci, line, size);
+    for (UBaseType_t index = 0; index < count; index++) {
+        TaskStatus_t * task = &tasks[index];
+        /* The task numbers are stored plus one because zero marks a free entry */
+        uint32_t used = task->ulRunTimeCounter - PreviousRunTime(task->xTaskNumber + 1,
+                                                                 task->ulRunTimeCounter);
+        uint32_t usage = elapsed ? (uint32_t)(((uint64_t)used * 1000) / elapsed) : 0;
+
+        size = snprintf(line, sizeof(line), "%-*s %c     %4lu %4lu.%lu%% %6lu\r\n",
+                        configMAX_TASK_NAME_LEN, task->pcTaskName, states[task->eCurrentState],
+                        (unsigned long)task->uxCurrentPriority, (unsigned long)(usage / 10),
+                        (unsigned long)(usage % 10), (unsigned long)task->usStackHighWaterMark);
+        SendLine(sci, line, size);
+    }
+    if (count == 0) {
+        size = snprintf(line, sizeof(line), "More than %d tasks\r\n", RUNTIME_STATS_TASKS);
+        SendLine(sci, line, size);
+    }
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && !defined(POSIX)
+    size = snprintf(line, sizeof(line), "Heap free %lu bytes, minimum ever free %lu bytes\r\n",
+                    (unsigned long)xPortGetFreeHeapSize(),
+                    (unsigned long)xPortGetMinimumEverFreeHeapSize());
+    SendLine(sci, line, size);
+#endif
+}
+
+bool RuntimeStatsStart(hal_sci_t sci, uint32_t period, UBaseType_t priority) {
+    reporter->sci = sci;
+    reporter->delay = pdMS_TO_TICKS(period);
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    return (xTaskCreate(ReporterTask, "Stats", RUNTIME_STATS_STACK, reporter, priority, NULL) ==
+            pdPASS);
+#else
+    static StaticTask_t task;
+    static StackType_t stack[RUNTIME_STATS_STACK];
+
+    return (xTaskCreateStatic(ReporterTask, "Stats", RUNTIME_STATS_STACK, reporter, priority, stack,
+                              &task) != NULL);
+#endif
+}
+
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
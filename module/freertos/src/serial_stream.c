@@ -0,0 +1,292 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Serial ports with stream buffers implementation
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS integration module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#ifdef USE_HAL
+
+#include "serial_stream.h"
+#include "stream_buffer.h"
+#include "task.h"
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef SERIAL_STREAM_INSTANCES
+#define SERIAL_STREAM_INSTANCES 4
+#endif
+
+#ifndef SERIAL_STREAM_CHUNK
+#define SERIAL_STREAM_CHUNK 16
+#endif
+
+//! Minimum size of the memory of a stream buffer, the kernel requires more than a length field
+#define SERIAL_STREAM_MIN_SIZE (sizeof(size_t) + 1)
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the descriptor of a serial port with stream buffers
+struct serial_stream_s {
+    hal_sci_t sci;                             /**< Serial port of the hardware abstraction layer */
+    StreamBufferHandle_t tx_stream;            /**< Stream buffer with the data to send */
+    StreamBufferHandle_t rx_stream;            /**< Stream buffer with the data received */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    StaticStreamBuffer_t tx_control;           /**< Control block of the transmission buffer */
+    StaticStreamBuffer_t rx_control;           /**< Control block of the reception buffer */
+#endif
+    struct {
+        uint8_t data[SERIAL_STREAM_CHUNK]; /**< Chunk taken from the stream being transmited */
+        uint8_t count;                     /**< Amount of bytes in the chunk */
+        uint8_t sent;                      /**< Amount of bytes of the chunk already transmited */
+    } tx[1];                                   /**< Chunk of data being transmited */
+    volatile bool sending;                     /**< The interrupt handler is sending data */
+    volatile uint32_t lost;                    /**< Amount of received bytes discarded */
+    bool allocated;                            /**< The descriptor is in use */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to allocate a descriptor for a new serial port with stream buffers
+ *
+ * @return  Pointer to the allocated descriptor, NULL if all descriptors are in use
+ */
+static serial_stream_t SerialAllocate(void);
+
+/**
+ * @brief Function to bind the serial port to the stream buffers once they were created
+ *
+ * @param   self        Pointer to the serial port descriptor
+ * @param   rx_trigger  Amount of received bytes required to wake a task blocked in SerialRead
+ * @return              Pointer to the serial port descriptor, NULL if the streams are invalid
+ */
+static serial_stream_t SerialBind(serial_stream_t self, size_t rx_trigger);
+
+/**
+ * @brief Function to move the next bytes of the transmission buffer to the serial port
+ *
+ * @remark It must be called from the interrupt handler or with the interrupts disabled
+ *
+ * @param   self   Pointer to the serial port descriptor
+ * @param   woken  Pointer to inform that a context switch is required, it can be NULL
+ */
+static void SerialTransmit(serial_stream_t self, BaseType_t * woken);
+
+/**
+ * @brief Function to start the transmission of the data in the stream buffer if the port is idle
+ *
+ * @param   self   Pointer to the serial port descriptor
+ */
+static void SerialStart(serial_stream_t self);
+
+/**
+ * @brief Function to handle the events raised by the serial port
+ *
+ * @param   sci     Pointer to the structure with the serial port descriptor
+ * @param   status  Pointer to structure with flags that raises the event
+ * @param   object  Pointer to the descriptor of the serial port with stream buffers
+ */
+static void SerialEvent(hal_sci_t sci, sci_status_t status, void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+_Static_assert(SERIAL_STREAM_CHUNK <= UINT8_MAX, "Serial chunk must fit in the chunk counters");
+
+/* === Private function implementation ========================================================= */
+
+static serial_stream_t SerialAllocate(void) {
+    static struct serial_stream_s instances[SERIAL_STREAM_INSTANCES] = {0};
+    serial_stream_t self = NULL;
+
+    taskENTER_CRITICAL();
+    for (int index = 0; index < SERIAL_STREAM_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            self = &instances[index];
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return self;
+}
+
+static serial_stream_t SerialBind(serial_stream_t self, size_t rx_trigger) {
+    if ((self->tx_stream == NULL) || (self->rx_stream == NULL)) {
+        if (self->tx_stream) {
+            vStreamBufferDelete(self->tx_stream);
+        }
+        if (self->rx_stream) {
+            vStreamBufferDelete(self->rx_stream);
+        }
+        self->allocated = false;
+        return NULL;
+    }
+    xStreamBufferSetTriggerLevel(self->rx_stream, rx_trigger);
+    SciSetEventHandler(self->sci, SerialEvent, self);
+    return self;
+}
+
+static void SerialTransmit(serial_stream_t self, BaseType_t * woken) {
+    uint16_t pending;
+    uint16_t accepted;
+
+    /* When the port accepts all the pending bytes it may not raise another event, so the next
+     * chunk is sent until the port accepts only a part of it or the stream buffer gets empty */
+    do {
+        if (self->tx->sent == self->tx->count) {
+            self->tx->sent = 0;
+            self->tx->count = xStreamBufferReceiveFromISR(self->tx_stream, self->tx->data,
+                                                          SERIAL_STREAM_CHUNK, woken);
+        }
+        pending = self->tx->count - self->tx->sent;
+        accepted = 0;
+        if (pending) {
+            accepted = SciSendData(self->sci, &self->tx->data[self->tx->sent], pending);
+            self->tx->sent += accepted;
+        }
+    } while ((pending != 0) && (accepted == pending));
+
+    self->sending = (pending != 0);
+}
+
+static void SerialStart(serial_stream_t self) {
+    taskENTER_CRITICAL();
+    if (!self->sending) {
+        SerialTransmit(self, NULL);
+    }
+    taskEXIT_CRITICAL();
+}
+
+static void SerialEvent(hal_sci_t sci, sci_status_t status, void * object) {
+    serial_stream_t self = object;
+    BaseType_t woken = pdFALSE;
+    uint8_t data[SERIAL_STREAM_CHUNK];
+    uint16_t count;
+
+    if (status->data_ready) {
+        do {
+            count = SciReceiveData(sci, data, sizeof(data));
+            if (count) {
+                size_t stored = xStreamBufferSendFromISR(self->rx_stream, data, count, &woken);
+                self->lost += count - stored;
+            }
+        } while (count == sizeof(data));
+    }
+
+    if (status->fifo_empty && self->sending) {
+        SerialTransmit(self, &woken);
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/* === Public function implementation ========================================================== */
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+serial_stream_t SerialCreate(hal_sci_t sci, size_t tx_size, size_t rx_size, size_t rx_trigger) {
+    serial_stream_t self;
+
+    if ((tx_size < SERIAL_STREAM_MIN_SIZE) || (rx_size < SERIAL_STREAM_MIN_SIZE) ||
+        (rx_trigger > rx_size)) {
+        return NULL;
+    }
+
+    self = SerialAllocate();
+    if (self) {
+        self->sci = sci;
+        self->tx_stream = xStreamBufferCreate(tx_size, 1);
+        self->rx_stream = xStreamBufferCreate(rx_size, rx_trigger);
+        self = SerialBind(self, rx_trigger);
+    }
+    return self;
+}
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+serial_stream_t SerialCreateStatic(hal_sci_t sci, uint8_t * tx_buffer, size_t tx_size,
+                                   uint8_t * rx_buffer, size_t rx_size, size_t rx_trigger) {
+    serial_stream_t self;
+
+    /* The kernel uses the whole memory and keeps one byte free, so the trigger level must fit
+     * in the remaining capacity */
+    if ((tx_size < SERIAL_STREAM_MIN_SIZE) || (rx_size < SERIAL_STREAM_MIN_SIZE) ||
+        (rx_trigger >= rx_size)) {
+        return NULL;
+    }
+
+    self = SerialAllocate();
+    if (self) {
+        self->sci = sci;
+        self->tx_stream = xStreamBufferCreateStatic(tx_size, 1, tx_buffer, &self->tx_control);
+        self->rx_stream =
+            xStreamBufferCreateStatic(rx_size, rx_trigger, rx_buffer, &self->rx_control);
+        self = SerialBind(self, rx_trigger);
+    }
+    return self;
+}
+#endif
+
+size_t SerialWrite(serial_stream_t self, void const * data, size_t size, TickType_t timeout) {
+    TimeOut_t start;
+    size_t result;
+
+    vTaskSetTimeOutState(&start);
+    result = xStreamBufferSend(self->tx_stream, data, size, 0);
+    SerialStart(self);
+    while ((result < size) && (xTaskCheckForTimeOut(&start, &timeout) == pdFALSE)) {
+        result += xStreamBufferSend(self->tx_stream, (uint8_t const *)data + result, size - result,
+                                    timeout);
+        SerialStart(self);
+    }
+    return result;
+}
+
+size_t SerialRead(serial_stream_t self, void * data, size_t size, TickType_t timeout) {
+    return xStreamBufferReceive(self->rx_stream, data, size, timeout);
+}
+
+bool SerialSetTrigger(serial_stream_t self, size_t level) {
+    return (xStreamBufferSetTriggerLevel(self->rx_stream, level) == pdTRUE);
+}
+
+uint32_t SerialLostBytes(serial_stream_t self) {
+    return self->lost;
+}
+
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
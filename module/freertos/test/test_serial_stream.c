@@ -0,0 +1,96 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Unit tests of the serial ports with stream buffers on the host
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "FreeRTOS.h"
+#include "serial_stream.h"
+#include "soc_sci.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Size of the memory of the stream buffers used by the tests
+#define SERIAL_TEST_SIZE 32
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+TEST(serial, static_rejects_invalid_sizes) {
+    static uint8_t tx_buffer[SERIAL_TEST_SIZE];
+    static uint8_t rx_buffer[SERIAL_TEST_SIZE];
+
+    TEST_ASSERT(SerialCreateStatic(HAL_SCI_USART3, tx_buffer, 0, rx_buffer, sizeof(rx_buffer), 1) ==
+                NULL);
+    TEST_ASSERT(SerialCreateStatic(HAL_SCI_USART3, tx_buffer, sizeof(tx_buffer), rx_buffer, 1, 1) ==
+                NULL);
+    TEST_ASSERT(SerialCreateStatic(HAL_SCI_USART3, tx_buffer, sizeof(size_t), rx_buffer,
+                                   sizeof(rx_buffer), 1) == NULL);
+    TEST_ASSERT(SerialCreateStatic(HAL_SCI_USART3, tx_buffer, sizeof(tx_buffer), rx_buffer,
+                                   sizeof(rx_buffer), sizeof(rx_buffer)) == NULL);
+}
+
+TEST(serial, static_capacity_is_one_byte_less) {
+    static uint8_t tx_buffer[SERIAL_TEST_SIZE];
+    static uint8_t rx_buffer[SERIAL_TEST_SIZE];
+    static const char message[] = "The whole message is longer than the transmission buffer";
+    uint8_t data[SERIAL_TEST_SIZE];
+    serial_stream_t serial;
+
+    serial = SerialCreateStatic(HAL_SCI_USART3, tx_buffer, sizeof(tx_buffer), rx_buffer,
+                                sizeof(rx_buffer), sizeof(rx_buffer) - 1);
+    TEST_ASSERT(serial != NULL);
+    TEST_ASSERT(SerialSetTrigger(serial, 1));
+
+    /* Without timeout only the capacity of the buffer, one byte less than its memory, is copied.
+     * The port isn't attached on the host, so it accepts at once all the data of the buffer */
+    TEST_ASSERT_EQUAL(sizeof(tx_buffer) - 1, SerialWrite(serial, message, sizeof(message), 0));
+    TEST_ASSERT_EQUAL(sizeof(message) - sizeof(tx_buffer) + 1,
+                      SerialWrite(serial, &message[sizeof(tx_buffer) - 1],
+                                  sizeof(message) - sizeof(tx_buffer) + 1, 0));
+    TEST_ASSERT_EQUAL(0, SerialRead(serial, data, sizeof(data), 0));
+    TEST_ASSERT_EQUAL(0, SerialLostBytes(serial));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
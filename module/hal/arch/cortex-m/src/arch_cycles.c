@@ -0,0 +1,76 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Cycle counter on Cortex-M implementation
+ **
+ ** @addtogroup cortex-m Cortex-M
+ ** @ingroup hal
+ ** @brief Cortex-M architecture Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "hal_cycles.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define DEMCR         (*(volatile uint32_t *)0xE000EDFC) /**< Debug exception and monitor control */
+#define DWT_CTRL      (*(volatile uint32_t *)0xE0001000) /**< Data watchpoint and trace control */
+#define DWT_CYCCNT    (*(volatile uint32_t *)0xE0001004) /**< Data watchpoint cycle counter */
+
+#define DEMCR_TRCENA  (1UL << 24) /**< Enable bit of the trace and debug blocks */
+#define DWT_CYCCNTENA (1UL << 0)  /**< Enable bit of the cycle counter */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void CyclesStart(void) {
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CTRL |= DWT_CYCCNTENA;
+}
+
+uint32_t CyclesFrequency(void) {
+    extern uint32_t SystemCoreClock;
+
+    return SystemCoreClock;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -0,0 +1,119 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Microbenchmarks of the hardware abstraction layer emulated on the host
+ **
+ ** The results measure the cost of the emulation on the host, they are useful to compare changes
+ ** in the hal code but they don't predict the time of the same operation on the target.
+ **
+ ** @addtogroup hal HAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "hal_gpio.h"
+#include "hal_sci.h"
+#include "hal_tick.h"
+#include "soc_gpio.h"
+#include "soc_sci.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Period in microseconds of the emulated timer, long enough to not disturb the measurement
+#define BENCH_TICK_PERIOD 999999
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to handle the emulated tick events
+ *
+ * @param   object  Pointer to the counter of events
+ */
+static void BenchTickEvent(void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void BenchTickEvent(void * object) {
+    __atomic_fetch_add((uint32_t *)object, 1, __ATOMIC_RELAXED);
+}
+
+/* === Public function implementation ========================================================== */
+
+//! Function that dispatch the tick interrupt in the posix soc
+extern void SysTick_Handler(void);
+
+BENCH(gpio, bit_set) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        GpioBitSet(HAL_GPIO0_0);
+    }
+}
+
+BENCH(gpio, bit_toggle) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        GpioBitToggle(HAL_GPIO0_0);
+    }
+}
+
+BENCH(gpio, get_state) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        BENCH_KEEP(GpioGetState(HAL_GPIO0_0));
+    }
+}
+
+BENCH(sci, send_byte) {
+    static const uint8_t data = 'U';
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        BENCH_KEEP(SciSendData(HAL_SCI_USART0, &data, sizeof(data)));
+    }
+}
+
+BENCH(tick, dispatch) {
+    static uint32_t events = 0;
+    static bool started = false;
+
+    if (!started) {
+        started = true;
+        TickStart(BenchTickEvent, &events, BENCH_TICK_PERIOD);
+    }
+    for (uint32_t index = 0; index < iterations; index++) {
+        SysTick_Handler();
+    }
+    BENCH_KEEP(events);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -39,6 +39,7 @@ SPDX-License-Identifier: MIT
 #include "hal_sci.h"
 #include "hal_gpio.h"
 #include "hal_tick.h"
+#include "hal_cycles.h"
 #include "soc_pin.h"
 #include "soc_sci.h"
 #include "soc_gpio.h"
@@ -0,0 +1,108 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HAL_CYCLES_H
+#define HAL_CYCLES_H
+
+/** @file
+ ** @brief Cycle counter declarations
+ **
+ ** Free running counter with the highest resolution available in the processor, used to measure
+ ** execution times and as the time base of the run time statistics. It uses the DWT unit on
+ ** Cortex-M, the mcycle register on RISC-V and the monotonic clock, in microseconds, on posix.
+ ** The counter is 32 bits wide, so the differences between two reads are valid while the elapsed
+ ** time is shorter than a complete turn of the counter.
+ **
+ ** @addtogroup hal HAL
+ ** @brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+#if defined(X86)
+#include <time.h>
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to enable the cycle counter
+ *
+ * The counter is not cleared, so the function can be called by every module that uses it without
+ * disturbing the measurements already started by the others.
+ */
+void CyclesStart(void);
+
+/**
+ * @brief Function to get the frequency of the cycle counter
+ *
+ * @return uint32_t Amount of counts in a second
+ */
+uint32_t CyclesFrequency(void);
+
+/**
+ * @brief Function to read the current value of the cycle counter
+ *
+ * @return uint32_t Current value of the cycle counter
+ */
+static inline uint32_t CyclesRead(void) {
+#if defined(CORTEX_M)
+    return *(volatile uint32_t *)0xE0001004;
+#elif defined(RV32)
+    uint32_t result;
+    __asm volatile("csrr %0, mcycle" : "=r"(result));
+    return result;
+#elif defined(X86)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+#else
+#error "The cycle counter is not available for this architecture"
+#endif
+}
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* HAL_CYCLES_H */
@@ -0,0 +1,112 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HAL_HOOKS_H
+#define HAL_HOOKS_H
+
+/** @file
+ ** @brief Instrumentation hooks of the hardware abstraction layer
+ **
+ ** The implementations of the hardware abstraction layer call these macros at the entry and
+ ** exit of the interrupt handlers, before the dispatch of the event to the registered handler
+ ** and in the data transfers. The backends that know when the hardware raised the event, like
+ ** the system timer, report it with the event hook so the whole latency can be measured. By
+ ** default the macros are empty, so they are compiled out, and they are defined by the
+ ** instrumentation modules included in the project.
+ **
+ ** @addtogroup hal HAL
+ ** @brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#ifdef USE_TRACE
+#include "trace.h"
+#endif
+
+#ifdef USE_LATENCY
+#include "latency.h"
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* The sources are 16 bits values, the gpio terminals of the posix board with the LPC43XX profile
+ * use the sources from HAL_HOOK_GPIO up to HAL_HOOK_GPIO + 8 * 32 - 1 */
+#define HAL_HOOK_TICK 0x00 //!< Source of the hooks called by the system timer
+#define HAL_HOOK_SCI  0x10 //!< Base source of the hooks called by the serial ports
+#define HAL_HOOK_GPIO 0x40 //!< Base source of the hooks called by the digital inputs events
+
+#ifdef USE_TRACE
+#define HAL_TRACE_IRQ_ENTER(SOURCE)      TraceEvent(TRACE_ISR_ENTER, SOURCE)
+#define HAL_TRACE_IRQ_EXIT(SOURCE)       TraceEvent(TRACE_ISR_EXIT, SOURCE)
+#define HAL_TRACE_SCI_SEND(SOURCE, SIZE) TraceEvent(TRACE_SCI_SEND, ((SOURCE) << 16) | (SIZE))
+#else
+#define HAL_TRACE_IRQ_ENTER(SOURCE)      ((void)0)
+#define HAL_TRACE_IRQ_EXIT(SOURCE)       ((void)0)
+#define HAL_TRACE_SCI_SEND(SOURCE, SIZE) ((void)0)
+#endif
+
+#ifdef USE_LATENCY
+#define HAL_LATENCY_IRQ_EVENT(SOURCE, CYCLES) LatencyEvent(SOURCE, CYCLES)
+#define HAL_LATENCY_IRQ_ENTER(SOURCE)         LatencyEnter(SOURCE)
+#define HAL_LATENCY_IRQ_DISPATCH(SOURCE)      LatencyDispatch(SOURCE)
+#define HAL_LATENCY_IRQ_EXIT(SOURCE)          LatencyExit(SOURCE)
+#else
+#define HAL_LATENCY_IRQ_EVENT(SOURCE, CYCLES) ((void)0)
+#define HAL_LATENCY_IRQ_ENTER(SOURCE)         ((void)0)
+#define HAL_LATENCY_IRQ_DISPATCH(SOURCE)      ((void)0)
+#define HAL_LATENCY_IRQ_EXIT(SOURCE)          ((void)0)
+#endif
+
+#ifndef HAL_HOOK_IRQ_EVENT
+//! Hook called with the value of the cycle counter when the hardware raised the interrupt
+#define HAL_HOOK_IRQ_EVENT(SOURCE, CYCLES) HAL_LATENCY_IRQ_EVENT(SOURCE, CYCLES)
+#endif
+
+#ifndef HAL_HOOK_IRQ_ENTER
+//! Hook called at the entry of an interrupt handler
+#define HAL_HOOK_IRQ_ENTER(SOURCE) (HAL_TRACE_IRQ_ENTER(SOURCE), HAL_LATENCY_IRQ_ENTER(SOURCE))
+#endif
+
+#ifndef HAL_HOOK_IRQ_DISPATCH
+//! Hook called by an interrupt handler just before the call to the registered event handler
+#define HAL_HOOK_IRQ_DISPATCH(SOURCE) HAL_LATENCY_IRQ_DISPATCH(SOURCE)
+#endif
+
+#ifndef HAL_HOOK_IRQ_EXIT
+//! Hook called at the exit of an interrupt handler after the dispatch of the event
+#define HAL_HOOK_IRQ_EXIT(SOURCE) (HAL_LATENCY_IRQ_EXIT(SOURCE), HAL_TRACE_IRQ_EXIT(SOURCE))
+#endif
+
+#ifndef HAL_HOOK_SCI_SEND
+//! Hook called when data is put into the output fifo of a serial port
+#define HAL_HOOK_SCI_SEND(SOURCE, SIZE) HAL_TRACE_SCI_SEND(SOURCE, SIZE)
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
+
+#endif /* HAL_HOOKS_H */
@@ -46,6 +46,9 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
 
+//! Value returned when a chip pin can't be connected to a peripheral signal
+#define HAL_PIN_NO_FUNCTION 0xFF
+
 /* === Public data type declarations =========================================================== */
 
 /**
@@ -53,6 +56,15 @@ extern "C" {
  */
 typedef struct hal_chip_pin_s const * hal_chip_pin_t;
 
+/**
+ * @brief Structure with an entry of the pin functions database generated for every soc
+ */
+struct hal_pin_function_s {
+    uint8_t port;     /**< Number of chip pin port */
+    uint8_t pin;      /**< Number of pin in chip port */
+    uint8_t function; /**< Function that routes the peripheral signal to the chip pin */
+};
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
@@ -67,6 +79,16 @@ typedef struct hal_chip_pin_s const * hal_chip_pin_t;
  */
 void ChipPinSetFunction(hal_chip_pin_t pin, uint8_t function, bool pullup, bool puldown);
 
+/**
+ * @brief Function to find in the pin functions database how to connect a signal to a chip pin
+ *
+ * @param  pin      Pointer to the structure with the chip pin descriptor
+ * @param  signal   Peripheral signal, as defined in the database of the soc
+ * @return          Function that routes the signal to the pin, HAL_PIN_NO_FUNCTION if the pin
+ *                  can't be used for the signal
+ */
+uint8_t ChipPinFindFunction(hal_chip_pin_t pin, uint8_t signal);
+
 /**
  * @brief Function to change the internal pullup resistor configuratioxn on chip pin
  *
@@ -0,0 +1,95 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_ECLIC_H
+#define SOC_ECLIC_H
+
+/** @file
+ ** @brief Interrupt controller on GD32VF103 declarations
+ **
+ ** The interrupts used by the hal are configured in the vectored mode of the ECLIC, the core jumps
+ ** from the vector table straight to the handler of every source, without the common entry code
+ ** that saves the context and searches the handler. The handlers must be declared with the
+ ** ECLIC_HANDLER attribute, so the compiler saves the registers they use and returns with mret.
+ **
+ ** @addtogroup gd32vf103 GD32VF103
+ ** @ingroup hal
+ ** @brief GD32VF103 SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Attribute of the handlers called from the vector table, they run with the interrupts disabled
+#define ECLIC_HANDLER __attribute__((interrupt))
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to enable an interrupt source in vectored mode
+ *
+ * The controller is switched to the ECLIC mode, with all the bits of the control register used as
+ * level. The global enable of the interrupts is not changed, it is set by the board setup in the
+ * bare metal projects and by the scheduler when the first task starts with an rtos.
+ *
+ * The handlers do not enable the interrupts again, so they are not nested and the level only
+ * selects which one of the pending interrupts is served first when a handler returns.
+ *
+ * @param  source  Number of the interrupt source
+ * @param  level   Level of the interrupt, the pending one with the higher level is served first
+ */
+void EclicEnable(uint32_t source, uint8_t level);
+
+/**
+ * @brief Function to disable an interrupt source and discard a pending request
+ *
+ * @param  source  Number of the interrupt source
+ */
+void EclicDisable(uint32_t source);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_ECLIC_H */
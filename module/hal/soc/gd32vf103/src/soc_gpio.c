@@ -0,0 +1,270 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Digital inputs/outputs on GD32VF103 implementation
+ **
+ ** @addtogroup gd32vf103 GD32VF103
+ ** @ingroup hal
+ ** @brief GD32VF103 SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_gpio.h"
+#include "soc_eclic.h"
+#include "gd32vf103.h"
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
+#include "hal_hooks.h"
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure level to set on ECLIC for digital inputs interrupts
+ */
+#ifndef HAL_GPIO_ECLIC_LEVEL
+#define HAL_GPIO_ECLIC_LEVEL 1
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/** @brief Structure to store a gpio bit event handler */
+typedef struct event_handler_s {
+    hal_gpio_bit_t gpio;      /**< Pointer to the structure with the gpio terminal descriptor */
+    hal_gpio_event_t handler; /**< Function to call on the serial port events */
+    void * object;            /**< Pointer to user data sended as parameter in handler calls */
+} * event_handler_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to dispatch an gpio bit event when then raises an interrupt
+ *
+ * @param  index    Index of gpio interrupt channel that raises the event
+ */
+static void GpioHandleEvent(uint8_t index);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Vector to store the event handlers of the serial ports
+ */
+static struct event_handler_s event_handlers[16] = {0};
+
+/**
+ * @brief Vector to store the address of the port registers
+ */
+static const uint32_t gpio_ports[] = {GPIOA, GPIOB, GPIOC, GPIOD};
+
+/* === Private function implementation ========================================================= */
+
+static void GpioHandleEvent(uint8_t index) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_GPIO + index);
+    event_handler_t descriptor = &event_handlers[index];
+    EXTI_PD = BIT(index);
+    bool rissing = GpioGetState(descriptor->gpio);
+
+    if (descriptor->handler != NULL) {
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_GPIO + index);
+        descriptor->handler(descriptor->gpio, rissing, descriptor->object);
+    }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_GPIO + index);
+}
+
+/* === Public function implementation ========================================================== */
+
+void GpioSetDirection(hal_gpio_bit_t gpio, bool output) {
+    if (gpio) {
+        ChipPinSetMode((hal_chip_pin_t)gpio, output ? GPIO_MODE_OUT_PP : GPIO_MODE_IPU);
+    }
+}
+
+bool GpioGetState(hal_gpio_bit_t gpio) {
+    bool value = false;
+    if (gpio) {
+        hal_chip_pin_t pin = (hal_chip_pin_t)gpio;
+        value = GPIO_ISTAT(gpio_ports[pin->port]) & BIT(pin->pin);
+    }
+    return value;
+}
+
+void GpioSetState(hal_gpio_bit_t gpio, bool state) {
+    if (gpio) {
+        hal_chip_pin_t output = (hal_chip_pin_t)gpio;
+        if (state) {
+            GPIO_BOP(gpio_ports[output->port]) = BIT(output->pin);
+        } else {
+            GPIO_BC(gpio_ports[output->port]) = BIT(output->pin);
+        }
+    }
+}
+
+void GpioBitSet(hal_gpio_bit_t gpio) {
+    if (gpio) {
+        hal_chip_pin_t output = (hal_chip_pin_t)gpio;
+        GPIO_BOP(gpio_ports[output->port]) = BIT(output->pin);
+    }
+}
+
+void GpioBitClear(hal_gpio_bit_t gpio) {
+    if (gpio) {
+        hal_chip_pin_t output = (hal_chip_pin_t)gpio;
+        GPIO_BC(gpio_ports[output->port]) = BIT(output->pin);
+    }
+}
+
+void GpioBitToggle(hal_gpio_bit_t gpio) {
+    if (gpio) {
+        hal_chip_pin_t output = (hal_chip_pin_t)gpio;
+        uint32_t port = gpio_ports[output->port];
+
+        /* Only the pin is written, so the other pins of the port are not changed by the toggle,
+           but a toggle of the same pin from an interrupt between the read and the write is lost */
+        if (GPIO_OCTL(port) & BIT(output->pin)) {
+            GPIO_BC(port) = BIT(output->pin);
+        } else {
+            GPIO_BOP(port) = BIT(output->pin);
+        }
+    }
+}
+
+void GpioSetEventHandler(hal_gpio_bit_t gpio, hal_gpio_event_t handler, void * object, bool rising,
+                         bool falling) {
+
+    uint32_t irq_number;
+    uint32_t irq_lines;
+    hal_chip_pin_t input = (hal_chip_pin_t)gpio;
+    event_handler_t descriptor = &event_handlers[input->pin];
+
+    if (input->pin >= 10) {
+        irq_number = EXTI10_15_IRQn;
+        irq_lines = BITS(10, 15);
+    } else if (input->pin >= 5) {
+        irq_number = EXTI5_9_IRQn;
+        irq_lines = BITS(5, 9);
+    } else {
+        irq_number = EXTI0_IRQn + input->pin;
+        irq_lines = BIT(input->pin);
+    }
+
+    if (((rising) || (falling)) && (handler)) {
+        if (descriptor->handler == NULL) {
+            descriptor->gpio = gpio;
+            descriptor->handler = handler;
+            descriptor->object = object;
+
+            /* Enable AFIO Clock */
+            rcu_periph_clock_enable(RCU_AF);
+            gpio_exti_source_select(input->port, input->pin);
+
+            /* Configure the interrupt mask */
+            EXTI_INTEN |= BIT(input->pin);
+
+            /* Configure the event mask */
+            EXTI_EVEN &= ~BIT(input->pin);
+
+            /* Enable or disable the rising trigger */
+            if (rising) {
+                EXTI_RTEN |= BIT(input->pin);
+            } else {
+                EXTI_RTEN &= ~BIT(input->pin);
+            }
+
+            /* Enable or disable the falling trigger */
+            if (falling) {
+                EXTI_FTEN |= BIT(input->pin);
+            } else {
+                EXTI_FTEN &= ~BIT(input->pin);
+            }
+
+            EXTI_PD = BIT(input->pin);
+            EclicEnable(irq_number, HAL_GPIO_ECLIC_LEVEL);
+        }
+    } else {
+        descriptor->handler = NULL;
+        EXTI_INTEN &= ~BIT(input->pin);
+        EXTI_PD = BIT(input->pin);
+
+        /* The lines from 5 to 15 share the interrupt, that is kept while any of them is used */
+        if ((EXTI_INTEN & irq_lines) == 0) {
+            EclicDisable(irq_number);
+        }
+    }
+}
+
+ECLIC_HANDLER void EXTI0_IRQHandler(void) {
+    GpioHandleEvent(0);
+}
+
+ECLIC_HANDLER void EXTI1_IRQHandler(void) {
+    GpioHandleEvent(1);
+}
+
+ECLIC_HANDLER void EXTI2_IRQHandler(void) {
+    GpioHandleEvent(2);
+}
+
+ECLIC_HANDLER void EXTI3_IRQHandler(void) {
+    GpioHandleEvent(3);
+}
+
+ECLIC_HANDLER void EXTI4_IRQHandler(void) {
+    GpioHandleEvent(4);
+}
+
+ECLIC_HANDLER void EXTI5_9_IRQHandler(void) {
+    for (int index = 5; index <= 9; index++) {
+        if (EXTI_PD & BIT(index)) {
+            GpioHandleEvent(index);
+        }
+    }
+}
+
+ECLIC_HANDLER void EXTI10_15_IRQHandler(void) {
+    for (int index = 10; index <= 15; index++) {
+        if (EXTI_PD & BIT(index)) {
+            GpioHandleEvent(index);
+        }
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -0,0 +1,338 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Serial ports on GD32VF103 implementation
+ **
+ ** @addtogroup gd32vf103 GD32VF103
+ ** @ingroup hal
+ ** @brief GD32VF103 SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_sci.h"
+#include "soc_pin.h"
+#include "soc_eclic.h"
+#include "gd32vf103.h"
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
+#include "hal_hooks.h"
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure level to set on ECLIC for serial port interrupts
+ */
+#ifndef HAL_SCI_ECLIC_LEVEL
+#define HAL_SCI_ECLIC_LEVEL 1
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Strcuture to store a serial port descriptor
+ */
+struct hal_sci_s {
+    uint32_t port;         /**< Address of the memory area with the serial port registers */
+    IRQn_Type interupt;    /**< Interrupt number corresponding to the serial port */
+    rcu_periph_enum clock; /**< Clock of the serial port in the reset and clock unit */
+    uint8_t index;         /**< Numeric index of serial port */
+    uint8_t txd_signal;    /**< Signal of the transmission line in the pin functions database */
+    uint8_t rxd_signal;    /**< Signal of the reception line in the pin functions database */
+    uint8_t remap_shift;   /**< Position of the serial port remap field in AFIO_PCF0 register */
+    uint32_t remap_mask;   /**< Mask of the serial port remap field in AFIO_PCF0 register */
+};
+
+/**
+ * @brief Structure to store a serial port event handler
+ */
+typedef struct event_handler_s {
+    hal_sci_event_t handler; /**< Function to call on the serial port events */
+    void * data;             /**< Pointer to user data sended as parameter in handler calls */
+} * event_handler_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations ===========================================================  */
+
+/**
+ * @brief Function to validate and configurate chip pins used by a serial port
+ *
+ * @param   sci     Pointer to the structure with the serial port descriptor
+ * @param   pins    Pointer to structure with chip pins asigned to serial port
+ * @return  true    The configuration is valid and has been applied
+ * @return  false   The configuration is invalid and has not been applied
+ */
+static bool ConfigPins(hal_sci_t sci, hal_sci_pins_t pins);
+
+/**
+ * @brief Function to encode serial port line parameters as bits required by control register
+ *
+ * @param   line      Pointer to structure with serial port line parameters
+ * @param   length    Pointer to store the word length in the format of the GD32 drivers
+ * @param   parity    Pointer to store the parity control in the format of the GD32 drivers
+ * @return  true      The configuration is valid and has been applied
+ * @return  false     The configuration is invalid and has not been applied
+ */
+static bool LineEncodeBits(hal_sci_line_t line, uint32_t * length, uint32_t * parity);
+
+/**
+ * @brief Function to dispatch an sci port event when the device raises an interrupt
+ *
+ * @param  sci  Pointer to the structure with the serial port descriptor
+ */
+static void SciHandleEvent(hal_sci_t sci);
+
+/* === Public variable definitions ============================================================= */
+
+/**
+ * @addtogroup gd32vf103 USART Constants
+ * @brief Constant for serial ports on board
+ * @{
+ */
+
+/** Constant to define serial port 0 */
+const hal_sci_t HAL_SCI_USART0 = &(struct hal_sci_s){
+    .port = USART0,
+    .interupt = USART0_IRQn,
+    .clock = RCU_USART0,
+    .index = 0,
+    .txd_signal = SOC_SIGNAL_USART0_TX,
+    .rxd_signal = SOC_SIGNAL_USART0_RX,
+    .remap_shift = 2,
+    .remap_mask = AFIO_PCF0_USART0_REMAP,
+};
+
+/** Constant to define serial port 1 */
+const hal_sci_t HAL_SCI_USART1 = &(struct hal_sci_s){
+    .port = USART1,
+    .interupt = USART1_IRQn,
+    .clock = RCU_USART1,
+    .index = 1,
+    .txd_signal = SOC_SIGNAL_USART1_TX,
+    .rxd_signal = SOC_SIGNAL_USART1_RX,
+    .remap_shift = 3,
+    .remap_mask = AFIO_PCF0_USART1_REMAP,
+};
+
+/** Constant to define serial port 2 */
+const hal_sci_t HAL_SCI_USART2 = &(struct hal_sci_s){
+    .port = USART2,
+    .interupt = USART2_IRQn,
+    .clock = RCU_USART2,
+    .index = 2,
+    .txd_signal = SOC_SIGNAL_USART2_TX,
+    .rxd_signal = SOC_SIGNAL_USART2_RX,
+    .remap_shift = 4,
+    .remap_mask = AFIO_PCF0_USART2_REMAP,
+};
+
+/** @} End of group gd32vf103 */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Vector to store the event handlers of the serial ports
+ */
+static struct event_handler_s event_handlers[3] = {0};
+
+/* === Private function implementation ========================================================= */
+
+static bool ConfigPins(hal_sci_t sci, hal_sci_pins_t pins) {
+    uint8_t remap = ChipPinFindFunction(pins->txd_pin, sci->txd_signal);
+    bool result = false;
+
+    /* Both lines are routed by the same remap field, so they must be pins of the same option */
+    if ((remap != HAL_PIN_NO_FUNCTION) &&
+        (remap == ChipPinFindFunction(pins->rxd_pin, sci->rxd_signal))) {
+        rcu_periph_clock_enable(sci->clock);
+        rcu_periph_clock_enable(RCU_AF);
+        AFIO_PCF0 = (AFIO_PCF0 & ~sci->remap_mask) | ((uint32_t)remap << sci->remap_shift);
+
+        ChipPinSetMode(pins->txd_pin, GPIO_MODE_AF_PP);
+        ChipPinSetMode(pins->rxd_pin, GPIO_MODE_IN_FLOATING);
+        result = true;
+    }
+    return result;
+}
+
+static bool LineEncodeBits(hal_sci_line_t line, uint32_t * length, uint32_t * parity) {
+    bool result = true;
+
+    switch (line->parity) {
+    case HAL_SCI_ODD_PARITY:
+        *parity = USART_PM_ODD;
+        break;
+    case HAL_SCI_EVEN_PARITY:
+        *parity = USART_PM_EVEN;
+        break;
+    case HAL_SCI_NO_PARITY:
+        *parity = USART_PM_NONE;
+        break;
+    default:
+        result = false;
+        break;
+    }
+
+    /* The parity bit is counted in the word length of the serial port */
+    switch (line->data_bits + (line->parity != HAL_SCI_NO_PARITY)) {
+    case 8:
+        *length = USART_WL_8BIT;
+        break;
+    case 9:
+        *length = USART_WL_9BIT;
+        break;
+    default:
+        result = false;
+        break;
+    }
+
+    return result;
+}
+
+static void SciHandleEvent(hal_sci_t sci) {
+    if (sci) {
+        event_handler_t event_handler = &event_handlers[sci->index];
+        struct sci_status_s status;
+
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_SCI + sci->index);
+        SciReadStatus(sci, &status);
+        if (event_handler->handler) {
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_SCI + sci->index);
+            event_handler->handler(sci, &status, event_handler->data);
+        }
+
+        /* Without new data from the handler the transmitter stops raising events */
+        if (USART_STAT(sci->port) & USART_STAT_TBE) {
+            USART_CTL0(sci->port) &= ~USART_CTL0_TBEIE;
+        }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_SCI + sci->index);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins) {
+    uint32_t length;
+    uint32_t parity;
+    bool result = false;
+
+    if (sci) {
+        result = LineEncodeBits(line, &length, &parity) && ConfigPins(sci, pins);
+        if (result) {
+            usart_deinit(sci->port);
+            usart_baudrate_set(sci->port, line->baud_rate);
+            usart_word_length_set(sci->port, length);
+            usart_parity_config(sci->port, parity);
+            usart_stop_bit_set(sci->port, USART_STB_1BIT);
+            usart_transmit_config(sci->port, USART_TRANSMIT_ENABLE);
+            usart_receive_config(sci->port, USART_RECEIVE_ENABLE);
+            usart_enable(sci->port);
+        }
+    }
+    return result;
+}
+
+uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
+    uint16_t result = 0;
+    if (sci) {
+        event_handler_t event_handler = &event_handlers[sci->index];
+
+        /* The transmitter has a buffer of a single byte */
+        if ((size > 0) && (USART_STAT(sci->port) & USART_STAT_TBE)) {
+            USART_DATA(sci->port) = *(uint8_t const *)data;
+            result = 1;
+        }
+        HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + sci->index, result);
+
+        if ((result < size) && (event_handler->handler != NULL)) {
+            USART_CTL0(sci->port) |= USART_CTL0_TBEIE;
+        }
+    }
+    return result;
+}
+
+uint16_t SciReceiveData(hal_sci_t sci, void * data, uint16_t size) {
+    uint16_t result = 0;
+    if (sci) {
+        if ((size > 0) && (USART_STAT(sci->port) & USART_STAT_RBNE)) {
+            *(uint8_t *)data = USART_DATA(sci->port);
+            result = 1;
+        }
+    }
+    return result;
+}
+
+void SciReadStatus(hal_sci_t sci, sci_status_t result) {
+    if (sci) {
+        uint32_t status = USART_STAT(sci->port);
+        result->data_ready = status & USART_STAT_RBNE;
+        result->overrun = status & USART_STAT_ORERR;
+        result->parity_error = status & USART_STAT_PERR;
+        result->framing_error = status & USART_STAT_FERR;
+        result->break_signal = status & USART_STAT_LBDF;
+        result->fifo_empty = status & USART_STAT_TBE;
+        result->tramition_completed = status & USART_STAT_TC;
+    }
+}
+
+void SciSetEventHandler(hal_sci_t sci, hal_sci_event_t handler, void * data) {
+    if (sci) {
+        event_handler_t event_handler = &event_handlers[sci->index];
+        event_handler->handler = handler;
+        event_handler->data = data;
+
+        USART_CTL0(sci->port) |= USART_CTL0_RBNEIE | USART_CTL0_PERRIE;
+        USART_CTL1(sci->port) |= USART_CTL1_LBDIE;
+        EclicEnable(sci->interupt, HAL_SCI_ECLIC_LEVEL);
+    }
+}
+
+ECLIC_HANDLER void USART0_IRQHandler(void) {
+    SciHandleEvent(HAL_SCI_USART0);
+}
+
+ECLIC_HANDLER void USART1_IRQHandler(void) {
+    SciHandleEvent(HAL_SCI_USART1);
+}
+
+ECLIC_HANDLER void USART2_IRQHandler(void) {
+    SciHandleEvent(HAL_SCI_USART2);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
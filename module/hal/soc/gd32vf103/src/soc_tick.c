@@ -0,0 +1,156 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief System timer on GD32VF103 implementation
+ **
+ ** The events are raised by the machine timer of the core, the compare register is advanced by a
+ ** whole period on every event, so the latency of the handlers doesn't accumulate as drift.
+ **
+ ** @addtogroup gd32vf103 GD32VF103
+ ** @ingroup hal
+ ** @brief GD32VF103 SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_tick.h"
+#include "soc_eclic.h"
+#include "gd32vf103.h"
+#include "riscv_encoding.h"
+#include "hal_cycles.h"
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
+#include "hal_hooks.h"
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure level to set on ECLIC for system timer interrupts
+ */
+#ifndef HAL_TICK_ECLIC_LEVEL
+#define HAL_TICK_ECLIC_LEVEL 0
+#endif
+
+//! Amount of core clock cycles in every count of the machine timer
+#define MTIME_PRESCALER 4
+
+//! Pointer to the low and high words of the machine timer counter
+#define MTIME ((volatile uint32_t *)(TIMER_CTRL_ADDR + TIMER_MTIME))
+
+//! Pointer to the low and high words of the machine timer compare register
+#define MTIMECMP ((volatile uint32_t *)(TIMER_CTRL_ADDR + TIMER_MTIMECMP))
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Pointer to the structure with the system timer descriptor
+ */
+typedef struct hal_tick_s {
+    hal_tick_event_t handler; /**< Function to call on the system timer events */
+    void * object;            /**< Pointer to user data sended as parameter in handler calls */
+    uint32_t period;          /**< Counts of the machine timer between two events */
+    uint64_t compare;         /**< Value of the machine timer for the next event */
+} * hal_tick_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to set the value of the machine timer for the next event
+ *
+ * @param  compare  Value of the machine timer that raises the event
+ */
+static void TickSetCompare(uint64_t compare);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Variable with the instance of system timer descriptor
+ */
+static struct hal_tick_s instance[1] = {0};
+
+/* === Private function implementation ========================================================= */
+
+static void TickSetCompare(uint64_t compare) {
+    /* The high word is written first with the maximum, so the halves never raise a false event */
+    MTIMECMP[1] = UINT32_MAX;
+    MTIMECMP[0] = (uint32_t)compare;
+    MTIMECMP[1] = (uint32_t)(compare >> 32);
+}
+
+/* === Public function implementation ========================================================== */
+
+void TickStart(hal_tick_event_t handler, void * object, uint32_t period) {
+    bool enabled = clear_csr(mstatus, MSTATUS_MIE) & MSTATUS_MIE;
+
+    instance->handler = handler;
+    instance->object = object;
+
+    /* Activate the machine timer */
+    SystemCoreClockUpdate();
+    instance->period = (SystemCoreClock / MTIME_PRESCALER / 1000000) * period;
+    instance->compare = get_timer_value() + instance->period;
+    TickSetCompare(instance->compare);
+
+    /* The timer uses the lowest level, and the interrupts are enabled again if they were */
+    EclicEnable(CLIC_INT_TMR, HAL_TICK_ECLIC_LEVEL);
+    if (enabled) {
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+}
+
+ECLIC_HANDLER void eclic_mtip_handler(void) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_TICK);
+    /* The event was raised when the counter reached the compare value, that is kept by the timer */
+    HAL_HOOK_IRQ_EVENT(HAL_HOOK_TICK, CyclesRead() - (MTIME[0] - MTIMECMP[0]) * MTIME_PRESCALER);
+
+    /* Writing the compare register also clears the request of the timer */
+    instance->compare += instance->period;
+    TickSetCompare(instance->compare);
+
+    if (instance->handler) {
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_TICK);
+        instance->handler(instance->object);
+    }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_TICK);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -37,6 +37,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ================================================================ */
 
 #include "hal_pin.h"
+#include "soc_pinmux.h"
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -48,6 +49,14 @@ extern "C" {
 
 /* === Public data type declarations =========================================================== */
 
+/**
+ * @brief Structure with the gpio terminal descriptor
+ */
+struct hal_chip_pin_s {
+    uint8_t pin : 5;  /**< Number of chip pin port */
+    uint8_t port : 4; /**< Number of pin in chip port */
+};
+
 /* === Public variable declarations ============================================================ */
 
 /** @cond !INTERNAL */
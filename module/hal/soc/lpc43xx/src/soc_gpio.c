@@ -47,6 +47,8 @@ SPDX-License-Identifier: MIT
 #include TO_STR(HAL_CONFIG_FILE)
 #endif
 
+#include "hal_hooks.h"
+
 /* === Macros definitions ====================================================================== */
 
 /**
@@ -209,13 +211,16 @@ static uint8_t FindHandlerDescriptor(hal_gpio_bit_t gpio, event_handler_t * desc
 }
 
 static void GpioHandleEvent(uint8_t index) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_GPIO + index);
     event_handler_t descriptor = &event_handlers[index];
     bool rissing = (Chip_PININT_GetRiseStates(LPC_GPIO_PIN_INT) & (1 << index));
     Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << index);
 
     if (descriptor->handler != NULL) {
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_GPIO + index);
         descriptor->handler(descriptor->gpio, rissing, descriptor->object);
     }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_GPIO + index);
 }
 
 /* === Public function implementation ========================================================== */
@@ -52,14 +52,6 @@ SPDX-License-Identifier: MIT
 
 /* === Private data type declarations ========================================================== */
 
-/**
- * @brief Structure with the gpio terminal descriptor
- */
-struct hal_chip_pin_s {
-    uint8_t pin : 5;  /**< Number of chip pin port */
-    uint8_t port : 4; /**< Number of pin in chip port */
-};
-
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
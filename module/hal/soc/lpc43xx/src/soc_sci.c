@@ -47,6 +47,8 @@ SPDX-License-Identifier: MIT
 #include TO_STR(HAL_CONFIG_FILE)
 #endif
 
+#include "hal_hooks.h"
+
 /* === Macros definitions ====================================================================== */
 
 /**
@@ -65,6 +67,8 @@ struct hal_sci_s {
     LPC_USART_T * port; /**< Pointer to the memory area with the serial port registers */
     IRQn_Type interupt; /**< Interrupt number corresponding to the serial port */
     uint8_t index;      /**< Numeric index of serial port */
+    uint8_t txd_signal; /**< Signal of the transmission line in the pin functions database */
+    uint8_t rxd_signal; /**< Signal of the reception line in the pin functions database */
 };
 
 /**
@@ -80,40 +84,14 @@ typedef struct event_handler_s {
 /* === Private function declarations ===========================================================  */
 
 /**
- * @brief Function to validate and configurate chip pins used by serial port USART0
- *
- * @param   pins    Pointer to structure with chip pins asigned to serial port
- * @return  true    The configuration is valid and has been applied
- * @return  false   The configuration is invalid and has not been applied
- */
-static bool ConfigPinsUsart0(hal_sci_pins_t pins);
-
-/**
- * @brief Function to validate and configurate chip pins used by serial port UART1
- *
- * @param   pins    Pointer to structure with chip pins asigned to serial port
- * @return  true    The configuration is valid and has been applied
- * @return  false   The configuration is invalid and has not been applied
- */
-static bool ConfigPinsUart1(hal_sci_pins_t pins);
-
-/**
- * @brief Function to validate and configurate chip pins used by serial port USART2
- *
- * @param   pins    Pointer to structure with chip pins asigned to serial port
- * @return  true    The configuration is valid and has been applied
- * @return  false   The configuration is invalid and has not been applied
- */
-static bool ConfigPinsUsart2(hal_sci_pins_t pins);
-
-/**
- * @brief Function to validate and configurate chip pins used by serial port USART3
+ * @brief Function to validate and configurate chip pins used by a serial port
  *
+ * @param   sci     Pointer to the structure with the serial port descriptor
  * @param   pins    Pointer to structure with chip pins asigned to serial port
  * @return  true    The configuration is valid and has been applied
  * @return  false   The configuration is invalid and has not been applied
  */
-static bool ConfigPinsUsart3(hal_sci_pins_t pins);
+static bool ConfigPins(hal_sci_t sci, hal_sci_pins_t pins);
 
 /**
  * @brief Function to encode serial port line parameters as bits required by control register
@@ -139,20 +117,40 @@ static void SciHandleEvent(hal_sci_t sci);
  */
 
 /** Constant to define serial port 0 */
-const hal_sci_t HAL_SCI_USART0 =
-    &(struct hal_sci_s){.port = LPC_USART0, .interupt = USART0_IRQn, .index = 0};
+const hal_sci_t HAL_SCI_USART0 = &(struct hal_sci_s){
+    .port = LPC_USART0,
+    .interupt = USART0_IRQn,
+    .index = 0,
+    .txd_signal = SOC_SIGNAL_U0_TXD,
+    .rxd_signal = SOC_SIGNAL_U0_RXD,
+};
 
 /** Constant to define serial port 1 */
-const hal_sci_t HAL_SCI_UART1 =
-    &(struct hal_sci_s){.port = LPC_UART1, .interupt = UART1_IRQn, .index = 1};
+const hal_sci_t HAL_SCI_UART1 = &(struct hal_sci_s){
+    .port = LPC_UART1,
+    .interupt = UART1_IRQn,
+    .index = 1,
+    .txd_signal = SOC_SIGNAL_U1_TXD,
+    .rxd_signal = SOC_SIGNAL_U1_RXD,
+};
 
 /** Constant to define serial port 2 */
-const hal_sci_t HAL_SCI_USART2 =
-    &(struct hal_sci_s){.port = LPC_USART2, .interupt = USART2_IRQn, .index = 2};
+const hal_sci_t HAL_SCI_USART2 = &(struct hal_sci_s){
+    .port = LPC_USART2,
+    .interupt = USART2_IRQn,
+    .index = 2,
+    .txd_signal = SOC_SIGNAL_U2_TXD,
+    .rxd_signal = SOC_SIGNAL_U2_RXD,
+};
 
 /** Constant to define serial port 3 */
-const hal_sci_t HAL_SCI_USART3 =
-    &(struct hal_sci_s){.port = LPC_USART3, .interupt = USART3_IRQn, .index = 3};
+const hal_sci_t HAL_SCI_USART3 = &(struct hal_sci_s){
+    .port = LPC_USART3,
+    .interupt = USART3_IRQn,
+    .index = 3,
+    .txd_signal = SOC_SIGNAL_U3_TXD,
+    .rxd_signal = SOC_SIGNAL_U3_RXD,
+};
 
 /** @} End of group lpc43xxSci */
 
@@ -165,127 +163,12 @@ static struct event_handler_s event_handlers[4] = {0};
 
 /* === Private function implementation ========================================================= */
 
-static bool ConfigPinsUsart0(hal_sci_pins_t pins) {
-    /*
-     * U0_TXD = (P2_0: F1), (P6_4: F2), (P9_5: F7), (PF_10: F1)
-     * U0_RXD = (P2_1: F1), (P6_5: F2), (P9_6: F7), (PF_11: F1)
-     */
-    uint8_t txd_function = 0xFF;
-    uint8_t rxd_function = 0xFF;
+static bool ConfigPins(hal_sci_t sci, hal_sci_pins_t pins) {
+    uint8_t txd_function = ChipPinFindFunction(pins->txd_pin, sci->txd_signal);
+    uint8_t rxd_function = ChipPinFindFunction(pins->rxd_pin, sci->rxd_signal);
     bool result = false;
 
-    if (pins->txd_pin == HAL_PIN_P2_0) {
-        txd_function = 1;
-    } else if (pins->txd_pin == HAL_PIN_P6_4) {
-        txd_function = 2;
-    } else if (pins->txd_pin == HAL_PIN_P9_5) {
-        txd_function = 7;
-    }
-
-    if (pins->rxd_pin == HAL_PIN_P2_1) {
-        rxd_function = 1;
-    } else if (pins->rxd_pin == HAL_PIN_P6_5) {
-        rxd_function = 2;
-    } else if (pins->rxd_pin == HAL_PIN_P9_6) {
-        rxd_function = 7;
-    }
-
-    if ((txd_function != 0xFF) && (rxd_function != 0xFF)) {
-        ChipPinSetFunction(pins->txd_pin, txd_function, false, false);
-        ChipPinSetFunction(pins->rxd_pin, rxd_function, true, false);
-        result = true;
-    }
-    return result;
-}
-
-static bool ConfigPinsUart1(hal_sci_pins_t pins) {
-    /*
-     * U1_TXD = (P1_13: F1), (P3_4: F4), (P5_6: F4), (PC_13: F2), (PE_11: F2)
-     * U1_RXD = (P1_14: F1), (P3_5: F4), (P5_7: F4), (PC_14: F2), (PE_12: F2)
-     */
-    uint8_t txd_function = 0xFF;
-    uint8_t rxd_function = 0xFF;
-    bool result = false;
-
-    if (pins->txd_pin == HAL_PIN_P1_13) {
-        txd_function = 1;
-    } else if (pins->txd_pin == HAL_PIN_P3_4) {
-        txd_function = 4;
-    } else if (pins->txd_pin == HAL_PIN_P5_6) {
-        txd_function = 4;
-    }
-
-    if (pins->rxd_pin == HAL_PIN_P1_14) {
-        rxd_function = 1;
-    } else if (pins->rxd_pin == HAL_PIN_P3_5) {
-        rxd_function = 4;
-    } else if (pins->rxd_pin == HAL_PIN_P5_7) {
-        rxd_function = 4;
-    }
-
-    if ((txd_function != 0xFF) && (rxd_function != 0xFF)) {
-        ChipPinSetFunction(pins->txd_pin, txd_function, false, false);
-        ChipPinSetFunction(pins->rxd_pin, rxd_function, true, false);
-        result = true;
-    }
-    return result;
-}
-
-static bool ConfigPinsUsart2(hal_sci_pins_t pins) {
-    /*
-     * U2_TXD = (P1_15: F1), (P2_10: F2), (P7_1: F6), (PA_1: F3)
-     * U2_RXD = (P1_16: F1), (P2_11: F2), (P7_2: F6), (PA_2: F3)
-     */
-    uint8_t txd_function = 0xFF;
-    uint8_t rxd_function = 0xFF;
-    bool result = false;
-
-    if (pins->txd_pin == HAL_PIN_P1_15) {
-        txd_function = 1;
-    } else if (pins->txd_pin == HAL_PIN_P2_10) {
-        txd_function = 2;
-    } else if (pins->txd_pin == HAL_PIN_P7_1) {
-        txd_function = 6;
-    }
-
-    if (pins->rxd_pin == HAL_PIN_P1_16) {
-        rxd_function = 1;
-    } else if (pins->rxd_pin == HAL_PIN_P2_11) {
-        rxd_function = 2;
-    } else if (pins->rxd_pin == HAL_PIN_P7_2) {
-        rxd_function = 6;
-    }
-
-    if ((txd_function != 0xFF) && (rxd_function != 0xFF)) {
-        ChipPinSetFunction(pins->txd_pin, txd_function, false, false);
-        ChipPinSetFunction(pins->rxd_pin, rxd_function, true, false);
-        result = true;
-    }
-    return result;
-}
-
-static bool ConfigPinsUsart3(hal_sci_pins_t pins) {
-    /*
-     * U2_TXD = (P2_3: F2), (P4_1: F6), (P9_3: F7), (PF_2: F1)
-     * U2_RXD = (P2_4: F2), (P4_2: F6), (P9_4: F7), (PF_3: F1)
-     */
-    uint8_t txd_function = 0xFF;
-    uint8_t rxd_function = 0xFF;
-    bool result = false;
-
-    if (pins->txd_pin == HAL_PIN_P2_3) {
-        txd_function = 2;
-    } else if (pins->txd_pin == HAL_PIN_P4_1) {
-        txd_function = 6;
-    }
-
-    if (pins->rxd_pin == HAL_PIN_P2_4) {
-        rxd_function = 2;
-    } else if (pins->rxd_pin == HAL_PIN_P4_2) {
-        rxd_function = 6;
-    }
-
-    if ((txd_function != 0xFF) && (rxd_function != 0xFF)) {
+    if ((txd_function != HAL_PIN_NO_FUNCTION) && (rxd_function != HAL_PIN_NO_FUNCTION)) {
         ChipPinSetFunction(pins->txd_pin, txd_function, false, false);
         ChipPinSetFunction(pins->rxd_pin, rxd_function, true, false);
         result = true;
@@ -340,10 +223,13 @@ static void SciHandleEvent(hal_sci_t sci) {
 
         (void)Chip_UART_ReadIntIDReg(sci->port);
 
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_SCI + sci->index);
         SciReadStatus(sci, &status);
         if (event_handler->handler) {
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_SCI + sci->index);
             event_handler->handler(sci, &status, event_handler->data);
         }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_SCI + sci->index);
     }
 }
 
@@ -353,21 +239,7 @@ bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins) {
     bool result = false;
 
     if (sci) {
-        switch (sci->index) {
-        case 0:
-            result = ConfigPinsUsart0(pins);
-            break;
-        case 1:
-            result = ConfigPinsUart1(pins);
-            break;
-        case 2:
-            result = ConfigPinsUsart2(pins);
-            break;
-        case 3:
-            result = ConfigPinsUsart3(pins);
-            break;
-        }
-
+        result = ConfigPins(sci, pins);
         if (result) {
             Chip_UART_Init(sci->port);
             Chip_UART_SetBaud(sci->port, line->baud_rate);
@@ -383,6 +255,7 @@ uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
     uint16_t result = 0;
     if (sci) {
         result = Chip_UART_Send(sci->port, data, size);
+        HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + sci->index, result);
     }
     return result;
 }
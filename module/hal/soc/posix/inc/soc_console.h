@@ -0,0 +1,136 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_CONSOLE_H
+#define SOC_CONSOLE_H
+
+/** @file
+ ** @brief Attachment of the emulated serial ports to host devices on posix declarations
+ **
+ ** Every emulated serial port can be attached to a pseudo terminal or to a socket of the host with
+ ** the environment variables MUJU_SCI0 to MUJU_SCI3, one for every port:
+ **
+ **     pty                 Creates a pseudo terminal and writes its name to the standard error
+ **     pty:/tmp/gateway1   Creates a pseudo terminal and a symbolic link to it with the given name
+ **     unix:/tmp/sci1      Listens for a client in a UNIX socket with the given path
+ **     tcp:5001            Listens for a client in the given TCP port of the local host
+ **
+ ** The sockets accept one client at a time and discard the transmitted data while there is none.
+ ** When the host side doesn't read fast enough the transmission functions accept less data, as a
+ ** real port with hardware flow control does.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Prefix of the names of the environment variables, followed by the number of the serial port
+#define CONSOLE_ENVIRONMENT "MUJU_SCI"
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to attach a serial port if it is enabled in the environment
+ *
+ * It can be called many times, only the first call for every port has effect.
+ *
+ * @param  port   Number of the serial port
+ */
+void ConsoleStart(uint8_t port);
+
+/**
+ * @brief Function to check if a serial port is attached to a host device
+ *
+ * @param  port   Number of the serial port
+ * @return true   The serial port is attached
+ * @return false  The serial port is not attached
+ */
+bool ConsoleAttached(uint8_t port);
+
+/**
+ * @brief Function to send data to the host device of a serial port
+ *
+ * @param  port      Number of the serial port
+ * @param  data      Pointer to the data to send
+ * @param  size      Amount of bytes to send
+ * @return uint16_t  Amount of bytes accepted
+ */
+uint16_t ConsoleSend(uint8_t port, void const * data, uint16_t size);
+
+/**
+ * @brief Function to receive the data of the host device of a serial port
+ *
+ * @param  port      Number of the serial port
+ * @param  data      Pointer to the memory to store the received data
+ * @param  size      Maximum amount of bytes to receive
+ * @return uint16_t  Amount of bytes received
+ */
+uint16_t ConsoleReceive(uint8_t port, void * data, uint16_t size);
+
+/**
+ * @brief Function to get the amount of bytes received from the host device of a serial port
+ *
+ * @param  port      Number of the serial port
+ * @return uint32_t  Amount of bytes ready to be received
+ */
+uint32_t ConsolePending(uint8_t port);
+
+/**
+ * @brief Function to check if the host device of a serial port can accept more data
+ *
+ * @param  port   Number of the serial port
+ * @return true   The data can be sent
+ * @return false  The last transmission was not fully accepted and the device is still busy
+ */
+bool ConsoleWritable(uint8_t port);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_CONSOLE_H */
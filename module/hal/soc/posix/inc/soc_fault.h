@@ -0,0 +1,152 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_FAULT_H
+#define SOC_FAULT_H
+
+/** @file
+ ** @brief Fault injection on the emulated peripherals on posix declarations
+ **
+ ** The faults are configured with the MUJU_FAULTS environment variable, or at any time with the
+ ** fault command of the stimulus engine, as a list of items separated by spaces or commas:
+ **
+ **     sci0.bit=1e-5           Probability of error of every bit received, a data bit error
+ **                             raises a parity error and a start or stop bit error a framing error
+ **     sci0.drop=0.001         Probability of losing every byte received
+ **     sci0.dup=0.001          Probability of receiving twice every byte
+ **     sci0.overrun=1e-4       Probability of an overrun on every byte received, losing a burst
+ **                             of up to 16 bytes
+ **     sci0.break=1e-4         Probability of receiving a break instead of every byte
+ **     GPIO1_3.stuck=0         Forces the terminal to low, or to high with 1, until set to off
+ **     GPIO0_0.glitch=10/50    Average glitches per second and width in microseconds of the
+ **                             pulses injected in the terminal, zero disables them
+ **     tick.delay=0.01/300     Probability of delaying every timer event and the delay in
+ **                             microseconds
+ **     tick.miss=0.001         Probability of missing every timer event
+ **     seed=1234               Seed of the random generators, for repeatable runs
+ **
+ ** The stimulus timeline can change the faults at given times to build schedules, for example
+ ** "@2000000 fault GPIO1_3.stuck=1" followed by "@2500000 fault GPIO1_3.stuck=off". The counters
+ ** of the injected faults are written to the standard error when the program ends.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Name of the environment variable with the initial configuration of the faults
+#define FAULT_ENVIRONMENT "MUJU_FAULTS"
+
+//! Maximum amount of bytes that a serial port with faults receives at once
+#define FAULT_SCI_CHUNK 4096
+
+#define FAULT_SCI_OVERRUN 0x01 //!< Flag of an overrun injected in a serial port
+#define FAULT_SCI_PARITY  0x02 //!< Flag of a parity error injected in a serial port
+#define FAULT_SCI_FRAMING 0x04 //!< Flag of a framing error injected in a serial port
+#define FAULT_SCI_BREAK   0x08 //!< Flag of a break signal injected in a serial port
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to read the configuration of the environment, only the first call has effect
+ */
+void FaultStart(void);
+
+/**
+ * @brief Function to change the configuration of the faults
+ *
+ * @param  spec   Text with the list of items of the configuration
+ * @return true   The configuration was applied
+ * @return false  The configuration has errors, the items before the error were applied
+ */
+bool FaultConfigure(char const * spec);
+
+/**
+ * @brief Function to apply the faults of a serial port to the received data
+ *
+ * The dropped bytes are removed from the data and the duplicated ones inserted, the bytes that
+ * don't fit in the memory are delivered in the next call.
+ *
+ * @param  port      Number of the serial port
+ * @param  data      Pointer to the received data, modified in place
+ * @param  size      Amount of bytes received, not greater than FAULT_SCI_CHUNK
+ * @param  capacity  Size of the memory pointed by data
+ * @return uint16_t  Amount of bytes after the faults
+ */
+uint16_t FaultSciReceive(uint8_t port, uint8_t * data, uint16_t size, uint16_t capacity);
+
+/**
+ * @brief Function to get the amount of bytes kept by the faults for the next reception
+ *
+ * @param  port      Number of the serial port
+ * @return uint32_t  Amount of bytes waiting
+ */
+uint32_t FaultSciPending(uint8_t port);
+
+/**
+ * @brief Function to get and clear the error flags injected in a serial port
+ *
+ * @param  port      Number of the serial port
+ * @return uint8_t   Combination of the FAULT_SCI_ flags
+ */
+uint8_t FaultSciStatus(uint8_t port);
+
+/**
+ * @brief Function to apply the faults to a system timer event
+ *
+ * @param  delay   Pointer to store the delay, in microseconds, to add before the event
+ * @return true    The event must be raised
+ * @return false   The event is missed
+ */
+bool FaultTick(uint32_t * delay);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_FAULT_H */
@@ -46,50 +46,174 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
 
+#if defined(GPIO_PROFILE_LPC43XX)
+#define SOC_GPIO_PORTS 8  //!< Amount of gpio ports on the LPC43xx family
+#define SOC_GPIO_BITS  32 //!< Amount of terminals in every gpio port on the LPC43xx family
+#endif
+
+#ifndef SOC_GPIO_PORTS
+#define SOC_GPIO_PORTS 4 //!< Amount of emulated gpio ports
+#endif
+
+#ifndef SOC_GPIO_BITS
+#define SOC_GPIO_BITS 8 //!< Amount of terminals in every emulated gpio port
+#endif
+
+#if (SOC_GPIO_PORTS < 1) || (SOC_GPIO_PORTS > 8)
+#error "The emulated gpio ports must be between 1 and 8"
+#endif
+
+#if (SOC_GPIO_BITS != 8) && (SOC_GPIO_BITS != 16) && (SOC_GPIO_BITS != 32)
+#error "The emulated gpio ports must have 8, 16 or 32 terminals"
+#endif
+
+//! Macro to generate the name of a gpio terminal descriptor from the gpio port and bit
+#define SOC_GPIO_NAME(PORT, BIT) HAL_GPIO##PORT##_##BIT
+
+/** @cond INTERNAL */
+#define SOC_GPIO_CONCAT(PREFIX, BITS) PREFIX##BITS
+#define SOC_GPIO_EXPAND(PREFIX, BITS) SOC_GPIO_CONCAT(PREFIX, BITS)
+#define SOC_GPIO_TERMINALS_8(P, X)                                                                 \
+    X(P, 0), X(P, 1), X(P, 2), X(P, 3), X(P, 4), X(P, 5), X(P, 6), X(P, 7)
+#define SOC_GPIO_TERMINALS_16(P, X)                                                                \
+    SOC_GPIO_TERMINALS_8(P, X), X(P, 8), X(P, 9), X(P, 10), X(P, 11), X(P, 12), X(P, 13),          \
+        X(P, 14), X(P, 15)
+#define SOC_GPIO_TERMINALS_32(P, X)                                                                \
+    SOC_GPIO_TERMINALS_16(P, X), X(P, 16), X(P, 17), X(P, 18), X(P, 19), X(P, 20), X(P, 21),       \
+        X(P, 22), X(P, 23), X(P, 24), X(P, 25), X(P, 26), X(P, 27), X(P, 28), X(P, 29), X(P, 30),  \
+        X(P, 31)
+/** @endcond */
+
+/**
+ * @brief Macro to apply another macro, with the port and bit as arguments, to every terminal of
+ * an emulated gpio port, separating the results with commas
+ */
+#define SOC_GPIO_TERMINALS(PORT, X) SOC_GPIO_EXPAND(SOC_GPIO_TERMINALS_, SOC_GPIO_BITS)(PORT, X)
+
 /* === Public data type declarations =========================================================== */
 
 /* === Public variable declarations ============================================================ */
 
 /** @cond !INTERNAL */
-extern const hal_gpio_bit_t HAL_GPIO0_0; /**< Constant to define Bit 0 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_1; /**< Constant to define Bit 1 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_2; /**< Constant to define Bit 2 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_3; /**< Constant to define Bit 3 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_4; /**< Constant to define Bit 4 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_5; /**< Constant to define Bit 5 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_6; /**< Constant to define Bit 6 on GPIO 0 */
-extern const hal_gpio_bit_t HAL_GPIO0_7; /**< Constant to define Bit 7 on GPIO 0 */
-
-extern const hal_gpio_bit_t HAL_GPIO1_0; /**< Constant to define Bit 0 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_1; /**< Constant to define Bit 1 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_2; /**< Constant to define Bit 2 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_3; /**< Constant to define Bit 3 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_4; /**< Constant to define Bit 4 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_5; /**< Constant to define Bit 5 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_6; /**< Constant to define Bit 6 on GPIO 1 */
-extern const hal_gpio_bit_t HAL_GPIO1_7; /**< Constant to define Bit 7 on GPIO 1 */
-
-extern const hal_gpio_bit_t HAL_GPIO2_0; /**< Constant to define Bit 0 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_1; /**< Constant to define Bit 1 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_2; /**< Constant to define Bit 2 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_3; /**< Constant to define Bit 3 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_4; /**< Constant to define Bit 4 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_5; /**< Constant to define Bit 5 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_6; /**< Constant to define Bit 6 on GPIO 2 */
-extern const hal_gpio_bit_t HAL_GPIO2_7; /**< Constant to define Bit 7 on GPIO 2 */
-
-extern const hal_gpio_bit_t HAL_GPIO3_0; /**< Constant to define Bit 0 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_1; /**< Constant to define Bit 1 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_2; /**< Constant to define Bit 2 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_3; /**< Constant to define Bit 3 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_4; /**< Constant to define Bit 4 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_5; /**< Constant to define Bit 5 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_6; /**< Constant to define Bit 6 on GPIO 3 */
-extern const hal_gpio_bit_t HAL_GPIO3_7; /**< Constant to define Bit 7 on GPIO 3 */
+/* Constants to define every terminal of every port, named as HAL_GPIO5_16 for the bit 16 on the
+ * GPIO 5, with the same names used by the real SoC for the terminals inside of the profile */
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(0, SOC_GPIO_NAME);
+#if SOC_GPIO_PORTS > 1
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(1, SOC_GPIO_NAME);
+#endif
+#if SOC_GPIO_PORTS > 2
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(2, SOC_GPIO_NAME);
+#endif
+#if SOC_GPIO_PORTS > 3
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(3, SOC_GPIO_NAME);
+#endif
+#if SOC_GPIO_PORTS > 4
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(4, SOC_GPIO_NAME);
+#endif
+#if SOC_GPIO_PORTS > 5
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(5, SOC_GPIO_NAME);
+#endif
+#if SOC_GPIO_PORTS > 6
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(6, SOC_GPIO_NAME);
+#endif
+#if SOC_GPIO_PORTS > 7
+extern const hal_gpio_bit_t SOC_GPIO_TERMINALS(7, SOC_GPIO_NAME);
+#endif
 /** @endcond */
 
 /* === Public function declarations ============================================================ */
 
+/**
+ * @brief Function to change an emulated terminal from outside of the program, like an external
+ * device does with a digital input
+ *
+ * When the state changes the event handler of the terminal is called if it was registered for
+ * the edge, in the same way that the interrupts do in the real boards.
+ *
+ * @param  port   Number of the gpio port
+ * @param  bit    Number of the terminal in the gpio port
+ * @param  state  New state of the terminal
+ */
+void GpioInjectState(uint8_t port, uint8_t bit, bool state);
+
+/**
+ * @brief Function to invert an emulated terminal from outside of the program
+ *
+ * @param  port      Number of the gpio port
+ * @param  bit       Number of the terminal in the gpio port
+ * @return true      The new state of the terminal is high
+ * @return false     The new state of the terminal is low
+ */
+bool GpioInjectToggle(uint8_t port, uint8_t bit);
+
+/**
+ * @brief Function to read at once the state of all the terminals of an emulated gpio port
+ *
+ * @param  port      Number of the gpio port
+ * @return uint32_t  State of the terminals, one bit for every terminal
+ */
+uint32_t GpioPortRead(uint8_t port);
+
+/**
+ * @brief Function to change at once some terminals of an emulated gpio port from the program
+ *
+ * The change is atomic, the terminals outside of the mask keep their states even when another
+ * thread changes them at the same time.
+ *
+ * @param  port   Number of the gpio port
+ * @param  mask   Terminals to change, one bit for every terminal
+ * @param  value  New state of the terminals selected by the mask
+ */
+void GpioPortWrite(uint8_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Function to change at once some terminals of an emulated gpio port from outside of the
+ * program, like external devices do with digital inputs
+ *
+ * The event handlers of the changed terminals are called as GpioInjectState does.
+ *
+ * @param  port   Number of the gpio port
+ * @param  mask   Terminals to change, one bit for every terminal
+ * @param  value  New state of the terminals selected by the mask
+ */
+void GpioInjectPort(uint8_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Function to force an emulated terminal to a fixed state, as a stuck-at fault does
+ *
+ * While the terminal is stuck the changes made by the program and by the external devices are
+ * ignored, when it is released it keeps the state until the next change.
+ *
+ * @param  port   Number of the gpio port
+ * @param  bit    Number of the terminal in the gpio port
+ * @param  stuck  The terminal is stuck, false releases it
+ * @param  state  State of the stuck terminal
+ */
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state);
+
+/**
+ * @brief Function to check if an emulated terminal was configured as output by the program
+ *
+ * @param  port      Number of the gpio port
+ * @param  bit       Number of the terminal in the gpio port
+ * @return true      The terminal is an output
+ * @return false     The terminal is an input
+ */
+bool GpioIsOutput(uint8_t port, uint8_t bit);
+
+/**
+ * @brief Function to get the port and bit of an emulated terminal from its name
+ *
+ * The name can be written as HAL_GPIO1_3, GPIO1_3 or 1.3.
+ *
+ * @param  text      Text with the name of the terminal
+ * @param  port      Pointer to store the number of the gpio port
+ * @param  bit       Pointer to store the number of the terminal in the port
+ * @return true      The name is valid and the terminal exists
+ * @return false     The name is not valid or the terminal doesn't exist
+ */
+bool GpioParseName(char const * text, uint8_t * port, uint8_t * bit);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
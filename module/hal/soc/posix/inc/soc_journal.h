@@ -0,0 +1,150 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_JOURNAL_H
+#define SOC_JOURNAL_H
+
+/** @file
+ ** @brief Record and replay of the external inputs on posix declarations
+ **
+ ** In record mode, enabled by the MUJU_RECORD environment variable with the name of the file,
+ ** every input received from outside of the program, as the changes of the emulated gpio inputs
+ ** and the data received by the serial ports, is written in a binary journal with its virtual
+ ** time. In replay mode, enabled by the MUJU_REPLAY environment variable, the keyboard, the
+ ** stimulus engine and the bus are disabled and the inputs are taken from the journal.
+ **
+ ** The virtual time follows the system timer: while it runs, the events are stamped with the
+ ** timer period in which they were received, and the replay runs the timer periods back to back,
+ ** delivering every event before the same timer event that followed it in the record. Without the
+ ** system timer the events are delivered at their recorded wall-clock times.
+ **
+ ** The journal starts with the text MJNL and a version byte, followed by the records. Every
+ ** record has a kind byte, the time since the previous record in microseconds as a variable
+ ** length number and the data of the event.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Name of the environment variable with the name of the journal to record
+#define JOURNAL_RECORD_ENVIRONMENT "MUJU_RECORD"
+
+//! Name of the environment variable with the name of the journal to replay
+#define JOURNAL_REPLAY_ENVIRONMENT "MUJU_REPLAY"
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to open the journal if it is enabled in the environment
+ *
+ * It can be called many times, only the first call has effect.
+ */
+void JournalStart(void);
+
+/**
+ * @brief Function to check if the inputs are taken from a journal
+ *
+ * @return true   The program is replaying a journal
+ * @return false  The program takes the inputs from the keyboard, the stimulus and the bus
+ */
+bool JournalReplaying(void);
+
+/**
+ * @brief Function to record a change of an emulated gpio input
+ *
+ * @param  port   Number of the gpio port
+ * @param  bit    Number of the terminal in the gpio port
+ * @param  state  New state of the terminal
+ */
+void JournalGpio(uint8_t port, uint8_t bit, bool state);
+
+/**
+ * @brief Function to record the data received by a serial port
+ *
+ * @param  port   Number of the serial port
+ * @param  data   Pointer to the received data
+ * @param  size   Amount of bytes received
+ */
+void JournalSci(uint8_t port, void const * data, uint16_t size);
+
+/**
+ * @brief Function to get the data of a serial port delivered by the replay
+ *
+ * @param  port      Number of the serial port
+ * @param  data      Pointer to the memory to store the received data
+ * @param  size      Maximum amount of bytes to receive
+ * @return uint16_t  Amount of bytes received
+ */
+uint16_t JournalSciReceive(uint8_t port, void * data, uint16_t size);
+
+/**
+ * @brief Function to get the amount of bytes of a serial port delivered by the replay
+ *
+ * @param  port      Number of the serial port
+ * @return uint32_t  Amount of bytes ready to be received
+ */
+uint32_t JournalSciPending(uint8_t port);
+
+/**
+ * @brief Function to advance the virtual time at the start of every period of the system timer
+ *
+ * In replay mode it delivers the events recorded in the period, in record mode it stamps the
+ * following events with the period.
+ *
+ * @param  period  Period, in microseconds, of the system timer
+ * @return true    The replay is driving the timer and the period must not be waited
+ * @return false   The period must be waited in real time
+ */
+bool JournalTick(uint32_t period);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_JOURNAL_H */
@@ -29,6 +29,11 @@ SPDX-License-Identifier: MIT
 /** @file
  ** @brief Serial ports on posix declarations
  **
+ ** The emulated serial ports use the names of the target boards, so the same board code runs in
+ ** the emulation. Every port is connected, in order of preference, to the journal being replayed,
+ ** to another board through the bus or to a host device as described in soc_console.h. Without
+ ** any of them the transmitted data is discarded.
+ **
  ** @addtogroup posix Posix
  ** @ingroup hal
  ** @brief Posix SOC Hardware abstraction layer
@@ -37,6 +42,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ================================================================ */
 
 #include "hal_sci.h"
+#include <stdint.h>
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -46,12 +52,32 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
 
+#define SOC_SCI_PORTS 4 //!< Amount of emulated serial ports
+
 /* === Public data type declarations =========================================================== */
 
 /* === Public variable declarations ============================================================ */
 
+/** @cond !INTERNAL */
+extern const hal_sci_t HAL_SCI_USART0; /**< Constant to define serial port 0 */
+extern const hal_sci_t HAL_SCI_UART1;  /**< Constant to define serial port 1, as on LPC43xx */
+extern const hal_sci_t HAL_SCI_USART1; /**< Constant to define serial port 1, as on STM32F1xx */
+extern const hal_sci_t HAL_SCI_USART2; /**< Constant to define serial port 2 */
+extern const hal_sci_t HAL_SCI_USART3; /**< Constant to define serial port 3 */
+/** @endcond */
+
 /* === Public function declarations ============================================================ */
 
+/**
+ * @brief Function to raise an emulated interrupt of a serial port from a host thread
+ *
+ * It calls the event handler of the serial port with the current status, as the interrupt
+ * service routine of a real device does when data is received or the output fifo is empty.
+ *
+ * @param  port   Number of the serial port
+ */
+void SciInjectEvent(uint8_t port);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
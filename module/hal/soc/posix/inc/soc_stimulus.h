@@ -0,0 +1,117 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_STIMULUS_H
+#define SOC_STIMULUS_H
+
+/** @file
+ ** @brief Stimulus injection of the emulated gpio terminals on posix declarations
+ **
+ ** The stimulus engine drives the emulated gpio terminals with the commands of a timeline file,
+ ** named by the MUJU_STIMULUS environment variable, or received from the clients of a UNIX
+ ** socket, named by the MUJU_STIMULUS_SOCKET environment variable. Every command is a text line
+ ** with an optional time, the command, the terminal and the arguments of the command:
+ **
+ **     [@absolute | +relative] command terminal [arguments]
+ **
+ ** The times are in microseconds. The absolute times are measured from the start of the file or
+ ** from the connection of the client and the relative times from the previous command, without a
+ ** time the command is executed at once. The terminal is written as HAL_GPIO1_3, GPIO1_3 or 1.3.
+ ** The available commands are:
+ **
+ **     set terminal                    Sets the terminal to high
+ **     clear terminal                  Sets the terminal to low
+ **     toggle terminal                 Inverts the state of the terminal
+ **     pulse terminal width            Inverts the terminal and restores it after the width
+ **     pattern terminal bits period    Applies the string of ones and zeros, one every period
+ **     burst terminal count period     Toggles the terminal count times, one every period, with
+ **                                     a zero period it runs at the maximum rate and reports it
+ **     fault items                     Changes the injected faults, as described in soc_fault.h
+ **
+ ** The lines starting with # are comments. The socket answers every line with "ok" or "error"
+ ** after the command is completed, so the clients can synchronize with the program.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Name of the environment variable with the name of the timeline file
+#define STIMULUS_FILE_ENVIRONMENT "MUJU_STIMULUS"
+
+//! Name of the environment variable with the path of the UNIX socket
+#define STIMULUS_SOCKET_ENVIRONMENT "MUJU_STIMULUS_SOCKET"
+
+/* === Public data type declarations =========================================================== */
+
+//! Structure with the time references of a source of commands
+typedef struct stimulus_clock_s {
+    uint64_t origin; /**< Time of the start of the source in microseconds */
+    uint64_t time;   /**< Time of the previous command in microseconds */
+} * stimulus_clock_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to start the threads of the sources of commands enabled in the environment
+ */
+void StimulusStart(void);
+
+/**
+ * @brief Function to wait the time of a command and execute it
+ *
+ * @param  clock   Pointer to the structure with the time references of the source
+ * @param  line    Text line with the command
+ * @return true    The command was executed or the line was empty
+ * @return false   The line has an error
+ */
+bool StimulusExecute(stimulus_clock_t clock, char const * line);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_STIMULUS_H */
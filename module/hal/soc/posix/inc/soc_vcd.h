@@ -0,0 +1,100 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_VCD_H
+#define SOC_VCD_H
+
+/** @file
+ ** @brief Waveform recorder of the emulated terminals on posix declarations
+ **
+ ** The recorder writes every change of the emulated gpio terminals and every byte sent by the
+ ** emulated serial ports in a Value Change Dump file that can be opened with GTKWave. It is
+ ** enabled when the MUJU_VCD environment variable has the name of the file to write. The changes
+ ** are stamped with the monotonic clock in nanoseconds since the start of the recording and they
+ ** are stored in memory and written to the file in large blocks.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Name of the environment variable with the name of the file to record
+#define VCD_ENVIRONMENT "MUJU_VCD"
+
+//! Amount of emulated serial ports recorded
+#define VCD_SCI_PORTS 4
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to record the new state of an emulated gpio terminal
+ *
+ * @param  port   Number of the gpio port
+ * @param  bit    Number of the terminal in the gpio port
+ * @param  state  New state of the terminal
+ */
+void VcdGpio(uint8_t port, uint8_t bit, bool state);
+
+/**
+ * @brief Function to record a byte sent by an emulated serial port
+ *
+ * @param  port   Number of the serial port
+ * @param  value  Byte sent by the serial port
+ */
+void VcdSci(uint8_t port, uint8_t value);
+
+/**
+ * @brief Function to write to the file all the changes stored in memory
+ */
+void VcdFlush(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_VCD_H */
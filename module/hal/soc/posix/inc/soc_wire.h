@@ -0,0 +1,160 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_WIRE_H
+#define SOC_WIRE_H
+
+/** @file
+ ** @brief Shared memory bus between emulated boards on posix declarations
+ **
+ ** The bus connects the emulated gpio terminals and serial ports of several programs running in
+ ** the same host. The connections are described in a netlist file, named by the MUJU_NETLIST
+ ** environment variable, shared by all the programs, and every program finds its terminals by
+ ** the board name given in the MUJU_BOARD environment variable:
+ **
+ **     # Handshake between the master and the slave
+ **     net ready master.GPIO1_3 slave.GPIO0_0
+ **     link master.sci0 slave.sci0
+ **
+ ** A net connects gpio terminals, when a program changes one of them as output the others are
+ ** changed as inputs and their event handlers are called. A link crosses the transmission and
+ ** reception lines of two serial ports. The state of the nets and the data of the links are kept
+ ** in a shared memory object, named by the MUJU_BUS environment variable or /muju-bus by default,
+ ** and the programs are notified of the changes with a futex in the same memory. The first program
+ ** connected to the object clears it, so a session doesn't see the states left by a previous one.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Name of the environment variable with the name of the netlist file
+#define WIRE_NETLIST_ENVIRONMENT "MUJU_NETLIST"
+
+//! Name of the environment variable with the name of the board in the netlist
+#define WIRE_BOARD_ENVIRONMENT "MUJU_BOARD"
+
+//! Name of the environment variable with the name of the shared memory object
+#define WIRE_BUS_ENVIRONMENT "MUJU_BUS"
+
+//! Maximum amount of serial ports of a board connected to the bus
+#define WIRE_SCI_PORTS 4
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to connect the program to the bus if it is enabled in the environment
+ *
+ * It can be called many times, only the first call has effect.
+ */
+void WireStart(void);
+
+/**
+ * @brief Function to drive the net connected to an emulated gpio terminal
+ *
+ * @param  port   Number of the gpio port
+ * @param  bit    Number of the terminal in the gpio port
+ * @param  state  New state of the terminal
+ */
+void WireGpio(uint8_t port, uint8_t bit, bool state);
+
+/**
+ * @brief Function to apply again the state of the nets to the terminals configured as inputs
+ */
+void WireRefresh(void);
+
+/**
+ * @brief Function to check if a serial port is linked to another board
+ *
+ * @param  port   Number of the serial port
+ * @return true   The serial port is linked
+ * @return false  The serial port is not linked
+ */
+bool WireSciLinked(uint8_t port);
+
+/**
+ * @brief Function to send data through the link of a serial port
+ *
+ * @param  port      Number of the serial port
+ * @param  data      Pointer to the data to send
+ * @param  size      Amount of bytes to send
+ * @return uint16_t  Amount of bytes accepted by the link
+ */
+uint16_t WireSciSend(uint8_t port, void const * data, uint16_t size);
+
+/**
+ * @brief Function to receive data from the link of a serial port
+ *
+ * @param  port      Number of the serial port
+ * @param  data      Pointer to the memory to store the received data
+ * @param  size      Maximum amount of bytes to receive
+ * @return uint16_t  Amount of bytes received
+ */
+uint16_t WireSciReceive(uint8_t port, void * data, uint16_t size);
+
+/**
+ * @brief Function to get the amount of bytes waiting in the reception side of a link
+ *
+ * @param  port      Number of the serial port
+ * @return uint32_t  Amount of bytes ready to be received
+ */
+uint32_t WireSciPending(uint8_t port);
+
+/**
+ * @brief Function to get the amount of free space in the transmission side of a link
+ *
+ * @param  port      Number of the serial port
+ * @return uint32_t  Amount of bytes that can be sent
+ */
+uint32_t WireSciSpace(uint8_t port);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SOC_WIRE_H */
@@ -0,0 +1,399 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Attachment of the emulated serial ports to host devices on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "soc_console.h"
+#include "soc_sci.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Size of the buffer of the data received by every serial port, it must be a power of two
+#define CONSOLE_BUFFER_SIZE 4096
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the attachment of a serial port
+struct console_port_s {
+    pthread_mutex_t lock;                /**< Mutual exclusion of the access to the client */
+    bool started;                        /**< The environment was already checked */
+    bool attached;                       /**< The serial port is attached to a host device */
+    int server;                          /**< Socket waiting for clients, or -1 */
+    int client;                          /**< Descriptor used to transfer the data, or -1 */
+    volatile bool blocked;               /**< The last transmission was not fully accepted */
+    volatile uint32_t head;              /**< Amount of bytes received since the start */
+    volatile uint32_t tail;              /**< Amount of bytes read by the program since the start */
+    uint8_t data[CONSOLE_BUFFER_SIZE];   /**< Bytes received waiting to be read by the program */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to create a pseudo terminal for a serial port
+ *
+ * @param  port    Number of the serial port
+ * @param  link    Name of the symbolic link to create, or NULL
+ * @return true    The pseudo terminal was created
+ * @return false   The pseudo terminal can't be created
+ */
+static bool ConsoleOpenTerminal(uint8_t port, char const * link);
+
+/**
+ * @brief Function to create the socket that waits for the clients of a serial port
+ *
+ * @param  port    Number of the serial port
+ * @param  kind    Kind of socket, AF_UNIX or AF_INET
+ * @param  address Path of the UNIX socket or number of the TCP port
+ * @return true    The socket was created
+ * @return false   The socket can't be created
+ */
+static bool ConsoleOpenServer(uint8_t port, int kind, char const * address);
+
+/**
+ * @brief Function to close the connection with the client of a serial port
+ *
+ * @param  port    Number of the serial port
+ */
+static void ConsoleClose(uint8_t port);
+
+/**
+ * @brief Function to notify the thread that the descriptors to wait for have changed
+ */
+static void ConsoleWake(void);
+
+/**
+ * @brief Function to implement a main loop of a thread to transfer the data of the host devices
+ *
+ * @param _         Pointer to initial data, required by function prototype, unused
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * ConsoleThread(void * _);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Mutual exclusion of the attachment of the serial ports
+static pthread_mutex_t console_lock = PTHREAD_MUTEX_INITIALIZER;
+
+//! Attachments of the serial ports
+static struct console_port_s console_ports[SOC_SCI_PORTS];
+
+//! Pipe used to wake the thread, the thread is running when it is open
+static int console_wake[2] = {-1, -1};
+
+/* === Private function implementation ========================================================= */
+
+static bool ConsoleOpenTerminal(uint8_t port, char const * link) {
+    struct termios settings;
+    int master, slave;
+    char const * name;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0)) {
+        return false;
+    }
+    name = ptsname(master);
+    /* The slave side is kept open so the master doesn't hang up when the clients close it */
+    slave = open(name, O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        close(master);
+        return false;
+    }
+    tcgetattr(slave, &settings);
+    cfmakeraw(&settings);
+    tcsetattr(slave, TCSANOW, &settings);
+    fcntl(master, F_SETFL, O_NONBLOCK);
+
+    if (link) {
+        unlink(link);
+        if (symlink(name, link) != 0) {
+            fprintf(stderr, "console: can't create the link %s\n", link);
+        }
+    }
+    fprintf(stderr, "console: sci%u on %s\n", port, name);
+    console_ports[port].client = master;
+    return true;
+}
+
+static bool ConsoleOpenServer(uint8_t port, int kind, char const * address) {
+    struct sockaddr_un local = {.sun_family = AF_UNIX};
+    struct sockaddr_in network = {.sin_family = AF_INET};
+    int server, enable = 1;
+    bool result;
+
+    server = socket(kind, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (server < 0) {
+        return false;
+    }
+    if (kind == AF_UNIX) {
+        snprintf(local.sun_path, sizeof(local.sun_path), "%s", address);
+        unlink(local.sun_path);
+        result = bind(server, (struct sockaddr *)&local, sizeof(local)) == 0;
+    } else {
+        setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        network.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        network.sin_port = htons(atoi(address));
+        result = bind(server, (struct sockaddr *)&network, sizeof(network)) == 0;
+    }
+    if (!result || (listen(server, 1) != 0)) {
+        close(server);
+        return false;
+    }
+    fprintf(stderr, "console: sci%u on %s%s\n", port, kind == AF_UNIX ? "unix:" : "tcp:", address);
+    console_ports[port].server = server;
+    return true;
+}
+
+static void ConsoleClose(uint8_t port) {
+    struct console_port_s * console = &console_ports[port];
+
+    pthread_mutex_lock(&console->lock);
+    close(console->client);
+    console->client = -1;
+    console->blocked = false;
+    pthread_mutex_unlock(&console->lock);
+}
+
+static void ConsoleWake(void) {
+    char signal = 0;
+
+    if (write(console_wake[1], &signal, 1) < 0) {
+        /* The pipe is full, so the thread will wake anyway */
+    }
+}
+
+static void * ConsoleThread(void * _) {
+    struct pollfd waits[2 * SOC_SCI_PORTS + 1];
+    int owners[2 * SOC_SCI_PORTS + 1];
+    char signals[16];
+    int count;
+
+    while (true) {
+        count = 0;
+        waits[count++] = (struct pollfd){.fd = console_wake[0], .events = POLLIN};
+        for (int port = 0; port < SOC_SCI_PORTS; port++) {
+            struct console_port_s * console = &console_ports[port];
+            if (!console->attached) {
+                continue;
+            }
+            if ((console->server >= 0) && (console->client < 0)) {
+                owners[count] = port;
+                waits[count++] = (struct pollfd){.fd = console->server, .events = POLLIN};
+            }
+            if (console->client >= 0) {
+                short events = console->blocked ? POLLOUT : 0;
+                /* The reception stops while the buffer is full, as with hardware flow control */
+                if (console->head - console->tail < CONSOLE_BUFFER_SIZE) {
+                    events |= POLLIN;
+                }
+                owners[count] = port;
+                waits[count++] = (struct pollfd){.fd = console->client, .events = events};
+            }
+        }
+        if (poll(waits, count, -1) < 0) {
+            continue;
+        }
+        if (waits[0].revents) {
+            while (read(console_wake[0], signals, sizeof(signals)) == sizeof(signals)) {
+            }
+        }
+        for (int index = 1; index < count; index++) {
+            uint8_t port = owners[index];
+            struct console_port_s * console = &console_ports[port];
+            if (!waits[index].revents) {
+                continue;
+            }
+            if (waits[index].fd == console->server) {
+                pthread_mutex_lock(&console->lock);
+                console->client = accept4(console->server, NULL, NULL, SOCK_NONBLOCK);
+                pthread_mutex_unlock(&console->lock);
+                continue;
+            }
+            if (waits[index].revents & POLLOUT) {
+                console->blocked = false;
+                SciInjectEvent(port);
+            }
+            if ((waits[index].revents & (POLLIN | POLLHUP | POLLERR)) &&
+                (console->head - console->tail < CONSOLE_BUFFER_SIZE)) {
+                uint32_t head = console->head;
+                uint32_t offset = head % CONSOLE_BUFFER_SIZE;
+                uint32_t space = CONSOLE_BUFFER_SIZE - (head - console->tail);
+                ssize_t size;
+
+                if (space > CONSOLE_BUFFER_SIZE - offset) {
+                    space = CONSOLE_BUFFER_SIZE - offset;
+                }
+                size = read(console->client, &console->data[offset], space);
+                if (size > 0) {
+                    __atomic_store_n(&console->head, head + size, __ATOMIC_RELEASE);
+                    SciInjectEvent(port);
+                } else if ((console->server >= 0) && (size == 0 || errno != EAGAIN)) {
+                    ConsoleClose(port);
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+/* === Public function implementation ========================================================== */
+
+void ConsoleStart(uint8_t port) {
+    struct console_port_s * console = &console_ports[port];
+    static pthread_t thread;
+    char name[sizeof(CONSOLE_ENVIRONMENT) + 4];
+    char const * value;
+    bool result = false;
+
+    if ((port >= SOC_SCI_PORTS) || __atomic_load_n(&console->started, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+    pthread_mutex_lock(&console_lock);
+    if (!console->started) {
+        pthread_mutex_init(&console->lock, NULL);
+        console->server = -1;
+        console->client = -1;
+        snprintf(name, sizeof(name), "%s%u", CONSOLE_ENVIRONMENT, port);
+        value = getenv(name);
+        if (value == NULL) {
+            result = false;
+        } else if (strcmp(value, "pty") == 0) {
+            result = ConsoleOpenTerminal(port, NULL);
+        } else if (strncmp(value, "pty:", 4) == 0) {
+            result = ConsoleOpenTerminal(port, value + 4);
+        } else if (strncmp(value, "unix:", 5) == 0) {
+            result = ConsoleOpenServer(port, AF_UNIX, value + 5);
+        } else if (strncmp(value, "tcp:", 4) == 0) {
+            result = ConsoleOpenServer(port, AF_INET, value + 4);
+        }
+        if (value && !result) {
+            fprintf(stderr, "console: can't attach sci%u to %s\n", port, value);
+        }
+        if (result && (console_wake[0] < 0)) {
+            if (pipe2(console_wake, O_NONBLOCK) == 0) {
+                pthread_create(&thread, NULL, ConsoleThread, NULL);
+            }
+        }
+        console->attached = result && (console_wake[0] >= 0);
+        __atomic_store_n(&console->started, true, __ATOMIC_RELEASE);
+        if (console->attached) {
+            ConsoleWake();
+        }
+    }
+    pthread_mutex_unlock(&console_lock);
+}
+
+bool ConsoleAttached(uint8_t port) {
+    ConsoleStart(port);
+    return (port < SOC_SCI_PORTS) && console_ports[port].attached;
+}
+
+uint16_t ConsoleSend(uint8_t port, void const * data, uint16_t size) {
+    struct console_port_s * console = &console_ports[port];
+    ssize_t result = size;
+
+    pthread_mutex_lock(&console->lock);
+    if (console->client >= 0) {
+        /* A write on a socket closed by the client would end the program with SIGPIPE */
+        if (console->server >= 0) {
+            result = send(console->client, data, size, MSG_NOSIGNAL);
+        } else {
+            result = write(console->client, data, size);
+        }
+        if ((result < 0) && (errno != EAGAIN)) {
+            /* The connection is broken, the data is lost as when nobody is listening and the
+             * thread closes the connection when it gets the hang up */
+            result = size;
+            ConsoleWake();
+        } else if (result < size) {
+            result = (result < 0) ? 0 : result;
+            console->blocked = true;
+            ConsoleWake();
+        }
+    }
+    pthread_mutex_unlock(&console->lock);
+    return result;
+}
+
+uint16_t ConsoleReceive(uint8_t port, void * data, uint16_t size) {
+    struct console_port_s * console = &console_ports[port];
+    uint32_t pending = ConsolePending(port);
+    uint32_t tail = console->tail;
+
+    if (size > pending) {
+        size = pending;
+    }
+    for (uint16_t index = 0; index < size; index++) {
+        ((uint8_t *)data)[index] = console->data[(tail + index) % CONSOLE_BUFFER_SIZE];
+    }
+    __atomic_store_n(&console->tail, tail + size, __ATOMIC_RELEASE);
+    if (size && (pending == CONSOLE_BUFFER_SIZE)) {
+        /* The reception was stopped by the full buffer and it can continue now */
+        ConsoleWake();
+    }
+    return size;
+}
+
+uint32_t ConsolePending(uint8_t port) {
+    struct console_port_s * console = &console_ports[port];
+
+    return __atomic_load_n(&console->head, __ATOMIC_ACQUIRE) - console->tail;
+}
+
+bool ConsoleWritable(uint8_t port) {
+    return !console_ports[port].blocked;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
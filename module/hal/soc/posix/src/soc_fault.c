@@ -0,0 +1,516 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Fault injection on the emulated peripherals on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_fault.h"
+#include "soc_gpio.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Maximum amount of serial ports with faults
+#define FAULT_SCI_PORTS 4
+
+//! Maximum amount of terminals with glitches
+#define FAULT_GLITCHES 8
+
+//! Maximum amount of bytes lost in an overrun
+#define FAULT_OVERRUN_BURST 16
+
+//! Period, in microseconds, of the checks of the glitches
+#define FAULT_GLITCH_SLOT 100
+
+//! Seed of the random generators when the configuration doesn't give one
+#define FAULT_DEFAULT_SEED 0x9E3779B97F4A7C15ULL
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the faults of a serial port
+struct fault_sci_s {
+    uint64_t random;                    /**< State of the random generator */
+    uint64_t bit;                       /**< Threshold of the errors of every bit */
+    uint64_t drop;                      /**< Threshold of the losses of every byte */
+    uint64_t dup;                       /**< Threshold of the duplications of every byte */
+    uint64_t overrun;                   /**< Threshold of the overruns on every byte */
+    uint64_t brk;                       /**< Threshold of the breaks on every byte */
+    uint8_t lost;                       /**< Bytes still to be lost by the current overrun */
+    uint8_t flags;                      /**< Error flags injected since the last status read */
+    uint32_t carried;                   /**< Amount of bytes kept in the carry buffer */
+    uint8_t carry[2 * FAULT_SCI_CHUNK]; /**< Bytes kept for the next reception */
+    uint8_t input[FAULT_SCI_CHUNK];     /**< Copy of the received data to apply the faults */
+    struct {
+        uint32_t bytes;   /**< Bytes received */
+        uint32_t bits;    /**< Bit errors injected */
+        uint32_t drops;   /**< Bytes dropped */
+        uint32_t dups;    /**< Bytes duplicated */
+        uint32_t overrun; /**< Overruns injected */
+        uint32_t lost;    /**< Bytes lost by the overruns */
+        uint32_t breaks;  /**< Breaks injected */
+    } count;                            /**< Counters of the injected faults */
+};
+
+//! Structure with the glitches of a gpio terminal
+struct fault_glitch_s {
+    uint8_t port;      /**< Number of the gpio port */
+    uint8_t bit;       /**< Number of the terminal in the gpio port */
+    uint64_t rate;     /**< Threshold of the glitches in every check period */
+    uint32_t width;    /**< Width, in microseconds, of the pulses */
+    uint32_t count;    /**< Glitches injected */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to read the configuration of the environment, called only once by FaultStart
+ */
+static void FaultOpen(void);
+
+/**
+ * @brief Function to write the counters of the injected faults at the end of the program
+ */
+static void FaultReport(void);
+
+/**
+ * @brief Function to get a new value from a random generator
+ *
+ * @param  state     Pointer to the state of the generator
+ * @return uint64_t  Random value with uniform distribution
+ */
+static uint64_t FaultRandom(uint64_t * state);
+
+/**
+ * @brief Function to decide if a fault happens in a trial
+ *
+ * @param  state     Pointer to the state of the random generator
+ * @param  threshold Threshold of the fault, obtained from the probability with FaultThreshold
+ * @return true      The fault happens
+ * @return false     The fault doesn't happen
+ */
+static bool FaultHappens(uint64_t * state, uint64_t threshold);
+
+/**
+ * @brief Function to convert a probability to a threshold for the random generators
+ *
+ * @param  text      Text with the probability
+ * @param  threshold Pointer to store the threshold
+ * @return true      The probability is valid
+ * @return false     The text is not a number between zero and one
+ */
+static bool FaultThreshold(char const * text, uint64_t * threshold);
+
+/**
+ * @brief Function to apply a list of items of the configuration, with the lock taken
+ *
+ * @param  spec    Text with the list of items of the configuration
+ * @return true    The configuration was applied
+ * @return false   The configuration has errors
+ */
+static bool FaultParse(char const * spec);
+
+/**
+ * @brief Function to apply an item of the configuration
+ *
+ * @param  item    Text with the item, without spaces
+ * @return true    The item was applied
+ * @return false   The item is not valid
+ */
+static bool FaultApply(char * item);
+
+/**
+ * @brief Function to implement a main loop of a thread to inject the glitches
+ *
+ * @param _         Pointer to initial data, required by function prototype, unused
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * GlitchThread(void * _);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Control of the single reading of the configuration
+static pthread_once_t fault_once = PTHREAD_ONCE_INIT;
+
+//! Mutual exclusion of the changes of the configuration
+static pthread_mutex_t fault_lock = PTHREAD_MUTEX_INITIALIZER;
+
+//! Seed of the random generators
+static uint64_t fault_seed = FAULT_DEFAULT_SEED;
+
+//! Faults of the serial ports
+static struct fault_sci_s fault_sci[FAULT_SCI_PORTS];
+
+//! Glitches of the gpio terminals
+static struct fault_glitch_s fault_glitches[FAULT_GLITCHES];
+
+//! Amount of terminals with glitches
+static volatile uint8_t fault_glitch_count;
+
+//! The thread that injects the glitches was created
+static bool fault_glitching;
+
+//! Thread that injects the glitches
+static pthread_t fault_thread;
+
+//! Faults of the system timer
+static struct {
+    uint64_t random; /**< State of the random generator */
+    uint64_t delay;  /**< Threshold of the delays of every event */
+    uint32_t time;   /**< Delay, in microseconds, of the delayed events */
+    uint64_t miss;   /**< Threshold of the losses of every event */
+    uint32_t delays; /**< Events delayed */
+    uint32_t misses; /**< Events missed */
+} fault_tick;
+
+//! Some fault was configured and the counters must be reported
+static bool fault_used;
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t FaultRandom(uint64_t * state) {
+    /* Generator xorshift64*, fast and good enough for the fault decisions */
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+static bool FaultHappens(uint64_t * state, uint64_t threshold) {
+    return threshold && (FaultRandom(state) < threshold);
+}
+
+static bool FaultThreshold(char const * text, uint64_t * threshold) {
+    char * end;
+    double probability = strtod(text, &end);
+
+    if ((end == text) || (*end && (*end != '/')) || (probability < 0) || (probability > 1)) {
+        return false;
+    }
+    *threshold = (probability >= 1) ? UINT64_MAX : (uint64_t)(probability * 18446744073709551616.0);
+    return true;
+}
+
+static bool FaultApply(char * item) {
+    char * value = strchr(item, '=');
+    char * name = strchr(item, '.');
+    char * width;
+    unsigned int port;
+    uint8_t gpio, bit;
+
+    if (value == NULL) {
+        return false;
+    }
+    *value++ = 0;
+    if (strcmp(item, "seed") == 0) {
+        fault_seed = strtoull(value, NULL, 0) | 1;
+        for (int index = 0; index < FAULT_SCI_PORTS; index++) {
+            fault_sci[index].random = fault_seed + index;
+        }
+        fault_tick.random = fault_seed + FAULT_SCI_PORTS;
+        return true;
+    }
+    if (name == NULL) {
+        return false;
+    }
+    *name++ = 0;
+    fault_used = true;
+
+    if ((sscanf(item, "sci%u", &port) == 1) && (port < FAULT_SCI_PORTS)) {
+        struct fault_sci_s * sci = &fault_sci[port];
+        if (strcmp(name, "bit") == 0) {
+            return FaultThreshold(value, &sci->bit);
+        } else if (strcmp(name, "drop") == 0) {
+            return FaultThreshold(value, &sci->drop);
+        } else if (strcmp(name, "dup") == 0) {
+            return FaultThreshold(value, &sci->dup);
+        } else if (strcmp(name, "overrun") == 0) {
+            return FaultThreshold(value, &sci->overrun);
+        } else if (strcmp(name, "break") == 0) {
+            return FaultThreshold(value, &sci->brk);
+        }
+    } else if (strcmp(item, "tick") == 0) {
+        if (strcmp(name, "delay") == 0) {
+            width = strchr(value, '/');
+            fault_tick.time = width ? strtoul(width + 1, NULL, 10) : 0;
+            return FaultThreshold(value, &fault_tick.delay);
+        } else if (strcmp(name, "miss") == 0) {
+            return FaultThreshold(value, &fault_tick.miss);
+        }
+    } else if (GpioParseName(item, &gpio, &bit)) {
+        if (strcmp(name, "stuck") == 0) {
+            if (strcmp(value, "off") == 0) {
+                GpioSetStuck(gpio, bit, false, false);
+            } else if ((strcmp(value, "0") == 0) || (strcmp(value, "1") == 0)) {
+                GpioSetStuck(gpio, bit, true, *value == '1');
+            } else {
+                return false;
+            }
+            return true;
+        } else if (strcmp(name, "glitch") == 0) {
+            struct fault_glitch_s * glitch = NULL;
+            double rate = strtod(value, &width);
+            if ((rate < 0) || (rate * FAULT_GLITCH_SLOT > 1000000)) {
+                return false;
+            }
+            for (int index = 0; index < fault_glitch_count; index++) {
+                if ((fault_glitches[index].port == gpio) && (fault_glitches[index].bit == bit)) {
+                    glitch = &fault_glitches[index];
+                }
+            }
+            if ((glitch == NULL) && (fault_glitch_count < FAULT_GLITCHES)) {
+                glitch = &fault_glitches[fault_glitch_count];
+                glitch->port = gpio;
+                glitch->bit = bit;
+                __atomic_store_n(&fault_glitch_count, fault_glitch_count + 1, __ATOMIC_RELEASE);
+            }
+            if (glitch == NULL) {
+                return false;
+            }
+            if (!fault_glitching) {
+                fault_glitching = true;
+                pthread_create(&fault_thread, NULL, GlitchThread, NULL);
+            }
+            /* The rate in glitches per second is converted to a probability for every check */
+            glitch->width = (*width == '/') ? strtoul(width + 1, NULL, 10) : 1;
+            glitch->rate = (uint64_t)(rate * FAULT_GLITCH_SLOT * 18446744073709.551616);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool FaultParse(char const * spec) {
+    char buffer[256], *item, *saveptr;
+    bool result = true;
+
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+    for (item = strtok_r(buffer, " ,\t\r\n", &saveptr); item && result;
+         item = strtok_r(NULL, " ,\t\r\n", &saveptr)) {
+        result = FaultApply(item);
+    }
+    return result;
+}
+
+static void * GlitchThread(void * _) {
+    uint64_t random = fault_seed ^ 0x5851F42D4C957F2DULL;
+    struct timespec slot;
+
+    /* The checks follow absolute times to keep the rate when the sleeps are longer */
+    clock_gettime(CLOCK_MONOTONIC, &slot);
+    while (true) {
+        slot.tv_nsec += FAULT_GLITCH_SLOT * 1000;
+        if (slot.tv_nsec >= 1000000000) {
+            slot.tv_nsec -= 1000000000;
+            slot.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &slot, NULL);
+        for (int index = 0; index < __atomic_load_n(&fault_glitch_count, __ATOMIC_ACQUIRE);
+             index++) {
+            struct fault_glitch_s * glitch = &fault_glitches[index];
+            if (FaultHappens(&random, glitch->rate)) {
+                GpioInjectToggle(glitch->port, glitch->bit);
+                usleep(glitch->width);
+                GpioInjectToggle(glitch->port, glitch->bit);
+                glitch->count++;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void FaultReport(void) {
+    if (!fault_used) {
+        return;
+    }
+    for (int port = 0; port < FAULT_SCI_PORTS; port++) {
+        struct fault_sci_s * sci = &fault_sci[port];
+        if (sci->count.bytes) {
+            fprintf(stderr,
+                    "fault: sci%d %u bytes, %u bit errors, %u dropped, %u duplicated, "
+                    "%u overruns losing %u bytes, %u breaks\n",
+                    port, sci->count.bytes, sci->count.bits, sci->count.drops, sci->count.dups,
+                    sci->count.overrun, sci->count.lost, sci->count.breaks);
+        }
+    }
+    for (int index = 0; index < fault_glitch_count; index++) {
+        fprintf(stderr, "fault: GPIO%u_%u %u glitches\n", fault_glitches[index].port,
+                fault_glitches[index].bit, fault_glitches[index].count);
+    }
+    if (fault_tick.delays || fault_tick.misses) {
+        fprintf(stderr, "fault: tick %u delayed, %u missed\n", fault_tick.delays,
+                fault_tick.misses);
+    }
+}
+
+static void FaultOpen(void) {
+    char const * spec = getenv(FAULT_ENVIRONMENT);
+
+    for (int index = 0; index < FAULT_SCI_PORTS; index++) {
+        fault_sci[index].random = fault_seed + index;
+    }
+    fault_tick.random = fault_seed + FAULT_SCI_PORTS;
+    if (spec) {
+        pthread_mutex_lock(&fault_lock);
+        if (!FaultParse(spec)) {
+            fprintf(stderr, "fault: error in %s\n", spec);
+        }
+        pthread_mutex_unlock(&fault_lock);
+    }
+    atexit(FaultReport);
+}
+
+/* === Public function implementation ========================================================== */
+
+void FaultStart(void) {
+    pthread_once(&fault_once, FaultOpen);
+}
+
+bool FaultConfigure(char const * spec) {
+    bool result;
+
+    FaultStart();
+    pthread_mutex_lock(&fault_lock);
+    result = FaultParse(spec);
+    pthread_mutex_unlock(&fault_lock);
+    return result;
+}
+
+uint16_t FaultSciReceive(uint8_t port, uint8_t * data, uint16_t size, uint16_t capacity) {
+    struct fault_sci_s * sci = &fault_sci[port % FAULT_SCI_PORTS];
+    uint32_t used = 0, kept = 0;
+    uint8_t byte;
+
+    FaultStart();
+    if (!fault_used && (sci->carried == 0)) {
+        return size;
+    }
+    memcpy(sci->input, data, size);
+
+    /* The bytes kept by the previous reception are delivered first */
+    while ((used < capacity) && (kept < sci->carried)) {
+        data[used++] = sci->carry[kept++];
+    }
+    memmove(sci->carry, &sci->carry[kept], sci->carried - kept);
+    sci->carried -= kept;
+
+    for (uint16_t index = 0; index < size; index++) {
+        byte = sci->input[index];
+        sci->count.bytes++;
+        if (sci->lost) {
+            sci->lost--;
+            sci->count.lost++;
+            continue;
+        }
+        if (FaultHappens(&sci->random, sci->overrun)) {
+            sci->lost = FaultRandom(&sci->random) % FAULT_OVERRUN_BURST;
+            sci->flags |= FAULT_SCI_OVERRUN;
+            sci->count.overrun++;
+            sci->count.lost++;
+            continue;
+        }
+        if (FaultHappens(&sci->random, sci->drop)) {
+            sci->count.drops++;
+            continue;
+        }
+        if (FaultHappens(&sci->random, sci->brk)) {
+            byte = 0;
+            sci->flags |= FAULT_SCI_BREAK | FAULT_SCI_FRAMING;
+            sci->count.breaks++;
+        } else if (sci->bit) {
+            /* Every character has ten bits, the start bit, eight data bits and the stop bit */
+            for (int bit = 0; bit < 10; bit++) {
+                if (FaultHappens(&sci->random, sci->bit)) {
+                    if ((bit == 0) || (bit == 9)) {
+                        sci->flags |= FAULT_SCI_FRAMING;
+                    } else {
+                        byte ^= 1 << (bit - 1);
+                        sci->flags |= FAULT_SCI_PARITY;
+                    }
+                    sci->count.bits++;
+                }
+            }
+        }
+        for (int copy = FaultHappens(&sci->random, sci->dup) ? 2 : 1; copy > 0; copy--) {
+            if ((used < capacity) && (sci->carried == 0)) {
+                data[used++] = byte;
+            } else if (sci->carried < sizeof(sci->carry)) {
+                sci->carry[sci->carried++] = byte;
+            } else {
+                /* The carry holds a whole reception and its duplicates, the port is not read */
+                sci->count.lost++;
+            }
+            if (copy == 2) {
+                sci->count.dups++;
+            }
+        }
+    }
+    return used;
+}
+
+uint32_t FaultSciPending(uint8_t port) {
+    return fault_sci[port % FAULT_SCI_PORTS].carried;
+}
+
+uint8_t FaultSciStatus(uint8_t port) {
+    struct fault_sci_s * sci = &fault_sci[port % FAULT_SCI_PORTS];
+
+    return __atomic_exchange_n(&sci->flags, 0, __ATOMIC_RELAXED);
+}
+
+bool FaultTick(uint32_t * delay) {
+    FaultStart();
+    *delay = 0;
+    if (FaultHappens(&fault_tick.random, fault_tick.miss)) {
+        fault_tick.misses++;
+        return false;
+    }
+    if (FaultHappens(&fault_tick.random, fault_tick.delay)) {
+        fault_tick.delays++;
+        *delay = fault_tick.time;
+    }
+    return true;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
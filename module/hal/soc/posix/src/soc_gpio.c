@@ -35,23 +35,39 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "soc_gpio.h"
+#include "hal_cycles.h"
+#include "hal_hooks.h"
+#include "soc_journal.h"
+#include "soc_stimulus.h"
+#include "soc_vcd.h"
+#include "soc_wire.h"
 #include <stdio.h>
+#include <string.h>
 #include <pthread.h>
 #include <termios.h>
 #include <unistd.h>
 
 /* === Macros definitions ====================================================================== */
 
-/**
- * @brief Macro to generate the name of an descriptor from the gpio port and bit
- */
-#define GPIO_NAME(PORT, BIT) HAL_GPIO##PORT##_##BIT
-
 /**
  * @brief Macro to define an gpio descriptor
  */
 #define GPIO_BIT(GPIO, BIT)                                                                        \
-    GPIO_NAME(GPIO, BIT) = &(struct hal_gpio_bit_s) { .gpio = GPIO, .bit = BIT }
+    SOC_GPIO_NAME(GPIO, BIT) = &(struct hal_gpio_bit_s) { .gpio = GPIO, .bit = BIT }
+
+//! Macro to get the mask of a terminal in the word of its gpio port
+#define GPIO_MASK(BIT) ((uint32_t)1 << (BIT))
+
+#ifdef POSIX_HEADLESS
+#define GPIO_HEADLESS true //!< The emulated gpio terminals are never drawn on the screen
+#else
+#define GPIO_HEADLESS false //!< The emulated gpio terminals are drawn when the output is a terminal
+#endif
+
+#ifndef GPIO_FRAME_RATE
+//! Amount of times per second that the changed gpio ports are drawn on the screen
+#define GPIO_FRAME_RATE 25
+#endif
 
 /* === Private data type declarations ========================================================== */
 
@@ -78,12 +94,27 @@ typedef struct event_handler_s {
 /**
  * @brief Variable to maintain the state of the emulated gpio terminals
  */
-static uint8_t gpio_emulation[4];
+static volatile uint32_t gpio_emulation[SOC_GPIO_PORTS];
+
+/**
+ * @brief Variable with a bit for every emulated gpio terminal configured as output
+ */
+static volatile uint32_t gpio_outputs[SOC_GPIO_PORTS];
+
+/**
+ * @brief Variable with a bit for every emulated gpio terminal stuck by a fault
+ */
+static volatile uint32_t gpio_stuck[SOC_GPIO_PORTS];
+
+/**
+ * @brief Variable with a bit for every gpio port changed since the last time it was drawn
+ */
+static volatile uint32_t gpio_dirty;
 
 /**
  * @brief Vector to store the event handlers of the gpio bits
  */
-static struct event_handler_s event_handlers[32] = {0};
+static struct event_handler_s event_handlers[SOC_GPIO_PORTS * SOC_GPIO_BITS] = {0};
 
 /* === Private function declarations =========================================================== */
 
@@ -95,17 +126,64 @@ static struct event_handler_s event_handlers[32] = {0};
  */
 static void * KeyboardThread(void * _);
 
+/**
+ * @brief Function to record the change of an emulated input and call its event handler
+ *
+ * @param  port      Number of the gpio port
+ * @param  bit       Number of the terminal in the gpio port
+ * @param  previous  State of the terminal before the change
+ * @param  state     State of the terminal after the change
+ */
+static void GpioDispatchEvent(uint8_t port, uint8_t bit, bool previous, bool state);
+
+/**
+ * @brief Function to change atomically some terminals of an emulated gpio port
+ *
+ * @param  port      Number of the gpio port
+ * @param  mask      Terminals to change, one bit for every terminal
+ * @param  value     New state of the terminals selected by the mask
+ * @param  current   Pointer to store the state of the port after the change
+ * @return uint32_t  Terminals that really changed its state, one bit for every terminal
+ */
+static uint32_t GpioPortUpdate(uint8_t port, uint32_t mask, uint32_t value, uint32_t * current);
+
+/**
+ * @brief Function to implement a main loop of a thread to draw the changed gpio ports
+ *
+ * @param _         Pointer to initial data, required by function prototype, unused
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * RenderThread(void * _);
+
 /**
  * @brief Function to draw on screen initial state of emulated gpio terminals
  */
 void DrawStatus(void);
 
 /**
- * @brief Function to refresh on screen current state of one emulated gpio terminal
+ * @brief Function to draw on screen current state of one emulated gpio port
+ *
+ * @param  gpio     Number of the gpio port
+ */
+static void DrawPort(uint8_t gpio);
+
+/**
+ * @brief Function to record a change of a terminal and mark its port to be drawn in the next frame
+ *
+ * @param  gpio      Pointer to the structure with the gpio terminal descriptor
+ * @param  previous  State of the terminal before the change
+ * @param  state     State of the terminal after the change
+ */
+static inline void RefreshStatus(hal_gpio_bit_t gpio, bool previous, bool state);
+
+/**
+ * @brief Function to record a change made by the program and drive the net of an output terminal
  *
- * @param  gpio     Pointer to the structure with the gpio terminal descriptor
+ * @param  gpio      Pointer to the structure with the gpio terminal descriptor
+ * @param  previous  State of the terminal before the change
+ * @param  state     State of the terminal after the change
  */
-void RefreshStatus(hal_gpio_bit_t gpio);
+static inline void DriveStatus(hal_gpio_bit_t gpio, bool previous, bool state);
 
 /* === Public variable definitions ============================================================= */
 
@@ -114,41 +192,28 @@ void RefreshStatus(hal_gpio_bit_t gpio);
  * @brief Constant for gpio terminals on board
  * @{
  */
-const hal_gpio_bit_t GPIO_BIT(0, 0); /**< Constant to define Bit 0 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 1); /**< Constant to define Bit 1 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 2); /**< Constant to define Bit 2 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 3); /**< Constant to define Bit 3 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 4); /**< Constant to define Bit 4 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 5); /**< Constant to define Bit 5 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 6); /**< Constant to define Bit 6 on GPIO 0 */
-const hal_gpio_bit_t GPIO_BIT(0, 7); /**< Constant to define Bit 7 on GPIO 0 */
-
-const hal_gpio_bit_t GPIO_BIT(1, 0); /**< Constant to define Bit 0 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 1); /**< Constant to define Bit 1 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 2); /**< Constant to define Bit 2 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 3); /**< Constant to define Bit 3 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 4); /**< Constant to define Bit 4 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 5); /**< Constant to define Bit 5 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 6); /**< Constant to define Bit 6 on GPIO 1 */
-const hal_gpio_bit_t GPIO_BIT(1, 7); /**< Constant to define Bit 7 on GPIO 1 */
-
-const hal_gpio_bit_t GPIO_BIT(2, 0); /**< Constant to define Bit 0 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 1); /**< Constant to define Bit 1 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 2); /**< Constant to define Bit 2 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 3); /**< Constant to define Bit 3 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 4); /**< Constant to define Bit 4 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 5); /**< Constant to define Bit 5 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 6); /**< Constant to define Bit 6 on GPIO 2 */
-const hal_gpio_bit_t GPIO_BIT(2, 7); /**< Constant to define Bit 7 on GPIO 2 */
-
-const hal_gpio_bit_t GPIO_BIT(3, 0); /**< Constant to define Bit 0 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 1); /**< Constant to define Bit 1 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 2); /**< Constant to define Bit 2 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 3); /**< Constant to define Bit 3 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 4); /**< Constant to define Bit 4 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 5); /**< Constant to define Bit 5 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 6); /**< Constant to define Bit 6 on GPIO 3 */
-const hal_gpio_bit_t GPIO_BIT(3, 7); /**< Constant to define Bit 7 on GPIO 3 */
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(0, GPIO_BIT);
+#if SOC_GPIO_PORTS > 1
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(1, GPIO_BIT);
+#endif
+#if SOC_GPIO_PORTS > 2
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(2, GPIO_BIT);
+#endif
+#if SOC_GPIO_PORTS > 3
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(3, GPIO_BIT);
+#endif
+#if SOC_GPIO_PORTS > 4
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(4, GPIO_BIT);
+#endif
+#if SOC_GPIO_PORTS > 5
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(5, GPIO_BIT);
+#endif
+#if SOC_GPIO_PORTS > 6
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(6, GPIO_BIT);
+#endif
+#if SOC_GPIO_PORTS > 7
+const hal_gpio_bit_t SOC_GPIO_TERMINALS(7, GPIO_BIT);
+#endif
 /** @} End of group posixGpio */
 
 /* === Private variable definitions ============================================================ */
@@ -157,8 +222,7 @@ const hal_gpio_bit_t GPIO_BIT(3, 7); /**< Constant to define Bit 7 on GPIO 3 */
 
 static void * KeyboardThread(void * _) {
     struct termios ttystate;
-    struct hal_gpio_bit_s gpio = {.gpio = 0, .bit = 0};
-    char key;
+    int key;
 
     tcgetattr(STDIN_FILENO, &ttystate);
     ttystate.c_lflag &= (~ICANON & ~ECHO);
@@ -167,23 +231,58 @@ static void * KeyboardThread(void * _) {
 
     while (true) {
         key = getchar();
-        if ((key >= '1') && (key <= '8')) {
-            gpio.gpio = 0;
-            gpio.bit = key - '1';
-            GpioBitToggle(&gpio);
-
-            event_handler_t descriptor = &event_handlers[8 * gpio.gpio + gpio.bit];
-            if (descriptor->handler != NULL) {
-                if (GpioGetState(&gpio)) {
-                    if (descriptor->rising) {
-                        descriptor->handler(&gpio, true, descriptor->object);
-                    }
-                } else {
-                    if (descriptor->falling) {
-                        descriptor->handler(&gpio, false, descriptor->object);
-                    }
+        if (key == EOF) {
+            break;
+        } else if ((key >= '1') && (key <= '8')) {
+            GpioInjectToggle(0, key - '1');
+        }
+    }
+    return 0;
+}
+
+static void GpioDispatchEvent(uint8_t port, uint8_t bit, bool previous, bool state) {
+    struct hal_gpio_bit_s gpio = {.gpio = port, .bit = bit};
+    uint16_t index = port * SOC_GPIO_BITS + bit;
+    event_handler_t descriptor = &event_handlers[index];
+
+    RefreshStatus(&gpio, previous, state);
+    if (previous != state) {
+        JournalGpio(port, bit, state);
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_GPIO + index);
+        if ((descriptor->handler != NULL) && (state ? descriptor->rising : descriptor->falling)) {
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_GPIO + index);
+            descriptor->handler(&gpio, state, descriptor->object);
+        }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_GPIO + index);
+    }
+}
+
+static uint32_t GpioPortUpdate(uint8_t port, uint32_t mask, uint32_t value, uint32_t * current) {
+    uint32_t previous = __atomic_load_n(&gpio_emulation[port], __ATOMIC_RELAXED);
+
+    do {
+        *current = (previous & ~mask) | (value & mask);
+    } while (!__atomic_compare_exchange_n(&gpio_emulation[port], &previous, *current, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return previous ^ *current;
+}
+
+static void * RenderThread(void * _) {
+    static const char DRAW_SAVE[] = "\0337";
+    static const char DRAW_RESTORE[] = "\0338";
+
+    while (true) {
+        usleep(1000000 / GPIO_FRAME_RATE);
+        uint32_t dirty = __atomic_exchange_n(&gpio_dirty, 0, __ATOMIC_ACQUIRE);
+        if (dirty) {
+            printf(DRAW_SAVE);
+            for (int gpio = 0; gpio < SOC_GPIO_PORTS; gpio++) {
+                if (dirty & (1 << gpio)) {
+                    DrawPort(gpio);
                 }
             }
+            printf(DRAW_RESTORE);
+            fflush(stdout);
         }
     }
     return 0;
@@ -191,32 +290,53 @@ static void * KeyboardThread(void * _) {
 
 void DrawStatus(void) {
     static const char DRAW_INIT[] = "\033[2J\033[1;1H";
-    static const char DRAW_BIT[] = "%d=\033[1;31m%d\033[0m";
-    static const char DRAW_END[] = "\033[5A\n";
-
-    int gpio, bit;
+    static const char DRAW_END[] = "\033[%d;1H";
 
     printf(DRAW_INIT);
-    for (gpio = 0; gpio < 4; gpio++) {
-        printf("GPIO %d: ", gpio);
-        for (bit = 7; bit >= 0; bit--) {
-            printf(DRAW_BIT, bit, (gpio_emulation[gpio] >> (bit)) & 0x01);
+    for (int gpio = 0; gpio < SOC_GPIO_PORTS; gpio++) {
+        DrawPort(gpio);
+    }
+    printf(DRAW_END, SOC_GPIO_PORTS + 2);
+    fflush(stdout);
+}
+
+static void DrawPort(uint8_t gpio) {
+    static const char DRAW_PORT[] = "\033[%d;1HGPIO %d: ";
+    static const char DRAW_BIT[] = "%d=\033[1;%dm%d\033[0m";
+    static const char DRAW_WIDE[] = "\033[1;%dm%d\033[0m";
+
+    uint32_t value = gpio_emulation[gpio];
+
+    printf(DRAW_PORT, gpio + 1, gpio);
+    for (int bit = SOC_GPIO_BITS - 1; bit >= 0; bit--) {
+        uint8_t state = (value >> bit) & 0x01;
+        if (SOC_GPIO_BITS > 8) {
+            /* The wide ports are drawn as binary numbers with the terminals grouped by bytes */
+            printf(DRAW_WIDE, state ? 32 : 31, state);
+            if ((bit > 0) && (bit % 8 == 0)) {
+                printf(" ");
+            }
+        } else {
+            printf(DRAW_BIT, bit, state ? 32 : 31, state);
             if (bit > 0) {
                 printf(", ");
             }
         }
-        printf("\n");
     }
-    printf(DRAW_END);
 }
 
-void RefreshStatus(hal_gpio_bit_t gpio) {
-    static const char DRAW_BIT[] = "\033[%d;%dH\033[1;%dm%d\033[0m";
-
-    uint8_t value = (gpio_emulation[gpio->gpio] >> (gpio->bit)) & 0x01;
+static inline void RefreshStatus(hal_gpio_bit_t gpio, bool previous, bool state) {
+    if (previous != state) {
+        __atomic_fetch_or(&gpio_dirty, 1 << gpio->gpio, __ATOMIC_RELEASE);
+        VcdGpio(gpio->gpio, gpio->bit, state);
+    }
+}
 
-    printf(DRAW_BIT, gpio->gpio + 1, 46 - 5 * gpio->bit, value ? 32 : 31, value);
-    fflush(stdout);
+static inline void DriveStatus(hal_gpio_bit_t gpio, bool previous, bool state) {
+    RefreshStatus(gpio, previous, state);
+    if ((previous != state) && (gpio_outputs[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+        WireGpio(gpio->gpio, gpio->bit, state);
+    }
 }
 
 /* === Public function implementation ========================================================== */
@@ -224,21 +344,35 @@ void RefreshStatus(hal_gpio_bit_t gpio) {
 void GpioSetDirection(hal_gpio_bit_t gpio, bool output) {
     static bool initied_status = false;
     static pthread_t thread;
+    static pthread_t render;
 
     if (!initied_status) {
         initied_status = true;
-        DrawStatus();
-        pthread_create(&thread, NULL, KeyboardThread, NULL);
+        /* The screen is not drawn when the output is redirected to a file */
+        if (!GPIO_HEADLESS && isatty(STDOUT_FILENO)) {
+            DrawStatus();
+            pthread_create(&render, NULL, RenderThread, NULL);
+        }
+        /* In replay mode the inputs are taken only from the journal */
+        if (!JournalReplaying()) {
+            pthread_create(&thread, NULL, KeyboardThread, NULL);
+            StimulusStart();
+        }
     }
-    if (!output) {
+    if (output) {
+        __atomic_fetch_or(&gpio_outputs[gpio->gpio], GPIO_MASK(gpio->bit), __ATOMIC_RELAXED);
+        WireGpio(gpio->gpio, gpio->bit, GpioGetState(gpio));
+    } else {
+        __atomic_fetch_and(&gpio_outputs[gpio->gpio], ~GPIO_MASK(gpio->bit), __ATOMIC_RELAXED);
         GpioBitSet(gpio);
+        WireRefresh();
     }
 }
 
 bool GpioGetState(hal_gpio_bit_t gpio) {
     bool result = false;
     if (gpio) {
-        result = (gpio_emulation[gpio->gpio] & (1 << gpio->bit)) != 0;
+        result = (gpio_emulation[gpio->gpio] & GPIO_MASK(gpio->bit)) != 0;
     }
     return result;
 }
@@ -252,30 +386,36 @@ void GpioSetState(hal_gpio_bit_t gpio, bool state) {
 }
 
 void GpioBitSet(hal_gpio_bit_t gpio) {
-    if (gpio) {
-        gpio_emulation[gpio->gpio] |= (1 << gpio->bit);
-        RefreshStatus(gpio);
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+        volatile uint32_t * port = &gpio_emulation[gpio->gpio];
+        uint32_t mask = GPIO_MASK(gpio->bit);
+        bool previous = __atomic_fetch_or(port, mask, __ATOMIC_RELAXED) & mask;
+        DriveStatus(gpio, previous, true);
     }
 }
 
 void GpioBitClear(hal_gpio_bit_t gpio) {
-    if (gpio) {
-        gpio_emulation[gpio->gpio] &= ~(1 << gpio->bit);
-        RefreshStatus(gpio);
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+        volatile uint32_t * port = &gpio_emulation[gpio->gpio];
+        uint32_t mask = GPIO_MASK(gpio->bit);
+        bool previous = __atomic_fetch_and(port, ~mask, __ATOMIC_RELAXED) & mask;
+        DriveStatus(gpio, previous, false);
     }
 }
 
 void GpioBitToggle(hal_gpio_bit_t gpio) {
-    if (gpio) {
-        gpio_emulation[gpio->gpio] ^= (1 << gpio->bit);
-        RefreshStatus(gpio);
+    if (gpio && !(gpio_stuck[gpio->gpio] & GPIO_MASK(gpio->bit))) {
+        volatile uint32_t * port = &gpio_emulation[gpio->gpio];
+        uint32_t mask = GPIO_MASK(gpio->bit);
+        bool previous = __atomic_fetch_xor(port, mask, __ATOMIC_RELAXED) & mask;
+        DriveStatus(gpio, previous, !previous);
     }
 }
 
 void GpioSetEventHandler(hal_gpio_bit_t gpio, hal_gpio_event_t handler, void * object, bool rising,
                          bool falling) {
 
-    uint8_t index = 8 * gpio->gpio + gpio->bit;
+    uint16_t index = gpio->gpio * SOC_GPIO_BITS + gpio->bit;
     event_handler_t descriptor = &event_handlers[index];
 
     descriptor->handler = handler;
@@ -284,6 +424,119 @@ void GpioSetEventHandler(hal_gpio_bit_t gpio, hal_gpio_event_t handler, void * o
     descriptor->falling = falling;
 }
 
+void GpioInjectState(uint8_t port, uint8_t bit, bool state) {
+    uint32_t mask = GPIO_MASK(bit);
+    bool previous;
+
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS) && !(gpio_stuck[port] & mask)) {
+        HAL_HOOK_IRQ_EVENT(HAL_HOOK_GPIO + port * SOC_GPIO_BITS + bit, CyclesRead());
+        if (state) {
+            previous = __atomic_fetch_or(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+        } else {
+            previous = __atomic_fetch_and(&gpio_emulation[port], ~mask, __ATOMIC_RELAXED) & mask;
+        }
+        GpioDispatchEvent(port, bit, previous, state);
+    }
+}
+
+bool GpioInjectToggle(uint8_t port, uint8_t bit) {
+    uint32_t mask = GPIO_MASK(bit);
+    bool previous = false;
+
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS)) {
+        if (gpio_stuck[port] & mask) {
+            /* A stuck terminal keeps its state */
+            return (gpio_emulation[port] & mask) != 0;
+        }
+        HAL_HOOK_IRQ_EVENT(HAL_HOOK_GPIO + port * SOC_GPIO_BITS + bit, CyclesRead());
+        previous = __atomic_fetch_xor(&gpio_emulation[port], mask, __ATOMIC_RELAXED) & mask;
+        GpioDispatchEvent(port, bit, previous, !previous);
+    }
+    return !previous;
+}
+
+uint32_t GpioPortRead(uint8_t port) {
+    uint32_t result = 0;
+
+    if (port < SOC_GPIO_PORTS) {
+        result = __atomic_load_n(&gpio_emulation[port], __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+void GpioPortWrite(uint8_t port, uint32_t mask, uint32_t value) {
+    uint32_t current, changed;
+
+    if (port < SOC_GPIO_PORTS) {
+        changed = GpioPortUpdate(port, mask & ~gpio_stuck[port], value, &current);
+        for (uint8_t bit = 0; changed; bit++, changed >>= 1) {
+            if (changed & 0x01) {
+                struct hal_gpio_bit_s gpio = {.gpio = port, .bit = bit};
+                DriveStatus(&gpio, !(current & GPIO_MASK(bit)), current & GPIO_MASK(bit));
+            }
+        }
+    }
+}
+
+void GpioInjectPort(uint8_t port, uint32_t mask, uint32_t value) {
+    uint32_t current, changed;
+
+    if (port < SOC_GPIO_PORTS) {
+        changed = GpioPortUpdate(port, mask & ~gpio_stuck[port], value, &current);
+        for (uint8_t bit = 0; changed; bit++, changed >>= 1) {
+            if (changed & 0x01) {
+                bool state = current & GPIO_MASK(bit);
+                HAL_HOOK_IRQ_EVENT(HAL_HOOK_GPIO + port * SOC_GPIO_BITS + bit, CyclesRead());
+                GpioDispatchEvent(port, bit, !state, state);
+            }
+        }
+    }
+}
+
+void GpioSetStuck(uint8_t port, uint8_t bit, bool stuck, bool state) {
+    struct hal_gpio_bit_s gpio = {.gpio = port, .bit = bit};
+    uint32_t mask = GPIO_MASK(bit);
+
+    if ((port < SOC_GPIO_PORTS) && (bit < SOC_GPIO_BITS)) {
+        __atomic_fetch_and(&gpio_stuck[port], ~mask, __ATOMIC_RELAXED);
+        if (stuck) {
+            /* The stuck outputs drive its nets and the stuck inputs raise its events */
+            if (gpio_outputs[port] & mask) {
+                GpioSetState(&gpio, state);
+            } else {
+                GpioInjectState(port, bit, state);
+            }
+            __atomic_fetch_or(&gpio_stuck[port], mask, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+bool GpioIsOutput(uint8_t port, uint8_t bit) {
+    return (port < SOC_GPIO_PORTS) && (gpio_outputs[port] & GPIO_MASK(bit));
+}
+
+bool GpioParseName(char const * text, uint8_t * port, uint8_t * bit) {
+    unsigned int number, terminal;
+    char separator;
+
+    if (strncmp(text, "HAL_", 4) == 0) {
+        text += 4;
+    }
+    if (strncmp(text, "GPIO", 4) == 0) {
+        text += 4;
+    }
+    if (sscanf(text, "%u%c%u", &number, &separator, &terminal) != 3) {
+        return false;
+    }
+    if (((separator != '_') && (separator != '.')) || (number >= SOC_GPIO_PORTS) ||
+        (terminal >= SOC_GPIO_BITS)) {
+        return false;
+    }
+    *port = number;
+    *bit = terminal;
+    return true;
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen
@@ -0,0 +1,499 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Record and replay of the external inputs on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_journal.h"
+#include "soc_gpio.h"
+#include "soc_sci.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Text at the start of every journal
+#define JOURNAL_MAGIC "MJNL"
+
+//! Version of the format of the journal
+#define JOURNAL_VERSION 1
+
+//! Kind of the record with a change of an emulated gpio input
+#define JOURNAL_GPIO 0x01
+
+//! Kind of the record with data received by a serial port
+#define JOURNAL_SCI 0x02
+
+//! Kind of the record with the first event of the system timer
+#define JOURNAL_TICK 0x03
+
+//! Maximum amount of serial ports in a journal
+#define JOURNAL_SCI_PORTS 4
+
+//! Size of the buffer of the data delivered to every serial port, it must be a power of two
+#define JOURNAL_SCI_BUFFER 4096
+
+//! Size of the buffer used to write the journal
+#define JOURNAL_FILE_BUFFER (64 * 1024)
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the next record to deliver in replay mode
+struct journal_record_s {
+    uint64_t time;            /**< Virtual time of the record, in microseconds */
+    uint8_t kind;             /**< Kind of the record */
+    uint8_t port;             /**< Number of the gpio or serial port */
+    uint8_t bit;              /**< Number of the terminal in the gpio port */
+    bool state;               /**< New state of the terminal */
+    uint16_t size;            /**< Amount of data received by the serial port */
+    uint8_t data[UINT16_MAX]; /**< Data received by the serial port */
+};
+
+//! Structure with the data delivered to a serial port in replay mode
+struct journal_sci_s {
+    volatile uint32_t head;           /**< Amount of bytes delivered since the start */
+    volatile uint32_t tail;           /**< Amount of bytes received since the start */
+    uint8_t data[JOURNAL_SCI_BUFFER]; /**< Bytes waiting to be received */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to open the journal, called only once by JournalStart
+ */
+static void JournalOpen(void);
+
+/**
+ * @brief Function to get the wall-clock time since the journal was opened
+ *
+ * @return uint64_t  Time in microseconds
+ */
+static uint64_t JournalClock(void);
+
+/**
+ * @brief Function to get the virtual time used to stamp the records in record mode
+ *
+ * @return uint64_t  Time in microseconds
+ */
+static uint64_t JournalNow(void);
+
+/**
+ * @brief Function to write the pending records at the end of the program
+ */
+static void JournalFlush(void);
+
+/**
+ * @brief Function to write a number with variable length, seven bits in every byte
+ *
+ * @param  value  Number to write
+ */
+static void JournalWriteNumber(uint64_t value);
+
+/**
+ * @brief Function to read a number with variable length, seven bits in every byte
+ *
+ * @param  value  Pointer to store the number
+ * @return true   The number was read
+ * @return false  The journal has ended
+ */
+static bool JournalReadNumber(uint64_t * value);
+
+/**
+ * @brief Function to write the header of a record, it must be called with the lock taken
+ *
+ * @param  kind  Kind of the record
+ */
+static void JournalWriteHeader(uint8_t kind);
+
+/**
+ * @brief Function to read the next record of the journal in replay mode
+ *
+ * @return true   The record is ready
+ * @return false  The journal has ended
+ */
+static bool JournalRead(void);
+
+/**
+ * @brief Function to deliver all the records before a virtual time, it must be called with the
+ * lock taken
+ *
+ * @param  until  Virtual time, in microseconds, of the first record that is not delivered
+ */
+static void JournalDeliver(uint64_t until);
+
+/**
+ * @brief Function to implement a main loop of a thread to deliver the records in real time
+ * until the system timer is started
+ *
+ * @param _         Pointer to initial data, required by function prototype, unused
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * ReplayThread(void * _);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Control of the single opening of the journal
+static pthread_once_t journal_once = PTHREAD_ONCE_INIT;
+
+//! Mutual exclusion of the access to the journal files
+static pthread_mutex_t journal_lock = PTHREAD_MUTEX_INITIALIZER;
+
+//! File of the journal in record mode
+static FILE * journal_record;
+
+//! File of the journal in replay mode
+static FILE * journal_replay;
+
+//! Monotonic time, in microseconds, when the journal was opened
+static uint64_t journal_start;
+
+//! Virtual time of the last record written or delivered
+static uint64_t journal_last;
+
+//! The first event of the system timer has occurred
+static volatile bool journal_ticking;
+
+//! Virtual time of the start of the current period of the system timer
+static uint64_t tick_time;
+
+//! Wall-clock time of the start of the current period of the system timer
+static uint64_t tick_wall;
+
+//! Period of the system timer, in microseconds
+static uint32_t tick_period;
+
+//! Next record to be delivered in replay mode
+static struct journal_record_s journal_next;
+
+//! The next record to be delivered is valid
+static bool journal_pending;
+
+//! Data delivered to the serial ports in replay mode
+static struct journal_sci_s journal_sci[JOURNAL_SCI_PORTS];
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t JournalClock(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - journal_start;
+}
+
+static uint64_t JournalNow(void) {
+    uint64_t now = JournalClock();
+
+    if (journal_ticking) {
+        /* The events are kept inside of the timer period in which they were received */
+        now = now - tick_wall;
+        if (now >= tick_period) {
+            now = tick_period - 1;
+        }
+        now = tick_time + now;
+    }
+    if (now < journal_last) {
+        now = journal_last;
+    }
+    return now;
+}
+
+static void JournalFlush(void) {
+    pthread_mutex_lock(&journal_lock);
+    fflush(journal_record);
+    pthread_mutex_unlock(&journal_lock);
+}
+
+static void JournalWriteNumber(uint64_t value) {
+    do {
+        putc((value & 0x7F) | (value > 0x7F ? 0x80 : 0), journal_record);
+        value = value >> 7;
+    } while (value);
+}
+
+static bool JournalReadNumber(uint64_t * value) {
+    int data, shift = 0;
+
+    *value = 0;
+    do {
+        data = getc(journal_replay);
+        if ((data == EOF) || (shift > 63)) {
+            return false;
+        }
+        *value |= (uint64_t)(data & 0x7F) << shift;
+        shift += 7;
+    } while (data & 0x80);
+    return true;
+}
+
+static void JournalWriteHeader(uint8_t kind) {
+    uint64_t now = JournalNow();
+
+    putc(kind, journal_record);
+    JournalWriteNumber(now - journal_last);
+    journal_last = now;
+}
+
+static bool JournalRead(void) {
+    uint64_t delta, size;
+    int kind, port, data;
+
+    kind = getc(journal_replay);
+    if ((kind == EOF) || !JournalReadNumber(&delta)) {
+        return false;
+    }
+    journal_next.kind = kind;
+    journal_next.time += delta;
+    if (kind == JOURNAL_GPIO) {
+        port = getc(journal_replay);
+        data = getc(journal_replay);
+        if ((port == EOF) || (data == EOF)) {
+            return false;
+        }
+        journal_next.port = port;
+        journal_next.bit = data & 0x7F;
+        journal_next.state = (data & 0x80) != 0;
+    } else if (kind == JOURNAL_SCI) {
+        port = getc(journal_replay);
+        if ((port == EOF) || !JournalReadNumber(&size) || (size > UINT16_MAX)) {
+            return false;
+        }
+        journal_next.port = port;
+        journal_next.size = size;
+        if (fread(journal_next.data, 1, size, journal_replay) != size) {
+            return false;
+        }
+    } else if (kind == JOURNAL_TICK) {
+        if (!JournalReadNumber(&size)) {
+            return false;
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void JournalDeliver(uint64_t until) {
+    struct journal_sci_s * sci;
+
+    while (journal_pending && (journal_next.time < until)) {
+        journal_last = journal_next.time;
+        if (journal_next.kind == JOURNAL_GPIO) {
+            GpioInjectState(journal_next.port, journal_next.bit, journal_next.state);
+        } else if ((journal_next.kind == JOURNAL_SCI) && (journal_next.port < JOURNAL_SCI_PORTS)) {
+            sci = &journal_sci[journal_next.port];
+            for (uint16_t index = 0; index < journal_next.size; index++) {
+                if (JournalSciPending(journal_next.port) >= JOURNAL_SCI_BUFFER) {
+                    /* The handler of the port takes the data in the event, if it doesn't the
+                     * data can't be discarded because the replay would differ from the record */
+                    SciInjectEvent(journal_next.port);
+                    if (JournalSciPending(journal_next.port) >= JOURNAL_SCI_BUFFER) {
+                        fprintf(stderr, "journal: data of sci%u not read at %llu us\n",
+                                journal_next.port, (unsigned long long)journal_last);
+                        exit(EXIT_FAILURE);
+                    }
+                }
+                sci->data[sci->head % JOURNAL_SCI_BUFFER] = journal_next.data[index];
+                __atomic_store_n(&sci->head, sci->head + 1, __ATOMIC_RELEASE);
+            }
+            SciInjectEvent(journal_next.port);
+        } else if (journal_next.kind == JOURNAL_TICK) {
+            /* The timer events are delivered by the timer thread from this record */
+            return;
+        }
+        journal_pending = JournalRead();
+        if (!journal_pending) {
+            fprintf(stderr, "journal: replay finished at %llu us\n",
+                    (unsigned long long)journal_last);
+        }
+    }
+}
+
+static void * ReplayThread(void * _) {
+    uint64_t now;
+    bool waiting = true;
+
+    while (waiting) {
+        pthread_mutex_lock(&journal_lock);
+        now = JournalClock();
+        JournalDeliver(now + 1);
+        /* After the first timer event the thread of the timer delivers the records */
+        waiting = journal_pending && (journal_next.kind != JOURNAL_TICK) && !journal_ticking;
+        now = journal_next.time > now ? journal_next.time - now : 0;
+        pthread_mutex_unlock(&journal_lock);
+        if (waiting) {
+            usleep(now < 1000 ? now : 1000);
+        }
+    }
+    return NULL;
+}
+
+static void JournalOpen(void) {
+    char const * record = getenv(JOURNAL_RECORD_ENVIRONMENT);
+    char const * replay = getenv(JOURNAL_REPLAY_ENVIRONMENT);
+    static pthread_t thread;
+    char magic[sizeof(JOURNAL_MAGIC)] = {0};
+
+    journal_start = JournalClock();
+    if (replay) {
+        journal_replay = fopen(replay, "rb");
+        if ((journal_replay == NULL) || (fread(magic, 1, 4, journal_replay) != 4) ||
+            (strcmp(magic, JOURNAL_MAGIC) != 0) || (getc(journal_replay) != JOURNAL_VERSION)) {
+            fprintf(stderr, "journal: can't replay %s\n", replay);
+            exit(EXIT_FAILURE);
+        }
+        journal_pending = JournalRead();
+        pthread_create(&thread, NULL, ReplayThread, NULL);
+    } else if (record) {
+        journal_record = fopen(record, "wb");
+        if (journal_record == NULL) {
+            fprintf(stderr, "journal: can't record %s\n", record);
+            return;
+        }
+        setvbuf(journal_record, NULL, _IOFBF, JOURNAL_FILE_BUFFER);
+        fwrite(JOURNAL_MAGIC, 1, 4, journal_record);
+        putc(JOURNAL_VERSION, journal_record);
+        /* The buffered records are written when the program ends with exit */
+        atexit(JournalFlush);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void JournalStart(void) {
+    pthread_once(&journal_once, JournalOpen);
+}
+
+bool JournalReplaying(void) {
+    JournalStart();
+    return journal_replay != NULL;
+}
+
+void JournalGpio(uint8_t port, uint8_t bit, bool state) {
+    JournalStart();
+    if (journal_record) {
+        pthread_mutex_lock(&journal_lock);
+        JournalWriteHeader(JOURNAL_GPIO);
+        putc(port, journal_record);
+        putc(bit | (state ? 0x80 : 0), journal_record);
+        pthread_mutex_unlock(&journal_lock);
+    }
+}
+
+void JournalSci(uint8_t port, void const * data, uint16_t size) {
+    JournalStart();
+    if (journal_record && size && (port < JOURNAL_SCI_PORTS)) {
+        pthread_mutex_lock(&journal_lock);
+        JournalWriteHeader(JOURNAL_SCI);
+        putc(port, journal_record);
+        JournalWriteNumber(size);
+        fwrite(data, 1, size, journal_record);
+        pthread_mutex_unlock(&journal_lock);
+    }
+}
+
+uint32_t JournalSciPending(uint8_t port) {
+    struct journal_sci_s * sci;
+
+    /* The ports without a buffer never receive data, they aren't merged with the others */
+    if (port >= JOURNAL_SCI_PORTS) {
+        return 0;
+    }
+    sci = &journal_sci[port];
+    return __atomic_load_n(&sci->head, __ATOMIC_ACQUIRE) -
+           __atomic_load_n(&sci->tail, __ATOMIC_ACQUIRE);
+}
+
+uint16_t JournalSciReceive(uint8_t port, void * data, uint16_t size) {
+    struct journal_sci_s * sci;
+    uint32_t pending = JournalSciPending(port);
+
+    if (pending == 0) {
+        return 0;
+    }
+    sci = &journal_sci[port];
+    if (size > pending) {
+        size = pending;
+    }
+    for (uint16_t index = 0; index < size; index++) {
+        ((uint8_t *)data)[index] = sci->data[(sci->tail + index) % JOURNAL_SCI_BUFFER];
+    }
+    __atomic_store_n(&sci->tail, sci->tail + size, __ATOMIC_RELEASE);
+    return size;
+}
+
+bool JournalTick(uint32_t period) {
+    bool result = false;
+
+    JournalStart();
+    pthread_mutex_lock(&journal_lock);
+    if (journal_record) {
+        if (!journal_ticking) {
+            tick_time = JournalNow();
+            tick_period = period;
+            JournalWriteHeader(JOURNAL_TICK);
+            JournalWriteNumber(period);
+            journal_ticking = true;
+        } else {
+            tick_time += period;
+        }
+        tick_wall = JournalClock();
+    } else if (journal_replay && journal_pending) {
+        if (!journal_ticking) {
+            /* The records before the first timer event are delivered at once */
+            JournalDeliver(UINT64_MAX);
+            if (journal_pending && (journal_next.kind == JOURNAL_TICK)) {
+                tick_time = journal_next.time;
+                journal_pending = JournalRead();
+            }
+            journal_ticking = true;
+        }
+        tick_time += period;
+        JournalDeliver(tick_time);
+        result = true;
+    }
+    pthread_mutex_unlock(&journal_lock);
+    return result;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -35,41 +35,174 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "soc_sci.h"
+#include "hal_hooks.h"
+#include "soc_console.h"
+#include "soc_fault.h"
+#include "soc_journal.h"
+#include "soc_vcd.h"
+#include "soc_wire.h"
 #include <string.h>
 
 /* === Macros definitions ====================================================================== */
 
 /* === Private data type declarations ========================================================== */
 
+/**
+ * @brief Structure to store a serial port descriptor
+ */
+struct hal_sci_s {
+    uint8_t index; /**< Numeric index of serial port */
+};
+
+/**
+ * @brief Structure to store a serial port event handler
+ */
+typedef struct event_handler_s {
+    hal_sci_t sci;           /**< Descriptor of the serial port sended as parameter in calls */
+    hal_sci_event_t handler; /**< Function to call on the serial port events */
+    void * data;             /**< Pointer to user data sended as parameter in handler calls */
+} * event_handler_t;
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
 /* === Public variable definitions ============================================================= */
 
+/**
+ * @addtogroup posixSci Serial Ports Constants
+ * @brief Constant for serial ports on board
+ * @{
+ */
+
+/** Constant to define serial port 0 */
+const hal_sci_t HAL_SCI_USART0 = &(struct hal_sci_s){.index = 0};
+
+/** Constant to define serial port 1, as on LPC43xx */
+const hal_sci_t HAL_SCI_UART1 = &(struct hal_sci_s){.index = 1};
+
+/** Constant to define serial port 1, as on STM32F1xx */
+const hal_sci_t HAL_SCI_USART1 = &(struct hal_sci_s){.index = 1};
+
+/** Constant to define serial port 2 */
+const hal_sci_t HAL_SCI_USART2 = &(struct hal_sci_s){.index = 2};
+
+/** Constant to define serial port 3 */
+const hal_sci_t HAL_SCI_USART3 = &(struct hal_sci_s){.index = 3};
+
+/** @} End of group posixSci */
+
 /* === Private variable definitions ============================================================ */
 
+/**
+ * @brief Vector to store the event handlers of the serial ports
+ */
+static struct event_handler_s event_handlers[SOC_SCI_PORTS] = {0};
+
 /* === Private function implementation ========================================================= */
 
 /* === Public function implementation ========================================================== */
 
 bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins) {
-    return false;
+    bool result = false;
+
+    if (sci && (sci->index < SOC_SCI_PORTS)) {
+        ConsoleStart(sci->index);
+        WireStart();
+        result = true;
+    }
+    return result;
 }
 
 uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
+    uint8_t port = sci ? sci->index : 0;
+
+    if (WireSciLinked(port)) {
+        size = WireSciSend(port, data, size);
+    } else if (ConsoleAttached(port)) {
+        size = ConsoleSend(port, data, size);
+    }
+    HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + port, size);
+    for (uint16_t index = 0; index < size; index++) {
+        VcdSci(port, ((uint8_t const *)data)[index]);
+    }
     return size;
 }
 
 uint16_t SciReceiveData(hal_sci_t sci, void * data, uint16_t size) {
-    return size;
+    uint8_t port = sci ? sci->index : 0;
+    uint16_t capacity = size;
+
+    /* The faults are applied to a copy of the data, so a reception is limited to its size */
+    if (size > FAULT_SCI_CHUNK) {
+        size = FAULT_SCI_CHUNK;
+    }
+    if (JournalReplaying()) {
+        size = JournalSciReceive(port, data, size);
+    } else if (WireSciLinked(port)) {
+        size = WireSciReceive(port, data, size);
+        JournalSci(port, data, size);
+    } else if (ConsoleAttached(port)) {
+        size = ConsoleReceive(port, data, size);
+        JournalSci(port, data, size);
+    }
+    /* The journal keeps the data without faults, to replay it with other faults */
+    return FaultSciReceive(port, data, size, capacity);
 }
 
 void SciReadStatus(hal_sci_t sci, sci_status_t result) {
+    uint8_t port = sci ? sci->index : 0;
+    uint8_t faults = FaultSciStatus(port);
+
     memset(result, 0, sizeof(*result));
+    if (JournalReplaying()) {
+        result->data_ready = (JournalSciPending(port) > 0);
+        result->fifo_empty = true;
+    } else if (WireSciLinked(port)) {
+        result->data_ready = (WireSciPending(port) > 0);
+        result->fifo_empty = (WireSciSpace(port) > 0);
+    } else if (ConsoleAttached(port)) {
+        result->data_ready = (ConsolePending(port) > 0);
+        result->fifo_empty = ConsoleWritable(port);
+    } else {
+        result->fifo_empty = true;
+    }
+    result->tramition_completed = result->fifo_empty;
+    result->data_ready |= (FaultSciPending(port) > 0);
+    result->overrun = (faults & FAULT_SCI_OVERRUN) != 0;
+    result->parity_error = (faults & FAULT_SCI_PARITY) != 0;
+    result->framing_error = (faults & FAULT_SCI_FRAMING) != 0;
+    result->break_signal = (faults & FAULT_SCI_BREAK) != 0;
 }
 
 void SciSetEventHandler(hal_sci_t sci, hal_sci_event_t handler, void * data) {
+    uint8_t port = sci ? sci->index : 0;
+    event_handler_t event_handler = &event_handlers[port % SOC_SCI_PORTS];
+
+    event_handler->sci = sci;
+    event_handler->data = data;
+    __atomic_store_n(&event_handler->handler, handler, __ATOMIC_RELEASE);
+    JournalStart();
+    ConsoleStart(port);
+    WireStart();
+}
+
+void SciInjectEvent(uint8_t port) {
+    event_handler_t event_handler;
+    hal_sci_event_t handler;
+    struct sci_status_s status;
+
+    if (port < SOC_SCI_PORTS) {
+        event_handler = &event_handlers[port];
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_SCI + port);
+        handler = __atomic_load_n(&event_handler->handler, __ATOMIC_ACQUIRE);
+        if (handler) {
+            SciReadStatus(event_handler->sci, &status);
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_SCI + port);
+            handler(event_handler->sci, &status, event_handler->data);
+        }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_SCI + port);
+    }
 }
 
 /* === End of documentation ==================================================================== */
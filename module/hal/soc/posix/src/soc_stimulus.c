@@ -0,0 +1,268 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Stimulus injection of the emulated gpio terminals on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_stimulus.h"
+#include "soc_fault.h"
+#include "soc_gpio.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Maximum length of a command line
+#define STIMULUS_LINE_SIZE 256
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to get the time of the monotonic clock
+ *
+ * @return  Time in microseconds
+ */
+static uint64_t StimulusClock(void);
+
+/**
+ * @brief Function to wait until a time of the monotonic clock
+ *
+ * @param   time    Time in microseconds
+ */
+static void StimulusWait(uint64_t time);
+
+/**
+ * @brief Function to implement a main loop of a thread to execute the timeline file
+ *
+ * @param   name    Name of the timeline file
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * FileThread(void * name);
+
+/**
+ * @brief Function to implement a main loop of a thread to execute the commands of the socket
+ *
+ * @param   path    Path of the UNIX socket
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * SocketThread(void * path);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t StimulusClock(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static void StimulusWait(uint64_t time) {
+    struct timespec until = {.tv_sec = time / 1000000, .tv_nsec = (time % 1000000) * 1000};
+    int error;
+
+    /* Only the waits interrupted by a signal are repeated, any other error would repeat forever */
+    do {
+        error = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL);
+    } while (error == EINTR);
+    if (error != 0) {
+        fprintf(stderr, "stimulus: can't wait until %llu us, %s\n", (unsigned long long)time,
+                strerror(error));
+    }
+}
+
+static void * FileThread(void * name) {
+    struct stimulus_clock_s clock[1];
+    char line[STIMULUS_LINE_SIZE];
+    int number = 0;
+    FILE * file;
+
+    file = fopen(name, "r");
+    if (file == NULL) {
+        fprintf(stderr, "stimulus: can't open %s\n", (char *)name);
+        return NULL;
+    }
+    clock->origin = StimulusClock();
+    clock->time = clock->origin;
+    while (fgets(line, sizeof(line), file)) {
+        number++;
+        if (!StimulusExecute(clock, line)) {
+            fprintf(stderr, "stimulus: error in line %d of %s\n", number, (char *)name);
+        }
+    }
+    fclose(file);
+    return NULL;
+}
+
+static void * SocketThread(void * path) {
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    struct stimulus_clock_s clock[1];
+    char line[STIMULUS_LINE_SIZE];
+    int server, client;
+    FILE * stream;
+
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    unlink(address.sun_path);
+    server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ((server < 0) || (bind(server, (struct sockaddr *)&address, sizeof(address)) != 0) ||
+        (listen(server, 1) != 0)) {
+        fprintf(stderr, "stimulus: can't listen on %s\n", (char *)path);
+        return NULL;
+    }
+
+    while (true) {
+        client = accept(server, NULL, NULL);
+        if (client < 0) {
+            continue;
+        }
+        stream = fdopen(client, "r+");
+        if (stream == NULL) {
+            fprintf(stderr, "stimulus: can't open the connection on %s\n", (char *)path);
+            close(client);
+            continue;
+        }
+        clock->origin = StimulusClock();
+        clock->time = clock->origin;
+        while (fgets(line, sizeof(line), stream)) {
+            fputs(StimulusExecute(clock, line) ? "ok\n" : "error\n", stream);
+            fflush(stream);
+        }
+        fclose(stream);
+    }
+    return NULL;
+}
+
+/* === Public function implementation ========================================================== */
+
+void StimulusStart(void) {
+    static pthread_t file_thread;
+    static pthread_t socket_thread;
+    char * name;
+
+    name = getenv(STIMULUS_FILE_ENVIRONMENT);
+    if (name) {
+        pthread_create(&file_thread, NULL, FileThread, name);
+    }
+    name = getenv(STIMULUS_SOCKET_ENVIRONMENT);
+    if (name) {
+        pthread_create(&socket_thread, NULL, SocketThread, name);
+    }
+}
+
+bool StimulusExecute(stimulus_clock_t clock, char const * line) {
+    char command[16], terminal[32], argument[STIMULUS_LINE_SIZE];
+    unsigned long long time;
+    unsigned long count, period;
+    uint8_t port, bit;
+    bool state;
+    int fields, used = 0;
+
+    line += strspn(line, " \t");
+    if ((*line == '#') || (*line == '\n') || (*line == '\r') || (*line == 0)) {
+        return true;
+    }
+
+    if ((*line == '@') || (*line == '+')) {
+        if (sscanf(line + 1, "%llu%n", &time, &used) != 1) {
+            return false;
+        }
+        clock->time = ((*line == '@') ? clock->origin : clock->time) + time;
+        line += used + 1;
+        StimulusWait(clock->time);
+    } else {
+        clock->time = StimulusClock();
+    }
+
+    fields = sscanf(line, "%15s %31s %255s %lu", command, terminal, argument, &period);
+    if ((fields >= 2) && (strcmp(command, "fault") == 0)) {
+        return FaultConfigure(strstr(line, "fault") + strlen("fault"));
+    }
+    if ((fields < 2) || !GpioParseName(terminal, &port, &bit)) {
+        return false;
+    }
+    if (strcmp(command, "set") == 0) {
+        GpioInjectState(port, bit, true);
+    } else if (strcmp(command, "clear") == 0) {
+        GpioInjectState(port, bit, false);
+    } else if (strcmp(command, "toggle") == 0) {
+        GpioInjectToggle(port, bit);
+    } else if ((strcmp(command, "pulse") == 0) && (fields >= 3)) {
+        state = GpioInjectToggle(port, bit);
+        clock->time += strtoul(argument, NULL, 10);
+        StimulusWait(clock->time);
+        GpioInjectState(port, bit, !state);
+    } else if ((strcmp(command, "pattern") == 0) && (fields == 4)) {
+        for (char const * value = argument; (*value == '0') || (*value == '1'); value++) {
+            GpioInjectState(port, bit, *value == '1');
+            clock->time += period;
+            StimulusWait(clock->time);
+        }
+    } else if ((strcmp(command, "burst") == 0) && (fields == 4)) {
+        count = strtoul(argument, NULL, 10);
+        for (unsigned long index = 0; index < count; index++) {
+            GpioInjectToggle(port, bit);
+            if (period) {
+                clock->time += period;
+                StimulusWait(clock->time);
+            }
+        }
+        if (period == 0) {
+            uint64_t elapsed = StimulusClock() - clock->time;
+            fprintf(stderr, "stimulus: %lu edges on GPIO%u_%u in %llu us\n", count, port, bit,
+                    (unsigned long long)elapsed);
+            clock->time += elapsed;
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
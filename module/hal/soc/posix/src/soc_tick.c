@@ -35,6 +35,10 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "soc_tick.h"
+#include "hal_cycles.h"
+#include "hal_hooks.h"
+#include "soc_fault.h"
+#include "soc_journal.h"
 #include <pthread.h>
 #include <unistd.h>
 #include <stdio.h>
@@ -51,6 +55,7 @@ typedef struct hal_tick_s {
     hal_tick_event_t handler; /**< Function to call on the system timer events */
     void * object;            /**< Pointer to user data sended as parameter in handler calls */
     uint32_t period;          /**< Period, in microseconds, between each system timer event */
+    uint32_t wakeup;          /**< Value of the cycle counter at the expected timer event */
 } * hal_tick_t;
 
 /* === Private variable declarations =========================================================== */
@@ -77,11 +82,32 @@ static struct hal_tick_s instance[1] = {0};
 /* === Private function implementation ========================================================= */
 
 static void * TimerThread(void * _) {
+    uint32_t delay;
+
     while (true) {
-        usleep(instance->period);
+        /* The cycle counter of the host is the monotonic clock in microseconds, it runs even if
+         * CyclesStart was never called and the period is already in its units */
+        instance->wakeup = CyclesRead() + instance->period;
+        /* In replay mode the timer periods run back to back, so the event happens at once */
+        if (!JournalTick(instance->period)) {
+            usleep(instance->period);
+        } else {
+            instance->wakeup = CyclesRead();
+        }
+        if (!FaultTick(&delay)) {
+            /* The missed event is lost, as an interrupt masked for a whole period */
+            continue;
+        }
+        if (delay) {
+            usleep(delay);
+        }
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_TICK);
+        HAL_HOOK_IRQ_EVENT(HAL_HOOK_TICK, instance->wakeup);
         if (instance->handler) {
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_TICK);
             instance->handler(instance->object);
         }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_TICK);
     }
     return 0;
 }
@@ -96,9 +122,12 @@ void TickStart(hal_tick_event_t handler, void * object, uint32_t period) {
 }
 
 void SysTick_Handler(void) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_TICK);
     if (instance->handler) {
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_TICK);
         instance->handler(instance->object);
     }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_TICK);
 }
 /* === End of documentation ==================================================================== */
 
@@ -0,0 +1,262 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Waveform recorder of the emulated terminals on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_vcd.h"
+#include "soc_gpio.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef VCD_BUFFER_SIZE
+//! Size of the memory used to store the changes before writing them to the file
+#define VCD_BUFFER_SIZE (256 * 1024)
+#endif
+
+//! Maximum size of the text of a single change
+#define VCD_CHANGE_SIZE 64
+
+//! Maximum time in nanoseconds that the changes are kept in memory
+#define VCD_FLUSH_PERIOD 100000000ULL
+
+//! Index of the first variable used for the serial ports
+#define VCD_SCI_BASE (SOC_GPIO_PORTS * SOC_GPIO_BITS)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to open the file and write the header if the recorder is enabled
+ */
+static void VcdOpen(void);
+
+/**
+ * @brief Function to get the time of the monotonic clock
+ *
+ * @return  Time in nanoseconds
+ */
+static uint64_t VcdClock(void);
+
+/**
+ * @brief Function to build the identifier of a variable in the file
+ *
+ * @param   index       Index of the variable
+ * @param   identifier  Pointer to the memory to store the identifier as a string
+ * @return              Pointer to the identifier
+ */
+static char * VcdIdentifier(uint16_t index, char identifier[4]);
+
+/**
+ * @brief Function to start a change in the buffer, it must be called with the lock taken
+ *
+ * @return  Pointer to the memory to store the text of the change
+ */
+static char * VcdBegin(void);
+
+/**
+ * @brief Function to finish a change in the buffer and release the lock
+ *
+ * @param   size    Size of the text of the change
+ */
+static void VcdEnd(int size);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Control of the single initialization of the recorder
+static pthread_once_t vcd_once = PTHREAD_ONCE_INIT;
+
+//! Lock of the buffer shared by the application and the emulation threads
+static pthread_mutex_t vcd_lock = PTHREAD_MUTEX_INITIALIZER;
+
+//! File to write the changes, NULL when the recorder is disabled
+static FILE * vcd_file;
+
+//! Time of the start of the recording
+static uint64_t vcd_start;
+
+//! Time of the last change stored
+static uint64_t vcd_last;
+
+//! Time of the last write to the file
+static uint64_t vcd_flushed;
+
+//! Memory used to store the changes
+static char vcd_buffer[VCD_BUFFER_SIZE];
+
+//! Amount of bytes stored in memory
+static size_t vcd_used;
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t VcdClock(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static char * VcdIdentifier(uint16_t index, char identifier[4]) {
+    int length = 0;
+
+    /* The identifiers use the printable characters from '!' to '~' */
+    do {
+        identifier[length++] = '!' + (index % 94);
+        index = index / 94;
+    } while (index > 0);
+    identifier[length] = 0;
+    return identifier;
+}
+
+static void VcdOpen(void) {
+    char const * name = getenv(VCD_ENVIRONMENT);
+    char identifier[4];
+
+    if (name == NULL) {
+        return;
+    }
+    vcd_file = fopen(name, "w");
+    if (vcd_file == NULL) {
+        return;
+    }
+
+    fprintf(vcd_file, "$version muju posix $end\n$timescale 1ns $end\n$scope module board $end\n");
+    for (int port = 0; port < SOC_GPIO_PORTS; port++) {
+        fprintf(vcd_file, "$scope module gpio%d $end\n", port);
+        for (int bit = 0; bit < SOC_GPIO_BITS; bit++) {
+            fprintf(vcd_file, "$var wire 1 %s gpio%d_%d $end\n",
+                    VcdIdentifier(port * SOC_GPIO_BITS + bit, identifier), port, bit);
+        }
+        fprintf(vcd_file, "$upscope $end\n");
+    }
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+        fprintf(vcd_file, "$scope module sci%d $end\n", port);
+        fprintf(vcd_file, "$var wire 8 %s tx_data $end\n",
+                VcdIdentifier(VCD_SCI_BASE + 2 * port, identifier));
+        fprintf(vcd_file, "$var event 1 %s tx_strobe $end\n",
+                VcdIdentifier(VCD_SCI_BASE + 2 * port + 1, identifier));
+        fprintf(vcd_file, "$upscope $end\n");
+    }
+    fprintf(vcd_file, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+    for (int index = 0; index < VCD_SCI_BASE; index++) {
+        fprintf(vcd_file, "0%s\n", VcdIdentifier(index, identifier));
+    }
+    for (int port = 0; port < VCD_SCI_PORTS; port++) {
+        fprintf(vcd_file, "bxxxxxxxx %s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, identifier));
+    }
+    fprintf(vcd_file, "$end\n");
+
+    vcd_start = VcdClock();
+    vcd_flushed = vcd_start;
+    atexit(VcdFlush);
+}
+
+static char * VcdBegin(void) {
+    uint64_t now = VcdClock() - vcd_start;
+
+    pthread_mutex_lock(&vcd_lock);
+    if (now > vcd_last) {
+        vcd_last = now;
+        vcd_used += sprintf(&vcd_buffer[vcd_used], "#%llu\n", (unsigned long long)now);
+    }
+    return &vcd_buffer[vcd_used];
+}
+
+static void VcdEnd(int size) {
+    vcd_used += size;
+    if ((vcd_used > VCD_BUFFER_SIZE - VCD_CHANGE_SIZE) ||
+        (vcd_last + vcd_start - vcd_flushed > VCD_FLUSH_PERIOD)) {
+        fwrite(vcd_buffer, 1, vcd_used, vcd_file);
+        fflush(vcd_file);
+        vcd_used = 0;
+        vcd_flushed = vcd_last + vcd_start;
+    }
+    pthread_mutex_unlock(&vcd_lock);
+}
+
+/* === Public function implementation ========================================================== */
+
+void VcdGpio(uint8_t port, uint8_t bit, bool state) {
+    char identifier[4];
+    char * change;
+
+    pthread_once(&vcd_once, VcdOpen);
+    if (vcd_file) {
+        change = VcdBegin();
+        VcdEnd(sprintf(change, "%c%s\n", state ? '1' : '0',
+                       VcdIdentifier(port * SOC_GPIO_BITS + bit, identifier)));
+    }
+}
+
+void VcdSci(uint8_t port, uint8_t value) {
+    char data[4];
+    char strobe[4];
+    char * change;
+    int size = 0;
+
+    pthread_once(&vcd_once, VcdOpen);
+    if (vcd_file && (port < VCD_SCI_PORTS)) {
+        change = VcdBegin();
+        change[size++] = 'b';
+        for (int bit = 7; bit >= 0; bit--) {
+            change[size++] = (value & (1 << bit)) ? '1' : '0';
+        }
+        size += sprintf(&change[size], " %s\n1%s\n", VcdIdentifier(VCD_SCI_BASE + 2 * port, data),
+                        VcdIdentifier(VCD_SCI_BASE + 2 * port + 1, strobe));
+        VcdEnd(size);
+    }
+}
+
+void VcdFlush(void) {
+    if (vcd_file) {
+        pthread_mutex_lock(&vcd_lock);
+        fwrite(vcd_buffer, 1, vcd_used, vcd_file);
+        fflush(vcd_file);
+        vcd_used = 0;
+        pthread_mutex_unlock(&vcd_lock);
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -0,0 +1,384 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Shared memory bus between emulated boards on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_wire.h"
+#include "soc_gpio.h"
+#include "soc_journal.h"
+#include "soc_sci.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Name of the shared memory object used when the environment doesn't define it
+#define WIRE_BUS_DEFAULT "/muju-bus"
+
+//! Maximum amount of nets in a netlist
+#define WIRE_NETS 64
+
+//! Maximum amount of links in a netlist
+#define WIRE_LINKS 16
+
+//! Size of the buffer of every direction of a link, it must be a power of two
+#define WIRE_PIPE_SIZE 4096
+
+//! Value used to mark a terminal or serial port without connections
+#define WIRE_NONE 0xFF
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with a direction of a link between two serial ports
+struct wire_pipe_s {
+    volatile uint32_t head;       /**< Amount of bytes written since the creation */
+    volatile uint32_t tail;       /**< Amount of bytes read since the creation */
+    uint8_t data[WIRE_PIPE_SIZE]; /**< Bytes in transit */
+};
+
+//! Structure with the contents of the shared memory object
+struct wire_bus_s {
+    volatile uint32_t generation;                /**< Counter of changes, used as futex */
+    volatile uint32_t waiters;                   /**< Amount of programs waiting for changes */
+    volatile uint8_t nets[WIRE_NETS];            /**< State of every net */
+    struct wire_pipe_s pipes[2 * WIRE_LINKS];    /**< Both directions of every link */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to connect the program to the bus, called only once by WireStart
+ */
+static void WireOpen(void);
+
+/**
+ * @brief Function to read the netlist and find the connections of the board
+ *
+ * @param   name    Name of the netlist file
+ * @param   board   Name of the board in the netlist
+ * @return  true    The netlist is valid
+ * @return  false   The netlist can't be read or has errors
+ */
+static bool WireLoadNetlist(char const * name, char const * board);
+
+/**
+ * @brief Function to notify to all the programs that the bus has changed
+ */
+static void WireNotify(void);
+
+/**
+ * @brief Function to implement a main loop of a thread to apply the changes of the bus
+ *
+ * @param _         Pointer to initial data, required by function prototype, unused
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * WireThread(void * _);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Control of the single initialization of the bus
+static pthread_once_t wire_once = PTHREAD_ONCE_INIT;
+
+//! Shared memory with the bus, NULL when the bus is disabled
+static struct wire_bus_s * bus;
+
+//! Net connected to every emulated gpio terminal
+static uint8_t gpio_nets[SOC_GPIO_PORTS * SOC_GPIO_BITS];
+
+//! The inputs must take again the state of their nets
+static volatile bool wire_refresh = true;
+
+//! Last state of the net applied to every emulated gpio terminal
+static bool gpio_levels[SOC_GPIO_PORTS * SOC_GPIO_BITS];
+
+//! Pipes used to transmit and to receive by every serial port
+static struct {
+    uint8_t transmit; /**< Index of the pipe used to transmit */
+    uint8_t receive;  /**< Index of the pipe used to receive */
+    bool blocked;     /**< The last transmission was not fully accepted */
+} sci_links[WIRE_SCI_PORTS];
+
+/* === Private function implementation ========================================================= */
+
+static bool WireLoadNetlist(char const * name, char const * board) {
+    char line[256], kind[8], endpoint[64];
+    int nets = 0, links = 0, number = 0, offset, used;
+    size_t length = strlen(board);
+    FILE * file;
+
+    file = fopen(name, "r");
+    if (file == NULL) {
+        fprintf(stderr, "wire: can't open %s\n", name);
+        return false;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        number++;
+        if ((sscanf(line, "%7s%n", kind, &offset) != 1) || (kind[0] == '#')) {
+            continue;
+        }
+        if (strcmp(kind, "net") == 0) {
+            /* The first word after the keyword is the name of the net */
+            if ((nets >= WIRE_NETS) || (sscanf(&line[offset], "%63s%n", endpoint, &used) != 1)) {
+                break;
+            }
+            offset += used;
+            while (sscanf(&line[offset], "%63s%n", endpoint, &used) == 1) {
+                uint8_t port, bit;
+                offset += used;
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.')) {
+                    if (!GpioParseName(&endpoint[length + 1], &port, &bit)) {
+                        fprintf(stderr, "wire: unknown terminal %s in line %d of %s\n", endpoint,
+                                number, name);
+                        fclose(file);
+                        return false;
+                    }
+                    gpio_nets[port * SOC_GPIO_BITS + bit] = nets;
+                }
+            }
+            nets++;
+        } else if (strcmp(kind, "link") == 0) {
+            if (links >= WIRE_LINKS) {
+                break;
+            }
+            for (int side = 0; side < 2; side++) {
+                unsigned int port;
+                if (sscanf(&line[offset], "%63s%n", endpoint, &used) != 1) {
+                    break;
+                }
+                offset += used;
+                if ((strncmp(endpoint, board, length) == 0) && (endpoint[length] == '.') &&
+                    (sscanf(&endpoint[length + 1], "sci%u", &port) == 1) &&
+                    (port < WIRE_SCI_PORTS)) {
+                    /* The pipe 2 * link carries the data from the first to the second side */
+                    sci_links[port].transmit = 2 * links + side;
+                    sci_links[port].receive = 2 * links + 1 - side;
+                }
+            }
+            links++;
+        } else {
+            break;
+        }
+    }
+    bool valid = feof(file);
+    fclose(file);
+    if (!valid) {
+        fprintf(stderr, "wire: error in line %d of %s\n", number, name);
+    }
+    return valid;
+}
+
+static void WireOpen(void) {
+    char const * netlist = getenv(WIRE_NETLIST_ENVIRONMENT);
+    char const * board = getenv(WIRE_BOARD_ENVIRONMENT);
+    char const * name = getenv(WIRE_BUS_ENVIRONMENT);
+    static pthread_t thread;
+    void * memory;
+    int file;
+
+    memset(gpio_nets, WIRE_NONE, sizeof(gpio_nets));
+    for (int port = 0; port < WIRE_SCI_PORTS; port++) {
+        sci_links[port].transmit = WIRE_NONE;
+        sci_links[port].receive = WIRE_NONE;
+    }
+    if ((netlist == NULL) || (board == NULL) || JournalReplaying() ||
+        !WireLoadNetlist(netlist, board)) {
+        return;
+    }
+
+    file = shm_open(name ? name : WIRE_BUS_DEFAULT, O_RDWR | O_CREAT, 0600);
+    if (file < 0) {
+        fprintf(stderr, "wire: can't open the shared memory\n");
+        return;
+    }
+    /* Every connected program keeps a shared lock on the object until it ends, even if it crashes,
+     * so the program that gets the exclusive lock is the first of the session and it clears the
+     * states left by the previous one. The others wait in the shared lock until it is cleared */
+    if ((flock(file, LOCK_EX | LOCK_NB) == 0) && (ftruncate(file, 0) != 0)) {
+        fprintf(stderr, "wire: can't clear the shared memory\n");
+    }
+    if ((ftruncate(file, sizeof(struct wire_bus_s)) != 0) || (flock(file, LOCK_SH) != 0)) {
+        fprintf(stderr, "wire: can't open the shared memory\n");
+        close(file);
+        return;
+    }
+    memory = mmap(NULL, sizeof(struct wire_bus_s), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (memory == MAP_FAILED) {
+        close(file);
+        return;
+    }
+    bus = memory;
+    pthread_create(&thread, NULL, WireThread, NULL);
+}
+
+static void WireNotify(void) {
+    __atomic_add_fetch(&bus->generation, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&bus->waiters, __ATOMIC_SEQ_CST)) {
+        syscall(SYS_futex, &bus->generation, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+static void * WireThread(void * _) {
+    uint32_t generation;
+    bool refresh;
+
+    while (true) {
+        generation = __atomic_load_n(&bus->generation, __ATOMIC_SEQ_CST);
+        refresh = __atomic_exchange_n(&wire_refresh, false, __ATOMIC_ACQUIRE);
+
+        for (int index = 0; index < SOC_GPIO_PORTS * SOC_GPIO_BITS; index++) {
+            uint8_t port = index / SOC_GPIO_BITS;
+            uint8_t bit = index % SOC_GPIO_BITS;
+            /* The inputs take the state of the net when configured and later only on its changes */
+            if ((gpio_nets[index] != WIRE_NONE) && !GpioIsOutput(port, bit) &&
+                (refresh || (bus->nets[gpio_nets[index]] != gpio_levels[index]))) {
+                gpio_levels[index] = bus->nets[gpio_nets[index]];
+                GpioInjectState(port, bit, gpio_levels[index]);
+            }
+        }
+        for (int port = 0; port < WIRE_SCI_PORTS; port++) {
+            if (WireSciLinked(port)) {
+                bool writable = sci_links[port].blocked && WireSciSpace(port);
+                if (writable) {
+                    sci_links[port].blocked = false;
+                }
+                if (writable || WireSciPending(port)) {
+                    SciInjectEvent(port);
+                }
+            }
+        }
+
+        __atomic_add_fetch(&bus->waiters, 1, __ATOMIC_SEQ_CST);
+        syscall(SYS_futex, &bus->generation, FUTEX_WAIT, generation, NULL, NULL, 0);
+        __atomic_sub_fetch(&bus->waiters, 1, __ATOMIC_SEQ_CST);
+    }
+    return NULL;
+}
+
+/* === Public function implementation ========================================================== */
+
+void WireStart(void) {
+    pthread_once(&wire_once, WireOpen);
+}
+
+void WireGpio(uint8_t port, uint8_t bit, bool state) {
+    uint8_t net;
+
+    WireStart();
+    net = gpio_nets[port * SOC_GPIO_BITS + bit];
+    if (bus && (net != WIRE_NONE) && (bus->nets[net] != state)) {
+        gpio_levels[port * SOC_GPIO_BITS + bit] = state;
+        bus->nets[net] = state;
+        WireNotify();
+    }
+}
+
+void WireRefresh(void) {
+    WireStart();
+    if (bus) {
+        __atomic_store_n(&wire_refresh, true, __ATOMIC_RELEASE);
+        WireNotify();
+    }
+}
+
+bool WireSciLinked(uint8_t port) {
+    WireStart();
+    return bus && (port < WIRE_SCI_PORTS) && (sci_links[port].transmit != WIRE_NONE);
+}
+
+uint32_t WireSciPending(uint8_t port) {
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].receive];
+
+    return __atomic_load_n(&pipe->head, __ATOMIC_ACQUIRE) - pipe->tail;
+}
+
+uint32_t WireSciSpace(uint8_t port) {
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].transmit];
+
+    return WIRE_PIPE_SIZE - (pipe->head - __atomic_load_n(&pipe->tail, __ATOMIC_ACQUIRE));
+}
+
+uint16_t WireSciSend(uint8_t port, void const * data, uint16_t size) {
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].transmit];
+    uint32_t space = WireSciSpace(port);
+    uint32_t head = pipe->head;
+
+    if (size > space) {
+        size = space;
+        sci_links[port].blocked = true;
+    }
+    for (uint16_t index = 0; index < size; index++) {
+        pipe->data[(head + index) & (WIRE_PIPE_SIZE - 1)] = ((uint8_t const *)data)[index];
+    }
+    if (size) {
+        __atomic_store_n(&pipe->head, head + size, __ATOMIC_RELEASE);
+        WireNotify();
+    }
+    return size;
+}
+
+uint16_t WireSciReceive(uint8_t port, void * data, uint16_t size) {
+    struct wire_pipe_s * pipe = &bus->pipes[sci_links[port].receive];
+    uint32_t pending = WireSciPending(port);
+    uint32_t tail = pipe->tail;
+
+    if (size > pending) {
+        size = pending;
+    }
+    for (uint16_t index = 0; index < size; index++) {
+        ((uint8_t *)data)[index] = pipe->data[(tail + index) & (WIRE_PIPE_SIZE - 1)];
+    }
+    if (size) {
+        __atomic_store_n(&pipe->tail, tail + size, __ATOMIC_RELEASE);
+        WireNotify();
+    }
+    return size;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
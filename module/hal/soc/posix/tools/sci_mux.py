@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Multiplexer of the serial ports of the emulated posix board
+
+Connects to several serial ports exported by the posix board with the MUJU_SCI0..3 environment
+variables and shows the received data as lines tagged with the time and the name of the port, so
+the traffic of all the ports can be followed in a single terminal or saved to a log file. The lines
+typed on the standard input are sent to the selected port, a line with @name selects another one.
+
+    MUJU_SCI0=unix:/tmp/sci0 MUJU_SCI1=tcp:5001 ./build/bin/project.elf &
+    sci_mux.py unix:/tmp/sci0 console=tcp:5001 --log traffic.log
+    sci_mux.py /dev/pts/7 /dev/pts/8
+"""
+
+import argparse
+import os
+import selectors
+import socket
+import sys
+import termios
+import time
+import tty
+
+
+class Port:
+    """Connection with one serial port of the board"""
+
+    def __init__(self, name, endpoint):
+        self.name = name
+        self.endpoint = endpoint
+        self.pending = b""
+        if endpoint.startswith("unix:"):
+            self.socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            self.socket.connect(endpoint[5:])
+            self.handle = self.socket.fileno()
+        elif endpoint.startswith("tcp:"):
+            host, _, port = endpoint[4:].rpartition(":")
+            self.socket = socket.create_connection((host or "127.0.0.1", int(port)))
+            self.handle = self.socket.fileno()
+        else:
+            self.socket = None
+            self.handle = os.open(endpoint, os.O_RDWR | os.O_NOCTTY)
+            tty.setraw(self.handle, termios.TCSANOW)
+
+    def read(self):
+        """Returns the received data, an empty result when the board closed the port"""
+        try:
+            return os.read(self.handle, 4096)
+        except OSError:
+            return b""
+
+    def write(self, data):
+        """Sends the data to the board"""
+        while data:
+            data = data[os.write(self.handle, data) :]
+
+    def lines(self, data):
+        """Splits the received data in complete lines, keeping the incomplete one for later"""
+        self.pending += data
+        *lines, self.pending = self.pending.split(b"\n")
+        return lines
+
+    def close(self):
+        """Closes the connection and returns the incomplete line if any"""
+        if self.socket:
+            self.socket.close()
+        else:
+            os.close(self.handle)
+        return [self.pending] if self.pending else []
+
+
+def parse_port(index, argument):
+    """Splits an argument with the optional name of the port and the endpoint"""
+    name, separator, endpoint = argument.partition("=")
+    if not separator or name.startswith(("/", "unix:", "tcp:")):
+        return f"sci{index}", argument
+    return name, endpoint
+
+
+def show(outputs, start, port, lines):
+    """Writes the lines received from a port tagged with the time and the port name"""
+    for line in lines:
+        text = line.rstrip(b"\r").decode("utf-8", errors="replace")
+        for output in outputs:
+            output.write(f"{time.monotonic() - start:10.3f} {port.name:>8} | {text}\n")
+            output.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "ports",
+        nargs="+",
+        help="[name=]unix:/path, [name=]tcp:[host:]port or pty device",
+    )
+    parser.add_argument("-l", "--log", help="file to save a copy of the received lines")
+    parser.add_argument(
+        "-q", "--quiet", action="store_true", help="do not show the received lines"
+    )
+    arguments = parser.parse_args()
+
+    ports = []
+    for index, argument in enumerate(arguments.ports):
+        name, endpoint = parse_port(index, argument)
+        try:
+            ports.append(Port(name, endpoint))
+        except OSError as error:
+            sys.exit(f"{name}: unable to open {endpoint}: {error.strerror}")
+
+    log = open(arguments.log, "w", encoding="utf-8") if arguments.log else None
+    outputs = ([] if arguments.quiet else [sys.stdout]) + ([log] if log else [])
+
+    selector = selectors.DefaultSelector()
+    for port in ports:
+        selector.register(port.handle, selectors.EVENT_READ, port)
+    selector.register(sys.stdin.fileno(), selectors.EVENT_READ, None)
+
+    start = time.monotonic()
+    selected = ports[0]
+    while ports:
+        for key, _ in selector.select():
+            port = key.data
+            if port is None:
+                line = sys.stdin.buffer.readline()
+                if not line:
+                    selector.unregister(sys.stdin.fileno())
+                elif line.startswith(b"@"):
+                    name = line[1:].strip().decode()
+                    selected = next(
+                        (port for port in ports if port.name == name), selected
+                    )
+                    sys.stderr.write(f"sending to {selected.name}\n")
+                elif selected in ports:
+                    selected.write(line)
+                continue
+
+            data = port.read()
+            if data:
+                show(outputs, start, port, port.lines(data))
+            else:
+                selector.unregister(port.handle)
+                show(outputs, start, port, port.close())
+                ports.remove(port)
+                sys.stderr.write(f"{port.name}: closed by the board\n")
+
+    if log:
+        log.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -37,6 +37,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ================================================================ */
 
 #include "hal_pin.h"
+#include "soc_pinmux.h"
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -47,6 +47,8 @@ SPDX-License-Identifier: MIT
 #include TO_STR(HAL_CONFIG_FILE)
 #endif
 
+#include "hal_hooks.h"
+
 /* === Macros definitions ====================================================================== */
 
 /**
@@ -93,13 +95,16 @@ static GPIO_TypeDef * const gpio_ports[] = {GPIOA, GPIOB, GPIOC, GPIOD};
 /* === Private function implementation ========================================================= */
 
 static void GpioHandleEvent(uint8_t index) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_GPIO + index);
     event_handler_t descriptor = &event_handlers[index];
     SET_BIT(EXTI->PR, 1 << index);
     bool rissing = GpioGetState(descriptor->gpio);
 
     if (descriptor->handler != NULL) {
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_GPIO + index);
         descriptor->handler(descriptor->gpio, rissing, descriptor->object);
     }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_GPIO + index);
 }
 
 /* === Public function implementation ========================================================== */
@@ -47,6 +47,8 @@ SPDX-License-Identifier: MIT
 #include TO_STR(HAL_CONFIG_FILE)
 #endif
 
+#include "hal_hooks.h"
+
 /* === Macros definitions ====================================================================== */
 
 /**
@@ -65,6 +67,10 @@ struct hal_sci_s {
     USART_TypeDef * port; /**< Pointer to the memory area with the serial port registers */
     IRQn_Type interupt;   /**< Interrupt number corresponding to the serial port */
     uint8_t index;        /**< Numeric index of serial port */
+    uint8_t txd_signal;   /**< Signal of the transmission line in the pin functions database */
+    uint8_t rxd_signal;   /**< Signal of the reception line in the pin functions database */
+    uint8_t remap_shift;  /**< Position of the serial port remap field in AFIO_MAPR register */
+    uint32_t remap_mask;  /**< Mask of the serial port remap field in AFIO_MAPR register */
 };
 
 /**
@@ -80,31 +86,22 @@ typedef struct event_handler_s {
 /* === Private function declarations ===========================================================  */
 
 /**
- * @brief Function to validate and configurate chip pins used by serial port UART1
- *
- * @param   pins    Pointer to structure with chip pins asigned to serial port
- * @return  true    The configuration is valid and has been applied
- * @return  false   The configuration is invalid and has not been applied
- */
-static bool ConfigPinsUart1(hal_sci_pins_t pins);
-
-/**
- * @brief Function to validate and configurate chip pins used by serial port USART2
+ * @brief Function to configure a chip pin as output of a peripheral or as input
  *
- * @param   pins    Pointer to structure with chip pins asigned to serial port
- * @return  true    The configuration is valid and has been applied
- * @return  false   The configuration is invalid and has not been applied
+ * @param   pin     Pointer to the structure with the chip pin descriptor
+ * @param   output  The pin is driven by the peripheral
  */
-static bool ConfigPinsUsart2(hal_sci_pins_t pins);
+static void ConfigPinMode(hal_chip_pin_t pin, bool output);
 
 /**
- * @brief Function to validate and configurate chip pins used by serial port USART3
+ * @brief Function to validate and configurate chip pins used by a serial port
  *
+ * @param   sci     Pointer to the structure with the serial port descriptor
  * @param   pins    Pointer to structure with chip pins asigned to serial port
  * @return  true    The configuration is valid and has been applied
  * @return  false   The configuration is invalid and has not been applied
  */
-static bool ConfigPinsUsart3(hal_sci_pins_t pins);
+static bool ConfigPins(hal_sci_t sci, hal_sci_pins_t pins);
 
 /**
  * @brief Function to encode serial port line parameters as bits required by control register
@@ -132,16 +129,37 @@ static void SciHandleEvent(hal_sci_t sci);
  */
 
 /** Constant to define serial port 1 */
-const hal_sci_t HAL_SCI_USART1 =
-    &(struct hal_sci_s){.port = USART1, .interupt = USART1_IRQn, .index = 0};
+const hal_sci_t HAL_SCI_USART1 = &(struct hal_sci_s){
+    .port = USART1,
+    .interupt = USART1_IRQn,
+    .index = 0,
+    .txd_signal = SOC_SIGNAL_USART1_TX,
+    .rxd_signal = SOC_SIGNAL_USART1_RX,
+    .remap_shift = AFIO_MAPR_USART1_REMAP_Pos,
+    .remap_mask = AFIO_MAPR_USART1_REMAP_Msk,
+};
 
 /** Constant to define serial port 2 */
-const hal_sci_t HAL_SCI_USART2 =
-    &(struct hal_sci_s){.port = USART2, .interupt = USART2_IRQn, .index = 1};
+const hal_sci_t HAL_SCI_USART2 = &(struct hal_sci_s){
+    .port = USART2,
+    .interupt = USART2_IRQn,
+    .index = 1,
+    .txd_signal = SOC_SIGNAL_USART2_TX,
+    .rxd_signal = SOC_SIGNAL_USART2_RX,
+    .remap_shift = AFIO_MAPR_USART2_REMAP_Pos,
+    .remap_mask = AFIO_MAPR_USART2_REMAP_Msk,
+};
 
 /** Constant to define serial port 3 */
-const hal_sci_t HAL_SCI_USART3 =
-    &(struct hal_sci_s){.port = USART3, .interupt = USART3_IRQn, .index = 2};
+const hal_sci_t HAL_SCI_USART3 = &(struct hal_sci_s){
+    .port = USART3,
+    .interupt = USART3_IRQn,
+    .index = 2,
+    .txd_signal = SOC_SIGNAL_USART3_TX,
+    .rxd_signal = SOC_SIGNAL_USART3_RX,
+    .remap_shift = AFIO_MAPR_USART3_REMAP_Pos,
+    .remap_mask = AFIO_MAPR_USART3_REMAP_Msk,
+};
 
 /** @} End of group stmf32f1xx */
 
@@ -159,114 +177,47 @@ UART_HandleTypeDef usart_handlers[3];
 
 /* === Private function implementation ========================================================= */
 
-static bool ConfigPinsUart1(hal_sci_pins_t pins) {
-    GPIO_InitTypeDef pin_config = {0};
-    uint8_t option = 0;
-    bool result = false;
-
-    if ((pins->txd_pin == HAL_PIN_PA9) && (pins->rxd_pin == HAL_PIN_PA10)) {
-        option = 1;
-    } else if ((pins->txd_pin == HAL_PIN_PB6) && (pins->rxd_pin == HAL_PIN_PB7)) {
-        option = 2;
-    }
-
-    if (option != 0) {
-        __HAL_RCC_USART1_CLK_ENABLE();
-        if (option == 1) {
-            __HAL_RCC_GPIOA_CLK_ENABLE();
-            __HAL_AFIO_REMAP_USART1_DISABLE();
-        } else {
-            __HAL_RCC_GPIOB_CLK_ENABLE();
-            __HAL_AFIO_REMAP_USART1_ENABLE();
-        }
+static void ConfigPinMode(hal_chip_pin_t pin, bool output) {
+    GPIO_TypeDef * gpio = (GPIO_TypeDef *)(GPIOA_BASE + pin->port * (GPIOB_BASE - GPIOA_BASE));
+    GPIO_InitTypeDef pin_config = {
+        .Pin = 1 << pin->pin,
+        .Mode = output ? GPIO_MODE_AF_PP : GPIO_MODE_INPUT,
+        .Pull = GPIO_NOPULL,
+        .Speed = GPIO_SPEED_FREQ_HIGH,
+    };
+
+    SET_BIT(RCC->APB2ENR, RCC_APB2ENR_IOPAEN << pin->port);
+    HAL_GPIO_Init(gpio, &pin_config);
+}
 
-        pin_config.Mode = GPIO_MODE_AF_PP;
-        pin_config.Speed = GPIO_SPEED_FREQ_HIGH;
-        if (option == 1) {
-            pin_config.Pin = GPIO_PIN_9;
-            HAL_GPIO_Init(GPIOA, &pin_config);
-        } else {
-            pin_config.Pin = GPIO_PIN_6;
-            HAL_GPIO_Init(GPIOB, &pin_config);
-        }
+static bool ConfigPins(hal_sci_t sci, hal_sci_pins_t pins) {
+    uint8_t remap = ChipPinFindFunction(pins->txd_pin, sci->txd_signal);
+    bool result = false;
 
-        pin_config.Mode = GPIO_MODE_INPUT;
-        pin_config.Pull = GPIO_NOPULL;
-        if (option == 1) {
-            pin_config.Pin = GPIO_PIN_10;
-            HAL_GPIO_Init(GPIOA, &pin_config);
-        } else {
-            pin_config.Pin = GPIO_PIN_7;
-            HAL_GPIO_Init(GPIOB, &pin_config);
+    /* Both lines are routed by the same remap field, so they must be pins of the same option */
+    if ((remap != HAL_PIN_NO_FUNCTION) &&
+        (remap == ChipPinFindFunction(pins->rxd_pin, sci->rxd_signal))) {
+        switch (sci->index) {
+        case 0:
+            __HAL_RCC_USART1_CLK_ENABLE();
+            break;
+        case 1:
+            __HAL_RCC_USART2_CLK_ENABLE();
+            break;
+        case 2:
+            __HAL_RCC_USART3_CLK_ENABLE();
+            break;
         }
+        __HAL_RCC_AFIO_CLK_ENABLE();
+        AFIO_REMAP_PARTIAL((uint32_t)remap << sci->remap_shift, sci->remap_mask);
 
+        ConfigPinMode(pins->txd_pin, true);
+        ConfigPinMode(pins->rxd_pin, false);
         result = true;
     }
     return result;
 }
 
-static bool ConfigPinsUsart2(hal_sci_pins_t pins) {
-    /*
-     * U2_TXD = (P1_15: F1), (P2_10: F2), (P7_1: F6), (PA_1: F3)
-     * U2_RXD = (P1_16: F1), (P2_11: F2), (P7_2: F6), (PA_2: F3)
-     */
-    // uint8_t txd_function = 0xFF;
-    // uint8_t rxd_function = 0xFF;
-    bool result = false;
-
-    // if (pins->txd_pin == HAL_PIN_P1_15) {
-    //     txd_function = 1;
-    // } else if (pins->txd_pin == HAL_PIN_P2_10) {
-    //     txd_function = 2;
-    // } else if (pins->txd_pin == HAL_PIN_P7_1) {
-    //     txd_function = 6;
-    // }
-
-    // if (pins->rxd_pin == HAL_PIN_P1_16) {
-    //     rxd_function = 1;
-    // } else if (pins->rxd_pin == HAL_PIN_P2_11) {
-    //     rxd_function = 2;
-    // } else if (pins->rxd_pin == HAL_PIN_P7_2) {
-    //     rxd_function = 6;
-    // }
-
-    // if ((txd_function != 0xFF) && (rxd_function != 0xFF)) {
-    //     ChipPinSetFunction(pins->txd_pin, txd_function, false, false);
-    //     ChipPinSetFunction(pins->rxd_pin, rxd_function, true, false);
-    //     result = true;
-    // }
-    return result;
-}
-
-static bool ConfigPinsUsart3(hal_sci_pins_t pins) {
-    /*
-     * U2_TXD = (P2_3: F2), (P4_1: F6), (P9_3: F7), (PF_2: F1)
-     * U2_RXD = (P2_4: F2), (P4_2: F6), (P9_4: F7), (PF_3: F1)
-     */
-    // uint8_t txd_function = 0xFF;
-    // uint8_t rxd_function = 0xFF;
-    bool result = false;
-
-    // if (pins->txd_pin == HAL_PIN_P2_3) {
-    //     txd_function = 2;
-    // } else if (pins->txd_pin == HAL_PIN_P4_1) {
-    //     txd_function = 6;
-    // }
-
-    // if (pins->rxd_pin == HAL_PIN_P2_4) {
-    //     rxd_function = 2;
-    // } else if (pins->rxd_pin == HAL_PIN_P4_2) {
-    //     rxd_function = 6;
-    // }
-
-    // if ((txd_function != 0xFF) && (rxd_function != 0xFF)) {
-    //     ChipPinSetFunction(pins->txd_pin, txd_function, false, false);
-    //     ChipPinSetFunction(pins->rxd_pin, rxd_function, true, false);
-    //     result = true;
-    // }
-    return result;
-}
-
 static bool LineEncodeBits(hal_sci_line_t line, UART_InitTypeDef * config) {
     bool result = true;
 
@@ -303,8 +254,10 @@ static void SciHandleEvent(hal_sci_t sci) {
         event_handler_t event_handler = &event_handlers[sci->index];
         struct sci_status_s status;
 
+        HAL_HOOK_IRQ_ENTER(HAL_HOOK_SCI + sci->index);
         SciReadStatus(sci, &status);
         if (event_handler->handler) {
+            HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_SCI + sci->index);
             event_handler->handler(sci, &status, event_handler->data);
         }
 
@@ -312,6 +265,7 @@ static void SciHandleEvent(hal_sci_t sci) {
         if (__HAL_UART_GET_FLAG(handler, UART_FLAG_TXE)) {
             __HAL_UART_DISABLE_IT(handler, UART_IT_TXE);
         }
+        HAL_HOOK_IRQ_EXIT(HAL_HOOK_SCI + sci->index);
     }
 }
 
@@ -321,18 +275,7 @@ bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins) {
     bool result = false;
 
     if (sci) {
-        switch (sci->index) {
-        case 0:
-            result = ConfigPinsUart1(pins);
-            break;
-        case 1:
-            result = ConfigPinsUsart2(pins);
-            break;
-        case 2:
-            result = ConfigPinsUsart3(pins);
-            break;
-        }
-
+        result = ConfigPins(sci, pins);
         if (result) {
             UART_HandleTypeDef * handler = &usart_handlers[sci->index];
             handler->Instance = sci->port;
@@ -356,6 +299,7 @@ uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
 
         HAL_UART_Transmit(handler, (uint8_t *)data, 1, 1);
         result = 1;
+        HAL_HOOK_SCI_SEND(HAL_HOOK_SCI + sci->index, result);
 
         if ((result < size) && (event_handler->handler != NULL)) {
             UART_HandleTypeDef * handler = &usart_handlers[sci->index];
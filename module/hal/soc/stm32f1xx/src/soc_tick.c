@@ -36,6 +36,8 @@ SPDX-License-Identifier: MIT
 
 #include "soc_tick.h"
 #include "stm32f1xx_hal.h"
+#include "hal_cycles.h"
+#include "hal_hooks.h"
 
 /* === Macros definitions ====================================================================== */
 
@@ -83,9 +85,15 @@ void TickStart(hal_tick_event_t handler, void * object, uint32_t period) {
 }
 
 void SysTick_Handler(void) {
+    HAL_HOOK_IRQ_ENTER(HAL_HOOK_TICK);
+    /* The counter is reloaded when the interrupt is raised and it counts down at the core clock,
+     * selected by SysTick_Config, so the cycles elapsed since the event are LOAD - VAL */
+    HAL_HOOK_IRQ_EVENT(HAL_HOOK_TICK, CyclesRead() - (SysTick->LOAD - SysTick->VAL));
     if (instance->handler) {
+        HAL_HOOK_IRQ_DISPATCH(HAL_HOOK_TICK);
         instance->handler(instance->object);
     }
+    HAL_HOOK_IRQ_EXIT(HAL_HOOK_TICK);
 }
 /* === End of documentation ==================================================================== */
 
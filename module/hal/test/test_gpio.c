@@ -0,0 +1,127 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Unit tests of the gpio terminals emulated on the host
+ **
+ ** @addtogroup hal HAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "hal_gpio.h"
+#include "soc_gpio.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure to record the events received by the handler
+struct gpio_events_s {
+    uint32_t rising;  /**< Amount of rising edges received */
+    uint32_t falling; /**< Amount of falling edges received */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to count the events of a gpio terminal
+ *
+ * @param   gpio     Terminal that produced the event
+ * @param   rising   The event is a rising edge
+ * @param   object   Pointer to the structure with the counters
+ */
+static void GpioCountEvent(hal_gpio_bit_t gpio, bool rising, void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void GpioCountEvent(hal_gpio_bit_t gpio, bool rising, void * object) {
+    struct gpio_events_s * events = object;
+
+    if (rising) {
+        events->rising++;
+    } else {
+        events->falling++;
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+TEST(gpio, set_and_clear) {
+    GpioBitSet(HAL_GPIO0_1);
+    TEST_ASSERT(GpioGetState(HAL_GPIO0_1));
+    GpioBitClear(HAL_GPIO0_1);
+    TEST_ASSERT(!GpioGetState(HAL_GPIO0_1));
+    GpioSetState(HAL_GPIO0_1, true);
+    TEST_ASSERT(GpioGetState(HAL_GPIO0_1));
+}
+
+TEST(gpio, toggle) {
+    GpioBitClear(HAL_GPIO0_2);
+    GpioBitToggle(HAL_GPIO0_2);
+    TEST_ASSERT(GpioGetState(HAL_GPIO0_2));
+    GpioBitToggle(HAL_GPIO0_2);
+    TEST_ASSERT(!GpioGetState(HAL_GPIO0_2));
+}
+
+TEST(gpio, port_write_keeps_unmasked_bits) {
+    GpioPortWrite(1, 0xFF, 0x00);
+    GpioBitSet(HAL_GPIO1_7);
+    GpioPortWrite(1, 0x0F, 0x05);
+    TEST_ASSERT_EQUAL(0x85, GpioPortRead(1) & 0xFF);
+}
+
+TEST(gpio, events_follow_the_enabled_edges) {
+    struct gpio_events_s events = {0};
+
+    GpioInjectState(2, 3, false);
+    GpioSetEventHandler(HAL_GPIO2_3, GpioCountEvent, &events, true, false);
+    GpioInjectState(2, 3, true);
+    GpioInjectState(2, 3, false);
+    GpioInjectState(2, 3, true);
+    GpioSetEventHandler(HAL_GPIO2_3, NULL, NULL, false, false);
+    TEST_ASSERT_EQUAL(2, events.rising);
+    TEST_ASSERT_EQUAL(0, events.falling);
+}
+
+TEST(gpio, stuck_terminal_ignores_writes) {
+    GpioSetStuck(3, 0, true, true);
+    GpioBitClear(HAL_GPIO3_0);
+    TEST_ASSERT(GpioGetState(HAL_GPIO3_0));
+    GpioSetStuck(3, 0, false, false);
+    GpioBitClear(HAL_GPIO3_0);
+    TEST_ASSERT(!GpioGetState(HAL_GPIO3_0));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
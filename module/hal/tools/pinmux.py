@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Generator of the database with the pin functions of the peripherals of a soc
+
+Reads the description of the pins that can be connected to every peripheral signal and writes a
+header file with an enumeration of the signals and a constant table, grouped by signal, with the
+port, the pin and the function that routes the signal to every pin. Every line of the description
+has the name of a signal followed by the pins and the functions, separated with a colon:
+
+    U0_TXD      P2_0:1  P6_4:2  P9_5:7  PF_10:1
+    USART1_TX   PA9:0   PB6:1
+
+The pins are named as in the hal constants, with the port as an hexadecimal digit followed by an
+underscore or as a letter, and the lines starting with # are comments. The header is written only
+when its content changes, so the sources that include it are not rebuilt without need.
+
+    pinmux.py module/hal/soc/lpc43xx/pinmux.def build/gen/inc/soc_pinmux.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+PIN = re.compile(r"^P(?:([0-9A-F])_(\d+)|([A-K])(\d+)):(\d+)$")
+SIGNAL = re.compile(r"^[A-Z][A-Z0-9_]*$")
+
+HEADER = """/* Generated by module/hal/tools/pinmux.py from {source}, do not edit */
+
+#ifndef SOC_PINMUX_H
+#define SOC_PINMUX_H
+
+#include "hal_pin.h"
+
+//! Peripheral signals that can be routed to the chip pins
+enum soc_signal_e {{
+{signals}
+    SOC_SIGNAL_COUNT,
+}};
+
+#ifdef SOC_PINMUX_TABLE
+
+//! Functions of the chip pins grouped by signal
+static const struct hal_pin_function_s soc_pin_functions[] = {{
+{functions}
+}};
+
+//! Index of the first function of every signal, the last one is the size of the table
+static const uint8_t soc_signal_first[SOC_SIGNAL_COUNT + 1] = {{{first}}};
+
+#endif
+
+#endif /* SOC_PINMUX_H */
+"""
+
+
+def parse(filename):
+    """Returns the signals of the description with the list of pins of every one"""
+    signals = {}
+    with open(filename, "r", encoding="utf-8") as file:
+        for number, line in enumerate(file, 1):
+            fields = line.split("#", 1)[0].split()
+            if not fields:
+                continue
+            name, pins = fields[0], []
+            if not SIGNAL.match(name) or name in signals:
+                sys.exit(f"{filename}:{number}: invalid or repeated signal {name}")
+            for text in fields[1:]:
+                match = PIN.match(text)
+                if not match:
+                    sys.exit(f"{filename}:{number}: invalid pin {text}")
+                if match.group(1):
+                    port, pin = int(match.group(1), 16), int(match.group(2))
+                else:
+                    port, pin = ord(match.group(3)) - ord("A"), int(match.group(4))
+                function = int(match.group(5))
+                if function > 254 or any(item[:2] == (port, pin) for item in pins):
+                    sys.exit(f"{filename}:{number}: invalid or repeated pin {text}")
+                pins.append((port, pin, function, text.split(":")[0]))
+            signals[name] = pins
+    if len(signals) > 255 or sum(len(pins) for pins in signals.values()) > 255:
+        sys.exit(f"{filename}: too many signals or pins for the tables")
+    return signals
+
+
+def generate(source, signals):
+    """Returns the text of the header file with the database"""
+    names = [f"    SOC_SIGNAL_{name}," for name in signals]
+    functions, first = [], [0]
+    for name, pins in signals.items():
+        for port, pin, function, text in pins:
+            entry = f"{{{port}, {pin}, {function}}},"
+            functions.append(f"    {entry:<16}/* {name} = {text} */")
+        first.append(first[-1] + len(pins))
+    return HEADER.format(
+        source=source,
+        signals="\n".join(names),
+        functions="\n".join(functions) or "    {0}",
+        first=", ".join(str(index) for index in first),
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "description", help="file with the pins of every peripheral signal"
+    )
+    parser.add_argument("header", help="header file to write")
+    arguments = parser.parse_args()
+
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..")
+    source = os.path.relpath(
+        os.path.abspath(arguments.description), os.path.abspath(root)
+    )
+    text = generate(source.replace(os.sep, "/"), parse(arguments.description))
+    if os.path.exists(arguments.header):
+        with open(arguments.header, "r", encoding="utf-8") as file:
+            if file.read() == text:
+                return
+    os.makedirs(os.path.dirname(arguments.header) or ".", exist_ok=True)
+    with open(arguments.header, "w", encoding="utf-8") as file:
+        file.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,169 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+/** @file
+ ** @brief Interrupt latency and duration histograms declarations
+ **
+ ** The module is called by the interrupt hooks of the hardware abstraction layer and it keeps, for
+ ** every interrupt source, a histogram of the latency and a histogram of the duration of the
+ ** handler in cycles of the cycle counter. The latency is the time from the hardware event to the
+ ** dispatch of the registered handler. The backends that can't know when the hardware raised the
+ ** event, like the digital inputs, measure it from the entry of the interrupt handler. The
+ ** duration is the time from the dispatch to the exit of the handler. The jitter of a periodic
+ ** interrupt, like the system timer, is the spread of its latency histogram.
+ **
+ ** The times are measured with the cycle counter of the hal, that on the targets only runs after
+ ** CyclesStart, so LatencyReset must be called once before the interrupts are enabled. The event
+ ** time of the system timer is calculated from the SysTick counter, that is clocked by the core
+ ** clock as the cycle counter because SysTick_Config selects the processor clock source.
+ **
+ ** The bucket N of a histogram counts the values from 2^(N-1) to 2^N - 1 cycles, the bucket zero
+ ** counts the values equal to zero and the last bucket also counts all the greater values.
+ **
+ ** @addtogroup latency Latency
+ ** @brief Interrupt latency instrumentation
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef USE_HAL
+#include "hal_sci.h"
+#endif
+
+#if defined(POSIX)
+#include <stdio.h>
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifndef LATENCY_BUCKETS
+//! Amount of buckets of every histogram
+#define LATENCY_BUCKETS 20
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Structure with the measurements of an interrupt source
+typedef struct latency_stats_s {
+    uint16_t source;                    /**< Source of the interrupt given by the hooks */
+    uint32_t count;                     /**< Amount of dispatched events */
+    uint32_t latency_min;               /**< Minimum latency in cycles */
+    uint32_t latency_max;               /**< Maximum latency in cycles */
+    uint32_t duration_max;              /**< Maximum duration of the handler in cycles */
+    uint32_t latency[LATENCY_BUCKETS];  /**< Histogram of the latency */
+    uint32_t duration[LATENCY_BUCKETS]; /**< Histogram of the duration of the handler */
+} * latency_stats_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to store the value of the cycle counter when the hardware raised an interrupt
+ *
+ * @param  source  Source of the interrupt
+ * @param  cycles  Value of the cycle counter at the hardware event
+ */
+void LatencyEvent(uint16_t source, uint32_t cycles);
+
+/**
+ * @brief Function to store the time of the entry of an interrupt handler
+ *
+ * @param  source  Source of the interrupt
+ */
+void LatencyEnter(uint16_t source);
+
+/**
+ * @brief Function to update the latency histogram just before the dispatch of the event
+ *
+ * @param  source  Source of the interrupt
+ */
+void LatencyDispatch(uint16_t source);
+
+/**
+ * @brief Function to update the duration histogram at the exit of an interrupt handler
+ *
+ * @param  source  Source of the interrupt
+ */
+void LatencyExit(uint16_t source);
+
+/**
+ * @brief Function to get a copy of the measurements of an interrupt source
+ *
+ * The sources are numbered in the order of their first event.
+ *
+ * @param  index   Order number of the interrupt source
+ * @param  stats   Pointer to the structure to store the measurements
+ * @return true    The source exists and its measurements were copied
+ * @return false   There are not so many interrupt sources
+ */
+bool LatencyGet(uint8_t index, latency_stats_t stats);
+
+/**
+ * @brief Function to clear the measurements of all the interrupt sources
+ *
+ * @remark It also starts the cycle counter, so it must be called once before the measurements
+ */
+void LatencyReset(void);
+
+#ifdef USE_HAL
+/**
+ * @brief Function to send the histograms of all the interrupt sources through a serial port
+ *
+ * @param  sci  Pointer to the structure with the serial port descriptor
+ */
+void LatencyReport(hal_sci_t sci);
+#endif
+
+#if defined(POSIX)
+/**
+ * @brief Function to write the histograms of all the interrupt sources in a file
+ *
+ * @param  file  Stream of the file to write the report
+ */
+void LatencyReportFile(FILE * file);
+#endif
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LATENCY_H */
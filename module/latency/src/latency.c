@@ -0,0 +1,310 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Interrupt latency and duration histograms implementation
+ **
+ ** @addtogroup latency Latency
+ ** @brief Interrupt latency instrumentation
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "latency.h"
+#include "fifo.h"
+#include "hal_cycles.h"
+#include "hal_hooks.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef LATENCY_VECTORS
+//! Maximum amount of interrupt sources measured
+#define LATENCY_VECTORS 8
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the measurements and the timestamps of an interrupt source
+typedef struct latency_vector_s {
+    struct latency_stats_s stats; /**< Measurements of the interrupt source */
+    uint16_t key;                 /**< Source plus one, zero marks a free entry */
+    bool pending;                 /**< The time of the hardware event was reported */
+    bool dispatched;              /**< The event was dispatched and the handler is running */
+    uint32_t event;               /**< Value of the cycle counter at the hardware event */
+    uint32_t entry;               /**< Value of the cycle counter at the entry of the handler */
+    uint32_t dispatch;            /**< Value of the cycle counter at the dispatch of the event */
+} * latency_vector_t;
+
+//! Function used to write the lines of the report
+typedef void (*latency_output_t)(void * target, char const * line, int size);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to find the entry of an interrupt source, allocating it on the first event
+ *
+ * @param   source  Source of the interrupt
+ * @return          Pointer to the entry of the source, NULL if there are no free entries
+ */
+static latency_vector_t LatencyFind(uint16_t source);
+
+/**
+ * @brief Function to get the histogram bucket of a value
+ *
+ * @param   value   Value in cycles
+ * @return          Index of the bucket that counts the value
+ */
+static uint8_t LatencyBucket(uint32_t value);
+
+/**
+ * @brief Function to format the report with the histograms of all the sources
+ *
+ * @param   output  Function used to write every line of the report
+ * @param   target  Object sent to the output function
+ */
+static void LatencyFormat(latency_output_t output, void * target);
+
+#ifdef USE_HAL
+/**
+ * @brief Function to send a line of the report through a serial port
+ *
+ * @param   target  Pointer to the structure with the serial port descriptor
+ * @param   line    Text to send
+ * @param   size    Length of the text to send
+ */
+static void LatencySendLine(void * target, char const * line, int size);
+#endif
+
+#if defined(POSIX)
+/**
+ * @brief Function to write a line of the report in a file
+ *
+ * @param   target  Stream of the file to write the report
+ * @param   line    Text to write
+ * @param   size    Length of the text to write
+ */
+static void LatencyWriteLine(void * target, char const * line, int size);
+#endif
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Measurements of the interrupt sources
+static struct latency_vector_s vectors[LATENCY_VECTORS];
+
+//! Amount of entries allocated
+static volatile uint32_t allocated = 0;
+
+/* === Private function implementation ========================================================= */
+
+static latency_vector_t LatencyFind(uint16_t source) {
+    static volatile uint32_t const released = 0;
+    uint32_t count = FifoLoad(&allocated);
+    uint32_t index;
+
+    for (index = 0; index < count; index++) {
+        if (vectors[index].key == source + 1) {
+            return &vectors[index];
+        }
+    }
+
+    /* An interrupt source can't preempt itself, so only one allocation is made for each source.
+     * The entries are never released, so they are reserved as the elements of a queue that is
+     * never read and the counter doesn't grow when the table is full */
+    if (!FifoReserve(&allocated, &released, LATENCY_VECTORS, 1, &index)) {
+        return NULL;
+    }
+    vectors[index].stats.source = source;
+    vectors[index].stats.latency_min = UINT32_MAX;
+    vectors[index].key = source + 1;
+    return &vectors[index];
+}
+
+static uint8_t LatencyBucket(uint32_t value) {
+    uint8_t result = (value == 0) ? 0 : (32 - __builtin_clz(value));
+
+    return (result < LATENCY_BUCKETS) ? result : (LATENCY_BUCKETS - 1);
+}
+
+static void LatencyFormat(latency_output_t output, void * target) {
+    struct latency_stats_s stats;
+    char line[80];
+    char name[12];
+    int size;
+
+    size = snprintf(line, sizeof(line), "\r\n%-8s %9s %10s %10s %10s\r\n", "Source", "Count",
+                    "Lat min", "Lat max", "Dur max");
+    output(target, line, size);
+    for (uint8_t index = 0; LatencyGet(index, &stats); index++) {
+        uint8_t last = 0;
+
+        if (stats.source >= HAL_HOOK_GPIO) {
+            snprintf(name, sizeof(name), "gpio %u", stats.source - HAL_HOOK_GPIO);
+        } else if (stats.source >= HAL_HOOK_SCI) {
+            snprintf(name, sizeof(name), "sci %u", stats.source - HAL_HOOK_SCI);
+        } else {
+            snprintf(name, sizeof(name), "tick");
+        }
+        if (stats.count == 0) {
+            stats.latency_min = 0;
+        }
+        size = snprintf(line, sizeof(line), "%-8s %9lu %10lu %10lu %10lu\r\n", name,
+                        (unsigned long)stats.count, (unsigned long)stats.latency_min,
+                        (unsigned long)stats.latency_max, (unsigned long)stats.duration_max);
+        output(target, line, size);
+
+        for (uint8_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+            if (stats.latency[bucket] || stats.duration[bucket]) {
+                last = bucket;
+            }
+        }
+        for (uint8_t bucket = 0; (stats.count > 0) && (bucket <= last); bucket++) {
+            if (bucket < LATENCY_BUCKETS - 1) {
+                size = snprintf(line, sizeof(line), "   < %-10lu", 1UL << bucket);
+            } else {
+                size = snprintf(line, sizeof(line), "   >= %-9lu", 1UL << (bucket - 1));
+            }
+            size += snprintf(&line[size], sizeof(line) - size, " %24lu %10lu\r\n",
+                             (unsigned long)stats.latency[bucket],
+                             (unsigned long)stats.duration[bucket]);
+            output(target, line, size);
+        }
+    }
+}
+
+#ifdef USE_HAL
+static void LatencySendLine(void * target, char const * line, int size) {
+    while (size > 0) {
+        uint16_t sent = SciSendData(target, line, size);
+        line += sent;
+        size -= sent;
+    }
+}
+#endif
+
+#if defined(POSIX)
+static void LatencyWriteLine(void * target, char const * line, int size) {
+    fwrite(line, 1, size, target);
+}
+#endif
+
+/* === Public function implementation ========================================================== */
+
+void LatencyEvent(uint16_t source, uint32_t cycles) {
+    latency_vector_t vector = LatencyFind(source);
+
+    if (vector) {
+        vector->event = cycles;
+        vector->pending = true;
+    }
+}
+
+void LatencyEnter(uint16_t source) {
+    uint32_t now = CyclesRead();
+    latency_vector_t vector = LatencyFind(source);
+
+    if (vector) {
+        vector->entry = now;
+    }
+}
+
+void LatencyDispatch(uint16_t source) {
+    uint32_t now = CyclesRead();
+    latency_vector_t vector = LatencyFind(source);
+    uint32_t latency;
+
+    if (vector) {
+        latency = now - (vector->pending ? vector->event : vector->entry);
+        vector->pending = false;
+        vector->dispatch = now;
+        vector->dispatched = true;
+        vector->stats.count++;
+        vector->stats.latency[LatencyBucket(latency)]++;
+        if (latency < vector->stats.latency_min) {
+            vector->stats.latency_min = latency;
+        }
+        if (latency > vector->stats.latency_max) {
+            vector->stats.latency_max = latency;
+        }
+    }
+}
+
+void LatencyExit(uint16_t source) {
+    uint32_t now = CyclesRead();
+    latency_vector_t vector = LatencyFind(source);
+    uint32_t duration;
+
+    if (vector && vector->dispatched) {
+        duration = now - vector->dispatch;
+        vector->dispatched = false;
+        vector->stats.duration[LatencyBucket(duration)]++;
+        if (duration > vector->stats.duration_max) {
+            vector->stats.duration_max = duration;
+        }
+    }
+}
+
+bool LatencyGet(uint8_t index, latency_stats_t stats) {
+    uint32_t count = FifoLoad(&allocated);
+
+    if ((index >= count) || (vectors[index].key == 0)) {
+        return false;
+    }
+    memcpy(stats, &vectors[index].stats, sizeof(struct latency_stats_s));
+    return true;
+}
+
+void LatencyReset(void) {
+    CyclesStart();
+    for (int index = 0; index < LATENCY_VECTORS; index++) {
+        uint16_t source = vectors[index].stats.source;
+
+        memset(&vectors[index].stats, 0, sizeof(struct latency_stats_s));
+        vectors[index].stats.source = source;
+        vectors[index].stats.latency_min = UINT32_MAX;
+    }
+}
+
+#ifdef USE_HAL
+void LatencyReport(hal_sci_t sci) {
+    LatencyFormat(LatencySendLine, sci);
+}
+#endif
+
+#if defined(POSIX)
+void LatencyReportFile(FILE * file) {
+    LatencyFormat(LatencyWriteLine, file);
+    fflush(file);
+}
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
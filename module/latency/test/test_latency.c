@@ -0,0 +1,97 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Unit tests of the interrupt latency instrumentation on the host
+ **
+ ** @addtogroup latency Latency
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "latency.h"
+#include "hal_hooks.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to find the measurements of an interrupt source
+ *
+ * @param   source  Source of the interrupt
+ * @param   stats   Pointer to store the measurements of the source
+ * @return  true    The source has measurements
+ * @return  false   The source was never measured
+ */
+static bool LatencyFindSource(uint16_t source, latency_stats_t stats);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static bool LatencyFindSource(uint16_t source, latency_stats_t stats) {
+    for (uint8_t index = 0; LatencyGet(index, stats); index++) {
+        if (stats->source == source) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* === Public function implementation ========================================================== */
+
+TEST(latency, wide_sources_are_not_merged) {
+    /* The last terminal of the posix board with the LPC43XX profile is beyond 8 bits */
+    uint16_t gpio = HAL_HOOK_GPIO + 8 * 32 - 1;
+    struct latency_stats_s stats;
+
+    LatencyReset();
+    LatencyEnter(HAL_HOOK_TICK);
+    LatencyDispatch(HAL_HOOK_TICK);
+    LatencyExit(HAL_HOOK_TICK);
+    LatencyEnter(gpio);
+    LatencyDispatch(gpio);
+    LatencyExit(gpio);
+    LatencyEnter(gpio);
+    LatencyDispatch(gpio);
+    LatencyExit(gpio);
+
+    TEST_ASSERT(LatencyFindSource(HAL_HOOK_TICK, &stats));
+    TEST_ASSERT_EQUAL(1, stats.count);
+    TEST_ASSERT(LatencyFindSource(gpio, &stats));
+    TEST_ASSERT_EQUAL(2, stats.count);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
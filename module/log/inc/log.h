@@ -0,0 +1,210 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LOG_H
+#define LOG_H
+
+/** @file
+ ** @brief Deferred binary logging declarations
+ **
+ ** The log macros don't format any text in the target. Every call stores in a lock free ring a
+ ** record with the identifier of the format string and the raw values of the arguments, so it
+ ** can be used from tasks and interrupts with a cost of a few tens of cycles. The format strings
+ ** are placed in a section that is not loaded in the memory of the target and the identifier is
+ ** the offset of the string in that section. The records are taken from the ring by LogRead or
+ ** LogDrain, usually from a low priority task or the idle hook, and the tools/log_decode.py
+ ** script rebuilds the text on the host using the strings stored in the ELF file.
+ **
+ ** The arguments are stored as 32 bits values, so only integer, character and pointer
+ ** conversions are supported in the format strings.
+ **
+ ** @addtogroup log Log
+ ** @brief Deferred binary logging
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "fifo.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef USE_HAL
+#include "hal_sci.h"
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define LOG_LEVEL_NONE    0 //!< Level to disable all the log messages
+#define LOG_LEVEL_ERROR   1 //!< Level of the messages about errors
+#define LOG_LEVEL_WARNING 2 //!< Level of the messages about unexpected conditions
+#define LOG_LEVEL_INFO    3 //!< Level of the messages about the normal operation
+#define LOG_LEVEL_DEBUG   4 //!< Level of the messages used only for debugging
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+//! Maximum amount of arguments of a log message
+#define LOG_MAX_ARGS 8
+
+//! Byte sent at the begin of every record to resynchronize the decoder
+#define LOG_SYNC 0x7E
+
+#if defined(POSIX)
+//! Attribute to place the format strings in the section used to build the identifiers
+#define LOG_SECTION __attribute__((section("log_strings"), aligned(1)))
+//! Base address of the section with the format strings
+#define LOG_BASE ((uintptr_t)__start_log_strings)
+#elif defined(__arm__)
+#define LOG_SECTION __attribute__((section(".log_strings,\"\",%progbits @"), aligned(1)))
+#define LOG_BASE    0
+#else
+#define LOG_SECTION __attribute__((section(".log_strings,\"\",@progbits #"), aligned(1)))
+#define LOG_BASE    0
+#endif
+
+//! Macro to count the arguments of a log message
+#define LOG_COUNT(...) LOG_COUNT_(, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+//! Macro used by LOG_COUNT to select the amount of arguments
+#define LOG_COUNT_(_, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+
+//! Macro to convert the arguments of a log message to the values stored in the record
+#define LOG_ARGS(...)      LOG_ARGS_(LOG_COUNT(__VA_ARGS__), ##__VA_ARGS__)
+#define LOG_ARGS_(N, ...)  LOG_ARGS__(N, ##__VA_ARGS__)
+#define LOG_ARGS__(N, ...) LOG_ARGS_##N(__VA_ARGS__)
+#define LOG_ARGS_0()
+#define LOG_ARGS_1(A)      , LOG_VALUE(A)
+#define LOG_ARGS_2(A, ...) , LOG_VALUE(A) LOG_ARGS_1(__VA_ARGS__)
+#define LOG_ARGS_3(A, ...) , LOG_VALUE(A) LOG_ARGS_2(__VA_ARGS__)
+#define LOG_ARGS_4(A, ...) , LOG_VALUE(A) LOG_ARGS_3(__VA_ARGS__)
+#define LOG_ARGS_5(A, ...) , LOG_VALUE(A) LOG_ARGS_4(__VA_ARGS__)
+#define LOG_ARGS_6(A, ...) , LOG_VALUE(A) LOG_ARGS_5(__VA_ARGS__)
+#define LOG_ARGS_7(A, ...) , LOG_VALUE(A) LOG_ARGS_6(__VA_ARGS__)
+#define LOG_ARGS_8(A, ...) , LOG_VALUE(A) LOG_ARGS_7(__VA_ARGS__)
+#define LOG_VALUE(A)       ((uint32_t)(uintptr_t)(A))
+
+//! Macro to build the first word of a record with the format, the level and the arguments count
+#define LOG_HEADER(FORMAT, LEVEL, COUNT)                                                           \
+    ((((uint32_t)((uintptr_t)(FORMAT) - LOG_BASE)) << 8) | ((LEVEL) << 4) | (COUNT))
+
+/**
+ * @brief Macro to store a log message of a level in the ring
+ *
+ * @param  LEVEL   Level of the message
+ * @param  FORMAT  Constant string with the printf format of the message
+ */
+#define LOG_MESSAGE(LEVEL, FORMAT, ...)                                                            \
+    do {                                                                                           \
+        static char const log_format[] LOG_SECTION = FORMAT;                                       \
+        uint32_t const log_record[] = {                                                            \
+            LOG_HEADER(log_format, LEVEL, LOG_COUNT(__VA_ARGS__)) LOG_ARGS(__VA_ARGS__)};          \
+        MpscPushBatch(log_queue, log_record, sizeof(log_record) / sizeof(uint32_t));               \
+    } while (0)
+
+#if (LOG_LEVEL >= LOG_LEVEL_ERROR)
+#define LogError(FORMAT, ...) LOG_MESSAGE(LOG_LEVEL_ERROR, FORMAT, ##__VA_ARGS__)
+#else
+#define LogError(FORMAT, ...)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_WARNING)
+#define LogWarning(FORMAT, ...) LOG_MESSAGE(LOG_LEVEL_WARNING, FORMAT, ##__VA_ARGS__)
+#else
+#define LogWarning(FORMAT, ...)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_INFO)
+#define LogInfo(FORMAT, ...) LOG_MESSAGE(LOG_LEVEL_INFO, FORMAT, ##__VA_ARGS__)
+#else
+#define LogInfo(FORMAT, ...)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_DEBUG)
+#define LogDebug(FORMAT, ...) LOG_MESSAGE(LOG_LEVEL_DEBUG, FORMAT, ##__VA_ARGS__)
+#else
+#define LogDebug(FORMAT, ...)
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+//! Ring with the records of the log messages
+extern struct mpsc_s log_queue[1];
+
+#if defined(POSIX)
+//! Begin of the section with the format strings, defined by the linker
+extern char const __start_log_strings[];
+#endif
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to take the encoded records of the log messages from the ring
+ *
+ * Every record is encoded as the synchronization byte followed by the header and the arguments
+ * as 32 bits little endian values. Only complete records are copied in the buffer.
+ *
+ * @param  buffer   Pointer to the memory to store the encoded records
+ * @param  size     Size of the memory to store the encoded records
+ * @return size_t   Amount of bytes stored in the buffer
+ */
+size_t LogRead(void * buffer, size_t size);
+
+/**
+ * @brief Function to get the amount of log messages discarded with the ring full
+ *
+ * @return uint32_t Amount of words of the discarded messages
+ */
+uint32_t LogLost(void);
+
+#ifdef USE_HAL
+/**
+ * @brief Function to send the records of the log messages through a serial port
+ *
+ * The records are sent with FifoDrain, so the function never waits for the serial port and it
+ * can be called from the idle hook.
+ *
+ * @param  sci  Pointer to the structure with the serial port descriptor
+ */
+void LogDrain(hal_sci_t sci);
+#endif
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LOG_H */
@@ -0,0 +1,129 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Deferred binary logging implementation
+ **
+ ** @addtogroup log Log
+ ** @brief Deferred binary logging
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "log.h"
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE 256
+#endif
+
+//! Maximum size in bytes of an encoded record
+#define LOG_RECORD_SIZE (1 + sizeof(uint32_t) * (1 + LOG_MAX_ARGS))
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure to store the record being taken from the ring
+struct log_record_s {
+    uint32_t words[1 + LOG_MAX_ARGS]; /**< Header and arguments of the record */
+    uint8_t count;                    /**< Amount of words already taken from the ring */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to take the words of the next record from the ring
+ *
+ * @return true   The record is complete and ready to be encoded
+ * @return false  The ring is empty or a producer has not finished to write the record
+ */
+static bool LogTakeRecord(void);
+
+/* === Public variable definitions ============================================================= */
+
+_Static_assert((LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) == 0, "Log size must be a power of two");
+
+//! Memory used to store the values of the log ring
+static struct mpsc_cell_s log_cells[LOG_BUFFER_SIZE];
+
+struct mpsc_s log_queue[1] = {{.cells = log_cells, .mask = LOG_BUFFER_SIZE - 1}};
+
+/* === Private variable definitions ============================================================ */
+
+//! Record being taken from the ring
+static struct log_record_s record[1];
+
+/* === Private function implementation ========================================================= */
+
+static bool LogTakeRecord(void) {
+    uint32_t total;
+
+    if (record->count == 0) {
+        record->count = MpscPopBatch(log_queue, record->words, 1);
+        if (record->count == 0) {
+            return false;
+        }
+    }
+
+    total = 1 + (record->words[0] & 0x0F);
+    record->count += MpscPopBatch(log_queue, &record->words[record->count], total - record->count);
+    return (record->count == total);
+}
+
+/* === Public function implementation ========================================================== */
+
+size_t LogRead(void * buffer, size_t size) {
+    uint8_t * data = buffer;
+    size_t result = 0;
+
+    while (LogTakeRecord()) {
+        if (result + 1 + sizeof(uint32_t) * record->count > size) {
+            break;
+        }
+        result += FifoEncodeWords(&data[result], LOG_SYNC, record->words, record->count);
+        record->count = 0;
+    }
+    return result;
+}
+
+uint32_t LogLost(void) {
+    return log_queue->dropped;
+}
+
+#ifdef USE_HAL
+void LogDrain(hal_sci_t sci) {
+    FIFO_DRAIN_DEFINE(pending, LOG_RECORD_SIZE);
+
+    /* Every record has a synchronization byte and at least one word */
+    FifoDrain(pending, sci, LogRead,
+              (MpscCount(log_queue) + record->count) * (1 + sizeof(uint32_t)));
+}
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Decoder of the deferred binary log records
+
+Reads the records sent by the log module from a file, a serial device or the standard input and
+prints the messages using the format strings stored in the ELF file of the program.
+
+    log_decode.py build/bin/project.elf /dev/ttyUSB1
+    ./build/bin/log.out | log_decode.py build/bin/log.out
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+LOG_SYNC = 0x7E
+LOG_LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+SECTION_NAMES = (b".log_strings", b"log_strings")
+CONVERSION = re.compile(
+    r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+))?(hh|h|ll|l|j|z|t)?([diouxXcps%])"
+)
+
+
+def load_strings(filename):
+    """Returns the content of the section with the format strings of an ELF file"""
+    with open(filename, "rb") as file:
+        elf = file.read()
+
+    if elf[:4] != b"\x7fELF":
+        raise ValueError(f"{filename} is not an ELF file")
+    is_64 = elf[4] == 2
+    endian = "<" if elf[5] == 1 else ">"
+
+    if is_64:
+        (shoff,) = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x3A)
+        header = endian + "IIQQQQIIQQ"
+    else:
+        (shoff,) = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x2E)
+        header = endian + "IIIIIIIIII"
+
+    sections = [
+        struct.unpack_from(header, elf, shoff + index * shentsize)
+        for index in range(shnum)
+    ]
+    names_offset = sections[shstrndx][4]
+    for section in sections:
+        name_start = names_offset + section[0]
+        name = elf[name_start : elf.index(b"\0", name_start)]
+        if name in SECTION_NAMES:
+            return elf[section[4] : section[4] + section[5]]
+    raise ValueError(f"{filename} doesn't have a section with log strings")
+
+
+def format_message(template, arguments):
+    """Formats a message converting the 32 bits raw arguments as the printf conversions"""
+    values = iter(arguments)
+
+    def convert(match):
+        flags, width, precision, _, specifier = match.groups()
+        if specifier == "%":
+            return "%"
+        value = next(values, 0)
+        if specifier in "di" and value & 0x80000000:
+            value -= 1 << 32
+        if specifier == "p":
+            return f"0x{value:08x}"
+        if specifier == "s":
+            return f"<0x{value:08x}>"
+        if specifier == "u":
+            specifier = "d"
+        spec = (
+            "%"
+            + flags
+            + (width or "")
+            + ("." + precision if precision else "")
+            + specifier
+        )
+        return spec % value
+
+    return CONVERSION.sub(convert, template)
+
+
+def decode(strings, stream, output):
+    """Decodes the records read from a binary stream and writes the messages in the output"""
+    buffer = b""
+    while True:
+        data = stream.read(1)
+        if not data:
+            break
+        buffer += data
+        while len(buffer) >= 5:
+            if buffer[0] != LOG_SYNC:
+                buffer = buffer[1:]
+                continue
+            (header,) = struct.unpack_from("<I", buffer, 1)
+            count = header & 0x0F
+            level = (header >> 4) & 0x0F
+            offset = header >> 8
+            if (count > 8) or (level not in LOG_LEVELS) or (offset >= len(strings)):
+                buffer = buffer[1:]
+                continue
+            size = 5 + 4 * count
+            if len(buffer) < size:
+                break
+            arguments = struct.unpack_from(f"<{count}I", buffer, 5)
+            template = strings[offset : strings.index(b"\0", offset)].decode(
+                errors="replace"
+            )
+            output.write(
+                f"[{LOG_LEVELS[level]}] {format_message(template, arguments)}\n"
+            )
+            output.flush()
+            buffer = buffer[size:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="ELF file of the program that generates the log")
+    parser.add_argument(
+        "input", nargs="?", help="file or serial device with the records"
+    )
+    arguments = parser.parse_args()
+
+    strings = load_strings(arguments.elf)
+    if arguments.input:
+        with open(arguments.input, "rb", buffering=0) as stream:
+            decode(strings, stream, sys.stdout)
+    else:
+        decode(strings, sys.stdin.buffer, sys.stdout)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except (KeyboardInterrupt, BrokenPipeError):
+        pass
@@ -0,0 +1,114 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/** @file
+ ** @brief Kernel configuration of the unit tests and microbenchmarks
+ **
+ ** Configuration used by the runners of the test and bench targets when the project doesn't have
+ ** its own FreeRTOSConfig.h. It enables both allocation modes, so the dynamic and the static
+ ** constructors of the modules can be tested with the posix port of the kernel.
+ **
+ ** @addtogroup test Test
+ ** @brief Unit tests and microbenchmarks on the host
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdlib.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* clang-format off */
+
+#define configUSE_PREEMPTION                1
+#define configUSE_IDLE_HOOK                 0
+#define configUSE_TICK_HOOK                 0
+#define configCPU_CLOCK_HZ                  ((unsigned long)1000000)
+#define configTICK_RATE_HZ                  ((TickType_t)1000)
+#define configMAX_PRIORITIES                (7)
+#define configMINIMAL_STACK_SIZE            ((uint16_t)256)
+#define configTOTAL_HEAP_SIZE               ((size_t)(64 * 1024))
+#define configMAX_TASK_NAME_LEN             (16)
+#define configUSE_TRACE_FACILITY            1
+#define configUSE_16_BIT_TICKS              0
+#define configIDLE_SHOULD_YIELD             1
+#define configUSE_MUTEXES                   1
+#define configUSE_RECURSIVE_MUTEXES         1
+#define configUSE_COUNTING_SEMAPHORES       1
+#define configQUEUE_REGISTRY_SIZE           8
+#define configCHECK_FOR_STACK_OVERFLOW      0
+#define configUSE_MALLOC_FAILED_HOOK        0
+#define configUSE_CO_ROUTINES               0
+#define configSUPPORT_DYNAMIC_ALLOCATION    1
+#define configSUPPORT_STATIC_ALLOCATION     1
+#define configGENERATE_RUN_TIME_STATS       0
+
+#define configUSE_TIMERS                    1
+#define configTIMER_TASK_PRIORITY           (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH            10
+#define configTIMER_TASK_STACK_DEPTH        (configMINIMAL_STACK_SIZE * 2)
+
+#define INCLUDE_vTaskPrioritySet            1
+#define INCLUDE_uxTaskPriorityGet           1
+#define INCLUDE_vTaskDelete                 1
+#define INCLUDE_vTaskSuspend                1
+#define INCLUDE_vTaskDelayUntil             1
+#define INCLUDE_vTaskDelay                  1
+#define INCLUDE_xTaskGetSchedulerState      1
+#define INCLUDE_xTaskGetCurrentTaskHandle   1
+#define INCLUDE_xTimerPendFunctionCall      1
+
+/* A failed assertion of the kernel ends the runner, the tasks can't return to the failed test */
+#define configASSERT(x)                                                                            \
+    if ((x) == 0) {                                                                                \
+        abort();                                                                                   \
+    }
+
+/* clang-format on */
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,179 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef UNIT_TEST_H
+#define UNIT_TEST_H
+
+/** @file
+ ** @brief Unit tests and microbenchmarks declarations
+ **
+ ** Minimal framework to test the modules on the host with the posix board. The tests are defined
+ ** with the TEST macro in the test folder of every module and the microbenchmarks with the BENCH
+ ** macro in the bench folder, both are registered before main runs so they don't need a list.
+ ** The runner of the module executes all the registered tests and then all the registered
+ ** microbenchmarks, so the same program is used by the make targets test and bench.
+ **
+ ** A failed assertion ends the test at once and the runner continues with the next one. Every
+ ** microbenchmark receives the amount of iterations to execute, the runner finds an amount that
+ ** lasts long enough to be measured and reports the best time of several runs in nanoseconds and
+ ** in cycles of the host for every iteration.
+ **
+ ** @addtogroup test Test
+ ** @brief Unit tests and microbenchmarks on the host
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/**
+ * @brief Defines a test case of a group, the body of the test follows the macro
+ *
+ * @param   GROUP   Name of the group of tests, usually the module or the function under test
+ * @param   NAME    Name of the test inside the group
+ */
+#define TEST(GROUP, NAME)                                                                          \
+    static void GROUP##_##NAME##_test(void);                                                       \
+    static struct test_case_s GROUP##_##NAME##_case = {#GROUP, #NAME, GROUP##_##NAME##_test, 0};   \
+    __attribute__((constructor)) static void GROUP##_##NAME##_register(void) {                     \
+        TestRegister(&GROUP##_##NAME##_case);                                                      \
+    }                                                                                              \
+    static void GROUP##_##NAME##_test(void)
+
+/**
+ * @brief Defines a microbenchmark of a group, the body runs the measured operation the amount of
+ * times given in the iterations parameter
+ *
+ * @param   GROUP   Name of the group of microbenchmarks
+ * @param   NAME    Name of the microbenchmark inside the group
+ */
+#define BENCH(GROUP, NAME)                                                                         \
+    static void GROUP##_##NAME##_bench(uint32_t iterations);                                       \
+    static struct bench_case_s GROUP##_##NAME##_case = {#GROUP, #NAME, GROUP##_##NAME##_bench, 0}; \
+    __attribute__((constructor)) static void GROUP##_##NAME##_register(void) {                     \
+        BenchRegister(&GROUP##_##NAME##_case);                                                     \
+    }                                                                                              \
+    static void GROUP##_##NAME##_bench(uint32_t iterations)
+
+//! Prevents the compiler from removing the computation of a value not used by the benchmark
+#define BENCH_KEEP(VALUE) __asm__ volatile("" : : "g"(VALUE) : "memory")
+
+//! Ends the test as failed when the condition is false
+#define TEST_ASSERT(CONDITION)                                                                     \
+    do {                                                                                           \
+        if (!(CONDITION)) {                                                                        \
+            TestFail(__FILE__, __LINE__, "%s is false", #CONDITION);                               \
+        }                                                                                          \
+    } while (0)
+
+//! Ends the test as failed when the integer values are different
+#define TEST_ASSERT_EQUAL(EXPECTED, ACTUAL)                                                        \
+    do {                                                                                           \
+        long long expected = (long long)(EXPECTED), actual = (long long)(ACTUAL);                  \
+        if (expected != actual) {                                                                  \
+            TestFail(__FILE__, __LINE__, "%s expected %lld but was %lld", #ACTUAL, expected,       \
+                     actual);                                                                      \
+        }                                                                                          \
+    } while (0)
+
+//! Ends the test as failed when the memory blocks are different
+#define TEST_ASSERT_EQUAL_MEMORY(EXPECTED, ACTUAL, SIZE)                                           \
+    do {                                                                                           \
+        if (memcmp((EXPECTED), (ACTUAL), (SIZE)) != 0) {                                           \
+            TestFail(__FILE__, __LINE__, "%s differs from %s", #ACTUAL, #EXPECTED);                \
+        }                                                                                          \
+    } while (0)
+
+/* === Public data type declarations =========================================================== */
+
+//! Function with the body of a test
+typedef void (*test_function_t)(void);
+
+//! Function with the body of a microbenchmark
+typedef void (*bench_function_t)(uint32_t iterations);
+
+//! Structure with a registered test
+typedef struct test_case_s {
+    char const * group;          /**< Name of the group of the test */
+    char const * name;           /**< Name of the test inside the group */
+    test_function_t function;    /**< Function with the body of the test */
+    struct test_case_s * next;   /**< Next registered test */
+} * test_case_t;
+
+//! Structure with a registered microbenchmark
+typedef struct bench_case_s {
+    char const * group;          /**< Name of the group of the microbenchmark */
+    char const * name;           /**< Name of the microbenchmark inside the group */
+    bench_function_t function;   /**< Function with the body of the microbenchmark */
+    struct bench_case_s * next;  /**< Next registered microbenchmark */
+} * bench_case_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to add a test to the list executed by the runner
+ *
+ * @param   test    Descriptor of the test, it must remain valid while the program runs
+ */
+void TestRegister(test_case_t test);
+
+/**
+ * @brief Function to add a microbenchmark to the list executed by the runner
+ *
+ * @param   bench   Descriptor of the microbenchmark, it must remain valid while the program runs
+ */
+void BenchRegister(bench_case_t bench);
+
+/**
+ * @brief Function to end the running test as failed, it does not return
+ *
+ * @param   file    Source file with the failed assertion
+ * @param   line    Line of the failed assertion
+ * @param   format  Message of the failure with the format of printf
+ */
+void TestFail(char const * file, int line, char const * format, ...)
+    __attribute__((noreturn, format(printf, 3, 4)));
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* UNIT_TEST_H */
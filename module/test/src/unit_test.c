@@ -0,0 +1,345 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Unit tests and microbenchmarks runner implementation
+ **
+ ** @addtogroup test Test
+ ** @brief Unit tests and microbenchmarks on the host
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Minimum duration in nanoseconds of every measurement of a microbenchmark
+#define BENCH_DURATION 20000000ULL
+
+//! Amount of measurements of every microbenchmark, the best one is reported
+#define BENCH_SAMPLES 10
+
+//! Maximum amount of results read from the baseline file
+#define BENCH_BASELINE 256
+
+//! Format of every result in the JSON file, used to write and to read it
+#define BENCH_FORMAT "{\"name\": \"%s\", \"iterations\": %u, \"ns\": %.3f, \"cycles\": %.3f}"
+
+//! Format to read the results from the baseline file
+#define BENCH_SCAN " {\"name\": \"%63[^\"]\", \"iterations\": %u, \"ns\": %lf, \"cycles\": %lf"
+
+/* === Private data type declarations ========================================================== */
+
+//! Structure with the result of a microbenchmark
+typedef struct bench_result_s {
+    char name[64];       /**< Group and name of the microbenchmark */
+    uint32_t iterations; /**< Amount of iterations of every measurement */
+    double ns;           /**< Nanoseconds for every iteration */
+    double cycles;       /**< Host cycles for every iteration, zero if they can't be read */
+} * bench_result_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to read the monotonic clock of the host
+ *
+ * @return  Time in nanoseconds
+ */
+static uint64_t BenchTime(void);
+
+/**
+ * @brief Function to read the cycle counter of the host
+ *
+ * @return  Value of the counter, zero if the host has not an accessible cycle counter
+ */
+static uint64_t BenchCycles(void);
+
+/**
+ * @brief Function to check if a test or a microbenchmark is selected by the filter
+ *
+ * @param   group   Name of the group
+ * @param   name    Name inside the group
+ * @param   filter  Text that must be included in the group or in the name, NULL to select all
+ * @return  true    The test or microbenchmark must be executed
+ */
+static bool Selected(char const * group, char const * name, char const * filter);
+
+/**
+ * @brief Function to execute the registered tests
+ *
+ * @param   filter  Text to select the tests to execute, NULL to execute all
+ * @return          Amount of failed tests
+ */
+static int TestRunAll(char const * filter);
+
+/**
+ * @brief Function to measure a microbenchmark
+ *
+ * @param   bench   Descriptor of the microbenchmark
+ * @param   result  Structure to return the result of the measurement
+ */
+static void BenchMeasure(bench_case_t bench, bench_result_t result);
+
+/**
+ * @brief Function to read the results of a previous execution of the microbenchmarks
+ *
+ * @param   filename    File with the results in JSON format written by the runner
+ * @param   results     Vector to return the results
+ * @return              Amount of results read
+ */
+static int BenchLoad(char const * filename, struct bench_result_s results[BENCH_BASELINE]);
+
+/**
+ * @brief Function to execute the registered microbenchmarks
+ *
+ * @param   filter      Text to select the microbenchmarks to execute, NULL to execute all
+ * @param   output      File to write the results in JSON format, NULL to not save them
+ * @param   baseline    File with previous results to compare, NULL to not compare them
+ * @param   tolerance   Percent of slowdown allowed against the baseline, negative for no limit
+ * @return              Amount of microbenchmarks slower than the tolerance
+ */
+static int BenchRunAll(char const * filter, char const * output, char const * baseline,
+                       double tolerance);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! List of the registered tests in definition order
+static test_case_t tests = NULL;
+
+//! List of the registered microbenchmarks in definition order
+static bench_case_t benchs = NULL;
+
+//! Context to return to the runner when an assertion fails
+static jmp_buf test_abort;
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t BenchTime(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static uint64_t BenchCycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static bool Selected(char const * group, char const * name, char const * filter) {
+    return !filter || strstr(group, filter) || strstr(name, filter);
+}
+
+static int TestRunAll(char const * filter) {
+    int executed = 0;
+    int failed = 0;
+
+    for (test_case_t test = tests; test; test = test->next) {
+        if (Selected(test->group, test->name, filter)) {
+            executed++;
+            if (setjmp(test_abort) == 0) {
+                test->function();
+                printf("%s.%s ... ok\n", test->group, test->name);
+            } else {
+                failed++;
+            }
+        }
+    }
+    if (executed) {
+        printf("\n%d tests, %d failures\n", executed, failed);
+    }
+    return failed;
+}
+
+static void BenchMeasure(bench_case_t bench, bench_result_t result) {
+    uint64_t start, elapsed, cycles;
+    uint32_t iterations = 1;
+
+    /* The amount of iterations is doubled until a run lasts a tenth of the measurement */
+    do {
+        start = BenchTime();
+        bench->function(iterations);
+        elapsed = BenchTime() - start;
+        if (elapsed < BENCH_DURATION / 10) {
+            iterations = iterations * 2;
+        }
+    } while ((elapsed < BENCH_DURATION / 10) && (iterations < UINT32_MAX / 2));
+    if (elapsed && (elapsed < BENCH_DURATION)) {
+        uint64_t scaled = iterations * BENCH_DURATION / elapsed;
+        iterations = (scaled < UINT32_MAX) ? (uint32_t)scaled : UINT32_MAX;
+    }
+
+    snprintf(result->name, sizeof(result->name), "%s.%s", bench->group, bench->name);
+    result->iterations = iterations;
+    result->ns = 0;
+    for (int sample = 0; sample < BENCH_SAMPLES; sample++) {
+        start = BenchTime();
+        cycles = BenchCycles();
+        bench->function(iterations);
+        cycles = BenchCycles() - cycles;
+        elapsed = BenchTime() - start;
+        if ((sample == 0) || ((double)elapsed / iterations < result->ns)) {
+            result->ns = (double)elapsed / iterations;
+            result->cycles = (double)cycles / iterations;
+        }
+    }
+}
+
+static int BenchLoad(char const * filename, struct bench_result_s results[BENCH_BASELINE]) {
+    char line[256];
+    int count = 0;
+    FILE * file = fopen(filename, "r");
+
+    while (file && (count < BENCH_BASELINE) && fgets(line, sizeof(line), file)) {
+        bench_result_t result = &results[count];
+        if (sscanf(line, BENCH_SCAN, result->name, &result->iterations, &result->ns,
+                   &result->cycles) == 4) {
+            count++;
+        }
+    }
+    if (file) {
+        fclose(file);
+    }
+    return count;
+}
+
+static int BenchRunAll(char const * filter, char const * output, char const * baseline,
+                       double tolerance) {
+    static struct bench_result_s previous[BENCH_BASELINE];
+    struct bench_result_s result;
+    int known = baseline ? BenchLoad(baseline, previous) : 0;
+    int slower = 0;
+    bool first = true;
+    FILE * file = NULL;
+
+    if (output) {
+        file = fopen(output, "w");
+        if (!file) {
+            fprintf(stderr, "unable to write the results to %s\n", output);
+        }
+    }
+    for (bench_case_t bench = benchs; bench; bench = bench->next) {
+        if (!Selected(bench->group, bench->name, filter)) {
+            continue;
+        }
+        if (first) {
+            printf("%-36s%12s%12s%12s%10s\n", "Benchmark", "Iterations", "ns/op", "cycles/op",
+                   "Change");
+        }
+        BenchMeasure(bench, &result);
+        printf("%-36s%12u%12.2f%12.2f", result.name, result.iterations, result.ns, result.cycles);
+        for (int index = 0; index < known; index++) {
+            if (strcmp(previous[index].name, result.name) == 0 && previous[index].ns > 0) {
+                double change = 100.0 * (result.ns - previous[index].ns) / previous[index].ns;
+                printf("%+9.1f%%", change);
+                if ((tolerance >= 0) && (change > tolerance)) {
+                    printf("  slower");
+                    slower++;
+                }
+            }
+        }
+        printf("\n");
+        if (file) {
+            fprintf(file, first ? "[\n    " BENCH_FORMAT : ",\n    " BENCH_FORMAT, result.name,
+                    result.iterations, result.ns, result.cycles);
+        }
+        first = false;
+    }
+    if (file) {
+        fprintf(file, "%s]\n", first ? "[\n" : "\n");
+        fclose(file);
+    }
+    return slower;
+}
+
+/* === Public function implementation ========================================================== */
+
+void TestRegister(test_case_t test) {
+    /* The constructors run in reverse order of definition, adding at the head keeps it */
+    test->next = tests;
+    tests = test;
+}
+
+void BenchRegister(bench_case_t bench) {
+    bench->next = benchs;
+    benchs = bench;
+}
+
+void TestFail(char const * file, int line, char const * format, ...) {
+    va_list arguments;
+
+    printf("%s:%d: FAIL: ", file, line);
+    va_start(arguments, format);
+    vprintf(format, arguments);
+    va_end(arguments);
+    printf("\n");
+    longjmp(test_abort, 1);
+}
+
+int main(int argc, char * argv[]) {
+    char const * filter = NULL;
+    char const * output = NULL;
+    char const * baseline = NULL;
+    double tolerance = -1;
+    int failed;
+
+    for (int index = 1; index < argc; index++) {
+        if ((strcmp(argv[index], "--filter") == 0) && (index + 1 < argc)) {
+            filter = argv[++index];
+        } else if ((strcmp(argv[index], "--json") == 0) && (index + 1 < argc)) {
+            output = argv[++index];
+        } else if ((strcmp(argv[index], "--baseline") == 0) && (index + 1 < argc)) {
+            baseline = argv[++index];
+        } else if ((strcmp(argv[index], "--tolerance") == 0) && (index + 1 < argc)) {
+            tolerance = atof(argv[++index]);
+        } else {
+            fprintf(stderr, "usage: %s [--filter text] [--json results] [--baseline results]"
+                            " [--tolerance percent]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    failed = TestRunAll(filter);
+    failed += BenchRunAll(filter, output, baseline, tolerance);
+    return failed ? 1 : 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
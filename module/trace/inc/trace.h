@@ -0,0 +1,187 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/** @file
+ ** @brief Event trace recorder declarations
+ **
+ ** The recorder stores the events of the kernel and of the hardware abstraction layer in a lock
+ ** free ring located in RAM, so it can be enabled in the production images. Every event uses two
+ ** words: the value of the cycle counter when the event happened and a word with the type of the
+ ** event in the upper byte and the data of the event in the remaining 24 bits. The events are
+ ** taken from the ring by TraceRead, TraceDrain or TraceDrainFile, usually from a low priority
+ ** task or the idle hook, and the tools/trace_convert.py script rebuilds the timeline on the host
+ ** in the JSON format used by Perfetto and the Chrome trace viewer.
+ **
+ ** This header is included from the kernel configuration file, so it only declares the functions
+ ** called by the hooks and must not include the headers of the kernel.
+ **
+ ** @addtogroup trace Trace
+ ** @brief Event trace recorder
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef USE_HAL
+#include "hal_sci.h"
+#endif
+
+#if defined(POSIX)
+#include <stdio.h>
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Byte sent at the begin of every event to resynchronize the decoder
+#define TRACE_SYNC                0x7E
+
+#define TRACE_START               0x01 //!< Recorder started, data is the time base in kHz
+#define TRACE_TASK_CREATE         0x02 //!< Task created, data is number << 8 | priority
+#define TRACE_TASK_NAME           0x03 //!< Part of a task name, data is number << 16 | 2 chars
+#define TRACE_TASK_SWITCHED_IN    0x04 //!< Task selected to run, data is the task number
+#define TRACE_TASK_READY          0x05 //!< Task moved to ready state, data is the task number
+#define TRACE_TASK_DELETE         0x06 //!< Task deleted, data is the task number
+#define TRACE_PRIORITY_INHERIT    0x07 //!< Mutex holder raised, data is number << 8 | priority
+#define TRACE_PRIORITY_DISINHERIT 0x08 //!< Mutex holder restored, data is number << 8 | priority
+#define TRACE_QUEUE_CREATE        0x09 //!< Queue created, data is number << 8 | type
+#define TRACE_QUEUE_SEND          0x0A //!< Item sent to a queue, data is the queue number
+#define TRACE_QUEUE_RECEIVE       0x0B //!< Item received from a queue, data is the queue number
+#define TRACE_QUEUE_BLOCK_SEND    0x0C //!< Task blocked on a full queue, data is the queue number
+#define TRACE_QUEUE_BLOCK_RECEIVE 0x0D //!< Task blocked on an empty queue, data is the queue number
+#define TRACE_ISR_ENTER           0x10 //!< Interrupt handler started, data is the source
+#define TRACE_ISR_EXIT            0x11 //!< Interrupt handler finished, data is the source
+#define TRACE_SCI_SEND            0x20 //!< Data sent to a serial port, data is source << 16 | size
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to enable the recorder
+ *
+ * It must be called before the creation of the tasks and queues to record their names and
+ * numbers, the events generated while the recorder is disabled are discarded.
+ */
+void TraceStart(void);
+
+/**
+ * @brief Function to disable the recorder, keeping the events already stored in the ring
+ *
+ * It is useful to freeze the history of events when a fault is detected.
+ */
+void TraceStop(void);
+
+/**
+ * @brief Function to store an event in the ring
+ *
+ * It can be called from tasks and interrupts of any priority.
+ *
+ * @param  type  Type of the event, one of the TRACE_* constants or a value from 0x80 for the
+ *               events defined by the application
+ * @param  data  Data of the event, only the lower 24 bits are stored
+ */
+void TraceEvent(uint8_t type, uint32_t data);
+
+/**
+ * @brief Function to store the events of the creation of a task
+ *
+ * @param  number    Number assigned by the kernel to the task
+ * @param  priority  Priority of the task
+ * @param  name      Name of the task
+ */
+void TraceTaskCreate(uint32_t number, uint32_t priority, char const * name);
+
+/**
+ * @brief Function to assign a number to a new queue and store the event of its creation
+ *
+ * @param  type      Type of the queue assigned by the kernel
+ * @return uint32_t  Number assigned to the queue
+ */
+uint32_t TraceQueueCreate(uint8_t type);
+
+/**
+ * @brief Function to take the encoded events from the ring
+ *
+ * Every event is encoded as the synchronization byte followed by the timestamp and the word with
+ * the type and data as 32 bits little endian values.
+ *
+ * @param  buffer   Pointer to the memory to store the encoded events
+ * @param  size     Size of the memory to store the encoded events
+ * @return size_t   Amount of bytes stored in the buffer
+ */
+size_t TraceRead(void * buffer, size_t size);
+
+/**
+ * @brief Function to get the amount of events discarded with the ring full
+ *
+ * @return uint32_t Amount of words of the discarded events
+ */
+uint32_t TraceLost(void);
+
+#ifdef USE_HAL
+/**
+ * @brief Function to send the encoded events through a serial port
+ *
+ * The events are sent with FifoDrain without waiting for the serial port. Only the events stored
+ * before the call are taken from the ring, the events recorded by the hooks of the port while it
+ * sends are left for the next call.
+ *
+ * @param  sci  Pointer to the structure with the serial port descriptor
+ */
+void TraceDrain(hal_sci_t sci);
+#endif
+
+#if defined(POSIX)
+/**
+ * @brief Function to write the encoded events in a file
+ *
+ * @param  file  Stream of the file opened in binary mode
+ */
+void TraceDrainFile(FILE * file);
+#endif
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* TRACE_H */
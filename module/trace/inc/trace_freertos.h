@@ -0,0 +1,92 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef TRACE_FREERTOS_H
+#define TRACE_FREERTOS_H
+
+/** @file
+ ** @brief Kernel hooks of the event trace recorder
+ **
+ ** This header is included at the end of the kernel configuration file when the trace module is
+ ** part of the project. It defines the trace macros of the kernel to store the events in the
+ ** recorder. The macros are expanded inside the sources of the kernel, so they use the fields of
+ ** the task and queue control blocks that are available when configUSE_TRACE_FACILITY is enabled.
+ **
+ ** @addtogroup trace Trace
+ ** @brief Event trace recorder
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#ifndef __ASSEMBLER__
+#include "trace.h"
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#if (configUSE_TRACE_FACILITY == 0)
+#error "The trace recorder requires configUSE_TRACE_FACILITY enabled"
+#endif
+
+#define traceTASK_CREATE(pxNewTCB)                                                                 \
+    TraceTaskCreate((pxNewTCB)->uxTCBNumber, (pxNewTCB)->uxPriority, (pxNewTCB)->pcTaskName)
+
+#define traceTASK_DELETE(pxTaskToDelete)                                                           \
+    TraceEvent(TRACE_TASK_DELETE, (pxTaskToDelete)->uxTCBNumber)
+
+#define traceTASK_SWITCHED_IN() TraceEvent(TRACE_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber)
+
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)                                                      \
+    TraceEvent(TRACE_TASK_READY, (pxTCB)->uxTCBNumber)
+
+#define traceTASK_PRIORITY_INHERIT(pxTCBOfMutexHolder, uxInheritedPriority)                        \
+    TraceEvent(TRACE_PRIORITY_INHERIT,                                                             \
+               ((pxTCBOfMutexHolder)->uxTCBNumber << 8) | (uxInheritedPriority))
+
+#define traceTASK_PRIORITY_DISINHERIT(pxTCBOfMutexHolder, uxOriginalPriority)                      \
+    TraceEvent(TRACE_PRIORITY_DISINHERIT,                                                          \
+               ((pxTCBOfMutexHolder)->uxTCBNumber << 8) | (uxOriginalPriority))
+
+#define traceQUEUE_CREATE(pxNewQueue)                                                              \
+    (pxNewQueue)->uxQueueNumber = TraceQueueCreate((pxNewQueue)->ucQueueType)
+
+#define traceQUEUE_SEND(pxQueue)          TraceEvent(TRACE_QUEUE_SEND, (pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) TraceEvent(TRACE_QUEUE_SEND, (pxQueue)->uxQueueNumber)
+#define traceQUEUE_RECEIVE(pxQueue)       TraceEvent(TRACE_QUEUE_RECEIVE, (pxQueue)->uxQueueNumber)
+
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)                                                       \
+    TraceEvent(TRACE_QUEUE_RECEIVE, (pxQueue)->uxQueueNumber)
+
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)                                                       \
+    TraceEvent(TRACE_QUEUE_BLOCK_SEND, (pxQueue)->uxQueueNumber)
+
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)                                                    \
+    TraceEvent(TRACE_QUEUE_BLOCK_RECEIVE, (pxQueue)->uxQueueNumber)
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
+
+#endif /* TRACE_FREERTOS_H */
@@ -0,0 +1,170 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Event trace recorder implementation
+ **
+ ** @addtogroup trace Trace
+ ** @brief Event trace recorder
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "trace.h"
+#include "fifo.h"
+#include "hal_cycles.h"
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE 256
+#endif
+
+//! Amount of words stored in the ring for every event
+#define TRACE_EVENT_WORDS 2
+
+//! Size in bytes of an encoded event
+#define TRACE_EVENT_SIZE (1 + sizeof(uint32_t) * TRACE_EVENT_WORDS)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+_Static_assert((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) == 0,
+               "Trace size must be a power of two");
+
+//! Memory used to store the values of the trace ring
+static struct mpsc_cell_s trace_cells[TRACE_BUFFER_SIZE];
+
+//! Ring with the stored events
+static struct mpsc_s trace_queue[1] = {{.cells = trace_cells, .mask = TRACE_BUFFER_SIZE - 1}};
+
+//! Flag to indicate that the recorder is storing the events
+static volatile bool trace_enabled = false;
+
+//! Last number assigned to a queue
+static volatile uint32_t trace_queues = 0;
+
+//! Event being taken from the ring
+static struct {
+    uint32_t words[TRACE_EVENT_WORDS]; /**< Timestamp and data of the event */
+    uint8_t count;                     /**< Amount of words already taken from the ring */
+} event[1];
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void TraceStart(void) {
+    CyclesStart();
+    trace_enabled = true;
+    TraceEvent(TRACE_START, CyclesFrequency() / 1000);
+}
+
+void TraceStop(void) {
+    trace_enabled = false;
+}
+
+void TraceEvent(uint8_t type, uint32_t data) {
+    if (trace_enabled) {
+        uint32_t const words[TRACE_EVENT_WORDS] = {
+            CyclesRead(),
+            ((uint32_t)type << 24) | (data & 0x00FFFFFF),
+        };
+        MpscPushBatch(trace_queue, words, TRACE_EVENT_WORDS);
+    }
+}
+
+void TraceTaskCreate(uint32_t number, uint32_t priority, char const * name) {
+    TraceEvent(TRACE_TASK_CREATE, (number << 8) | (priority & 0xFF));
+    for (int index = 0; name[index] != 0; index += 2) {
+        uint32_t chars = ((uint8_t)name[index] << 8) | (uint8_t)name[index + 1];
+        TraceEvent(TRACE_TASK_NAME, ((number & 0xFF) << 16) | chars);
+        if (name[index + 1] == 0) {
+            break;
+        }
+    }
+}
+
+uint32_t TraceQueueCreate(uint8_t type) {
+    uint32_t number = FifoAtomicAdd(&trace_queues, 1);
+
+    TraceEvent(TRACE_QUEUE_CREATE, (number << 8) | type);
+    return number;
+}
+
+size_t TraceRead(void * buffer, size_t size) {
+    uint8_t * data = buffer;
+    size_t result = 0;
+
+    while (result + TRACE_EVENT_SIZE <= size) {
+        event->count += MpscPopBatch(trace_queue, &event->words[event->count],
+                                     TRACE_EVENT_WORDS - event->count);
+        if (event->count < TRACE_EVENT_WORDS) {
+            break;
+        }
+        result += FifoEncodeWords(&data[result], TRACE_SYNC, event->words, TRACE_EVENT_WORDS);
+        event->count = 0;
+    }
+    return result;
+}
+
+uint32_t TraceLost(void) {
+    return trace_queue->dropped;
+}
+
+#ifdef USE_HAL
+void TraceDrain(hal_sci_t sci) {
+    FIFO_DRAIN_DEFINE(pending, 4 * TRACE_EVENT_SIZE);
+
+    /* Only the events stored before the call are sent, the events recorded by the sends are left
+     * in the ring for the next call */
+    FifoDrain(pending, sci, TraceRead,
+              (MpscCount(trace_queue) + event->count) / TRACE_EVENT_WORDS * TRACE_EVENT_SIZE);
+}
+#endif
+
+#if defined(POSIX)
+void TraceDrainFile(FILE * file) {
+    uint8_t buffer[32 * TRACE_EVENT_SIZE];
+    size_t count;
+
+    do {
+        count = TraceRead(buffer, sizeof(buffer));
+        fwrite(buffer, 1, count, file);
+    } while (count == sizeof(buffer));
+    fflush(file);
+}
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,91 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Unit tests of the event trace recorder on the host
+ **
+ ** @addtogroup trace Trace
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unit_test.h"
+#include "trace.h"
+#include "soc_sci.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Size in bytes of an encoded event
+#define TEST_EVENT_SIZE 9
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+TEST(trace, read_encodes_the_events) {
+    uint8_t data[4 * TEST_EVENT_SIZE];
+
+    TraceStart();
+    TraceEvent(TRACE_QUEUE_CREATE, 0x123456);
+    TraceStop();
+
+    TEST_ASSERT_EQUAL(2 * TEST_EVENT_SIZE, TraceRead(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(TRACE_SYNC, data[0]);
+    TEST_ASSERT_EQUAL(TRACE_START, data[8]);
+    TEST_ASSERT_EQUAL(TRACE_SYNC, data[TEST_EVENT_SIZE]);
+    TEST_ASSERT_EQUAL(0x56, data[TEST_EVENT_SIZE + 5]);
+    TEST_ASSERT_EQUAL(0x34, data[TEST_EVENT_SIZE + 6]);
+    TEST_ASSERT_EQUAL(0x12, data[TEST_EVENT_SIZE + 7]);
+    TEST_ASSERT_EQUAL(TRACE_QUEUE_CREATE, data[TEST_EVENT_SIZE + 8]);
+    TEST_ASSERT_EQUAL(0, TraceRead(data, sizeof(data)));
+}
+
+TEST(trace, drain_returns_while_the_port_records_events) {
+    uint8_t data[4 * TEST_EVENT_SIZE];
+
+    /* Every send through the serial port records a new event, the drain must not chase them */
+    TraceStart();
+    TraceDrain(HAL_SCI_USART3);
+    TraceDrain(HAL_SCI_USART3);
+    TraceStop();
+
+    TEST_ASSERT(TraceRead(data, sizeof(data)) > 0);
+    while (TraceRead(data, sizeof(data)) > 0) {
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
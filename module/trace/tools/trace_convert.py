@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+
+"""Converter of the event trace recorder stream to the Chrome trace format
+
+Reads the events sent by the trace module from a file, a serial device or the standard input and
+writes a JSON file that can be opened with Perfetto (https://ui.perfetto.dev) or the trace viewer
+of Chrome. Every task is shown as a thread with a slice for every time it runs, the interrupts are
+shown as threads of a second process and the kernel objects operations as instant events. A
+summary with the worst scheduling latency of every task is printed at the end.
+
+    trace_convert.py /dev/ttyUSB1 trace.json
+    trace_convert.py trace.bin trace.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRACE_SYNC = 0x7E
+
+TRACE_START = 0x01
+TRACE_TASK_CREATE = 0x02
+TRACE_TASK_NAME = 0x03
+TRACE_TASK_SWITCHED_IN = 0x04
+TRACE_TASK_READY = 0x05
+TRACE_TASK_DELETE = 0x06
+TRACE_PRIORITY_INHERIT = 0x07
+TRACE_PRIORITY_DISINHERIT = 0x08
+TRACE_QUEUE_CREATE = 0x09
+TRACE_QUEUE_SEND = 0x0A
+TRACE_QUEUE_RECEIVE = 0x0B
+TRACE_QUEUE_BLOCK_SEND = 0x0C
+TRACE_QUEUE_BLOCK_RECEIVE = 0x0D
+TRACE_ISR_ENTER = 0x10
+TRACE_ISR_EXIT = 0x11
+TRACE_SCI_SEND = 0x20
+
+KNOWN_TYPES = set(range(TRACE_START, TRACE_QUEUE_BLOCK_RECEIVE + 1))
+KNOWN_TYPES |= {TRACE_ISR_ENTER, TRACE_ISR_EXIT, TRACE_SCI_SEND}
+
+QUEUE_TYPES = [
+    "queue",
+    "mutex",
+    "counting semaphore",
+    "binary semaphore",
+    "recursive mutex",
+]
+
+PROCESS_TASKS = 1
+PROCESS_INTERRUPTS = 2
+
+
+def read_events(stream):
+    """Generator of the (timestamp, type, data) tuples found in the stream"""
+    pending = b""
+    while True:
+        chunk = stream.read(1024)
+        if not chunk:
+            return
+        pending += chunk
+        while len(pending) >= 9:
+            if pending[0] != TRACE_SYNC:
+                pending = pending[1:]
+                continue
+            timestamp, word = struct.unpack_from("<II", pending, 1)
+            kind = word >> 24
+            if kind not in KNOWN_TYPES and kind < 0x80:
+                pending = pending[1:]
+                continue
+            pending = pending[9:]
+            yield timestamp, kind, word & 0x00FFFFFF
+
+
+def source_name(source):
+    """Name of the source of an interrupt reported by the hooks of the HAL"""
+    if source == 0x00:
+        return "tick"
+    if 0x10 <= source < 0x40:
+        return "sci {}".format(source - 0x10)
+    if 0x40 <= source:
+        return "gpio {}".format(source - 0x40)
+    return "irq {}".format(source)
+
+
+class Converter:
+    """Rebuilds the timeline of the system from the recorded events"""
+
+    def __init__(self, frequency):
+        self.frequency = frequency
+        self.events = []
+        self.last = None
+        self.time = 0
+        self.tasks = {}
+        self.names = {}
+        self.queues = {}
+        self.running = None
+        self.ready = {}
+        self.latency = {}
+
+    def microseconds(self, timestamp):
+        """Converts a 32 bits timestamp to microseconds, removing the overflows of the counter"""
+        if self.last is not None:
+            delta = (timestamp - self.last) & 0xFFFFFFFF
+            if delta & 0x80000000:
+                delta -= 0x100000000
+            self.time += delta
+        self.last = timestamp
+        return self.time * 1000.0 / self.frequency
+
+    def task_name(self, number):
+        name = self.names.get(number & 0xFF)
+        return name if name else "task {}".format(number)
+
+    def instant(self, time, name, args=None):
+        thread = self.running if self.running is not None else 0
+        event = {"name": name, "ph": "i", "s": "t", "ts": time, "pid": PROCESS_TASKS}
+        event["tid"] = thread
+        if args:
+            event["args"] = args
+        self.events.append(event)
+
+    def switch(self, time, number):
+        if self.running is not None:
+            self.events.append(
+                {"ph": "E", "ts": time, "pid": PROCESS_TASKS, "tid": self.running}
+            )
+        self.running = number
+        args = {"priority": self.tasks.get(number, {}).get("priority")}
+        if number in self.ready:
+            wait = time - self.ready.pop(number)
+            args["ready_us"] = round(wait, 3)
+            self.latency[number] = max(self.latency.get(number, 0), wait)
+        name = self.task_name(number)
+        self.events.append(
+            {
+                "name": name,
+                "ph": "B",
+                "ts": time,
+                "pid": PROCESS_TASKS,
+                "tid": number,
+                "args": args,
+            }
+        )
+
+    def process(self, timestamp, kind, data):
+        if kind == TRACE_START:
+            if data:
+                self.frequency = data
+            self.last = None
+        time = self.microseconds(timestamp)
+
+        if kind == TRACE_TASK_CREATE:
+            self.tasks[data >> 8] = {"priority": data & 0xFF}
+        elif kind == TRACE_TASK_NAME:
+            number = data >> 16
+            chars = (
+                bytes([(data >> 8) & 0xFF, data & 0xFF]).rstrip(b"\0").decode("latin-1")
+            )
+            self.names[number] = self.names.get(number, "") + chars
+        elif kind == TRACE_TASK_SWITCHED_IN:
+            if self.running != data:
+                self.switch(time, data)
+        elif kind == TRACE_TASK_READY:
+            if data != self.running:
+                self.ready.setdefault(data, time)
+        elif kind == TRACE_TASK_DELETE:
+            self.instant(time, "delete {}".format(self.task_name(data)))
+        elif kind in (TRACE_PRIORITY_INHERIT, TRACE_PRIORITY_DISINHERIT):
+            action = "inherit" if kind == TRACE_PRIORITY_INHERIT else "disinherit"
+            holder = self.task_name(data >> 8)
+            self.instant(
+                time,
+                "priority {}".format(action),
+                {"holder": holder, "priority": data & 0xFF},
+            )
+        elif kind == TRACE_QUEUE_CREATE:
+            queue_type = data & 0xFF
+            name = QUEUE_TYPES[queue_type] if queue_type < len(QUEUE_TYPES) else "queue"
+            self.queues[data >> 8] = "{} {}".format(name, data >> 8)
+        elif kind in (TRACE_QUEUE_SEND, TRACE_QUEUE_RECEIVE):
+            action = "send" if kind == TRACE_QUEUE_SEND else "receive"
+            queue = self.queues.get(data, "queue {}".format(data))
+            self.instant(time, "{} {}".format(action, queue))
+        elif kind in (TRACE_QUEUE_BLOCK_SEND, TRACE_QUEUE_BLOCK_RECEIVE):
+            action = "block send" if kind == TRACE_QUEUE_BLOCK_SEND else "block receive"
+            queue = self.queues.get(data, "queue {}".format(data))
+            self.instant(time, "{} {}".format(action, queue))
+        elif kind in (TRACE_ISR_ENTER, TRACE_ISR_EXIT):
+            phase = "B" if kind == TRACE_ISR_ENTER else "E"
+            event = {"ph": phase, "ts": time, "pid": PROCESS_INTERRUPTS, "tid": data}
+            if phase == "B":
+                event["name"] = source_name(data)
+            self.events.append(event)
+        elif kind == TRACE_SCI_SEND:
+            self.events.append(
+                {
+                    "name": "send",
+                    "ph": "i",
+                    "s": "t",
+                    "ts": time,
+                    "pid": PROCESS_INTERRUPTS,
+                    "tid": data >> 16,
+                    "args": {"size": data & 0xFFFF},
+                }
+            )
+        elif kind >= 0x80:
+            self.instant(time, "user 0x{:02X}".format(kind), {"data": data})
+
+    def metadata(self):
+        """Events with the names of the processes and threads"""
+        result = [
+            {
+                "name": "process_name",
+                "ph": "M",
+                "pid": PROCESS_TASKS,
+                "args": {"name": "Tasks"},
+            },
+            {
+                "name": "process_name",
+                "ph": "M",
+                "pid": PROCESS_INTERRUPTS,
+                "args": {"name": "Interrupts"},
+            },
+        ]
+        for number, task in self.tasks.items():
+            result.append(
+                {
+                    "name": "thread_name",
+                    "ph": "M",
+                    "pid": PROCESS_TASKS,
+                    "tid": number,
+                    "args": {
+                        "name": "{} (P{})".format(
+                            self.task_name(number), task["priority"]
+                        )
+                    },
+                }
+            )
+        sources = {
+            event["tid"] for event in self.events if event["pid"] == PROCESS_INTERRUPTS
+        }
+        for source in sources:
+            result.append(
+                {
+                    "name": "thread_name",
+                    "ph": "M",
+                    "pid": PROCESS_INTERRUPTS,
+                    "tid": source,
+                    "args": {"name": source_name(source)},
+                }
+            )
+        return result
+
+    def summary(self, output):
+        """Prints the worst time between the ready state and the execution of every task"""
+        for number in sorted(self.latency):
+            output.write(
+                "{:16s} worst ready to run {:10.3f} us\n".format(
+                    self.task_name(number), self.latency[number]
+                )
+            )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="file or serial device with the events")
+    parser.add_argument("output", help="JSON file to write")
+    parser.add_argument(
+        "-f",
+        "--frequency",
+        type=int,
+        default=1000,
+        help="frequency of the time base in kHz when the stream has no start event",
+    )
+    arguments = parser.parse_args()
+
+    converter = Converter(arguments.frequency)
+    with open(arguments.input, "rb", buffering=0) as stream:
+        try:
+            for timestamp, kind, data in read_events(stream):
+                converter.process(timestamp, kind, data)
+        except KeyboardInterrupt:
+            pass
+
+    with open(arguments.output, "w") as output:
+        json.dump({"traceEvents": converter.metadata() + converter.events}, output)
+    converter.summary(sys.stderr)
+
+
+if __name__ == "__main__":
+    main()